@@ -141,6 +141,7 @@ static I2C_HandleTypeDef heval_I2c;
   * @{
   */
 static void     I2Cx_MspInit(void);
+static void     I2Cx_QueueMspInit(void);
 static void     I2Cx_Init(void);
 static void     I2Cx_ITConfig(void);
 static void     I2Cx_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
@@ -148,6 +149,8 @@ static uint8_t  I2Cx_Read(uint8_t Addr, uint8_t Reg);
 static HAL_StatusTypeDef I2Cx_ReadMultiple(uint8_t Addr, uint16_t Reg, uint16_t MemAddSize, uint8_t *Buffer, uint16_t Length);
 static HAL_StatusTypeDef I2Cx_WriteMultiple(uint8_t Addr, uint16_t Reg, uint16_t MemAddSize, uint8_t *Buffer, uint16_t Length);
 static HAL_StatusTypeDef I2Cx_IsDeviceReady(uint16_t DevAddress, uint32_t Trials);
+static uint32_t I2Cx_QueueInUse(void);
+static uint32_t I2Cx_QueueRetry(HAL_StatusTypeDef Status, uint32_t TickStart);
 static void     I2Cx_Error(uint8_t Addr);
 
 /* IOExpander IO functions */
@@ -176,6 +179,10 @@ void                EEPROM_IO_Init(void);
 HAL_StatusTypeDef   EEPROM_IO_WriteData(uint16_t DevAddress, uint16_t MemAddress, uint8_t* pBuffer, uint32_t BufferSize);
 HAL_StatusTypeDef   EEPROM_IO_ReadData(uint16_t DevAddress, uint16_t MemAddress, uint8_t* pBuffer, uint32_t BufferSize);
 HAL_StatusTypeDef   EEPROM_IO_IsDeviceReady(uint16_t DevAddress, uint32_t Trials);
+HAL_StatusTypeDef   EEPROM_IO_QueueTransaction(I2C_TransactionTypeDef *pTrans);
+void                EEPROM_IO_PollHandler(void);
+HAL_StatusTypeDef   EEPROM_IO_AbortTransaction(I2C_TransactionTypeDef *pTrans);
+uint32_t            EEPROM_IO_IsQueueEnabled(void);
 /**
   * @}
   */
@@ -451,6 +458,67 @@ JOYState_TypeDef BSP_JOY_GetState(void)
   }  
 }
 
+/**
+  * @brief  Enables the I2C transaction queue, used by the non blocking EEPROM
+  *         transfers: configures the DMA streams of the I2C and their interrupts.
+  * @note   Without this call the I2C bus is only accessed in polling mode and
+  *         the DMA streams stay free for the application.
+  * @note   BSP_I2C_EV_IRQHandler(), BSP_I2C_ER_IRQHandler(), BSP_I2C_DMA_Tx_IRQHandler()
+  *         and BSP_I2C_DMA_Rx_IRQHandler() must then be called from the I2C and
+  *         DMA stream interrupts.
+  * @param  None
+  * @retval None
+  */
+void BSP_I2C_EnableQueue(void)
+{
+  I2Cx_Init();
+  
+  if(heval_I2c.hdmatx == NULL)
+  {
+    I2Cx_QueueMspInit();
+  }
+}
+
+/**
+  * @brief  Handles I2C event interrupt request.
+  * @param  None
+  * @retval None
+  */
+void BSP_I2C_EV_IRQHandler(void)
+{
+  HAL_I2C_EV_IRQHandler(&heval_I2c);
+}
+
+/**
+  * @brief  Handles I2C error interrupt request.
+  * @param  None
+  * @retval None
+  */
+void BSP_I2C_ER_IRQHandler(void)
+{
+  HAL_I2C_ER_IRQHandler(&heval_I2c);
+}
+
+/**
+  * @brief  Handles I2C DMA Tx transfer interrupt request.
+  * @param  None
+  * @retval None
+  */
+void BSP_I2C_DMA_Tx_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(heval_I2c.hdmatx);
+}
+
+/**
+  * @brief  Handles I2C DMA Rx transfer interrupt request.
+  * @param  None
+  * @retval None
+  */
+void BSP_I2C_DMA_Rx_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(heval_I2c.hdmarx);
+}
+
 /*******************************************************************************
                             BUS OPERATIONS
 *******************************************************************************/
@@ -500,6 +568,70 @@ static void I2Cx_MspInit(void)
   HAL_NVIC_EnableIRQ(EVAL_I2Cx_ER_IRQn);
 }
 
+/**
+  * @brief  Initializes the DMA streams of the queued I2C transfers.
+  * @param  None
+  * @retval None
+  */
+static void I2Cx_QueueMspInit(void)
+{
+  static DMA_HandleTypeDef hdma_tx;
+  static DMA_HandleTypeDef hdma_rx;
+  
+  /* Enable DMA clock */
+  EVAL_DMAx_CLK_ENABLE();
+  
+  /* I2C TX DMA stream configuration */
+  hdma_tx.Instance                  = EVAL_I2Cx_DMA_STREAM_TX;
+  hdma_tx.Init.Channel              = EVAL_I2Cx_DMA_CHANNEL;
+  hdma_tx.Init.Direction            = DMA_MEMORY_TO_PERIPH;
+  hdma_tx.Init.PeriphInc            = DMA_PINC_DISABLE;
+  hdma_tx.Init.MemInc               = DMA_MINC_ENABLE;
+  hdma_tx.Init.PeriphDataAlignment  = DMA_PDATAALIGN_BYTE;
+  hdma_tx.Init.MemDataAlignment     = DMA_MDATAALIGN_BYTE;
+  hdma_tx.Init.Mode                 = DMA_NORMAL;
+  hdma_tx.Init.Priority             = DMA_PRIORITY_HIGH;
+  hdma_tx.Init.FIFOMode             = DMA_FIFOMODE_DISABLE;
+  hdma_tx.Init.FIFOThreshold        = DMA_FIFO_THRESHOLD_FULL;
+  hdma_tx.Init.MemBurst             = DMA_MBURST_SINGLE;
+  hdma_tx.Init.PeriphBurst          = DMA_PBURST_SINGLE;
+  
+  /* Associate the initialized hdma_tx handle to the I2C handle */
+  __HAL_LINKDMA(&heval_I2c, hdmatx, hdma_tx);
+  
+  /* Configure the DMA Stream */
+  HAL_DMA_Init(&hdma_tx);
+  
+  /* Set and enable the DMA TX IRQ, same priority as the I2C ones */
+  HAL_NVIC_SetPriority(EVAL_I2Cx_DMA_TX_IRQn, EVAL_I2Cx_DMA_PREPRIO, 0);
+  HAL_NVIC_EnableIRQ(EVAL_I2Cx_DMA_TX_IRQn);
+  
+  /* I2C RX DMA stream configuration */
+  hdma_rx.Instance                  = EVAL_I2Cx_DMA_STREAM_RX;
+  hdma_rx.Init.Channel              = EVAL_I2Cx_DMA_CHANNEL;
+  hdma_rx.Init.Direction            = DMA_PERIPH_TO_MEMORY;
+  hdma_rx.Init.PeriphInc            = DMA_PINC_DISABLE;
+  hdma_rx.Init.MemInc               = DMA_MINC_ENABLE;
+  hdma_rx.Init.PeriphDataAlignment  = DMA_PDATAALIGN_BYTE;
+  hdma_rx.Init.MemDataAlignment     = DMA_MDATAALIGN_BYTE;
+  hdma_rx.Init.Mode                 = DMA_NORMAL;
+  hdma_rx.Init.Priority             = DMA_PRIORITY_HIGH;
+  hdma_rx.Init.FIFOMode             = DMA_FIFOMODE_DISABLE;
+  hdma_rx.Init.FIFOThreshold        = DMA_FIFO_THRESHOLD_FULL;
+  hdma_rx.Init.MemBurst             = DMA_MBURST_SINGLE;
+  hdma_rx.Init.PeriphBurst          = DMA_PBURST_SINGLE;
+  
+  /* Associate the initialized hdma_rx handle to the I2C handle */
+  __HAL_LINKDMA(&heval_I2c, hdmarx, hdma_rx);
+  
+  /* Configure the DMA Stream */
+  HAL_DMA_Init(&hdma_rx);
+  
+  /* Set and enable the DMA RX IRQ, same priority as the I2C ones */
+  HAL_NVIC_SetPriority(EVAL_I2Cx_DMA_RX_IRQn, EVAL_I2Cx_DMA_PREPRIO, 0);
+  HAL_NVIC_EnableIRQ(EVAL_I2Cx_DMA_RX_IRQn);
+}
+
 /**
   * @brief  Initializes I2C HAL.
   * @param  None
@@ -564,8 +696,13 @@ static void I2Cx_ITConfig(void)
 static void I2Cx_Write(uint8_t Addr, uint8_t Reg, uint8_t Value)
 {
   HAL_StatusTypeDef status = HAL_OK;
+  uint32_t tickstart = HAL_GetTick();
 
-  status = HAL_I2C_Mem_Write(&heval_I2c, Addr, (uint16_t)Reg, I2C_MEMADD_SIZE_8BIT, &Value, 1, 100); 
+  do
+  {
+    status = HAL_I2C_Mem_Write(&heval_I2c, Addr, (uint16_t)Reg, I2C_MEMADD_SIZE_8BIT, &Value, 1, 100); 
+  }
+  while(I2Cx_QueueRetry(status, tickstart) != 0);
 
   /* Check the communication status */
   if(status != HAL_OK)
@@ -585,8 +722,13 @@ static uint8_t I2Cx_Read(uint8_t Addr, uint8_t Reg)
 {
   HAL_StatusTypeDef status = HAL_OK;
   uint8_t Value = 0;
+  uint32_t tickstart = HAL_GetTick();
   
-  status = HAL_I2C_Mem_Read(&heval_I2c, Addr, Reg, I2C_MEMADD_SIZE_8BIT, &Value, 1, 1000);
+  do
+  {
+    status = HAL_I2C_Mem_Read(&heval_I2c, Addr, Reg, I2C_MEMADD_SIZE_8BIT, &Value, 1, 1000);
+  }
+  while(I2Cx_QueueRetry(status, tickstart) != 0);
   
   /* Check the communication status */
   if(status != HAL_OK)
@@ -608,8 +750,13 @@ static uint8_t I2Cx_Read(uint8_t Addr, uint8_t Reg)
 static HAL_StatusTypeDef I2Cx_ReadMultiple(uint8_t Addr, uint16_t Reg, uint16_t MemAddress, uint8_t *Buffer, uint16_t Length)
 {
   HAL_StatusTypeDef status = HAL_OK;
+  uint32_t tickstart = HAL_GetTick();
   
-  status = HAL_I2C_Mem_Read(&heval_I2c, Addr, (uint16_t)Reg, MemAddress, Buffer, Length, 1000);
+  do
+  {
+    status = HAL_I2C_Mem_Read(&heval_I2c, Addr, (uint16_t)Reg, MemAddress, Buffer, Length, 1000);
+  }
+  while(I2Cx_QueueRetry(status, tickstart) != 0);
   
   /* Check the communication status */
   if(status != HAL_OK)
@@ -631,8 +778,13 @@ static HAL_StatusTypeDef I2Cx_ReadMultiple(uint8_t Addr, uint16_t Reg, uint16_t
 static HAL_StatusTypeDef I2Cx_WriteMultiple(uint8_t Addr, uint16_t Reg, uint16_t MemAddress, uint8_t *Buffer, uint16_t Length)
 {
   HAL_StatusTypeDef status = HAL_OK;
+  uint32_t tickstart = HAL_GetTick();
   
-  status = HAL_I2C_Mem_Write(&heval_I2c, Addr, (uint16_t)Reg, MemAddress, Buffer, Length, 1000);
+  do
+  {
+    status = HAL_I2C_Mem_Write(&heval_I2c, Addr, (uint16_t)Reg, MemAddress, Buffer, Length, 1000);
+  }
+  while(I2Cx_QueueRetry(status, tickstart) != 0);
   
   /* Check the communication status */
   if(status != HAL_OK)
@@ -652,16 +804,63 @@ static HAL_StatusTypeDef I2Cx_WriteMultiple(uint8_t Addr, uint16_t Reg, uint16_t
   */
 static HAL_StatusTypeDef I2Cx_IsDeviceReady(uint16_t DevAddress, uint32_t Trials)
 { 
-  return (HAL_I2C_IsDeviceReady(&heval_I2c, DevAddress, Trials, 1000));
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t tickstart = HAL_GetTick();
+  
+  do
+  {
+    status = HAL_I2C_IsDeviceReady(&heval_I2c, DevAddress, Trials, 1000);
+  }
+  while(I2Cx_QueueRetry(status, tickstart) != 0);
+  
+  return status;
+}
+
+/**
+  * @brief  Checks whether queued transfers are pending on the I2C bus.
+  * @param  None
+  * @retval 1 if queued transfers are pending, 0 otherwise
+  */
+static uint32_t I2Cx_QueueInUse(void)
+{
+  if((heval_I2c.pQueueHead != NULL) || (heval_I2c.pQueueActive != NULL) || (heval_I2c.pQueuePoll != NULL))
+  {
+    return 1;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Checks whether a blocking access has to be retried because the bus
+  *         may be owned by a queued transfer.
+  * @param  Status: HAL status of the blocking access
+  * @param  TickStart: Tick of the first attempt
+  * @retval 1 to retry the access, 0 otherwise
+  */
+static uint32_t I2Cx_QueueRetry(HAL_StatusTypeDef Status, uint32_t TickStart)
+{
+  if((Status != HAL_BUSY) || (I2Cx_QueueInUse() == 0))
+  {
+    return 0;
+  }
+  
+  return ((HAL_GetTick() - TickStart) < EVAL_I2Cx_QUEUE_TIMEOUT) ? 1 : 0;
 }
 
 /**
   * @brief  Manages error callback by re-initializing I2C.
+  * @note   The I2C is not re-initialized while queued transfers are pending:
+  *         the queue recovers from its own errors.
   * @param  Addr: I2C Address
   * @retval None
   */
 static void I2Cx_Error(uint8_t Addr)
 {
+  if(I2Cx_QueueInUse() != 0)
+  {
+    return;
+  }
+  
   /* De-initialize the I2C communication bus */
   HAL_I2C_DeInit(&heval_I2c);
   
@@ -910,6 +1109,47 @@ HAL_StatusTypeDef EEPROM_IO_IsDeviceReady(uint16_t DevAddress, uint32_t Trials)
   return (I2Cx_IsDeviceReady(DevAddress, Trials));
 }
 
+/**
+  * @brief  Queues an I2C EEPROM transfer, performed in DMA mode.
+  * @param  pTrans: Pointer to the transaction, owned by the I2C driver until
+  *         its completion callback
+  * @retval HAL status
+  */
+HAL_StatusTypeDef EEPROM_IO_QueueTransaction(I2C_TransactionTypeDef *pTrans)
+{
+  return (HAL_I2C_Queue_DMA(&heval_I2c, pTrans));
+}
+
+/**
+  * @brief  Runs one acknowledge polling step of the queued EEPROM writes.
+  * @param  None
+  * @retval None
+  */
+void EEPROM_IO_PollHandler(void)
+{
+  HAL_I2C_QueuePollHandler(&heval_I2c);
+}
+
+/**
+  * @brief  Removes a queued I2C EEPROM transfer, stopping it if it is in progress.
+  * @param  pTrans: Pointer to the transaction
+  * @retval HAL status: HAL_ERROR if the transaction is already completed
+  */
+HAL_StatusTypeDef EEPROM_IO_AbortTransaction(I2C_TransactionTypeDef *pTrans)
+{
+  return (HAL_I2C_QueueAbort(&heval_I2c, pTrans));
+}
+
+/**
+  * @brief  Checks whether the I2C transaction queue is enabled.
+  * @param  None
+  * @retval 1 if BSP_I2C_EnableQueue() was called, 0 otherwise
+  */
+uint32_t EEPROM_IO_IsQueueEnabled(void)
+{
+  return ((heval_I2c.hdmatx != NULL) ? 1 : 0);
+}
+
 /**
   * @}
   */
@@ -310,6 +310,27 @@ typedef enum
 #define EVAL_I2Cx_EV_IRQn                     I2C1_EV_IRQn
 #define EVAL_I2Cx_ER_IRQn                     I2C1_ER_IRQn
 
+/* Definition for I2Cx's DMA, used by the queued (EEPROM) transfers once
+   BSP_I2C_EnableQueue() is called */
+#define EVAL_I2Cx_DMA_CHANNEL                 DMA_CHANNEL_1
+#define EVAL_I2Cx_DMA_STREAM_TX               DMA1_Stream6
+#define EVAL_I2Cx_DMA_STREAM_RX               DMA1_Stream0
+
+/* Definition for I2Cx's DMA NVIC */
+#define EVAL_I2Cx_DMA_TX_IRQn                 DMA1_Stream6_IRQn
+#define EVAL_I2Cx_DMA_RX_IRQn                 DMA1_Stream0_IRQn
+#define EVAL_I2Cx_DMA_TX_IRQHandler           DMA1_Stream6_IRQHandler
+#define EVAL_I2Cx_DMA_RX_IRQHandler           DMA1_Stream0_IRQHandler
+#define EVAL_I2Cx_EV_IRQHandler               I2C1_EV_IRQHandler
+#define EVAL_I2Cx_ER_IRQHandler               I2C1_ER_IRQHandler
+#define EVAL_I2Cx_DMA_PREPRIO                 0x05
+
+/* Maximum time (in ms) a blocking I2C access waits for the queued transfers
+   owning the bus */
+#ifndef EVAL_I2Cx_QUEUE_TIMEOUT
+ #define EVAL_I2Cx_QUEUE_TIMEOUT              1000
+#endif /* EVAL_I2Cx_QUEUE_TIMEOUT */
+
 /**
   * @}
   */ 
@@ -338,6 +359,11 @@ uint32_t         BSP_PB_GetState(Button_TypeDef Button);
 void             BSP_COM_Init(COM_TypeDef COM, UART_HandleTypeDef *husart);
 uint8_t          BSP_JOY_Init(JOYMode_TypeDef Joy_Mode);
 JOYState_TypeDef BSP_JOY_GetState(void);
+void             BSP_I2C_EnableQueue(void);
+void             BSP_I2C_EV_IRQHandler(void);
+void             BSP_I2C_ER_IRQHandler(void);
+void             BSP_I2C_DMA_Tx_IRQHandler(void);
+void             BSP_I2C_DMA_Rx_IRQHandler(void);
 
 /**
   * @}
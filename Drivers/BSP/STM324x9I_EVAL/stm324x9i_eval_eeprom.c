@@ -28,9 +28,21 @@
   *          by just adapting the defines for hardware resources and 
   *          EEPROM_IO_Init() function. 
   *        
-  *          @note In this driver, basic read and write functions (BSP_EEPROM_ReadBuffer() 
-  *                and BSP_EEPROM_WritePage()) use DMA mode to perform the data 
-  *                transfer to/from EEPROM memory.
+  *          @note In this driver, buffer read and write functions (BSP_EEPROM_ReadBuffer() 
+  *                and BSP_EEPROM_WriteBuffer()) use polling mode to perform the data 
+  *                transfer to/from EEPROM memory, or DMA mode through the I2C transaction
+  *                queue once it is enabled with BSP_I2C_EnableQueue().
+  *
+  *          @note BSP_EEPROM_ReadBuffer_DMA() and BSP_EEPROM_WriteBuffer_DMA() require the
+  *                I2C transaction queue, enabled with BSP_I2C_EnableQueue(). They return as
+  *                soon as the transfer is queued. The write is split into page writes,
+  *                each one queued once the EEPROM acknowledges again after programming
+  *                the previous one. This acknowledge polling is performed by
+  *                BSP_EEPROM_PollHandler() that the application calls periodically
+  *                (e.g. from a timer), one address probe per call, while the bus is
+  *                free for other devices. BSP_EEPROM_TransferComplete_CallBack() is
+  *                called at the end of the transfer, BSP_EEPROM_TIMEOUT_UserCallback()
+  *                on error. A single transfer can be in progress at a time.
   *
   *         @note   Regarding BSP_EEPROM_WritePage(), it is a optimized function to perform
   *                small write (less than 1 page) BUT The number of bytes (combined to write start address) must not 
@@ -127,8 +139,13 @@
   */
 __IO uint16_t EEPROMAddress = 0;
 __IO uint32_t EEPROMTimeout = EEPROM_READ_TIMEOUT;
-__IO uint16_t EEPROMDataRead;
 __IO uint8_t  EEPROMDataWrite;
+
+static I2C_TransactionTypeDef EEPROMTransaction;
+static uint8_t       *EEPROMWritePtr;
+static uint16_t      EEPROMWriteAddr = 0;
+static uint16_t      EEPROMWriteRemaining = 0;
+static __IO uint32_t EEPROMStatus = EEPROM_OK;
 /**
   * @}
   */ 
@@ -136,6 +153,9 @@ __IO uint8_t  EEPROMDataWrite;
 /** @defgroup STM324x9I_EVAL_EEPROM_Private_Function_Prototypes
   * @{
   */ 
+static uint32_t EEPROM_QueueTransfer(uint32_t Type, uint8_t* pBuffer, uint16_t Addr, uint16_t Size);
+static uint32_t EEPROM_WaitTransfer(void);
+static void     EEPROM_TransferCplt(I2C_HandleTypeDef *hi2c, I2C_TransactionTypeDef *pTrans);
 /**
   * @}
   */ 
@@ -190,22 +210,29 @@ uint32_t BSP_EEPROM_Init(void)
   */
 uint32_t BSP_EEPROM_ReadBuffer(uint8_t* pBuffer, uint16_t ReadAddr, uint16_t* NumByteToRead)
 {  
-  uint32_t buffersize = *NumByteToRead;
+  uint32_t status = EEPROM_OK;
+  
+  if(EEPROM_IO_IsQueueEnabled() == 0)
+  {
+    if(EEPROM_IO_ReadData(EEPROMAddress, ReadAddr, pBuffer, *NumByteToRead) != HAL_OK)
+    {
+      BSP_EEPROM_TIMEOUT_UserCallback();
+      return EEPROM_FAIL;
+    }
+    return EEPROM_OK;
+  }
   
-  /* Set the pointer to the Number of data to be read. This pointer will be used 
-     by the DMA Transfer Completer interrupt Handler in order to reset the 
-     variable to 0. User should check on this variable in order to know if the 
-     DMA transfer has been complete or not. */
-  EEPROMDataRead = *NumByteToRead;
+  /* Let a previous non blocking transfer complete */
+  EEPROM_WaitTransfer();
   
-  if(EEPROM_IO_ReadData(EEPROMAddress, ReadAddr, pBuffer, buffersize) != HAL_OK)
+  status = BSP_EEPROM_ReadBuffer_DMA(pBuffer, ReadAddr, *NumByteToRead);
+  if(status == EEPROM_OK)
   {
-    BSP_EEPROM_TIMEOUT_UserCallback();
-    return EEPROM_FAIL;
+    status = EEPROM_WaitTransfer();
   }
-
+  
   /* If all operations OK, return EEPROM_OK (0) */
-  return EEPROM_OK;
+  return status;
 }
 
 /**
@@ -272,146 +299,131 @@ uint32_t BSP_EEPROM_WritePage(uint8_t* pBuffer, uint16_t WriteAddr, uint8_t* Num
   */
 uint32_t BSP_EEPROM_WriteBuffer(uint8_t *pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite)
 {
-  uint16_t numofpage = 0, numofsingle = 0, count = 0;
-  uint16_t addr = 0;
-  uint8_t  dataindex = 0;
   uint32_t status = EEPROM_OK;
-
-  addr = WriteAddr % EEPROM_PAGESIZE;
-  count = EEPROM_PAGESIZE - addr;
-  numofpage =  NumByteToWrite / EEPROM_PAGESIZE;
-  numofsingle = NumByteToWrite % EEPROM_PAGESIZE;
- 
-  /* If WriteAddr is EEPROM_PAGESIZE aligned */
-  if(addr == 0) 
+  uint8_t  dataindex = 0;
+  
+  if(EEPROM_IO_IsQueueEnabled() == 0)
   {
-    /* If NumByteToWrite < EEPROM_PAGESIZE */
-    if(numofpage == 0) 
+    /* Write page by page, up to the end of each page */
+    while(NumByteToWrite != 0)
     {
-      /* Store the number of data to be written */
-      dataindex = numofsingle;
-      /* Start writing data */
-      status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-      if(status != EEPROM_OK)
+      dataindex = EEPROM_PAGESIZE - (WriteAddr % EEPROM_PAGESIZE);
+      if(dataindex > NumByteToWrite)
       {
-        return status;
-      }
-    }
-    /* If NumByteToWrite > EEPROM_PAGESIZE */
-    else  
-    {
-      while(numofpage--)
-      {
-        /* Store the number of data to be written */
-        dataindex = EEPROM_PAGESIZE;        
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if(status != EEPROM_OK)
-        {
-          return status;
-        }
-        
-        WriteAddr +=  EEPROM_PAGESIZE;
-        pBuffer += EEPROM_PAGESIZE;
+        dataindex = NumByteToWrite;
       }
       
-      if(numofsingle!=0)
+      status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, &dataindex);
+      if(status != EEPROM_OK)
       {
-        /* Store the number of data to be written */
-        dataindex = numofsingle;          
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if(status != EEPROM_OK)
-        {
-          return status;
-        }
+        return status;
       }
+      
+      WriteAddr += dataindex;
+      pBuffer += dataindex;
+      NumByteToWrite -= dataindex;
     }
+    return EEPROM_OK;
   }
-  /* If WriteAddr is not EEPROM_PAGESIZE aligned */
-  else 
+  
+  /* Let a previous non blocking transfer complete */
+  EEPROM_WaitTransfer();
+  
+  status = BSP_EEPROM_WriteBuffer_DMA(pBuffer, WriteAddr, NumByteToWrite);
+  if(status == EEPROM_OK)
   {
-    /* If NumByteToWrite < EEPROM_PAGESIZE */
-    if(numofpage== 0) 
-    {
-      /* If the number of data to be written is more than the remaining space 
-      in the current page: */
-      if(NumByteToWrite > count)
-      {
-        /* Store the number of data to be written */
-        dataindex = count;        
-        /* Write the data contained in same page */
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if(status != EEPROM_OK)
-        {
-          return status;
-        }
-        
-        /* Store the number of data to be written */
-        dataindex = (NumByteToWrite - count);          
-        /* Write the remaining data in the following page */
-        status = BSP_EEPROM_WritePage((uint8_t*)(pBuffer + count), (WriteAddr + count), (uint8_t*)(&dataindex));
-        if(status != EEPROM_OK)
-        {
-          return status;
-        }
-      }      
-      else      
-      {
-        /* Store the number of data to be written */
-        dataindex = numofsingle;         
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if(status != EEPROM_OK)
-        {
-          return status;
-        }
-      }     
-    }
-    /* If NumByteToWrite > EEPROM_PAGESIZE */
-    else
-    {
-      NumByteToWrite -= count;
-      numofpage =  NumByteToWrite / EEPROM_PAGESIZE;
-      numofsingle = NumByteToWrite % EEPROM_PAGESIZE;
-      
-      if(count != 0)
-      {  
-        /* Store the number of data to be written */
-        dataindex = count;         
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if(status != EEPROM_OK)
-        {
-          return status;
-        }
-        WriteAddr += count;
-        pBuffer += count;
-      } 
-      
-      while(numofpage--)
-      {
-        /* Store the number of data to be written */
-        dataindex = EEPROM_PAGESIZE;          
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if(status != EEPROM_OK)
-        {
-          return status;
-        }
-        WriteAddr +=  EEPROM_PAGESIZE;
-        pBuffer += EEPROM_PAGESIZE;  
-      }
-      if(numofsingle != 0)
-      {
-        /* Store the number of data to be written */
-        dataindex = numofsingle;           
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if(status != EEPROM_OK)
-        {
-          return status;
-        }
-      }
-    }
-  }  
-                                   
+    status = EEPROM_WaitTransfer();
+  }
+  
   /* If all operations OK, return EEPROM_OK (0) */
-  return EEPROM_OK;
+  return status;
+}
+
+/**
+  * @brief  Starts reading a block of data from the EEPROM in non blocking mode.
+  * @param  pBuffer: pointer to the buffer that receives the data read from 
+  *         the EEPROM.
+  * @param  ReadAddr: EEPROM's internal address to start reading from.
+  * @param  NumByteToRead: number of bytes to read from the EEPROM.
+  * 
+  *        @note BSP_EEPROM_TransferComplete_CallBack() is called once the data are
+  *              read, BSP_EEPROM_TIMEOUT_UserCallback() on error.
+  * 
+  * @retval EEPROM_OK (0) if the transfer is started, EEPROM_BUSY if a transfer 
+  *         is already in progress, else EEPROM_FAIL.
+  */
+uint32_t BSP_EEPROM_ReadBuffer_DMA(uint8_t* pBuffer, uint16_t ReadAddr, uint16_t NumByteToRead)
+{
+  if(EEPROMStatus == EEPROM_BUSY)
+  {
+    return EEPROM_BUSY;
+  }
+  EEPROMStatus = EEPROM_BUSY;
+  
+  return EEPROM_QueueTransfer(I2C_TRANSACTION_MEM_READ, pBuffer, ReadAddr, NumByteToRead);
+}
+
+/**
+  * @brief  Starts writing a buffer of data to the EEPROM in non blocking mode.
+  * @param  pBuffer: pointer to the buffer containing the data to be written 
+  *         to the EEPROM, which must remain valid until the end of the transfer.
+  * @param  WriteAddr: EEPROM's internal address to write to.
+  * @param  NumByteToWrite: number of bytes to write to the EEPROM.
+  * 
+  *        @note The buffer is written page by page, each page write being queued
+  *              once the previous one is programmed, as reported by the acknowledge
+  *              polling of BSP_EEPROM_PollHandler(). 
+  *              BSP_EEPROM_TransferComplete_CallBack() is called once the last page
+  *              is programmed, BSP_EEPROM_TIMEOUT_UserCallback() on error.
+  * 
+  * @retval EEPROM_OK (0) if the transfer is started, EEPROM_BUSY if a transfer 
+  *         is already in progress, else EEPROM_FAIL.
+  */
+uint32_t BSP_EEPROM_WriteBuffer_DMA(uint8_t* pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite)
+{
+  uint16_t count = 0;
+  
+  if(EEPROMStatus == EEPROM_BUSY)
+  {
+    return EEPROM_BUSY;
+  }
+  EEPROMStatus = EEPROM_BUSY;
+  
+  EEPROMWritePtr = pBuffer;
+  EEPROMWriteAddr = WriteAddr;
+  EEPROMWriteRemaining = NumByteToWrite;
+  
+  /* Write up to the end of the first page */
+  count = EEPROM_PAGESIZE - (WriteAddr % EEPROM_PAGESIZE);
+  if(count > NumByteToWrite)
+  {
+    count = NumByteToWrite;
+  }
+  
+  return EEPROM_QueueTransfer(I2C_TRANSACTION_MEM_WRITE, pBuffer, WriteAddr, count);
+}
+
+/**
+  * @brief  Returns the status of the last non blocking transfer.
+  * @param  None
+  * @retval EEPROM_BUSY while the transfer is in progress, then EEPROM_OK (0),
+  *         EEPROM_FAIL or EEPROM_TIMEOUT.
+  */
+uint32_t BSP_EEPROM_GetStatus(void)
+{
+  return EEPROMStatus;
+}
+
+/**
+  * @brief  Runs one acknowledge polling step of the page writes in progress.
+  * @note   This function must be called periodically, e.g. from a timer, while
+  *         a non blocking write is in progress.
+  * @param  None
+  * @retval None
+  */
+void BSP_EEPROM_PollHandler(void)
+{
+  EEPROM_IO_PollHandler();
 }
 
 /**
@@ -449,6 +461,115 @@ __weak void BSP_EEPROM_TIMEOUT_UserCallback(void)
 {
 }
 
+/**
+  * @brief  Non blocking transfer complete callback.
+  * @param  None
+  * @retval None
+  */
+__weak void BSP_EEPROM_TransferComplete_CallBack(void)
+{
+}
+
+/**
+  * @brief  Queues a transfer of the non blocking read or write.
+  * @param  Type: I2C transaction type, I2C_TRANSACTION_MEM_READ or I2C_TRANSACTION_MEM_WRITE
+  * @param  pBuffer: pointer to the data buffer
+  * @param  Addr: EEPROM's internal address
+  * @param  Size: number of bytes to transfer
+  * @retval EEPROM_OK (0) if the transfer is queued, else EEPROM_FAIL.
+  */
+static uint32_t EEPROM_QueueTransfer(uint32_t Type, uint8_t* pBuffer, uint16_t Addr, uint16_t Size)
+{
+  EEPROMTransaction.Type             = Type;
+  EEPROMTransaction.DevAddress       = EEPROMAddress;
+  EEPROMTransaction.MemAddress       = Addr;
+  EEPROMTransaction.MemAddSize       = I2C_MEMADD_SIZE_16BIT;
+  EEPROMTransaction.pData            = pBuffer;
+  EEPROMTransaction.Size             = Size;
+  EEPROMTransaction.PollTrials       = (Type == I2C_TRANSACTION_MEM_WRITE) ? EEPROM_MAX_TRIALS : 0;
+  EEPROMTransaction.XferCpltCallback = EEPROM_TransferCplt;
+  
+  if(EEPROM_IO_QueueTransaction(&EEPROMTransaction) != HAL_OK)
+  {
+    EEPROMStatus = EEPROM_FAIL;
+    BSP_EEPROM_TIMEOUT_UserCallback();
+    return EEPROM_FAIL;
+  }
+  return EEPROM_OK;
+}
+
+/**
+  * @brief  Waits for the end of the non blocking transfer in progress.
+  * @note   The transfer is aborted when it does not progress for EEPROM_LONG_TIMEOUT.
+  * @param  None
+  * @retval Status of the transfer.
+  */
+static uint32_t EEPROM_WaitTransfer(void)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint16_t remaining = EEPROMWriteRemaining;
+  
+  while(EEPROMStatus == EEPROM_BUSY)
+  {
+    /* Drive the acknowledge polling of the page writes */
+    EEPROM_IO_PollHandler();
+    
+    /* A page is programmed */
+    if(EEPROMWriteRemaining != remaining)
+    {
+      remaining = EEPROMWriteRemaining;
+      tickstart = HAL_GetTick();
+    }
+    
+    if((HAL_GetTick() - tickstart) > EEPROM_LONG_TIMEOUT)
+    {
+      /* Take the transfer back from the I2C queue, unless it has just completed */
+      if(EEPROM_IO_AbortTransaction(&EEPROMTransaction) == HAL_OK)
+      {
+        EEPROMStatus = EEPROM_TIMEOUT;
+        BSP_EEPROM_TIMEOUT_UserCallback();
+      }
+    }
+  }
+  return EEPROMStatus;
+}
+
+/**
+  * @brief  Completion of a queued transfer: chains the next page of a write.
+  * @param  hi2c: I2C handle
+  * @param  pTrans: completed transaction
+  * @retval None
+  */
+static void EEPROM_TransferCplt(I2C_HandleTypeDef *hi2c, I2C_TransactionTypeDef *pTrans)
+{
+  uint16_t count = 0;
+  
+  if(pTrans->ErrorCode != HAL_I2C_ERROR_NONE)
+  {
+    EEPROMStatus = (pTrans->ErrorCode == HAL_I2C_ERROR_TIMEOUT) ? EEPROM_TIMEOUT : EEPROM_FAIL;
+    BSP_EEPROM_TIMEOUT_UserCallback();
+    return;
+  }
+  
+  if(pTrans->Type == I2C_TRANSACTION_MEM_WRITE)
+  {
+    /* The page is programmed */
+    EEPROMWritePtr += pTrans->Size;
+    EEPROMWriteAddr += pTrans->Size;
+    EEPROMWriteRemaining -= pTrans->Size;
+    
+    if(EEPROMWriteRemaining != 0)
+    {
+      count = (EEPROMWriteRemaining > EEPROM_PAGESIZE) ? EEPROM_PAGESIZE : EEPROMWriteRemaining;
+      EEPROM_QueueTransfer(I2C_TRANSACTION_MEM_WRITE, EEPROMWritePtr, EEPROMWriteAddr, count);
+      return;
+    }
+  }
+  
+  EEPROMStatus = EEPROM_OK;
+  BSP_EEPROM_TransferComplete_CallBack();
+}
+
 /**
   * @}
   */
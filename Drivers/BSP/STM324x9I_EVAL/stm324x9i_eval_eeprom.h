@@ -80,6 +80,9 @@ This timeout is based on systick set to 1ms*/
 #define EEPROM_READ_TIMEOUT         ((uint32_t)(1000))
 /* Timeout for write based on max write which is EEPROM_PAGESIZE bytes: EEPROM_PAGESIZE * BSP_I2C_SPEED (320us) */
 #define EEPROM_WRITE_TIMEOUT         ((uint32_t)(10))
+/* Timeout for a blocking transfer through the I2C transaction queue, restarted at each
+   programmed page: longer than the read of all the EEPROM */
+#define EEPROM_LONG_TIMEOUT          ((uint32_t)(1000))
 
 /* Maximum number of trials for EEPROM_WaitEepromStandbyState() function */
 #define EEPROM_MAX_TRIALS           3000
@@ -87,6 +90,7 @@ This timeout is based on systick set to 1ms*/
 #define EEPROM_OK                   0
 #define EEPROM_FAIL                 1
 #define EEPROM_TIMEOUT              2
+#define EEPROM_BUSY                 3
 /**
   * @}
   */ 
@@ -106,6 +110,10 @@ uint32_t BSP_EEPROM_ReadBuffer(uint8_t* pBuffer, uint16_t ReadAddr, uint16_t* Nu
 uint32_t BSP_EEPROM_WritePage(uint8_t* pBuffer, uint16_t WriteAddr, uint8_t* NumByteToWrite);
 uint32_t BSP_EEPROM_WriteBuffer(uint8_t* pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite);
 uint32_t BSP_EEPROM_WaitEepromStandbyState(void);
+uint32_t BSP_EEPROM_ReadBuffer_DMA(uint8_t* pBuffer, uint16_t ReadAddr, uint16_t NumByteToRead);
+uint32_t BSP_EEPROM_WriteBuffer_DMA(uint8_t* pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite);
+uint32_t BSP_EEPROM_GetStatus(void);
+void     BSP_EEPROM_PollHandler(void);
 
 /* USER Callbacks: This function is declared as __weak in EEPROM driver and 
    should be implemented into user application.  
@@ -113,12 +121,20 @@ uint32_t BSP_EEPROM_WaitEepromStandbyState(void);
    occurs during communication (waiting on an event that doesn't occur, bus 
    errors, busy devices ...). */
 void     BSP_EEPROM_TIMEOUT_UserCallback(void);
+/* BSP_EEPROM_TransferComplete_CallBack() function is called when a transfer
+   started with BSP_EEPROM_ReadBuffer_DMA() or BSP_EEPROM_WriteBuffer_DMA() 
+   completes successfully. */
+void     BSP_EEPROM_TransferComplete_CallBack(void);
 
 /* Link function for I2C EEPROM peripheral */
 void              EEPROM_IO_Init(void);
 HAL_StatusTypeDef EEPROM_IO_WriteData(uint16_t DevAddress, uint16_t MemAddress, uint8_t *pBuffer, uint32_t BufferSize);
 HAL_StatusTypeDef EEPROM_IO_ReadData(uint16_t DevAddress, uint16_t MemAddress, uint8_t *pBuffer, uint32_t BufferSize);
 HAL_StatusTypeDef EEPROM_IO_IsDeviceReady(uint16_t DevAddress, uint32_t Trials);
+HAL_StatusTypeDef EEPROM_IO_QueueTransaction(I2C_TransactionTypeDef *pTrans);
+void              EEPROM_IO_PollHandler(void);
+HAL_StatusTypeDef EEPROM_IO_AbortTransaction(I2C_TransactionTypeDef *pTrans);
+uint32_t          EEPROM_IO_IsQueueEnabled(void);
 
 /**
   * @}
@@ -73,6 +73,12 @@
        the DMA Tx/Rx transfer complete are handled using the functions
        BSP_SD_DMA_Tx_IRQHandler()/BSP_SD_DMA_Rx_IRQHandler(). The corresponding user callbacks 
        are implemented by the user at application level. 
+     o An RTOS based application can avoid the polling of the DMA functions with
+       BSP_SD_ReadBlocks_DMA_Start()/BSP_SD_WriteBlocks_DMA_Start(), which only start
+       the transfer. Once the user callback has signaled the transfer complete, the
+       transfer is closed with BSP_SD_ReadBlocks_DMA_End()/BSP_SD_WriteBlocks_DMA_End().
+       After a write, BSP_SD_GetStatus() returns SD_TRANSFER_BUSY until the card
+       has finished programming the blocks.
      o The SD erase block(s) is performed using the function BSP_SD_Erase() with specifying
        the number of blocks to erase.
      o The SD runtime status is returned when calling the function BSP_SD_GetStatus().
@@ -105,6 +111,11 @@
 /** @defgroup STM324x9I_EVAL_SD_Private_Defines
   * @{
   */
+/* SDIO flags cleared at the end of a transfer, as done by the HAL SD driver */
+#define SD_STATIC_FLAGS          ((uint32_t)(SDIO_FLAG_CCRCFAIL | SDIO_FLAG_DCRCFAIL | SDIO_FLAG_CTIMEOUT |\
+                                             SDIO_FLAG_DTIMEOUT | SDIO_FLAG_TXUNDERR | SDIO_FLAG_RXOVERR  |\
+                                             SDIO_FLAG_CMDREND  | SDIO_FLAG_CMDSENT  | SDIO_FLAG_DATAEND  |\
+                                             SDIO_FLAG_DBCKEND))
 /**
   * @}
   */ 
@@ -355,6 +366,115 @@ uint8_t BSP_SD_WriteBlocks_DMA(uint32_t *pData, uint64_t WriteAddr, uint32_t Blo
   return SD_state;  
 }
 
+/**
+  * @brief  Starts reading block(s) from a specified address in an SD card, in DMA
+  *         mode. The function returns without waiting for the end of the transfer.
+  * @note   The transfer must be closed with BSP_SD_ReadBlocks_DMA_End() once
+  *         HAL_SD_DMA_RxCpltCallback() or HAL_SD_XferErrorCallback() is called.
+  * @param  pData: Pointer to the buffer that will contain the data to transmit
+  * @param  ReadAddr: Address from where data is to be read  
+  * @param  BlockSize: SD card data block size, that should be 512
+  * @param  NumOfBlocks: Number of SD blocks to read 
+  * @retval SD status
+  */
+uint8_t BSP_SD_ReadBlocks_DMA_Start(uint32_t *pData, uint64_t ReadAddr, uint32_t BlockSize, uint32_t NumOfBlocks)
+{
+  if(HAL_SD_ReadBlocks_DMA(&uSdHandle, pData, ReadAddr, BlockSize, NumOfBlocks) != SD_OK)
+  {
+    /* Release the DMA stream enabled before the read command failed */
+    HAL_DMA_Abort(uSdHandle.hdmarx);
+    return MSD_ERROR;
+  }
+  else
+  {
+    return MSD_OK;
+  }
+}
+
+/**
+  * @brief  Closes a read transfer started by BSP_SD_ReadBlocks_DMA_Start().
+  * @param  None
+  * @retval SD status
+  */
+uint8_t BSP_SD_ReadBlocks_DMA_End(void)
+{
+  if(HAL_SD_CheckReadOperation(&uSdHandle, (uint32_t)SD_DATATIMEOUT) != SD_OK)
+  {
+    /* Release the DMA stream left enabled by the failed transfer */
+    HAL_DMA_Abort(uSdHandle.hdmarx);
+    return MSD_ERROR;
+  }
+  else
+  {
+    return MSD_OK;
+  }
+}
+
+/**
+  * @brief  Starts writing block(s) to a specified address in an SD card, in DMA
+  *         mode. The function returns without waiting for the end of the transfer.
+  * @note   The transfer must be closed with BSP_SD_WriteBlocks_DMA_End() once
+  *         HAL_SD_DMA_TxCpltCallback() or HAL_SD_XferErrorCallback() is called.
+  * @param  pData: Pointer to the buffer that will contain the data to transmit
+  * @param  WriteAddr: Address from where data is to be written  
+  * @param  BlockSize: SD card data block size, that should be 512
+  * @param  NumOfBlocks: Number of SD blocks to write 
+  * @retval SD status
+  */
+uint8_t BSP_SD_WriteBlocks_DMA_Start(uint32_t *pData, uint64_t WriteAddr, uint32_t BlockSize, uint32_t NumOfBlocks)
+{
+  if(HAL_SD_WriteBlocks_DMA(&uSdHandle, pData, WriteAddr, BlockSize, NumOfBlocks) != SD_OK)
+  {
+    /* Release the DMA stream enabled before the write command failed */
+    HAL_DMA_Abort(uSdHandle.hdmatx);
+    return MSD_ERROR;
+  }
+  else
+  {
+    return MSD_OK;
+  }
+}
+
+/**
+  * @brief  Closes a write transfer started by BSP_SD_WriteBlocks_DMA_Start().
+  * @note   Unlike HAL_SD_CheckWriteOperation(), the function does not wait for
+  *         the card to leave the programming state: poll BSP_SD_GetStatus()
+  *         until it returns SD_TRANSFER_OK before the next transfer.
+  * @param  None
+  * @retval SD status
+  */
+uint8_t BSP_SD_WriteBlocks_DMA_End(void)
+{
+  HAL_SD_ErrorTypedef errorstate = SD_OK;
+  uint32_t timeout = SD_DATATIMEOUT;
+  
+  /* Wait until the Tx transfer is no longer active */
+  while((__HAL_SD_SDIO_GET_FLAG(&uSdHandle, SDIO_FLAG_TXACT)) && (timeout > 0))
+  {
+    timeout--;
+  }
+  
+  /* Send stop command in multiblock write */
+  if(uSdHandle.SdOperation == SD_WRITE_MULTIPLE_BLOCK)
+  {
+    errorstate = HAL_SD_StopTransfer(&uSdHandle);
+  }
+  
+  /* Clear all the static flags */
+  __HAL_SD_SDIO_CLEAR_FLAG(&uSdHandle, SD_STATIC_FLAGS);
+  
+  if((timeout == 0) || (errorstate != SD_OK) || (uSdHandle.SdTransferErr != SD_OK))
+  {
+    /* Release the DMA stream left enabled by the failed transfer */
+    HAL_DMA_Abort(uSdHandle.hdmatx);
+    return MSD_ERROR;
+  }
+  else
+  {
+    return MSD_OK;
+  }
+}
+
 /**
   * @brief  Erases the specified memory area of the given SD card. 
   * @param  StartAddr: Start byte address
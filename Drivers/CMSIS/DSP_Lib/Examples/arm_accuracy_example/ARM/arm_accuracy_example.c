@@ -0,0 +1,791 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2012 ARM Limited. All rights reserved.
+*
+* $Date:         17. January 2013
+* $Revision:     V1.4.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_accuracy_example.c
+*
+* Description:   Measures the SNR, maximum error and cycles of the Q15, Q31,
+*                fast and floating-point variants of the FIR, convolution,
+*                biquad and matrix multiplication functions against a
+*                double-precision reference.
+*
+* Target Processor: Cortex-M4/Cortex-M3
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup AccuracyExample Precision versus Speed Example
+ *
+ * \par Description:
+ * \par
+ * The library offers several variants of the same operation that trade
+ * precision for speed: the fast Q15 and Q31 FIR filters, convolutions,
+ * biquad cascades and matrix multiplications use smaller accumulators than
+ * the standard ones.  This example runs every variant on the same inputs and
+ * compares its output with a double-precision reference, so that the fastest
+ * variant meeting an accuracy target can be chosen.
+ * \par
+ * The inputs are a multi-tone, a white noise and a linear chirp, each at
+ * three levels: -6, -26 and -46 dB below full scale.  The signals and
+ * coefficients are rounded to the Q15 grid first, so that every variant sees
+ * exactly the same values and the errors measured come from the arithmetic of
+ * the variant and the rounding of its output only.  The matrix product
+ * multiplies the input, arranged as a 16 x 16 matrix, by the input reversed
+ * and divided by 16, so that no variant overflows.
+ * \par
+ * For each variant, signal and level the example records:
+ * - the SNR of the output against the reference, in dB;
+ * - the largest absolute error, relative to full scale;
+ * - the cycles of one call, from the DWT cycle counter.
+ * \par
+ * select_fastest() then returns, for each operation, the fastest variant
+ * whose SNR meets a target on every signal at a given level.
+ *
+ * \par Running on a host
+ * \par
+ * The example also builds natively with <code>ARM_MATH_CM0</code> and
+ * <code>ACCURACY_HOST</code> defined, for instance with
+ * <pre>
+ *   gcc -DARM_MATH_CM0 -DACCURACY_HOST -I<CMSIS>/Include arm_accuracy_example.c <DSP_Lib sources> -lm
+ * </pre>
+ * It then prints the results as a table, with the cycles replaced by host
+ * clock ticks, and returns.  A recorded signal can be added to the synthetic
+ * ones by giving the path of a raw file of 32-bit floating-point samples as
+ * first argument; its first <code>BLOCK_LEN</code> samples are normalized to
+ * full scale.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c results holds one entry per variant, signal and level
+ * \li \c fastest holds the fastest variant of each operation meeting \c SNR_TARGET
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_fir_init_q15(), arm_fir_q15(), arm_fir_fast_q15()
+ * - arm_fir_init_q31(), arm_fir_q31(), arm_fir_fast_q31()
+ * - arm_fir_init_f32(), arm_fir_f32()
+ * - arm_conv_q15(), arm_conv_fast_q15(), arm_conv_opt_q15(), arm_conv_fast_opt_q15()
+ * - arm_conv_q31(), arm_conv_fast_q31(), arm_conv_f32()
+ * - arm_biquad_cascade_df1_init_q15(), arm_biquad_cascade_df1_q15(), arm_biquad_cascade_df1_fast_q15()
+ * - arm_biquad_cascade_df1_init_q31(), arm_biquad_cascade_df1_q31(), arm_biquad_cascade_df1_fast_q31()
+ * - arm_biquad_cascade_df1_init_f32(), arm_biquad_cascade_df1_f32()
+ * - arm_biquad_cascade_df2T_init_f32(), arm_biquad_cascade_df2T_f32()
+ * - arm_mat_init_q15(), arm_mat_mult_q15(), arm_mat_mult_fast_q15()
+ * - arm_mat_init_q31(), arm_mat_mult_q31(), arm_mat_mult_fast_q31()
+ * - arm_mat_init_f32(), arm_mat_mult_f32()
+ *
+ * <b> Refer  </b>
+ * \link arm_accuracy_example.c \endlink
+ *
+ */
+
+
+/** \example arm_accuracy_example.c
+  */
+
+/* The DWT cycle counter is declared by the device header only: arm_math.h
+   includes the generic part of the core header. Name the device header with
+   CMSIS_device_header, for instance -DCMSIS_device_header="ARMCM4_FP.h" */
+#if defined (CMSIS_device_header)
+#include CMSIS_device_header
+#endif
+
+#include "arm_math.h"
+
+#if defined (ACCURACY_HOST)
+#include <stdio.h>
+#include <time.h>
+#endif
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define BLOCK_LEN       256
+#define NUM_TAPS        32
+#define NUM_STAGES      2
+#define MAT_DIM         16          /* MAT_DIM * MAT_DIM = BLOCK_LEN */
+#define CONV_LEN        (BLOCK_LEN + NUM_TAPS - 1)
+#define NUM_LEVELS      3
+#define MAX_SIGNALS     4           /* three synthetic, one recorded */
+#define SNR_TARGET      60.0f       /* accuracy target of select_fastest() */
+#define SNR_TARGET_LEVEL 1          /* level at which the target is checked */
+#define SNR_F32_MIN     100.0f      /* sanity check of the floating-point variants */
+
+/* Operations */
+enum
+{
+  OP_FIR = 0,
+  OP_CONV,
+  OP_BIQUAD,
+  OP_MAT,
+  NUM_OPS
+};
+
+/* Variants, grouped by operation */
+enum
+{
+  FIR_Q15 = 0,
+  FIR_FAST_Q15,
+  FIR_Q31,
+  FIR_FAST_Q31,
+  FIR_F32,
+  CONV_Q15,
+  CONV_FAST_Q15,
+  CONV_OPT_Q15,
+  CONV_FAST_OPT_Q15,
+  CONV_Q31,
+  CONV_FAST_Q31,
+  CONV_F32,
+  BIQUAD_Q15,
+  BIQUAD_FAST_Q15,
+  BIQUAD_Q31,
+  BIQUAD_FAST_Q31,
+  BIQUAD_F32,
+  BIQUAD_DF2T_F32,
+  MAT_Q15,
+  MAT_FAST_Q15,
+  MAT_Q31,
+  MAT_FAST_Q31,
+  MAT_F32,
+  NUM_VARIANTS
+};
+
+typedef struct
+{
+  const char *name;       /* function name */
+  uint8_t op;             /* operation */
+  uint8_t isFloat;        /* floating-point variant */
+} variant_t;
+
+const variant_t variants[NUM_VARIANTS] =
+{
+  { "arm_fir_q15",                      OP_FIR,    0 },
+  { "arm_fir_fast_q15",                 OP_FIR,    0 },
+  { "arm_fir_q31",                      OP_FIR,    0 },
+  { "arm_fir_fast_q31",                 OP_FIR,    0 },
+  { "arm_fir_f32",                      OP_FIR,    1 },
+  { "arm_conv_q15",                     OP_CONV,   0 },
+  { "arm_conv_fast_q15",                OP_CONV,   0 },
+  { "arm_conv_opt_q15",                 OP_CONV,   0 },
+  { "arm_conv_fast_opt_q15",            OP_CONV,   0 },
+  { "arm_conv_q31",                     OP_CONV,   0 },
+  { "arm_conv_fast_q31",                OP_CONV,   0 },
+  { "arm_conv_f32",                     OP_CONV,   1 },
+  { "arm_biquad_cascade_df1_q15",       OP_BIQUAD, 0 },
+  { "arm_biquad_cascade_df1_fast_q15",  OP_BIQUAD, 0 },
+  { "arm_biquad_cascade_df1_q31",       OP_BIQUAD, 0 },
+  { "arm_biquad_cascade_df1_fast_q31",  OP_BIQUAD, 0 },
+  { "arm_biquad_cascade_df1_f32",       OP_BIQUAD, 1 },
+  { "arm_biquad_cascade_df2T_f32",      OP_BIQUAD, 1 },
+  { "arm_mat_mult_q15",                 OP_MAT,    0 },
+  { "arm_mat_mult_fast_q15",            OP_MAT,    0 },
+  { "arm_mat_mult_q31",                 OP_MAT,    0 },
+  { "arm_mat_mult_fast_q31",            OP_MAT,    0 },
+  { "arm_mat_mult_f32",                 OP_MAT,    1 }
+};
+
+const char *signalNames[MAX_SIGNALS] = { "multitone", "noise", "chirp", "recorded" };
+
+/* Peak amplitude of each level: -6, -26 and -46 dBFS */
+const float64_t levels[NUM_LEVELS] = { 0.5, 0.05, 0.005 };
+
+typedef struct
+{
+  float32_t snr;          /* SNR against the reference, in dB */
+  float32_t maxErr;       /* largest absolute error, relative to full scale */
+  uint32_t cycles;        /* cycles of one call */
+} result_t;
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+float64_t signalRaw[MAX_SIGNALS][BLOCK_LEN];   /* synthetic and recorded signals, peak 1 */
+float64_t x[BLOCK_LEN];                        /* current input, on the Q15 grid */
+float64_t xb[BLOCK_LEN];                       /* matrix B of the product, on the Q15 grid */
+float64_t h[NUM_TAPS];                         /* FIR coefficients, on the Q15 grid */
+float64_t bq[5 * NUM_STAGES];                  /* biquad coefficients, on the Q15 grid */
+float64_t ref[CONV_LEN];                       /* reference output */
+float64_t out[CONV_LEN];                       /* output of the variant under test */
+
+q15_t     srcQ15[BLOCK_LEN], coefQ15[NUM_TAPS], dstQ15[CONV_LEN];
+q31_t     srcQ31[BLOCK_LEN], coefQ31[NUM_TAPS], dstQ31[CONV_LEN];
+float32_t srcF32[BLOCK_LEN], coefF32[NUM_TAPS], dstF32[CONV_LEN];
+q15_t     stateQ15[NUM_TAPS + BLOCK_LEN];
+q31_t     stateQ31[NUM_TAPS + BLOCK_LEN];
+float32_t stateF32[NUM_TAPS + BLOCK_LEN];
+q15_t     scratch1Q15[BLOCK_LEN + 2 * NUM_TAPS];
+q15_t     scratch2Q15[BLOCK_LEN];
+q15_t     bqQ15[6 * NUM_STAGES];
+q31_t     bqQ31[5 * NUM_STAGES];
+float32_t bqF32[5 * NUM_STAGES];
+
+/* ----------------------------------------------------------------------
+* Results
+* ------------------------------------------------------------------- */
+result_t results[NUM_VARIANTS][MAX_SIGNALS][NUM_LEVELS];
+int32_t  fastest[NUM_OPS];
+uint32_t numSignals;
+
+arm_status status;   /* Status of the example */
+
+/* ----------------------------------------------------------------------
+* Cycle counter
+* ------------------------------------------------------------------- */
+#if defined (ACCURACY_HOST)
+
+static uint32_t cycle_count(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint32_t) (t.tv_sec * 1000000000u + t.tv_nsec);
+}
+
+static void cycle_counter_init(void)
+{
+}
+
+#elif defined (DWT_BASE)
+
+#define cycle_count()   (DWT->CYCCNT)
+
+static void cycle_counter_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+#else
+
+/* No device header: no cycle is counted */
+static void cycle_counter_init(void)
+{
+}
+
+static uint32_t cycle_count(void)
+{
+  return 0;
+}
+
+#endif
+
+/* ----------------------------------------------------------------------
+* Rounds to the Q15 grid, with saturation
+* ------------------------------------------------------------------- */
+static float64_t q15_grid(float64_t v)
+{
+  v = floor(v * 32768.0 + 0.5);
+  v = (v > 32767.0) ? 32767.0 : ((v < -32768.0) ? -32768.0 : v);
+  return v / 32768.0;
+}
+
+/* ----------------------------------------------------------------------
+* Synthetic signals, normalized to a peak of 1
+* ------------------------------------------------------------------- */
+static void make_signals(void)
+{
+  const float64_t tone[5] = { 0.013, 0.047, 0.089, 0.151, 0.233 };
+  uint32_t seed = 1u;
+  uint32_t n, k;
+
+  for (n = 0; n < BLOCK_LEN; n++)
+  {
+    /* Multi-tone */
+    signalRaw[0][n] = 0.0;
+    for (k = 0; k < 5; k++)
+    {
+      signalRaw[0][n] += 0.2 * sin(2.0 * PI * tone[k] * n + k);
+    }
+
+    /* Uniform white noise */
+    seed = seed * 1664525u + 1013904223u;
+    signalRaw[1][n] = (float64_t) (int32_t) seed / 2147483648.0;
+
+    /* Linear chirp from 0 to half the sampling rate */
+    signalRaw[2][n] = sin(PI * 0.5 * n * n / BLOCK_LEN);
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Filter coefficients, on the Q15 grid
+* ------------------------------------------------------------------- */
+static void make_coefficients(void)
+{
+  float64_t w, alpha, a0, c;
+  uint32_t n, s;
+
+  /* Windowed-sinc low-pass FIR with a cutoff of 0.2 fs */
+  for (n = 0; n < NUM_TAPS; n++)
+  {
+    c = n - (NUM_TAPS - 1) / 2.0;
+    w = 0.54 - 0.46 * cos(2.0 * PI * n / (NUM_TAPS - 1));
+    h[n] = q15_grid(0.4 * w * ((c == 0.0) ? 1.0 : sin(0.4 * PI * c) / (0.4 * PI * c)));
+  }
+
+  /* Two low-pass biquads with a cutoff of 0.1 fs.  The coefficients reach 2
+   * so they are rounded to the Q15 grid after a division by 2, which is
+   * undone with a postShift of 1 in the fixed-point variants.  The feedback
+   * coefficients are negated as the biquad functions expect. */
+  w = 2.0 * PI * 0.1;
+  for (s = 0; s < NUM_STAGES; s++)
+  {
+    alpha = sin(w) / (2.0 * ((s == 0) ? 0.5412 : 1.3066));
+    a0 = 1.0 + alpha;
+    bq[5 * s + 0] = 2.0 * q15_grid(0.5 * (1.0 - cos(w)) / 2.0 / a0);
+    bq[5 * s + 1] = 2.0 * q15_grid(0.5 * (1.0 - cos(w)) / a0);
+    bq[5 * s + 2] = bq[5 * s + 0];
+    bq[5 * s + 3] = 2.0 * q15_grid(0.5 * 2.0 * cos(w) / a0);
+    bq[5 * s + 4] = 2.0 * q15_grid(0.5 * -(1.0 - alpha) / a0);
+  }
+
+  /* Fixed-point and floating-point copies */
+  for (n = 0; n < NUM_TAPS; n++)
+  {
+    coefQ15[n] = (q15_t) (h[n] * 32768.0);
+    coefQ31[n] = (q31_t) (h[n] * 2147483648.0);
+    coefF32[n] = (float32_t) h[n];
+  }
+
+  /* The FIR functions take the coefficients in time reversed order, which is
+   * the same here since the filter is symmetric. */
+
+  for (s = 0; s < NUM_STAGES; s++)
+  {
+    bqQ15[6 * s + 0] = (q15_t) (bq[5 * s + 0] * 16384.0);
+    bqQ15[6 * s + 1] = 0;
+    bqQ15[6 * s + 2] = (q15_t) (bq[5 * s + 1] * 16384.0);
+    bqQ15[6 * s + 3] = (q15_t) (bq[5 * s + 2] * 16384.0);
+    bqQ15[6 * s + 4] = (q15_t) (bq[5 * s + 3] * 16384.0);
+    bqQ15[6 * s + 5] = (q15_t) (bq[5 * s + 4] * 16384.0);
+
+    for (n = 0; n < 5; n++)
+    {
+      bqQ31[5 * s + n] = (q31_t) (bq[5 * s + n] * 1073741824.0);
+      bqF32[5 * s + n] = (float32_t) bq[5 * s + n];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Double-precision references
+* ------------------------------------------------------------------- */
+static uint32_t reference(uint32_t op)
+{
+  float64_t acc, y, s1[NUM_STAGES][4];
+  uint32_t n, k, s, r, c;
+
+  switch (op)
+  {
+  case OP_FIR:
+    for (n = 0; n < BLOCK_LEN; n++)
+    {
+      acc = 0.0;
+      for (k = 0; (k < NUM_TAPS) && (k <= n); k++)
+      {
+        acc += h[k] * x[n - k];
+      }
+      ref[n] = acc;
+    }
+    return (BLOCK_LEN);
+
+  case OP_CONV:
+    for (n = 0; n < CONV_LEN; n++)
+    {
+      acc = 0.0;
+      for (k = 0; k < NUM_TAPS; k++)
+      {
+        if((n >= k) && (n - k < BLOCK_LEN))
+        {
+          acc += h[k] * x[n - k];
+        }
+      }
+      ref[n] = acc;
+    }
+    return (CONV_LEN);
+
+  case OP_BIQUAD:
+    memset(s1, 0, sizeof(s1));
+    for (n = 0; n < BLOCK_LEN; n++)
+    {
+      y = x[n];
+      for (s = 0; s < NUM_STAGES; s++)
+      {
+        acc = bq[5 * s] * y + bq[5 * s + 1] * s1[s][0] + bq[5 * s + 2] * s1[s][1] +
+          bq[5 * s + 3] * s1[s][2] + bq[5 * s + 4] * s1[s][3];
+        s1[s][1] = s1[s][0];
+        s1[s][0] = y;
+        s1[s][3] = s1[s][2];
+        s1[s][2] = acc;
+        y = acc;
+      }
+      ref[n] = y;
+    }
+    return (BLOCK_LEN);
+
+  default:
+    /* A is the input as a MAT_DIM x MAT_DIM matrix, B the input reversed */
+    /* and divided by MAT_DIM so that the product cannot overflow */
+    for (r = 0; r < MAT_DIM; r++)
+    {
+      for (c = 0; c < MAT_DIM; c++)
+      {
+        acc = 0.0;
+        for (k = 0; k < MAT_DIM; k++)
+        {
+          acc += x[r * MAT_DIM + k] * xb[k * MAT_DIM + c];
+        }
+        ref[r * MAT_DIM + c] = acc;
+      }
+    }
+    return (BLOCK_LEN);
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Runs one variant on x and leaves its output in out.  Returns the cycles
+* of the call.
+* ------------------------------------------------------------------- */
+static uint32_t run_variant(uint32_t v, uint32_t len)
+{
+  arm_fir_instance_q15 firQ15;
+  arm_fir_instance_q31 firQ31;
+  arm_fir_instance_f32 firF32;
+  arm_biquad_casd_df1_inst_q15 biqQ15;
+  arm_biquad_casd_df1_inst_q31 biqQ31;
+  arm_biquad_casd_df1_inst_f32 biqF32;
+  arm_biquad_cascade_df2T_instance_f32 biqDf2T;
+  arm_matrix_instance_q15 aQ15, bQ15, cQ15;
+  arm_matrix_instance_q31 aQ31, bQ31, cQ31;
+  arm_matrix_instance_f32 aF32, bF32, cF32;
+  uint32_t n, start, cycles;
+
+  /* Inputs of each type */
+  for (n = 0; n < BLOCK_LEN; n++)
+  {
+    srcQ15[n] = (q15_t) (x[n] * 32768.0);
+    srcQ31[n] = (q31_t) (x[n] * 2147483648.0);
+    srcF32[n] = (float32_t) x[n];
+  }
+
+  arm_mat_init_q15(&aQ15, MAT_DIM, MAT_DIM, srcQ15);
+  arm_mat_init_q15(&bQ15, MAT_DIM, MAT_DIM, stateQ15);
+  arm_mat_init_q15(&cQ15, MAT_DIM, MAT_DIM, dstQ15);
+  arm_mat_init_q31(&aQ31, MAT_DIM, MAT_DIM, srcQ31);
+  arm_mat_init_q31(&bQ31, MAT_DIM, MAT_DIM, stateQ31);
+  arm_mat_init_q31(&cQ31, MAT_DIM, MAT_DIM, dstQ31);
+  arm_mat_init_f32(&aF32, MAT_DIM, MAT_DIM, srcF32);
+  arm_mat_init_f32(&bF32, MAT_DIM, MAT_DIM, stateF32);
+  arm_mat_init_f32(&cF32, MAT_DIM, MAT_DIM, dstF32);
+
+  /* Initialization is done outside of the timed section */
+  arm_fir_init_q15(&firQ15, NUM_TAPS, coefQ15, stateQ15, BLOCK_LEN);
+  arm_fir_init_q31(&firQ31, NUM_TAPS, coefQ31, stateQ31, BLOCK_LEN);
+  arm_fir_init_f32(&firF32, NUM_TAPS, coefF32, stateF32, BLOCK_LEN);
+  arm_biquad_cascade_df1_init_q15(&biqQ15, NUM_STAGES, bqQ15, stateQ15, 1);
+  arm_biquad_cascade_df1_init_q31(&biqQ31, NUM_STAGES, bqQ31, stateQ31, 1);
+  arm_biquad_cascade_df1_init_f32(&biqF32, NUM_STAGES, bqF32, stateF32);
+  arm_biquad_cascade_df2T_init_f32(&biqDf2T, NUM_STAGES, bqF32, stateF32);
+
+  if(variants[v].op == OP_MAT)
+  {
+    /* B of the matrix product goes in the state buffers, after the FIR and
+     * biquad initializations have cleared them */
+    for (n = 0; n < BLOCK_LEN; n++)
+    {
+      stateQ15[n] = (q15_t) (xb[n] * 32768.0);
+      stateQ31[n] = (q31_t) (xb[n] * 2147483648.0);
+      stateF32[n] = (float32_t) xb[n];
+    }
+  }
+
+  start = cycle_count();
+
+  switch (v)
+  {
+  case FIR_Q15:           arm_fir_q15(&firQ15, srcQ15, dstQ15, BLOCK_LEN); break;
+  case FIR_FAST_Q15:      arm_fir_fast_q15(&firQ15, srcQ15, dstQ15, BLOCK_LEN); break;
+  case FIR_Q31:           arm_fir_q31(&firQ31, srcQ31, dstQ31, BLOCK_LEN); break;
+  case FIR_FAST_Q31:      arm_fir_fast_q31(&firQ31, srcQ31, dstQ31, BLOCK_LEN); break;
+  case FIR_F32:           arm_fir_f32(&firF32, srcF32, dstF32, BLOCK_LEN); break;
+  case CONV_Q15:          arm_conv_q15(srcQ15, BLOCK_LEN, coefQ15, NUM_TAPS, dstQ15); break;
+  case CONV_FAST_Q15:     arm_conv_fast_q15(srcQ15, BLOCK_LEN, coefQ15, NUM_TAPS, dstQ15); break;
+  case CONV_OPT_Q15:      arm_conv_opt_q15(srcQ15, BLOCK_LEN, coefQ15, NUM_TAPS, dstQ15, scratch1Q15, scratch2Q15); break;
+  case CONV_FAST_OPT_Q15: arm_conv_fast_opt_q15(srcQ15, BLOCK_LEN, coefQ15, NUM_TAPS, dstQ15, scratch1Q15, scratch2Q15); break;
+  case CONV_Q31:          arm_conv_q31(srcQ31, BLOCK_LEN, coefQ31, NUM_TAPS, dstQ31); break;
+  case CONV_FAST_Q31:     arm_conv_fast_q31(srcQ31, BLOCK_LEN, coefQ31, NUM_TAPS, dstQ31); break;
+  case CONV_F32:          arm_conv_f32(srcF32, BLOCK_LEN, coefF32, NUM_TAPS, dstF32); break;
+  case BIQUAD_Q15:        arm_biquad_cascade_df1_q15(&biqQ15, srcQ15, dstQ15, BLOCK_LEN); break;
+  case BIQUAD_FAST_Q15:   arm_biquad_cascade_df1_fast_q15(&biqQ15, srcQ15, dstQ15, BLOCK_LEN); break;
+  case BIQUAD_Q31:        arm_biquad_cascade_df1_q31(&biqQ31, srcQ31, dstQ31, BLOCK_LEN); break;
+  case BIQUAD_FAST_Q31:   arm_biquad_cascade_df1_fast_q31(&biqQ31, srcQ31, dstQ31, BLOCK_LEN); break;
+  case BIQUAD_F32:        arm_biquad_cascade_df1_f32(&biqF32, srcF32, dstF32, BLOCK_LEN); break;
+  case BIQUAD_DF2T_F32:   arm_biquad_cascade_df2T_f32(&biqDf2T, srcF32, dstF32, BLOCK_LEN); break;
+  case MAT_Q15:           arm_mat_mult_q15(&aQ15, &bQ15, &cQ15, scratch1Q15); break;
+  case MAT_FAST_Q15:      arm_mat_mult_fast_q15(&aQ15, &bQ15, &cQ15, scratch1Q15); break;
+  case MAT_Q31:           arm_mat_mult_q31(&aQ31, &bQ31, &cQ31); break;
+  case MAT_FAST_Q31:      arm_mat_mult_fast_q31(&aQ31, &bQ31, &cQ31); break;
+  default:                arm_mat_mult_f32(&aF32, &bF32, &cF32); break;
+  }
+
+  cycles = cycle_count() - start;
+
+  /* Output of the variant, in double precision */
+  for (n = 0; n < len; n++)
+  {
+    switch (v)
+    {
+    case FIR_Q15: case FIR_FAST_Q15: case CONV_Q15: case CONV_FAST_Q15:
+    case CONV_OPT_Q15: case CONV_FAST_OPT_Q15: case BIQUAD_Q15:
+    case BIQUAD_FAST_Q15: case MAT_Q15: case MAT_FAST_Q15:
+      out[n] = dstQ15[n] / 32768.0;
+      break;
+    case FIR_Q31: case FIR_FAST_Q31: case CONV_Q31: case CONV_FAST_Q31:
+    case BIQUAD_Q31: case BIQUAD_FAST_Q31: case MAT_Q31: case MAT_FAST_Q31:
+      out[n] = dstQ31[n] / 2147483648.0;
+      break;
+    default:
+      out[n] = dstF32[n];
+      break;
+    }
+  }
+
+  return (cycles);
+}
+
+/* ----------------------------------------------------------------------
+* SNR and maximum error of out against ref
+* ------------------------------------------------------------------- */
+static void measure(uint32_t len, result_t * pRes)
+{
+  float64_t sig = 0.0, noise = 0.0, err, maxErr = 0.0;
+  uint32_t n;
+
+  for (n = 0; n < len; n++)
+  {
+    err = out[n] - ref[n];
+    sig += ref[n] * ref[n];
+    noise += err * err;
+    err = fabs(err);
+    maxErr = (err > maxErr) ? err : maxErr;
+  }
+
+  pRes->snr = (noise > 0.0) ? (float32_t) (10.0 * log10(sig / noise)) : 200.0f;
+  pRes->maxErr = (float32_t) maxErr;
+}
+
+/* ----------------------------------------------------------------------
+* Fastest variant of an operation whose SNR meets the target on every
+* signal at the given level, or -1 if none does
+* ------------------------------------------------------------------- */
+static int32_t select_fastest(uint32_t op, float32_t snrTarget, uint32_t level)
+{
+  int32_t best = -1;
+  uint32_t bestCycles = 0xFFFFFFFFu;
+  uint32_t v, s, worst;
+  uint8_t ok;
+
+  for (v = 0; v < NUM_VARIANTS; v++)
+  {
+    if(variants[v].op != op)
+    {
+      continue;
+    }
+
+    ok = 1u;
+    worst = 0u;
+    for (s = 0; s < numSignals; s++)
+    {
+      ok &= (results[v][s][level].snr >= snrTarget) ? 1u : 0u;
+      worst = (results[v][s][level].cycles > worst) ? results[v][s][level].cycles : worst;
+    }
+
+    if(ok && (worst < bestCycles))
+    {
+      best = (int32_t) v;
+      bestCycles = worst;
+    }
+  }
+
+  return (best);
+}
+
+/* ----------------------------------------------------------------------
+* Reads a recorded signal, on the host only
+* ------------------------------------------------------------------- */
+#if defined (ACCURACY_HOST)
+
+static uint32_t read_recorded(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  float32_t v[BLOCK_LEN];
+  float64_t peak = 0.0;
+  uint32_t n;
+
+  if((f == NULL) || (fread(v, sizeof(float32_t), BLOCK_LEN, f) != BLOCK_LEN))
+  {
+    printf("cannot read %d samples from %s\n", BLOCK_LEN, path);
+    if(f != NULL)
+    {
+      fclose(f);
+    }
+    return (0u);
+  }
+  fclose(f);
+
+  for (n = 0; n < BLOCK_LEN; n++)
+  {
+    peak = (fabs(v[n]) > peak) ? fabs(v[n]) : peak;
+  }
+
+  for (n = 0; n < BLOCK_LEN; n++)
+  {
+    signalRaw[3][n] = (peak > 0.0) ? v[n] / peak : 0.0;
+  }
+
+  return (1u);
+}
+
+#endif
+
+/* ----------------------------------------------------------------------
+* Accuracy example
+* ------------------------------------------------------------------- */
+#if defined (ACCURACY_HOST)
+int32_t main(int argc, char **argv)
+#else
+int32_t main(void)
+#endif
+{
+  uint32_t v, s, l, n, len, op;
+  result_t *pRes;
+
+  status = ARM_MATH_SUCCESS;
+
+  cycle_counter_init();
+
+  make_signals();
+  make_coefficients();
+  numSignals = 3u;
+
+#if defined (ACCURACY_HOST)
+  if(argc > 1)
+  {
+    numSignals += read_recorded(argv[1]);
+  }
+#endif
+
+  for (s = 0; s < numSignals; s++)
+  {
+    for (l = 0; l < NUM_LEVELS; l++)
+    {
+      for (n = 0; n < BLOCK_LEN; n++)
+      {
+        x[n] = q15_grid(levels[l] * signalRaw[s][n]);
+      }
+
+      for (n = 0; n < BLOCK_LEN; n++)
+      {
+        xb[n] = q15_grid(x[BLOCK_LEN - 1 - n] / MAT_DIM);
+      }
+
+      for (op = 0; op < NUM_OPS; op++)
+      {
+        len = reference(op);
+
+        for (v = 0; v < NUM_VARIANTS; v++)
+        {
+          if(variants[v].op != op)
+          {
+            continue;
+          }
+
+          pRes = &results[v][s][l];
+          pRes->cycles = run_variant(v, len);
+          measure(len, pRes);
+
+          /* Sanity check: the floating-point variants are exact to 100 dB */
+          if(variants[v].isFloat && (pRes->snr < SNR_F32_MIN))
+          {
+            status = ARM_MATH_TEST_FAILURE;
+          }
+        }
+      }
+    }
+  }
+
+  for (op = 0; op < NUM_OPS; op++)
+  {
+    fastest[op] = select_fastest(op, SNR_TARGET, SNR_TARGET_LEVEL);
+  }
+
+#if defined (ACCURACY_HOST)
+
+  printf("%-32s %-10s %8s %9s %11s %8s\n", "variant", "signal", "level", "SNR dB", "max error", "ticks");
+  for (v = 0; v < NUM_VARIANTS; v++)
+  {
+    for (s = 0; s < numSignals; s++)
+    {
+      for (l = 0; l < NUM_LEVELS; l++)
+      {
+        pRes = &results[v][s][l];
+        printf("%-32s %-10s %5.0f dB %9.1f %11.3e %8u\n", variants[v].name, signalNames[s],
+               20.0 * log10(levels[l]), pRes->snr, pRes->maxErr, pRes->cycles);
+      }
+    }
+  }
+
+  printf("\nfastest variant with SNR >= %.0f dB at %.0f dBFS:\n", SNR_TARGET,
+         20.0 * log10(levels[SNR_TARGET_LEVEL]));
+  for (op = 0; op < NUM_OPS; op++)
+  {
+    printf("  %s\n", (fastest[op] >= 0) ? variants[fastest[op]].name : "none");
+  }
+
+  return ((status == ARM_MATH_SUCCESS) ? 0 : 1);
+
+#else
+
+  if( status != ARM_MATH_SUCCESS)
+  {
+    while(1);
+  }
+
+  while(1);                             /* main function does not return */
+
+#endif
+}
+
+ /** \endlink */
@@ -0,0 +1,328 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2012 ARM Limited. All rights reserved.
+*
+* $Date:         17. January 2013
+* $Revision:     V1.4.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_cfft_bfp_example.c
+*
+* Description:   Compares SNR and cycles of the fixed-point, block floating-point
+*                and floating-point complex FFTs.
+*
+* Target Processor: Cortex-M4/Cortex-M3
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup CFFTBFPExample Block Floating-Point FFT Example
+ *
+ * \par Description:
+ * \par
+ * Transforms a 1024-point test signal made of a strong tone and a tone 74 dB
+ * weaker with each complex FFT variant of the library, and measures the
+ * signal-to-noise ratio of every result against a double-precision FFT, as
+ * well as the number of cycles spent in the transform.
+ * \par
+ * The fixed-point transforms arm_cfft_q15() and arm_cfft_q31() scale by 1/2
+ * at every radix-2 stage, so their output is the DFT divided by fftLen.
+ * The block floating-point transforms only scale when a stage could
+ * overflow and return the accumulated exponent.
+ *
+ * \par
+ * The test is run with the strong tone near full scale and 40 dB down.  At
+ * the lower level the fixed-scaling Q15 transform loses most of its SNR,
+ * while the block floating-point Q15 transform keeps it.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c snr holds the SNR in dB of each variant for each input level
+ * \li \c cycles holds the DWT cycle count of each variant for each input level
+ * \li \c bfpExponent holds the block exponents returned by the BFP variants
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_cfft_q15()
+ * - arm_cfft_bfp_q15()
+ * - arm_cfft_q31()
+ * - arm_cfft_bfp_q31()
+ * - arm_cfft_f32()
+ *
+ * <b> Refer  </b>
+ * \link arm_cfft_bfp_example.c \endlink
+ *
+ */
+
+
+/** \example arm_cfft_bfp_example.c
+  */
+
+/* The DWT cycle counter is declared by the device header only: arm_math.h
+   includes the generic part of the core header. Name the device header with
+   CMSIS_device_header, for instance -DCMSIS_device_header="ARMCM4_FP.h" */
+#if defined (CMSIS_device_header)
+#include CMSIS_device_header
+#endif
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define FFT_LEN         1024
+#define LOG2_FFT_LEN    10
+#define TONE1_BIN       37.25
+#define TONE2_BIN       200.0
+#define TONE2_REL       0.0002      /* weak tone, 74 dB below the strong one */
+#define NUM_LEVELS      2
+
+/* Variants, in the order of the result arrays */
+enum
+{
+  FFT_Q15 = 0,
+  FFT_BFP_Q15,
+  FFT_Q31,
+  FFT_BFP_Q31,
+  FFT_F32,
+  FFT_NUM_VARIANTS
+};
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+float64_t refSignal[2 * FFT_LEN];     /* Double-precision reference */
+q15_t     bufQ15[2 * FFT_LEN];
+q31_t     bufQ31[2 * FFT_LEN];
+float32_t bufF32[2 * FFT_LEN];
+
+/* ----------------------------------------------------------------------
+* Results
+* ------------------------------------------------------------------- */
+float32_t snr[NUM_LEVELS][FFT_NUM_VARIANTS];
+uint32_t  cycles[NUM_LEVELS][FFT_NUM_VARIANTS];
+int32_t   bfpExponent[NUM_LEVELS][2];
+
+/* Amplitude of the strong tone: near full scale, and 40 dB down */
+const float64_t toneLevel[NUM_LEVELS] = { 0.45, 0.0045 };
+
+arm_status status;   /* Status of the example */
+
+/* ----------------------------------------------------------------------
+* Cycle counter
+* ------------------------------------------------------------------- */
+#if defined (DWT_BASE)
+
+static void cycle_counter_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t cycle_count(void)
+{
+  return DWT->CYCCNT;
+}
+
+#else
+
+/* No device header: no cycle is counted */
+static void cycle_counter_init(void)
+{
+}
+
+static uint32_t cycle_count(void)
+{
+  return 0;
+}
+
+#endif
+
+/* ----------------------------------------------------------------------
+* Double-precision radix-2 FFT used as the reference
+* ------------------------------------------------------------------- */
+static void ref_fft(float64_t * p, uint32_t n)
+{
+  uint32_t i, j, k, m;
+  float64_t wr, wi, tr, ti, ang;
+
+  /* Bit reversal */
+  for (i = 0, j = 0; i < n; i++)
+  {
+    if(i < j)
+    {
+      tr = p[2 * i]; p[2 * i] = p[2 * j]; p[2 * j] = tr;
+      ti = p[2 * i + 1]; p[2 * i + 1] = p[2 * j + 1]; p[2 * j + 1] = ti;
+    }
+    for (m = n >> 1; (m >= 1) && (j & m); m >>= 1)
+      j ^= m;
+    j |= m;
+  }
+
+  /* Decimation in time */
+  for (m = 1; m < n; m <<= 1)
+  {
+    for (k = 0; k < m; k++)
+    {
+      ang = -3.14159265358979323846 * k / m;
+      wr = cos(ang);
+      wi = sin(ang);
+      for (i = k; i < n; i += 2 * m)
+      {
+        j = i + m;
+        tr = wr * p[2 * j] - wi * p[2 * j + 1];
+        ti = wr * p[2 * j + 1] + wi * p[2 * j];
+        p[2 * j] = p[2 * i] - tr;
+        p[2 * j + 1] = p[2 * i + 1] - ti;
+        p[2 * i] += tr;
+        p[2 * i + 1] += ti;
+      }
+    }
+  }
+}
+
+/* SNR in dB of a result given as value * scale */
+static float32_t snr_db(const float64_t * pRef, float64_t (*get)(uint32_t), float64_t scale)
+{
+  uint32_t i;
+  float64_t sig = 0.0, err = 0.0, d;
+
+  for (i = 0; i < 2 * FFT_LEN; i++)
+  {
+    d = pRef[i] - get(i) * scale;
+    sig += pRef[i] * pRef[i];
+    err += d * d;
+  }
+
+  return (float32_t) (10.0 * log10(sig / err));
+}
+
+static float64_t get_q15(uint32_t i) { return bufQ15[i] / 32768.0; }
+static float64_t get_q31(uint32_t i) { return bufQ31[i] / 2147483648.0; }
+static float64_t get_f32(uint32_t i) { return bufF32[i]; }
+
+/* Complex test signal: a strong tone off-bin and a weak tone on-bin */
+static void load_input(float64_t amp)
+{
+  uint32_t i;
+  float64_t ph1, ph2, re, im;
+
+  for (i = 0; i < FFT_LEN; i++)
+  {
+    ph1 = 2.0 * 3.14159265358979323846 * TONE1_BIN * i / FFT_LEN;
+    ph2 = 2.0 * 3.14159265358979323846 * TONE2_BIN * i / FFT_LEN;
+    re = amp * (cos(ph1) + TONE2_REL * cos(ph2));
+    im = amp * (sin(ph1) + TONE2_REL * sin(ph2));
+
+    refSignal[2 * i] = re;
+    refSignal[2 * i + 1] = im;
+    bufQ15[2 * i] = (q15_t) floor(re * 32768.0 + 0.5);
+    bufQ15[2 * i + 1] = (q15_t) floor(im * 32768.0 + 0.5);
+    bufQ31[2 * i] = (q31_t) floor(re * 2147483648.0 + 0.5);
+    bufQ31[2 * i + 1] = (q31_t) floor(im * 2147483648.0 + 0.5);
+    bufF32[2 * i] = (float32_t) re;
+    bufF32[2 * i + 1] = (float32_t) im;
+  }
+}
+
+int32_t main(void)
+{
+  uint32_t lvl;
+  uint32_t start;
+
+  status = ARM_MATH_SUCCESS;
+
+  cycle_counter_init();
+
+  for (lvl = 0; lvl < NUM_LEVELS; lvl++)
+  {
+    load_input(toneLevel[lvl]);
+    ref_fft(refSignal, FFT_LEN);
+
+    /* Q15, scaled at every stage */
+    start = cycle_count();
+    arm_cfft_q15(&arm_cfft_sR_q15_len1024, bufQ15, 0, 1);
+    cycles[lvl][FFT_Q15] = cycle_count() - start;
+    snr[lvl][FFT_Q15] = snr_db(refSignal, get_q15, FFT_LEN);
+
+    /* Q31, scaled at every stage */
+    start = cycle_count();
+    arm_cfft_q31(&arm_cfft_sR_q31_len1024, bufQ31, 0, 1);
+    cycles[lvl][FFT_Q31] = cycle_count() - start;
+    snr[lvl][FFT_Q31] = snr_db(refSignal, get_q31, FFT_LEN);
+
+    /* Floating-point */
+    start = cycle_count();
+    arm_cfft_f32(&arm_cfft_sR_f32_len1024, bufF32, 0, 1);
+    cycles[lvl][FFT_F32] = cycle_count() - start;
+    snr[lvl][FFT_F32] = snr_db(refSignal, get_f32, 1.0);
+
+    load_input(toneLevel[lvl]);
+    ref_fft(refSignal, FFT_LEN);
+
+    /* Block floating-point Q15 */
+    start = cycle_count();
+    arm_cfft_bfp_q15(&arm_cfft_sR_q15_len1024, bufQ15, 0, 1, &bfpExponent[lvl][0]);
+    cycles[lvl][FFT_BFP_Q15] = cycle_count() - start;
+    snr[lvl][FFT_BFP_Q15] = snr_db(refSignal, get_q15, ldexp(1.0, bfpExponent[lvl][0]));
+
+    /* Block floating-point Q31 */
+    start = cycle_count();
+    arm_cfft_bfp_q31(&arm_cfft_sR_q31_len1024, bufQ31, 0, 1, &bfpExponent[lvl][1]);
+    cycles[lvl][FFT_BFP_Q31] = cycle_count() - start;
+    snr[lvl][FFT_BFP_Q31] = snr_db(refSignal, get_q31, ldexp(1.0, bfpExponent[lvl][1]));
+
+    /* The BFP transforms must never do worse than the fixed-scaling ones */
+    if((snr[lvl][FFT_BFP_Q15] < snr[lvl][FFT_Q15]) ||
+       (snr[lvl][FFT_BFP_Q31] < snr[lvl][FFT_Q31]))
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+
+    /* The exponent can never exceed two bits per stage */
+    if((bfpExponent[lvl][0] > 2 * LOG2_FFT_LEN) ||
+       (bfpExponent[lvl][1] > 2 * LOG2_FFT_LEN))
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  if( status != ARM_MATH_SUCCESS)
+  {
+    while(1);
+  }
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2012 ARM Limited. All rights reserved.
+*
+* $Date:         17. January 2013
+* $Revision:     V1.4.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_gcc_phat_example_f32.c
+*
+* Description:   Time-delay estimation between the channels of a 4 microphone
+*                array with GCC-PHAT, and its cycle budget.
+*
+* Target Processor: Cortex-M4/Cortex-M3
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup GCCPHATExample GCC-PHAT Time-Delay Estimation Example
+ *
+ * \par Description:
+ * \par
+ * Simulates one frame of a 4 microphone array sampled at 16 kHz, as the SAI
+ * or I2S DMA delivers it: 512 interleaved samples per microphone.  The source
+ * is a broadband signal made of many tones of random phase, so that delays of
+ * a fraction of a sample can be applied exactly, and each microphone adds its
+ * own noise.
+ * \par
+ * The spectrum of each microphone is computed once, then the delays of the
+ * 6 pairs are estimated and compared with the simulated ones.  The whole frame
+ * is timed with the cycle counter and compared with the 32 ms frame period.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c micDelay holds the simulated delay of each microphone, in samples
+ * \li \c pairDelay holds the estimated delay of each pair
+ * \li \c pairPeak holds the peak of each whitened cross-correlation
+ * \li \c cyclesFrame holds the cycle count of one complete frame
+ * \li \c loadPercent holds the share of the frame period that it takes
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_gcc_phat_init_f32()
+ * - arm_gcc_phat_spectrum_f32()
+ * - arm_gcc_phat_pairs_f32()
+ * - arm_cos_f32()
+ *
+ * <b> Refer  </b>
+ * \link arm_gcc_phat_example_f32.c \endlink
+ *
+ */
+
+
+/** \example arm_gcc_phat_example_f32.c
+  */
+
+/* The DWT cycle counter is declared by the device header only: arm_math.h
+   includes the generic part of the core header. Name the device header with
+   CMSIS_device_header, for instance -DCMSIS_device_header="ARMCM4_FP.h" */
+#if defined (CMSIS_device_header)
+#include CMSIS_device_header
+#endif
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define NUM_MICS        4
+#define NUM_PAIRS       (NUM_MICS * (NUM_MICS - 1) / 2)
+#define FRAME_LEN       512
+#define FFT_LEN         1024
+#define MAX_LAG         8           /* 17 cm spacing at 343 m/s and 16 kHz */
+#define NUM_TONES       96
+#define SAMPLE_RATE     16000u
+#define CPU_CLOCK       168000000u
+#define NOISE_LEVEL     0.05f
+#define DELTA           0.2f        /* allowed delay error, in samples */
+#define MIN_PEAK        0.3f        /* smallest correlation peak of a clean source */
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+float32_t frame[FRAME_LEN * NUM_MICS];     /* interleaved microphone samples */
+float32_t spectra[NUM_MICS * FFT_LEN];
+float32_t scratch[2 * FFT_LEN];
+
+arm_gcc_phat_instance_f32 S;
+
+/* Delay of the source at each microphone, in samples */
+const float32_t micDelay[NUM_MICS] = { 0.0f, 1.3f, -2.6f, 3.75f };
+
+/* ----------------------------------------------------------------------
+* Results
+* ------------------------------------------------------------------- */
+float32_t pairDelay[NUM_PAIRS];
+float32_t pairPeak[NUM_PAIRS];
+uint32_t  cyclesFrame;
+float32_t loadPercent;
+
+arm_status status;   /* Status of the example */
+
+/* ----------------------------------------------------------------------
+* Cycle counter
+* ------------------------------------------------------------------- */
+#if defined (DWT_BASE)
+
+static void cycle_counter_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t cycle_count(void)
+{
+  return DWT->CYCCNT;
+}
+
+#else
+
+/* No device header: no cycle is counted */
+static void cycle_counter_init(void)
+{
+}
+
+static uint32_t cycle_count(void)
+{
+  return 0;
+}
+
+#endif
+
+/* ----------------------------------------------------------------------
+* Pseudo-random numbers between 0 and 1
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345u;
+
+static float32_t rand_unit(void)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return (float32_t) (seed >> 8) / 16777216.0f;
+}
+
+/* ----------------------------------------------------------------------
+* Simulates one frame of the array
+* ------------------------------------------------------------------- */
+static void simulate_frame(void)
+{
+  float32_t freq[NUM_TONES], phase[NUM_TONES];
+  float32_t acc;
+  uint32_t n, m, k;
+
+  /* Tones spread between 200 Hz and 6 kHz */
+  for (k = 0; k < NUM_TONES; k++)
+  {
+    freq[k] = 2.0f * PI * (200.0f + 5800.0f * rand_unit()) / SAMPLE_RATE;
+    phase[k] = 2.0f * PI * rand_unit();
+  }
+
+  for (n = 0; n < FRAME_LEN; n++)
+  {
+    for (m = 0; m < NUM_MICS; m++)
+    {
+      acc = 0.0f;
+      for (k = 0; k < NUM_TONES; k++)
+      {
+        acc += arm_cos_f32(freq[k] * ((float32_t) n - micDelay[m]) + phase[k]);
+      }
+      frame[n * NUM_MICS + m] = acc / NUM_TONES +
+        NOISE_LEVEL * (rand_unit() - 0.5f);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+* GCC-PHAT example
+* ------------------------------------------------------------------- */
+int32_t main(void)
+{
+  uint32_t m, a, b, p, start;
+  float32_t err;
+
+  status = arm_gcc_phat_init_f32(&S, FFT_LEN, FRAME_LEN, NUM_MICS, MAX_LAG,
+                                 spectra, scratch);
+
+  cycle_counter_init();
+
+  simulate_frame();
+
+  /* One frame: a spectrum per microphone, then all the pairs */
+  start = cycle_count();
+
+  for (m = 0; m < NUM_MICS; m++)
+  {
+    arm_gcc_phat_spectrum_f32(&S, &frame[m], NUM_MICS, m);
+  }
+  arm_gcc_phat_pairs_f32(&S, pairDelay, pairPeak);
+
+  cyclesFrame = cycle_count() - start;
+  loadPercent = 100.0f * (float32_t) cyclesFrame /
+    ((float32_t) CPU_CLOCK * FRAME_LEN / SAMPLE_RATE);
+
+  /* Compare with the simulated delays */
+  p = 0;
+  for (a = 0; a < NUM_MICS - 1; a++)
+  {
+    for (b = a + 1; b < NUM_MICS; b++)
+    {
+      err = pairDelay[p] - (micDelay[b] - micDelay[a]);
+      if((err > DELTA) || (err < -DELTA) || (pairPeak[p] < MIN_PEAK))
+      {
+        status = ARM_MATH_TEST_FAILURE;
+      }
+      p++;
+    }
+  }
+
+  /* The frame must be processed well within its period */
+  if(loadPercent > 50.0f)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  if( status != ARM_MATH_SUCCESS)
+  {
+    while(1);
+  }
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
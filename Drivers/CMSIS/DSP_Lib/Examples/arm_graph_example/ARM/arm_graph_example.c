@@ -0,0 +1,411 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2012 ARM Limited. All rights reserved.
+*
+* $Date:         17. January 2013
+* $Revision:     V1.4.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_graph_example.c
+*
+* Description:   Runs a filter, decimator and spectrum chain as a DSP graph
+*                fed block by block, checks it against the same kernels glued
+*                by hand and validates its schedule with the simulator.
+*
+*
+* Target Processor: Cortex-M4/Cortex-M3
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup DspGraphExample DSP Graph Example
+ *
+ * \par Description:
+ * \par
+ * Builds a spectrum analyzer as a DSP graph of five nodes:
+ * <pre>
+ *   source --> DC blocker --> FIR decimator --> FIR --> real FFT --> magnitude --> sink
+ *              (biquad)       (by 4)
+ * </pre>
+ * The source edge holds two blocks of <code>SOURCE_BLOCK</code> samples, as
+ * the two halves of a circular DMA buffer would, and the input signal is
+ * written into it one block at a time, the graph being run after each block.
+ * Every kernel works directly in the edges, with no intermediate copy.
+ * \par
+ * The example checks that:
+ * - the simulator runs every node the expected number of times, without
+ *   calling any kernel, and rejects source blocks that do not fit the source
+ *   edge in one piece;
+ * - arm_graph_init() rejects an edge of the wrong sample type;
+ * - the spectra produced by the graph are those of the same kernels called
+ *   one after the other on intermediate buffers.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c graphOut holds the spectra produced by the graph
+ * \li \c refOut holds the spectra of the chain glued by hand
+ * \li \c trace holds the order of the node runs given by the simulator
+ * \li \c nodes hold the runs and cycles of every node after the graph ran
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_graph_edge_init()
+ * - arm_graph_edge_write_ptr()
+ * - arm_graph_edge_commit()
+ * - arm_graph_edge_read_ptr()
+ * - arm_graph_edge_release()
+ * - arm_graph_node_biquad_cascade_df1_f32()
+ * - arm_graph_node_fir_decimate_f32()
+ * - arm_graph_node_fir_f32()
+ * - arm_graph_node_rfft_fast_f32()
+ * - arm_graph_node_cmplx_mag_f32()
+ * - arm_graph_init()
+ * - arm_graph_simulate()
+ * - arm_graph_reset()
+ * - arm_graph_run()
+ *
+ * <b> Refer  </b>
+ * \link arm_graph_example.c \endlink
+ *
+ */
+
+
+/** \example arm_graph_example.c
+  */
+
+/* The DWT cycle counter is declared by the device header only: arm_math.h
+   includes the generic part of the core header. Name the device header with
+   CMSIS_device_header, for instance -DCMSIS_device_header="ARMCM4_FP.h" */
+#if defined (CMSIS_device_header)
+#include CMSIS_device_header
+#endif
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define NUM_SAMPLES     2048
+#define SOURCE_BLOCK    32          /* samples written by the "DMA" at a time */
+#define DECIM_FACTOR    4
+#define DECIM_BLOCK     64          /* input samples of a decimator run */
+#define DECIM_TAPS      32
+#define FIR_BLOCK       16
+#define FIR_TAPS        16
+#define FFT_LEN         64
+#define NUM_BINS        (FFT_LEN / 2)
+#define NUM_FRAMES      (NUM_SAMPLES / DECIM_FACTOR / FFT_LEN)
+#define NUM_NODES       5
+#define MAX_TRACE       256
+#define TOLERANCE       1.0e-5f     /* relative to the largest output */
+
+/* ----------------------------------------------------------------------
+* Edges of the graph, sized at build time
+* ------------------------------------------------------------------- */
+float32_t srcBuf[2 * SOURCE_BLOCK];       /* ping-pong */
+float32_t dcBuf[2 * DECIM_BLOCK];
+float32_t decimBuf[2 * FIR_BLOCK];
+float32_t firBuf[FFT_LEN];
+float32_t fftBuf[FFT_LEN];
+float32_t magBuf[2 * NUM_BINS];
+
+arm_graph_edge srcEdge, dcEdge, decimEdge, firEdge, fftEdge, magEdge;
+arm_graph_node nodes[NUM_NODES];
+arm_graph_instance graph;
+
+/* ----------------------------------------------------------------------
+* Kernel instances of the graph and of the reference chain
+* ------------------------------------------------------------------- */
+const float32_t dcCoeffs[5] = { 1.0f, -1.0f, 0.0f, 0.995f, 0.0f };
+float32_t decimCoeffs[DECIM_TAPS];
+float32_t firCoeffs[FIR_TAPS];
+
+arm_biquad_casd_df1_inst_f32 dcInst, dcRef;
+arm_fir_decimate_instance_f32 decimInst, decimRef;
+arm_fir_instance_f32 firInst, firRef;
+arm_rfft_fast_instance_f32 fftInst;
+
+float32_t dcState[4], dcRefState[4];
+float32_t decimState[DECIM_TAPS + DECIM_BLOCK - 1], decimRefState[DECIM_TAPS + DECIM_BLOCK - 1];
+float32_t firState[FIR_TAPS + FIR_BLOCK - 1], firRefState[FIR_TAPS + FIR_BLOCK - 1];
+
+/* ----------------------------------------------------------------------
+* Signals
+* ------------------------------------------------------------------- */
+float32_t input[NUM_SAMPLES];
+float32_t refDc[NUM_SAMPLES];
+float32_t refDecim[NUM_SAMPLES / DECIM_FACTOR];
+float32_t refFir[NUM_SAMPLES / DECIM_FACTOR];
+float32_t refFft[FFT_LEN];
+
+/* ----------------------------------------------------------------------
+* Results
+* ------------------------------------------------------------------- */
+float32_t graphOut[NUM_FRAMES * NUM_BINS];
+float32_t refOut[NUM_FRAMES * NUM_BINS];
+uint16_t trace[MAX_TRACE];
+
+arm_status status;   /* Status of the example */
+
+/* ----------------------------------------------------------------------
+* Cycle counter
+* ------------------------------------------------------------------- */
+#if defined (DWT_BASE)
+
+static void cycle_counter_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t cycle_count(void)
+{
+  return DWT->CYCCNT;
+}
+
+#else
+
+/* No device header: no cycle is counted */
+static void cycle_counter_init(void)
+{
+}
+
+static uint32_t cycle_count(void)
+{
+  return 0;
+}
+
+#endif
+
+/* ----------------------------------------------------------------------
+* Windowed sinc low-pass filter with a cutoff of fc times the sample rate
+* ------------------------------------------------------------------- */
+static void lowpass(float32_t * pCoeffs, uint32_t numTaps, float32_t fc)
+{
+  uint32_t i;
+  float32_t t, sum = 0.0f;
+
+  for (i = 0; i < numTaps; i++)
+  {
+    t = (float32_t) i - 0.5f * (float32_t) (numTaps - 1u);
+    pCoeffs[i] = (t == 0.0f) ? 2.0f * fc : arm_sin_f32(2.0f * PI * fc * t) / (PI * t);
+    pCoeffs[i] *= 0.54f - 0.46f * arm_cos_f32(2.0f * PI * (float32_t) i / (float32_t) (numTaps - 1u));
+    sum += pCoeffs[i];
+  }
+
+  for (i = 0; i < numTaps; i++)
+  {
+    pCoeffs[i] /= sum;
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Builds the graph with fresh kernel states
+* ------------------------------------------------------------------- */
+static arm_status build_graph(void)
+{
+  arm_biquad_cascade_df1_init_f32(&dcInst, 1, (float32_t *) dcCoeffs, dcState);
+  arm_fir_decimate_init_f32(&decimInst, DECIM_TAPS, DECIM_FACTOR, decimCoeffs, decimState, DECIM_BLOCK);
+  arm_fir_init_f32(&firInst, FIR_TAPS, firCoeffs, firState, FIR_BLOCK);
+  arm_rfft_fast_init_f32(&fftInst, FFT_LEN);
+
+  arm_graph_edge_init(&srcEdge, ARM_GRAPH_F32, srcBuf, 2 * SOURCE_BLOCK);
+  arm_graph_edge_init(&dcEdge, ARM_GRAPH_F32, dcBuf, 2 * DECIM_BLOCK);
+  arm_graph_edge_init(&decimEdge, ARM_GRAPH_F32, decimBuf, 2 * FIR_BLOCK);
+  arm_graph_edge_init(&firEdge, ARM_GRAPH_F32, firBuf, FFT_LEN);
+  arm_graph_edge_init(&fftEdge, ARM_GRAPH_F32, fftBuf, FFT_LEN);
+  arm_graph_edge_init(&magEdge, ARM_GRAPH_F32, magBuf, 2 * NUM_BINS);
+
+  /* Producers before consumers */
+  arm_graph_node_biquad_cascade_df1_f32(&nodes[0], &dcInst, &srcEdge, &dcEdge, SOURCE_BLOCK);
+  arm_graph_node_fir_decimate_f32(&nodes[1], &decimInst, &dcEdge, &decimEdge, DECIM_BLOCK);
+  arm_graph_node_fir_f32(&nodes[2], &firInst, &decimEdge, &firEdge, FIR_BLOCK);
+  arm_graph_node_rfft_fast_f32(&nodes[3], &fftInst, &firEdge, &fftEdge);
+  arm_graph_node_cmplx_mag_f32(&nodes[4], &fftEdge, &magEdge, NUM_BINS);
+
+  return (arm_graph_init(&graph, nodes, NUM_NODES, cycle_count));
+}
+
+/* ----------------------------------------------------------------------
+* DSP graph example
+* ------------------------------------------------------------------- */
+int32_t main(void)
+{
+  const uint32_t expectedRuns[NUM_NODES] = { NUM_SAMPLES / SOURCE_BLOCK, NUM_SAMPLES / DECIM_BLOCK,
+                                             NUM_SAMPLES / DECIM_FACTOR / FIR_BLOCK, NUM_FRAMES, NUM_FRAMES };
+  uint32_t i, n, numRuns, frames = 0;
+  float32_t *pBlock;
+  float32_t peak, diff;
+
+  status = ARM_MATH_SUCCESS;
+
+  cycle_counter_init();
+
+  /* Decimator cutoff below the new Nyquist frequency, then a gentler low-pass */
+  lowpass(decimCoeffs, DECIM_TAPS, 0.1f);
+  lowpass(firCoeffs, FIR_TAPS, 0.3f);
+
+  /* Offset plus tones at 1/64, 3/64 (both kept) and 11/64 (removed by the decimator) of the sample rate */
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    input[i] = 0.2f + 0.5f * arm_sin_f32(2.0f * PI * (float32_t) i / 64.0f)
+                    + 0.25f * arm_sin_f32(2.0f * PI * 3.0f * (float32_t) i / 64.0f)
+                    + 0.25f * arm_sin_f32(2.0f * PI * 11.0f * (float32_t) i / 64.0f);
+  }
+
+  /* A Q15 node cannot read a floating-point edge */
+  if(build_graph() != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  nodes[4].inType = ARM_GRAPH_Q15;
+  if(arm_graph_init(&graph, nodes, NUM_NODES, cycle_count) != ARM_MATH_SIZE_MISMATCH)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  nodes[4].inType = ARM_GRAPH_F32;
+
+  /* Simulate the schedule: every node must run as often as the rates say */
+  if((status == ARM_MATH_SUCCESS) &&
+     (arm_graph_simulate(&graph, NUM_SAMPLES, SOURCE_BLOCK, trace, MAX_TRACE, &numRuns) == ARM_MATH_SUCCESS))
+  {
+    n = 0;
+    for (i = 0; i < NUM_NODES; i++)
+    {
+      if(nodes[i].runs != expectedRuns[i])
+      {
+        status = ARM_MATH_TEST_FAILURE;
+      }
+      n += nodes[i].runs;
+    }
+
+    if((numRuns != n) || (numRuns > MAX_TRACE))
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+  else
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  /* Blocks of 48 samples cannot be written in one piece to a source of 64 */
+  if(arm_graph_simulate(&graph, NUM_SAMPLES, 48, NULL, 0, &numRuns) != ARM_MATH_SIZE_MISMATCH)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  /* Run the graph, writing the input as a DMA would and reading the spectra */
+  if(build_graph() != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  for (i = 0; (i < NUM_SAMPLES) && (status == ARM_MATH_SUCCESS); i += SOURCE_BLOCK)
+  {
+    pBlock = (float32_t *) arm_graph_edge_write_ptr(&srcEdge, SOURCE_BLOCK);
+    if(pBlock == NULL)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+      break;
+    }
+
+    arm_copy_f32(&input[i], pBlock, SOURCE_BLOCK);
+    arm_graph_edge_commit(&srcEdge, SOURCE_BLOCK);
+
+    arm_graph_run(&graph);
+
+    while((pBlock = (float32_t *) arm_graph_edge_read_ptr(&magEdge, NUM_BINS)) != NULL)
+    {
+      if(frames < NUM_FRAMES)
+      {
+        arm_copy_f32(pBlock, &graphOut[frames * NUM_BINS], NUM_BINS);
+      }
+      frames++;
+      arm_graph_edge_release(&magEdge, NUM_BINS);
+    }
+  }
+
+  if(frames != NUM_FRAMES)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  /* The same chain glued by hand, with the same block sizes */
+  arm_biquad_cascade_df1_init_f32(&dcRef, 1, (float32_t *) dcCoeffs, dcRefState);
+  arm_fir_decimate_init_f32(&decimRef, DECIM_TAPS, DECIM_FACTOR, decimCoeffs, decimRefState, DECIM_BLOCK);
+  arm_fir_init_f32(&firRef, FIR_TAPS, firCoeffs, firRefState, FIR_BLOCK);
+
+  for (i = 0; i < NUM_SAMPLES; i += SOURCE_BLOCK)
+  {
+    arm_biquad_cascade_df1_f32(&dcRef, &input[i], &refDc[i], SOURCE_BLOCK);
+  }
+
+  for (i = 0; i < NUM_SAMPLES; i += DECIM_BLOCK)
+  {
+    arm_fir_decimate_f32(&decimRef, &refDc[i], &refDecim[i / DECIM_FACTOR], DECIM_BLOCK);
+  }
+
+  for (i = 0; i < NUM_SAMPLES / DECIM_FACTOR; i += FIR_BLOCK)
+  {
+    arm_fir_f32(&firRef, &refDecim[i], &refFir[i], FIR_BLOCK);
+  }
+
+  for (i = 0; i < NUM_FRAMES; i++)
+  {
+    arm_rfft_fast_f32(&fftInst, &refFir[i * FFT_LEN], refFft, 0);
+    arm_cmplx_mag_f32(refFft, &refOut[i * NUM_BINS], NUM_BINS);
+  }
+
+  peak = 0.0f;
+  diff = 0.0f;
+  for (i = 0; i < NUM_FRAMES * NUM_BINS; i++)
+  {
+    peak = (fabsf(refOut[i]) > peak) ? fabsf(refOut[i]) : peak;
+    diff = (fabsf(graphOut[i] - refOut[i]) > diff) ? fabsf(graphOut[i] - refOut[i]) : diff;
+  }
+
+  if(diff > TOLERANCE * peak)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  if( status != ARM_MATH_SUCCESS)
+  {
+    while(1);
+  }
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
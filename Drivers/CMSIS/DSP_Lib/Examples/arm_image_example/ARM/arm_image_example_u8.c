@@ -0,0 +1,365 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2012 ARM Limited. All rights reserved.
+*
+* $Date:         17. January 2013
+* $Revision:     V1.4.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_image_example_u8.c
+*
+* Description:   Streams a camera frame line by line through the image kernels.
+*
+* Target Processor: Cortex-M4/Cortex-M3
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup ImageExample Line-Streaming Image Processing Example
+ *
+ * \par Description:
+ * \par
+ * Feeds a synthetic RGB565 frame to the image kernels one line at a time, the
+ * way lines arrive from the DCMI line event of a camera, and checks every
+ * output line against a full-frame reference written in plain C.
+ * \par
+ * The handler <code>camera_line_event()</code> only keeps the last five
+ * grayscale lines: it converts the incoming line, pushes it into a 3-line and
+ * a 5-line buffer and runs the 2D kernels on the returned row pointers.
+ * Complete output frames are stored here only so that they can be compared
+ * with the reference once the frame has ended.
+ * \par
+ * Building this file natively on a host with <code>ARM_MATH_CM0</code> defined
+ * checks the scalar code paths, while running it on a Cortex-M4 checks the
+ * SIMD code paths.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_image_rgb565_to_gray_u8()
+ * - arm_image_threshold_u8()
+ * - arm_image_linebuf_init_u8()
+ * - arm_image_linebuf_push_u8()
+ * - arm_image_conv_sep_u8()
+ * - arm_image_gaussian_u8()
+ * - arm_image_box_u8()
+ * - arm_image_sobel_u8()
+ * - arm_image_resize_bilinear_init_u8()
+ * - arm_image_resize_bilinear_u8()
+ *
+ * <b> Refer  </b>
+ * \link arm_image_example_u8.c \endlink
+ *
+ */
+
+
+/** \example arm_image_example_u8.c
+  */
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+* Frame geometry (odd sizes exercise the tail loops)
+* ------------------------------------------------------------------- */
+#define WIDTH           83
+#define HEIGHT          61
+#define DST_WIDTH       40
+#define DST_HEIGHT      29
+#define THRESHOLD       96
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+uint16_t frameRGB565[HEIGHT][WIDTH];    /* camera frame, read one line at a time */
+
+/* Line-streaming state */
+uint8_t grayLine[WIDTH];
+uint8_t lineStore3[3 * WIDTH];
+uint8_t lineStore5[5 * WIDTH];
+uint8_t prevLine[WIDTH];
+q15_t   scratch[2 * WIDTH];
+arm_image_linebuf_instance_u8 lineBuf3;
+arm_image_linebuf_instance_u8 lineBuf5;
+arm_image_resize_instance_u8 resize;
+
+/* Output frames, kept only for the comparison */
+uint8_t outGauss[HEIGHT][WIDTH];
+uint8_t outBox[HEIGHT][WIDTH];
+uint8_t outSobel[HEIGHT][WIDTH];
+uint8_t outConv[HEIGHT][WIDTH];
+uint8_t outEdges[HEIGHT][WIDTH];
+uint8_t outSmall[DST_HEIGHT][DST_WIDTH];
+
+/* Reference frames */
+uint8_t refGray[HEIGHT][WIDTH];
+q15_t   refTmp[HEIGHT][WIDTH];
+uint8_t refOut[HEIGHT][WIDTH];
+
+/* Sharpening kernel, used through arm_image_conv_sep_u8() */
+const q15_t sharpenH[5] = { -4096, 8192, 24576, 8192, -4096 };
+const q15_t sharpenV[5] = { 1000, 6000, 18000, 6000, 1768 };
+
+const q15_t gauss5[5] = { 2048, 8192, 12288, 8192, 2048 };
+
+arm_status status;   /* Status of the example */
+
+/* ----------------------------------------------------------------------
+* Line handler, called once per camera line and once per flush line
+* ------------------------------------------------------------------- */
+static uint32_t linesIn;     /* lines pushed into the buffers */
+static uint32_t smallLine;   /* lines produced by the downscaler */
+
+static void process_gray_line(void)
+{
+  const uint8_t *rows3[3];
+  const uint8_t *rows5[5];
+
+  arm_image_linebuf_push_u8(&lineBuf3, grayLine, rows3);
+  arm_image_linebuf_push_u8(&lineBuf5, grayLine, rows5);
+
+  /* 3x3 kernels lag one line behind the input */
+  if((linesIn >= 1u) && (linesIn - 1u < HEIGHT))
+  {
+    arm_image_box_u8(rows3, WIDTH, 3, scratch, outBox[linesIn - 1u]);
+    arm_image_sobel_u8(rows3, WIDTH, scratch, outSobel[linesIn - 1u]);
+    arm_image_threshold_u8(outSobel[linesIn - 1u], outEdges[linesIn - 1u],
+                           THRESHOLD, WIDTH);
+  }
+
+  /* 5x5 kernels lag two lines behind the input */
+  if(linesIn >= 2u)
+  {
+    arm_image_gaussian_u8(rows5, WIDTH, 5, scratch, outGauss[linesIn - 2u]);
+    arm_image_conv_sep_u8(rows5, WIDTH, sharpenH, sharpenV, 5, scratch,
+                          outConv[linesIn - 2u]);
+  }
+
+  linesIn++;
+}
+
+static void camera_line_event(const uint16_t * pLine)
+{
+  arm_image_rgb565_to_gray_u8(pLine, grayLine, WIDTH);
+
+  if(arm_image_resize_bilinear_u8(&resize, grayLine, outSmall[smallLine]) != 0u)
+  {
+    smallLine++;
+  }
+
+  process_gray_line();
+}
+
+static void camera_frame_event(void)
+{
+  /* Push the last line twice more to flush the 5x5 kernels */
+  process_gray_line();
+  process_gray_line();
+}
+
+/* ----------------------------------------------------------------------
+* Full-frame reference
+* ------------------------------------------------------------------- */
+static int32_t clampi(int32_t v, int32_t lo, int32_t hi)
+{
+  return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
+
+static void ref_conv(const q15_t * pH, const q15_t * pV, int32_t n)
+{
+  int32_t x, y, k, acc, r = n / 2;
+
+  for (y = 0; y < HEIGHT; y++)
+    for (x = 0; x < WIDTH; x++)
+    {
+      for (acc = 0, k = 0; k < n; k++)
+        acc += pV[k] * refGray[clampi(y + k - r, 0, HEIGHT - 1)][x];
+      refTmp[y][x] = (q15_t) clampi((acc + 0x80) >> 8, -32768, 32767);
+    }
+
+  for (y = 0; y < HEIGHT; y++)
+    for (x = 0; x < WIDTH; x++)
+    {
+      for (acc = 0, k = 0; k < n; k++)
+        acc += pH[k] * refTmp[y][clampi(x + k - r, 0, WIDTH - 1)];
+      refOut[y][x] = (uint8_t) clampi((acc + (1 << 21)) >> 22, 0, 255);
+    }
+}
+
+static void ref_box3(void)
+{
+  int32_t x, y, i, j, sum;
+
+  for (y = 0; y < HEIGHT; y++)
+    for (x = 0; x < WIDTH; x++)
+    {
+      for (sum = 0, i = -1; i <= 1; i++)
+        for (j = -1; j <= 1; j++)
+          sum += refGray[clampi(y + i, 0, HEIGHT - 1)][clampi(x + j, 0, WIDTH - 1)];
+      refOut[y][x] = (uint8_t) ((sum * 7282 + 0x8000) >> 16);
+    }
+}
+
+static void ref_sobel(void)
+{
+  int32_t x, y, i, j, gx, gy, p, mag;
+  static const int32_t kx[3][3] = { { -1, 0, 1 }, { -2, 0, 2 }, { -1, 0, 1 } };
+
+  for (y = 0; y < HEIGHT; y++)
+    for (x = 0; x < WIDTH; x++)
+    {
+      for (gx = 0, gy = 0, i = 0; i < 3; i++)
+        for (j = 0; j < 3; j++)
+        {
+          p = refGray[clampi(y + i - 1, 0, HEIGHT - 1)][clampi(x + j - 1, 0, WIDTH - 1)];
+          gx += kx[i][j] * p;
+          gy += kx[j][i] * p;
+        }
+      mag = (((gx < 0) ? -gx : gx) + ((gy < 0) ? -gy : gy)) >> 2;
+      refOut[y][x] = (uint8_t) ((mag > 255) ? 255 : mag);
+    }
+}
+
+static int32_t compare(const uint8_t * pOut, const uint8_t * pRef, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+    if(pOut[i] != pRef[i])
+      return 1;
+
+  return 0;
+}
+
+int32_t main(void)
+{
+  int32_t x, y, r, g, b;
+  uint32_t stepX, stepY, posX, posY, ix, iy, ix1, iy1, fx, fy, top, bot;
+
+  status = ARM_MATH_SUCCESS;
+
+  /* Synthetic scene: gradients plus a bright rectangle */
+  for (y = 0; y < HEIGHT; y++)
+    for (x = 0; x < WIDTH; x++)
+    {
+      r = (x * 31) / (WIDTH - 1);
+      g = (y * 63) / (HEIGHT - 1);
+      b = ((x ^ y) & 8) ? 31 : 0;
+      if((x > 20) && (x < 50) && (y > 15) && (y < 40))
+      {
+        r = 31;
+        g = 63;
+      }
+      frameRGB565[y][x] = (uint16_t) ((r << 11) | (g << 5) | b);
+    }
+
+  /* ------------------------------------------------------------------
+  * Stream the frame
+  * ------------------------------------------------------------------- */
+  arm_image_linebuf_init_u8(&lineBuf3, WIDTH, 3, lineStore3);
+  arm_image_linebuf_init_u8(&lineBuf5, WIDTH, 5, lineStore5);
+  if(arm_image_resize_bilinear_init_u8(&resize, WIDTH, HEIGHT, DST_WIDTH,
+                                       DST_HEIGHT, prevLine) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  for (y = 0; y < HEIGHT; y++)
+  {
+    camera_line_event(frameRGB565[y]);
+  }
+  camera_frame_event();
+
+  if(smallLine != DST_HEIGHT)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  /* ------------------------------------------------------------------
+  * Compare with the reference
+  * ------------------------------------------------------------------- */
+  for (y = 0; y < HEIGHT; y++)
+    for (x = 0; x < WIDTH; x++)
+    {
+      r = (frameRGB565[y][x] >> 11) & 0x1F;
+      g = (frameRGB565[y][x] >> 5) & 0x3F;
+      b = frameRGB565[y][x] & 0x1F;
+      refGray[y][x] = (uint8_t) ((630 * r + 608 * g + 240 * b + 128) >> 8);
+    }
+
+  ref_conv(gauss5, gauss5, 5);
+  if(compare(&outGauss[0][0], &refOut[0][0], WIDTH * HEIGHT))
+    status = ARM_MATH_TEST_FAILURE;
+
+  ref_conv(sharpenH, sharpenV, 5);
+  if(compare(&outConv[0][0], &refOut[0][0], WIDTH * HEIGHT))
+    status = ARM_MATH_TEST_FAILURE;
+
+  ref_box3();
+  if(compare(&outBox[0][0], &refOut[0][0], WIDTH * HEIGHT))
+    status = ARM_MATH_TEST_FAILURE;
+
+  ref_sobel();
+  if(compare(&outSobel[0][0], &refOut[0][0], WIDTH * HEIGHT))
+    status = ARM_MATH_TEST_FAILURE;
+
+  for (y = 0; y < HEIGHT; y++)
+    for (x = 0; x < WIDTH; x++)
+      if(outEdges[y][x] != ((refOut[y][x] >= THRESHOLD) ? 255 : 0))
+        status = ARM_MATH_TEST_FAILURE;
+
+  /* Bilinear downscale, sampled at the centres of the output pixels */
+  stepX = ((uint32_t) WIDTH << 16) / DST_WIDTH;
+  stepY = ((uint32_t) HEIGHT << 16) / DST_HEIGHT;
+  for (y = 0, posY = (stepY >> 1) - 0x8000u; y < DST_HEIGHT; y++, posY += stepY)
+  {
+    iy = posY >> 16;
+    fy = (posY >> 8) & 0xFFu;
+    iy1 = (iy < HEIGHT - 1) ? iy + 1u : iy;
+    for (x = 0, posX = (stepX >> 1) - 0x8000u; x < DST_WIDTH; x++, posX += stepX)
+    {
+      ix = posX >> 16;
+      fx = (posX >> 8) & 0xFFu;
+      ix1 = (ix < WIDTH - 1) ? ix + 1u : ix;
+      top = refGray[iy][ix] * (256u - fx) + refGray[iy][ix1] * fx;
+      bot = refGray[iy1][ix] * (256u - fx) + refGray[iy1][ix1] * fx;
+      if(outSmall[y][x] != (uint8_t) ((top * (256u - fy) + bot * fy + 0x8000u) >> 16))
+        status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  if( status != ARM_MATH_SUCCESS)
+  {
+    while(1);
+  }
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
@@ -0,0 +1,444 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2012 ARM Limited. All rights reserved.
+*
+* $Date:         17. January 2013
+* $Revision:     V1.4.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_nn_example_q7.c
+*
+* Description:   Checks the neural network layers against a scalar reference.
+*
+* Target Processor: Cortex-M4/Cortex-M3
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup NNExample Neural Network Layer Example
+ *
+ * \par Description:
+ * \par
+ * Runs each neural network layer on pseudo-random data and compares the
+ * result with a straightforward reference implementation written in plain C.
+ * The layers are bit exact, so any difference is reported as a failure.
+ * \par
+ * The reference does not depend on the target: building this file natively
+ * on a host with <code>ARM_MATH_CM0</code> defined checks the scalar code paths,
+ * while running it on a Cortex-M4 checks the __SMLAD code paths.
+ * The scratch memory of each layer is taken from a single arena, sized from
+ * the <code>_buffer_size</code> functions, to show how the per-layer scratch is
+ * accounted for.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_nn_conv_init_q7()
+ * - arm_nn_conv_1d_init_q7()
+ * - arm_nn_conv_HWC_q7()
+ * - arm_nn_conv_init_q15()
+ * - arm_nn_conv_HWC_q15()
+ * - arm_nn_depthwise_conv_HWC_q7()
+ * - arm_nn_fully_connected_q7()
+ * - arm_nn_fully_connected_q15()
+ * - arm_nn_pool_init_q7()
+ * - arm_nn_maxpool_HWC_q7()
+ * - arm_nn_avgpool_HWC_q7()
+ * - arm_nn_relu_q7()
+ * - arm_nn_softmax_q7()
+ *
+ * <b> Refer  </b>
+ * \link arm_nn_example_q7.c \endlink
+ *
+ */
+
+
+/** \example arm_nn_example_q7.c
+  */
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+* Layer geometry
+* ------------------------------------------------------------------- */
+#define IN_DIM_X        9
+#define IN_DIM_Y        7
+#define IN_CH           3
+#define OUT_CH          5
+#define KER_DIM         3
+#define PAD             1
+#define STRIDE          2
+#define FC_DIM          37
+#define FC_ROWS         11
+#define KWS_LEN         25
+#define KWS_CH          6
+#define KWS_KER         5
+#define SCRATCH_SIZE    512
+#define WEIGHT_SIZE     160
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+q7_t  inputQ7[IN_DIM_X * IN_DIM_Y * IN_CH];
+q15_t inputQ15[IN_DIM_X * IN_DIM_Y * IN_CH];
+q7_t  weightQ7[WEIGHT_SIZE];
+q15_t weightQ15[WEIGHT_SIZE];
+q7_t  biasQ7[FC_ROWS];
+q15_t biasQ15[FC_ROWS];
+q7_t  fcWeightQ7[FC_ROWS * FC_DIM];
+q15_t fcWeightQ15[FC_ROWS * FC_DIM];
+
+q7_t  outputQ7[IN_DIM_X * IN_DIM_Y * OUT_CH];
+q7_t  refQ7[IN_DIM_X * IN_DIM_Y * OUT_CH];
+q15_t outputQ15[IN_DIM_X * IN_DIM_Y * OUT_CH];
+q15_t refQ15[IN_DIM_X * IN_DIM_Y * OUT_CH];
+
+/* Scratch arena shared by all layers, aligned for q31_t access */
+q31_t scratch[SCRATCH_SIZE / sizeof(q31_t)];
+
+arm_status status;   /* Status of the example */
+
+/* ----------------------------------------------------------------------
+* Pseudo-random test data
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345u;
+
+static q31_t next_rand(void)
+{
+  seed = seed * 1103515245u + 12345u;
+  return (q31_t) (seed >> 8);
+}
+
+static void fill_q7(q7_t * p, uint32_t n)
+{
+  while(n--)
+  {
+    *p++ = (q7_t) next_rand();
+  }
+}
+
+static void fill_q15(q15_t * p, uint32_t n)
+{
+  while(n--)
+  {
+    *p++ = (q15_t) ((next_rand() >> 12) - 2048);
+  }
+}
+
+static q31_t ref_sat(q31_t x, q31_t lim)
+{
+  return (x >= lim) ? lim - 1 : ((x < -lim) ? -lim : x);
+}
+
+/* ----------------------------------------------------------------------
+* Scalar reference: direct convolution, no im2col
+* ------------------------------------------------------------------- */
+static void ref_conv_q31(const q31_t * pIn, const q31_t * pW, const q31_t * pB,
+  uint32_t dimX, uint32_t dimY, uint32_t chIn, uint32_t chOut,
+  uint32_t kerX, uint32_t kerY, uint32_t pad, uint32_t stride,
+  uint32_t biasShift, uint32_t outShift, int32_t depthwise, q31_t * pOut)
+{
+  uint32_t dimOutX = (dimX + 2 * pad - kerX) / stride + 1;
+  uint32_t dimOutY = (dimY + 2 * pad - kerY) / stride + 1;
+  uint32_t ox, oy, c, kx, ky, k;
+  int32_t ix, iy;
+  q63_t acc;
+
+  for (oy = 0; oy < dimOutY; oy++)
+    for (ox = 0; ox < dimOutX; ox++)
+      for (c = 0; c < chOut; c++)
+      {
+        acc = ((q63_t) pB[c] << biasShift) + (outShift ? (1 << (outShift - 1)) : 0);
+        for (ky = 0; ky < kerY; ky++)
+          for (kx = 0; kx < kerX; kx++)
+          {
+            iy = (int32_t) (oy * stride + ky) - (int32_t) pad;
+            ix = (int32_t) (ox * stride + kx) - (int32_t) pad;
+            if(iy < 0 || ix < 0 || iy >= (int32_t) dimY || ix >= (int32_t) dimX)
+              continue;
+            if(depthwise)
+            {
+              acc += (q63_t) pIn[(iy * dimX + ix) * chIn + c] *
+                pW[(ky * kerX + kx) * chIn + c];
+            }
+            else
+            {
+              for (k = 0; k < chIn; k++)
+                acc += (q63_t) pIn[(iy * dimX + ix) * chIn + k] *
+                  pW[((c * kerY + ky) * kerX + kx) * chIn + k];
+            }
+          }
+        *pOut++ = (q31_t) (acc >> outShift);
+      }
+}
+
+static q31_t refIn[IN_DIM_X * IN_DIM_Y * IN_CH];
+static q31_t refW[FC_ROWS * FC_DIM];
+static q31_t refB[FC_ROWS];
+static q31_t refOut[IN_DIM_X * IN_DIM_Y * OUT_CH];
+
+static void widen_q7(const q7_t * p, q31_t * d, uint32_t n)
+{
+  while(n--) *d++ = *p++;
+}
+
+static void widen_q15(const q15_t * p, q31_t * d, uint32_t n)
+{
+  while(n--) *d++ = *p++;
+}
+
+static void check_q7(const q7_t * pOut, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    if(pOut[i] != (q7_t) ref_sat(refOut[i], 128))
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+}
+
+static void check_q15(const q15_t * pOut, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    if(pOut[i] != (q15_t) ref_sat(refOut[i], 32768))
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+}
+
+int32_t main(void)
+{
+  arm_nn_conv_instance_q7 conv;
+  arm_nn_conv_instance_q15 convQ15;
+  arm_nn_pool_instance_q7 pool;
+  uint32_t scratchUsed = 0;                /* Largest scratch requirement */
+  uint32_t n, i, j, cnt;
+  q31_t acc, mx, sum;
+
+  status = ARM_MATH_SUCCESS;
+
+  fill_q7(inputQ7, sizeof(inputQ7));
+  fill_q15(inputQ15, sizeof(inputQ15) / sizeof(q15_t));
+  fill_q7(weightQ7, sizeof(weightQ7));
+  fill_q15(weightQ15, sizeof(weightQ15) / sizeof(q15_t));
+  fill_q7(biasQ7, sizeof(biasQ7));
+  fill_q15(biasQ15, sizeof(biasQ15) / sizeof(q15_t));
+  fill_q7(fcWeightQ7, sizeof(fcWeightQ7));
+  fill_q15(fcWeightQ15, sizeof(fcWeightQ15) / sizeof(q15_t));
+
+  /* ------------------------------------------------------------------
+  * 2D convolution, Q7
+  * ------------------------------------------------------------------- */
+  status = arm_nn_conv_init_q7(&conv, IN_DIM_X, IN_DIM_Y, IN_CH, OUT_CH,
+                               KER_DIM, KER_DIM, PAD, PAD, STRIDE, STRIDE,
+                               2, 9, weightQ7, biasQ7);
+  if(arm_nn_conv_buffer_size_q7(&conv) > scratchUsed)
+    scratchUsed = arm_nn_conv_buffer_size_q7(&conv);
+
+  arm_nn_conv_HWC_q7(&conv, inputQ7, outputQ7, (q15_t *) scratch);
+
+  widen_q7(inputQ7, refIn, IN_DIM_X * IN_DIM_Y * IN_CH);
+  widen_q7(weightQ7, refW, OUT_CH * KER_DIM * KER_DIM * IN_CH);
+  widen_q7(biasQ7, refB, OUT_CH);
+  ref_conv_q31(refIn, refW, refB, IN_DIM_X, IN_DIM_Y, IN_CH, OUT_CH,
+               KER_DIM, KER_DIM, PAD, STRIDE, 2, 9, 0, refOut);
+  check_q7(outputQ7, (uint32_t) conv.dimOutX * conv.dimOutY * OUT_CH);
+
+  /* ------------------------------------------------------------------
+  * 1D convolution, Q7 (keyword spotting style)
+  * ------------------------------------------------------------------- */
+  arm_nn_conv_1d_init_q7(&conv, KWS_LEN, KWS_CH, OUT_CH, KWS_KER, 2, 1,
+                         1, 6, weightQ7, biasQ7);
+  if(arm_nn_conv_buffer_size_q7(&conv) > scratchUsed)
+    scratchUsed = arm_nn_conv_buffer_size_q7(&conv);
+
+  arm_nn_conv_HWC_q7(&conv, inputQ7, outputQ7, (q15_t *) scratch);
+
+  widen_q7(inputQ7, refIn, KWS_LEN * KWS_CH);
+  widen_q7(weightQ7, refW, OUT_CH * KWS_KER * KWS_CH);
+  /* The reference pads both axes, so pad the 1D case by hand */
+  for (i = 0, n = conv.dimOutX; i < n; i++)
+    for (j = 0; j < OUT_CH; j++)
+    {
+      acc = ((q31_t) biasQ7[j] << 1) + (1 << 5);
+      for (cnt = 0; cnt < KWS_KER * KWS_CH; cnt++)
+      {
+        int32_t ix = (int32_t) i - 2 + (int32_t) (cnt / KWS_CH);
+        if(ix >= 0 && ix < KWS_LEN)
+          acc += refIn[ix * KWS_CH + cnt % KWS_CH] * refW[j * KWS_KER * KWS_CH + cnt];
+      }
+      refOut[i * OUT_CH + j] = acc >> 6;
+    }
+  check_q7(outputQ7, conv.dimOutX * OUT_CH);
+
+  /* ------------------------------------------------------------------
+  * 2D convolution, Q15
+  * ------------------------------------------------------------------- */
+  arm_nn_conv_init_q15(&convQ15, IN_DIM_X, IN_DIM_Y, IN_CH, OUT_CH,
+                       KER_DIM, KER_DIM, PAD, PAD, 1, 1, 4, 18,
+                       weightQ15, biasQ15);
+  if(arm_nn_conv_buffer_size_q15(&convQ15) > scratchUsed)
+    scratchUsed = arm_nn_conv_buffer_size_q15(&convQ15);
+
+  arm_nn_conv_HWC_q15(&convQ15, inputQ15, outputQ15, (q15_t *) scratch);
+
+  widen_q15(inputQ15, refIn, IN_DIM_X * IN_DIM_Y * IN_CH);
+  widen_q15(weightQ15, refW, OUT_CH * KER_DIM * KER_DIM * IN_CH);
+  widen_q15(biasQ15, refB, OUT_CH);
+  ref_conv_q31(refIn, refW, refB, IN_DIM_X, IN_DIM_Y, IN_CH, OUT_CH,
+               KER_DIM, KER_DIM, PAD, 1, 4, 18, 0, refOut);
+  check_q15(outputQ15, (uint32_t) convQ15.dimOutX * convQ15.dimOutY * OUT_CH);
+
+  /* ------------------------------------------------------------------
+  * Depthwise convolution, Q7
+  * ------------------------------------------------------------------- */
+  arm_nn_conv_init_q7(&conv, IN_DIM_X, IN_DIM_Y, IN_CH, IN_CH,
+                      KER_DIM, KER_DIM, PAD, PAD, 1, 1, 0, 5, weightQ7, biasQ7);
+
+  if(arm_nn_depthwise_conv_HWC_q7(&conv, inputQ7, outputQ7) != ARM_MATH_SUCCESS)
+    status = ARM_MATH_TEST_FAILURE;
+
+  widen_q7(inputQ7, refIn, IN_DIM_X * IN_DIM_Y * IN_CH);
+  widen_q7(weightQ7, refW, KER_DIM * KER_DIM * IN_CH);
+  widen_q7(biasQ7, refB, IN_CH);
+  ref_conv_q31(refIn, refW, refB, IN_DIM_X, IN_DIM_Y, IN_CH, IN_CH,
+               KER_DIM, KER_DIM, PAD, 1, 0, 5, 1, refOut);
+  check_q7(outputQ7, (uint32_t) conv.dimOutX * conv.dimOutY * IN_CH);
+
+  /* ------------------------------------------------------------------
+  * Fully-connected, Q7 and Q15
+  * ------------------------------------------------------------------- */
+  if(arm_nn_fully_connected_buffer_size_q7(FC_DIM) > scratchUsed)
+    scratchUsed = arm_nn_fully_connected_buffer_size_q7(FC_DIM);
+
+  arm_nn_fully_connected_q7(inputQ7, fcWeightQ7, FC_DIM, FC_ROWS, 3, 8,
+                            biasQ7, outputQ7, (q15_t *) scratch);
+  arm_nn_fully_connected_q15(inputQ15, fcWeightQ15, FC_DIM, FC_ROWS, 1, 17,
+                             biasQ15, outputQ15);
+
+  for (i = 0; i < FC_ROWS; i++)
+  {
+    acc = ((q31_t) biasQ7[i] << 3) + (1 << 7);
+    for (j = 0; j < FC_DIM; j++)
+      acc += (q31_t) inputQ7[j] * fcWeightQ7[i * FC_DIM + j];
+    refOut[i] = acc >> 8;
+  }
+  check_q7(outputQ7, FC_ROWS);
+
+  for (i = 0; i < FC_ROWS; i++)
+  {
+    acc = ((q31_t) biasQ15[i] << 1) + (1 << 16);
+    for (j = 0; j < FC_DIM; j++)
+      acc += (q31_t) inputQ15[j] * fcWeightQ15[i * FC_DIM + j];
+    refOut[i] = acc >> 17;
+  }
+  check_q15(outputQ15, FC_ROWS);
+
+  /* ------------------------------------------------------------------
+  * Pooling, Q7
+  * ------------------------------------------------------------------- */
+  arm_nn_pool_init_q7(&pool, IN_DIM_X, IN_DIM_Y, IN_CH, 3, 3, 1, 1, 2, 2);
+  if(arm_nn_avgpool_buffer_size_q7(&pool) > scratchUsed)
+    scratchUsed = arm_nn_avgpool_buffer_size_q7(&pool);
+
+  arm_nn_maxpool_HWC_q7(&pool, inputQ7, outputQ7);
+  arm_nn_avgpool_HWC_q7(&pool, inputQ7, (q7_t *) refQ7, scratch);
+
+  n = 0;
+  for (i = 0; i < pool.dimOutY; i++)
+    for (j = 0; j < pool.dimOutX; j++)
+      for (cnt = 0; cnt < IN_CH; cnt++, n++)
+      {
+        int32_t kx, ky, ix, iy, count = 0;
+        mx = -128;
+        sum = 0;
+        for (ky = 0; ky < 3; ky++)
+          for (kx = 0; kx < 3; kx++)
+          {
+            iy = (int32_t) (i * 2 + ky) - 1;
+            ix = (int32_t) (j * 2 + kx) - 1;
+            if(iy < 0 || ix < 0 || iy >= IN_DIM_Y || ix >= IN_DIM_X)
+              continue;
+            acc = inputQ7[(iy * IN_DIM_X + ix) * IN_CH + cnt];
+            mx = (acc > mx) ? acc : mx;
+            sum += acc;
+            count++;
+          }
+        if(outputQ7[n] != mx)
+          status = ARM_MATH_TEST_FAILURE;
+        /* Allow one LSB for the rounding of the average */
+        if(fabs((double) refQ7[n] - (double) sum / count) > 0.5 + 1e-9)
+          status = ARM_MATH_TEST_FAILURE;
+      }
+
+  /* ------------------------------------------------------------------
+  * Activations
+  * ------------------------------------------------------------------- */
+  memcpy(outputQ7, inputQ7, FC_DIM);
+  arm_nn_relu_q7(outputQ7, FC_DIM);
+  for (i = 0; i < FC_DIM; i++)
+    if(outputQ7[i] != ((inputQ7[i] < 0) ? 0 : inputQ7[i]))
+      status = ARM_MATH_TEST_FAILURE;
+
+  /* Softmax over ten classes, compared with the exact base-2 softmax */
+  for (i = 0; i < 10; i++)
+    refQ7[i] = (q7_t) (i * 3 - 20);
+  arm_nn_softmax_q7(refQ7, 10, outputQ7);
+  {
+    double den = 0.0;
+    for (i = 0; i < 10; i++)
+      den += pow(2.0, refQ7[i]);
+    for (i = 0; i < 10; i++)
+      if(fabs(outputQ7[i] - 128.0 * pow(2.0, refQ7[i]) / den) > 2.0)
+        status = ARM_MATH_TEST_FAILURE;
+  }
+
+  /* All layers ran from the same arena */
+  if(scratchUsed > sizeof(scratch))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  if( status != ARM_MATH_SUCCESS)
+  {
+    while(1);
+  }
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
@@ -0,0 +1,333 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2012 ARM Limited. All rights reserved.
+*
+* $Date:         17. January 2013
+* $Revision:     V1.4.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_pid_bank_example_f32.c
+*
+* Description:   Runs 12 PID loops at a 20 kHz control rate with the PID
+*                controller bank and compares it with single PID instances.
+*
+* Target Processor: Cortex-M4/Cortex-M3
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup PIDBankExample PID Controller Bank Example
+ *
+ * \par Description:
+ * \par
+ * Simulates the current and speed loops of six motors, 12 loops in total,
+ * each driving a first-order plant, at a 20 kHz control rate as set by the
+ * PWM timer.  The loops are updated by one call to arm_pid_bank_f32() per
+ * period, and also by 12 calls to arm_pid_f32() on separate instances.
+ * \par
+ * The example checks that:
+ * - without output limits, the bank gives exactly the outputs of the single
+ *   instances;
+ * - with output limits, the commands never leave the limits and every loop
+ *   still settles on its setpoint after a step that saturates its command,
+ *   which needs the integrator to stop winding up while saturated;
+ * - the Q31 bank gives exactly the outputs of arm_pid_q31().
+ * \par
+ * The cycles of both floating-point variants are measured over one control
+ * period, and the bank must take less than a tenth of the 8400 cycles of a
+ * 20 kHz period at 168 MHz.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c cyclesBank holds the cycle count of one call to arm_pid_bank_f32()
+ * \li \c cyclesSingle holds the cycle count of the 12 calls to arm_pid_f32()
+ * \li \c loadPercent holds the share of the control period taken by the bank
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_pid_bank_init_f32()
+ * - arm_pid_bank_set_f32()
+ * - arm_pid_bank_reset_f32()
+ * - arm_pid_bank_f32()
+ * - arm_pid_bank_init_q31()
+ * - arm_pid_bank_set_q31()
+ * - arm_pid_bank_q31()
+ * - arm_pid_init_f32()
+ * - arm_pid_f32()
+ * - arm_pid_init_q31()
+ * - arm_pid_q31()
+ * - arm_scale_f32()
+ * - arm_float_to_q31()
+ *
+ * <b> Refer  </b>
+ * \link arm_pid_bank_example_f32.c \endlink
+ *
+ */
+
+
+/** \example arm_pid_bank_example_f32.c
+  */
+
+/* The DWT cycle counter is declared by the device header only: arm_math.h
+   includes the generic part of the core header. Name the device header with
+   CMSIS_device_header, for instance -DCMSIS_device_header="ARMCM4_FP.h" */
+#if defined (CMSIS_device_header)
+#include CMSIS_device_header
+#endif
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define NUM_LOOPS       12
+#define CONTROL_RATE    20000u
+#define CPU_CLOCK       168000000u
+#define NUM_STEPS       2000        /* 100 ms of control */
+#define OUT_LIMIT       2.0f
+#define SETTLE_ERROR    0.02f
+#define Q31_SCALE       0.125f      /* keeps the Q31 outputs below 1.0 */
+#define MAX_LOAD        10.0f       /* percent of the control period */
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+float32_t bankCoeffs[3 * NUM_LOOPS];
+float32_t bankState[3 * NUM_LOOPS];
+float32_t bankLimits[2 * NUM_LOOPS];
+q31_t     bankCoeffsQ31[3 * NUM_LOOPS];
+q31_t     bankStateQ31[3 * NUM_LOOPS];
+q31_t     bankLimitsQ31[2 * NUM_LOOPS];
+
+arm_pid_bank_instance_f32 bank;
+arm_pid_bank_instance_q31 bankQ31;
+arm_pid_instance_f32 single[NUM_LOOPS];
+arm_pid_instance_q31 singleQ31[NUM_LOOPS];
+
+float32_t setpoint[NUM_LOOPS];
+float32_t plant[NUM_LOOPS];          /* plant outputs */
+float32_t plantPole[NUM_LOOPS];      /* plant y[n] = pole * y[n-1] + (1 - pole) * u[n] */
+float32_t error[NUM_LOOPS];
+float32_t outBank[NUM_LOOPS];
+float32_t outSingle[NUM_LOOPS];
+q31_t     errorQ31[NUM_LOOPS];
+q31_t     outBankQ31[NUM_LOOPS];
+
+/* ----------------------------------------------------------------------
+* Results
+* ------------------------------------------------------------------- */
+uint32_t  cyclesBank;
+uint32_t  cyclesSingle;
+float32_t loadPercent;
+
+arm_status status;   /* Status of the example */
+
+/* ----------------------------------------------------------------------
+* Cycle counter
+* ------------------------------------------------------------------- */
+#if defined (DWT_BASE)
+
+static void cycle_counter_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t cycle_count(void)
+{
+  return DWT->CYCCNT;
+}
+
+#else
+
+/* No device header: no cycle is counted */
+static void cycle_counter_init(void)
+{
+}
+
+static uint32_t cycle_count(void)
+{
+  return 0;
+}
+
+#endif
+
+/* ----------------------------------------------------------------------
+* Advances the plants by one control period
+* ------------------------------------------------------------------- */
+static void plant_update(const float32_t * pCommand)
+{
+  uint32_t i;
+
+  for (i = 0; i < NUM_LOOPS; i++)
+  {
+    plant[i] = plantPole[i] * plant[i] + (1.0f - plantPole[i]) * pCommand[i];
+    error[i] = setpoint[i] - plant[i];
+  }
+}
+
+/* ----------------------------------------------------------------------
+* PID controller bank example
+* ------------------------------------------------------------------- */
+int32_t main(void)
+{
+  uint32_t i, n, start, cycles;
+  float32_t Kp, Ki, Kd, peak;
+
+  status = ARM_MATH_SUCCESS;
+
+  cycle_counter_init();
+
+  arm_pid_bank_init_f32(&bank, NUM_LOOPS, bankCoeffs, bankState, bankLimits);
+  arm_pid_bank_init_q31(&bankQ31, NUM_LOOPS, bankCoeffsQ31, bankStateQ31, bankLimitsQ31);
+
+  /* Current loops are fast, speed loops slower */
+  for (i = 0; i < NUM_LOOPS; i++)
+  {
+    Kp = (i & 1u) ? 0.4f : 0.8f;
+    Ki = (i & 1u) ? 0.01f : 0.05f;
+    Kd = (i & 1u) ? 0.02f : 0.0f;
+    plantPole[i] = (i & 1u) ? 0.995f : 0.95f;
+    setpoint[i] = 0.25f + 0.05f * (float32_t) i;
+
+    single[i].Kp = Kp;
+    single[i].Ki = Ki;
+    single[i].Kd = Kd;
+    arm_pid_init_f32(&single[i], 1);
+
+    arm_pid_bank_set_f32(&bank, i, Kp, Ki, Kd, -1.0e30f, 1.0e30f);
+
+    singleQ31[i].Kp = (q31_t) (Kp * 2147483648.0f);
+    singleQ31[i].Ki = (q31_t) (Ki * 2147483648.0f);
+    singleQ31[i].Kd = (q31_t) (Kd * 2147483648.0f);
+    arm_pid_init_q31(&singleQ31[i], 1);
+
+    arm_pid_bank_set_q31(&bankQ31, i, singleQ31[i].Kp, singleQ31[i].Ki,
+                         singleQ31[i].Kd, (q31_t) 0x80000000, 0x7FFFFFFF);
+  }
+
+  /* 1. Without limits the bank and the single instances must agree exactly */
+  arm_fill_f32(0.0f, plant, NUM_LOOPS);
+  plant_update(plant);
+  cyclesBank = 0xFFFFFFFFu;
+  cyclesSingle = 0xFFFFFFFFu;
+
+  for (n = 0; n < NUM_STEPS; n++)
+  {
+    start = cycle_count();
+    arm_pid_bank_f32(&bank, error, outBank);
+    cycles = cycle_count() - start;
+    cyclesBank = (cycles < cyclesBank) ? cycles : cyclesBank;
+
+    start = cycle_count();
+    for (i = 0; i < NUM_LOOPS; i++)
+    {
+      outSingle[i] = arm_pid_f32(&single[i], error[i]);
+    }
+    cycles = cycle_count() - start;
+    cyclesSingle = (cycles < cyclesSingle) ? cycles : cyclesSingle;
+
+    for (i = 0; i < NUM_LOOPS; i++)
+    {
+      if(outBank[i] != outSingle[i])
+      {
+        status = ARM_MATH_TEST_FAILURE;
+      }
+    }
+
+    /* The Q31 bank on the same errors, scaled down to stay in range */
+    arm_scale_f32(error, Q31_SCALE, outSingle, NUM_LOOPS);
+    arm_float_to_q31(outSingle, errorQ31, NUM_LOOPS);
+    arm_pid_bank_q31(&bankQ31, errorQ31, outBankQ31);
+    for (i = 0; i < NUM_LOOPS; i++)
+    {
+      if(outBankQ31[i] != arm_pid_q31(&singleQ31[i], errorQ31[i]))
+      {
+        status = ARM_MATH_TEST_FAILURE;
+      }
+    }
+
+    plant_update(outBank);
+  }
+
+  loadPercent = 100.0f * (float32_t) cyclesBank * CONTROL_RATE / CPU_CLOCK;
+
+  /* 2. With output limits, a large step saturates the commands.  Every loop
+   * must still settle on its setpoint. */
+  arm_pid_bank_reset_f32(&bank);
+  for (i = 0; i < NUM_LOOPS; i++)
+  {
+    arm_pid_bank_set_f32(&bank, i, (i & 1u) ? 0.4f : 0.8f, (i & 1u) ? 0.01f : 0.05f,
+                         (i & 1u) ? 0.02f : 0.0f, -OUT_LIMIT, OUT_LIMIT);
+    setpoint[i] = 1.5f;
+  }
+
+  arm_fill_f32(0.0f, plant, NUM_LOOPS);
+  plant_update(plant);
+
+  for (n = 0; n < 4 * NUM_STEPS; n++)
+  {
+    arm_pid_bank_f32(&bank, error, outBank);
+    for (i = 0; i < NUM_LOOPS; i++)
+    {
+      if((outBank[i] > OUT_LIMIT) || (outBank[i] < -OUT_LIMIT))
+      {
+        status = ARM_MATH_TEST_FAILURE;
+      }
+    }
+    plant_update(outBank);
+  }
+
+  for (i = 0; i < NUM_LOOPS; i++)
+  {
+    peak = error[i] < 0.0f ? -error[i] : error[i];
+    if(peak > SETTLE_ERROR * setpoint[i])
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  /* The bank must fit easily in the control period */
+  if(loadPercent > MAX_LOAD)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  if( status != ARM_MATH_SUCCESS)
+  {
+    while(1);
+  }
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
@@ -0,0 +1,309 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2012 ARM Limited. All rights reserved.
+*
+* $Date:         17. January 2013
+* $Revision:     V1.4.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_planner_example.c
+*
+* Description:   Selects the fastest convolution and complex FFT variants with
+*                the kernel planner, then makes the same plans again from the
+*                recorded wisdom.
+*
+* Target Processor: Cortex-M4/Cortex-M3
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup PlannerExample Kernel Planner Example
+ *
+ * \par Description:
+ * \par
+ * Makes plans for three Q15 convolutions and three floating-point complex
+ * FFTs of different sizes.  The first time, the planner has a cycle counter
+ * and an empty wisdom table: it runs every candidate variant on the buffers,
+ * keeps the fastest one and records it.  The second time, the planner has no
+ * cycle counter but is given the wisdom recorded the first time, as it would
+ * be after a restart with the table saved in flash, and must make the same
+ * choices without measuring anything.
+ * \par
+ * The example checks that:
+ * - the planned convolutions give exactly the output of arm_conv_q15(); the
+ *   fast variants are allowed, and the inputs are small enough for their
+ *   32-bit accumulator never to overflow;
+ * - the planned FFTs give the output of arm_cfft_f32() to within
+ *   <code>FFT_TOLERANCE</code>;
+ * - the second round selects the same variants and adds no wisdom entry.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c wisdom holds the entries recorded by the planner, with the cycles of
+ * the selected variants
+ * \li \c numWisdom holds the number of entries recorded
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_planner_init()
+ * - arm_conv_plan_init_q15()
+ * - arm_conv_plan_q15()
+ * - arm_conv_q15()
+ * - arm_cfft_plan_init_f32()
+ * - arm_cfft_plan_f32()
+ * - arm_cfft_f32()
+ *
+ * <b> Refer  </b>
+ * \link arm_planner_example.c \endlink
+ *
+ */
+
+
+/** \example arm_planner_example.c
+  */
+
+/* The DWT cycle counter is declared by the device header only: arm_math.h
+   includes the generic part of the core header. Name the device header with
+   CMSIS_device_header, for instance -DCMSIS_device_header="ARMCM4_FP.h" */
+#if defined (CMSIS_device_header)
+#include CMSIS_device_header
+#endif
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define NUM_CONV        3
+#define NUM_FFT         3
+#define MAX_SRCA_LEN    1024
+#define MAX_SRCB_LEN    64
+#define MAX_FFT_LEN     1024
+#define MAX_WISDOM      16
+#define INPUT_SHIFT     4           /* keeps the fast accumulators from overflowing */
+#define FFT_TOLERANCE   1.0e-4f     /* relative to the largest output */
+
+const uint32_t convLen[NUM_CONV][2] = { { 64, 16 }, { 256, 32 }, { 1024, 64 } };
+const uint16_t fftLen[NUM_FFT] = { 64, 256, 1024 };
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+q15_t     srcA[MAX_SRCA_LEN];
+q15_t     srcB[MAX_SRCB_LEN];
+q15_t     dstPlan[MAX_SRCA_LEN + MAX_SRCB_LEN - 1];
+q15_t     dstRef[MAX_SRCA_LEN + MAX_SRCB_LEN - 1];
+q15_t     scratch1[MAX_SRCA_LEN + 2 * MAX_SRCB_LEN - 2];
+q15_t     scratch2[MAX_SRCB_LEN];
+float32_t fftPlan[2 * MAX_FFT_LEN];
+float32_t fftRef[2 * MAX_FFT_LEN];
+
+arm_planner_instance planner;
+arm_conv_plan_instance_q15 convPlan[NUM_CONV];
+arm_cfft_plan_instance_f32 fftPlanInst[NUM_FFT];
+
+/* ----------------------------------------------------------------------
+* Results
+* ------------------------------------------------------------------- */
+arm_plan_wisdom_entry wisdom[MAX_WISDOM];
+uint16_t numWisdom;
+
+arm_status status;   /* Status of the example */
+
+/* ----------------------------------------------------------------------
+* Cycle counter
+* ------------------------------------------------------------------- */
+#if defined (DWT_BASE)
+
+static void cycle_counter_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t cycle_count(void)
+{
+  return DWT->CYCCNT;
+}
+
+#else
+
+/* No device header: no cycle is counted */
+static void cycle_counter_init(void)
+{
+}
+
+static uint32_t cycle_count(void)
+{
+  return 0;
+}
+
+#endif
+
+/* ----------------------------------------------------------------------
+* Plans all the kernels, checks their outputs and returns the selected
+* variants in pVariants
+* ------------------------------------------------------------------- */
+static arm_status plan_and_check(arm_planner_instance * P, uint8_t * pVariants)
+{
+  uint32_t i, n, lenA, lenB;
+  uint32_t seed = 1u;
+  float32_t peak, diff;
+
+  for (i = 0; i < NUM_CONV; i++)
+  {
+    lenA = convLen[i][0];
+    lenB = convLen[i][1];
+
+    if(arm_conv_plan_init_q15(P, &convPlan[i], srcA, lenA, srcB, lenB, dstPlan,
+                              scratch1, scratch2, ARM_PLAN_ALLOW_FAST,
+                              ARM_PLAN_REGION(dstPlan)) != ARM_MATH_SUCCESS)
+    {
+      return (ARM_MATH_TEST_FAILURE);
+    }
+    pVariants[i] = (uint8_t) convPlan[i].variant;
+
+    arm_conv_plan_q15(&convPlan[i], srcA, srcB, dstPlan);
+    arm_conv_q15(srcA, lenA, srcB, lenB, dstRef);
+
+    for (n = 0; n < lenA + lenB - 1; n++)
+    {
+      if(dstPlan[n] != dstRef[n])
+      {
+        return (ARM_MATH_TEST_FAILURE);
+      }
+    }
+  }
+
+  for (i = 0; i < NUM_FFT; i++)
+  {
+    if(arm_cfft_plan_init_f32(P, &fftPlanInst[i], fftLen[i], 0, 1, fftPlan, 0,
+                              ARM_PLAN_REGION(fftPlan)) != ARM_MATH_SUCCESS)
+    {
+      return (ARM_MATH_TEST_FAILURE);
+    }
+    pVariants[NUM_CONV + i] = (uint8_t) fftPlanInst[i].variant;
+
+    /* The planner may have cleared the buffer, so fill it afterwards */
+    for (n = 0; n < 2u * fftLen[i]; n++)
+    {
+      seed = seed * 1664525u + 1013904223u;
+      fftPlan[n] = (float32_t) (int32_t) seed / 2147483648.0f;
+      fftRef[n] = fftPlan[n];
+    }
+
+    arm_cfft_plan_f32(&fftPlanInst[i], fftPlan);
+    arm_cfft_f32(fftPlanInst[i].pCfft, fftRef, 0, 1);
+
+    peak = 0.0f;
+    diff = 0.0f;
+    for (n = 0; n < 2u * fftLen[i]; n++)
+    {
+      peak = (fabsf(fftRef[n]) > peak) ? fabsf(fftRef[n]) : peak;
+      diff = (fabsf(fftPlan[n] - fftRef[n]) > diff) ? fabsf(fftPlan[n] - fftRef[n]) : diff;
+    }
+
+    if(diff > FFT_TOLERANCE * peak)
+    {
+      return (ARM_MATH_TEST_FAILURE);
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/* ----------------------------------------------------------------------
+* Kernel planner example
+* ------------------------------------------------------------------- */
+int32_t main(void)
+{
+  uint8_t measured[NUM_CONV + NUM_FFT];
+  uint8_t replayed[NUM_CONV + NUM_FFT];
+  uint32_t i, seed = 12345u;
+
+  status = ARM_MATH_SUCCESS;
+
+  cycle_counter_init();
+
+  /* Inputs small enough for the fast convolutions to be exact */
+  for (i = 0; i < MAX_SRCA_LEN; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    srcA[i] = (q15_t) ((int32_t) seed >> (16 + INPUT_SHIFT));
+  }
+
+  for (i = 0; i < MAX_SRCB_LEN; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    srcB[i] = (q15_t) ((int32_t) seed >> (16 + INPUT_SHIFT));
+  }
+
+  /* First round: measure every candidate and record the wisdom */
+  arm_planner_init(&planner, cycle_count, wisdom, 0, MAX_WISDOM);
+  status = plan_and_check(&planner, measured);
+  numWisdom = planner.numEntries;
+
+  if(numWisdom != NUM_CONV + NUM_FFT)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  /* Second round: no timer, only the wisdom of the first round */
+  if(status == ARM_MATH_SUCCESS)
+  {
+    arm_planner_init(&planner, NULL, wisdom, numWisdom, MAX_WISDOM);
+    status = plan_and_check(&planner, replayed);
+
+    for (i = 0; i < NUM_CONV + NUM_FFT; i++)
+    {
+      if(replayed[i] != measured[i])
+      {
+        status = ARM_MATH_TEST_FAILURE;
+      }
+    }
+
+    if(planner.numEntries != numWisdom)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  if( status != ARM_MATH_SUCCESS)
+  {
+    while(1);
+  }
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
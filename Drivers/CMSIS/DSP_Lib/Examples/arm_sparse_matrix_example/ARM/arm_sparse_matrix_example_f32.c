@@ -0,0 +1,333 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2012 ARM Limited. All rights reserved.
+*
+* $Date:         17. January 2013
+* $Revision:     V1.4.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_sparse_matrix_example_f32.c
+*
+* Description:   Compares the CSR sparse matrix-vector product with the dense
+*                matrix multiplication on a sparse 512 x 512 matrix.
+*
+* Target Processor: Cortex-M4/Cortex-M3
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup SparseMatrixExample Sparse Matrix Example
+ *
+ * \par Description:
+ * \par
+ * Builds the CSR form of a 512 x 512 matrix with 11 non-zero values per row
+ * (about 2% fill), as found in the Jacobian of a small state estimator or the
+ * adjacency matrix of a sensor network, and multiplies it with a vector.
+ * \par
+ * The dense form of the whole matrix needs 1 MB, more than the SRAM of the
+ * device, so the dense reference is computed on a slab of the first
+ * <code>DENSE_ROWS</code> rows only.  The slab is converted with
+ * arm_mat_csr_from_dense_f32() and its product is compared with the first
+ * rows of the sparse product.  The cycle count of arm_mat_mult_f32() on the
+ * slab is scaled up to the full matrix for the comparison.
+ * \par
+ * The same arrays also describe the transpose in CSC form.  Its transposed
+ * product must give the original product again, and the transposed product
+ * of the CSR form is checked with the identity x' * (A * x) = (A' * x)' * x.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c cyclesSparse holds the DWT cycle count of the full sparse product
+ * \li \c cyclesDense holds the cycle count of the dense product, scaled to 512 rows
+ * \li \c bytesSparse and \c bytesDense hold the storage needed by both forms
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_mat_csr_init_f32()
+ * - arm_mat_csc_init_f32()
+ * - arm_mat_csr_from_dense_f32()
+ * - arm_mat_csr_vec_mult_f32()
+ * - arm_mat_csr_trans_vec_mult_f32()
+ * - arm_mat_csc_trans_vec_mult_f32()
+ * - arm_dot_prod_f32()
+ * - arm_mat_init_f32()
+ * - arm_mat_mult_f32()
+ *
+ * <b> Refer  </b>
+ * \link arm_sparse_matrix_example_f32.c \endlink
+ *
+ */
+
+
+/** \example arm_sparse_matrix_example_f32.c
+  */
+
+/* The DWT cycle counter is declared by the device header only: arm_math.h
+   includes the generic part of the core header. Name the device header with
+   CMSIS_device_header, for instance -DCMSIS_device_header="ARMCM4_FP.h" */
+#if defined (CMSIS_device_header)
+#include CMSIS_device_header
+#endif
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define NUM_NODES       512
+#define NNZ_PER_ROW     11
+#define NNZ             (NUM_NODES * NNZ_PER_ROW)
+#define DENSE_ROWS      16
+#define DELTA           1.0e-4f
+
+/* Column offsets of the non-zero values of each row, modulo NUM_NODES */
+const int16_t colOffset[NNZ_PER_ROW] = { -64, -17, -8, -2, -1, 0, 1, 2, 8, 17, 64 };
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+float32_t spData[NNZ];
+uint16_t  spColIdx[NNZ];
+uint32_t  spRowPtr[NUM_NODES + 1];
+
+float32_t denseData[DENSE_ROWS * NUM_NODES];
+float32_t slabData[DENSE_ROWS * NNZ_PER_ROW];
+uint16_t  slabColIdx[DENSE_ROWS * NNZ_PER_ROW];
+uint32_t  slabRowPtr[DENSE_ROWS + 1];
+
+float32_t x[NUM_NODES];
+float32_t y[NUM_NODES];
+float32_t yt[NUM_NODES];
+float32_t yDense[DENSE_ROWS];
+float32_t ySlab[DENSE_ROWS];
+
+/* ----------------------------------------------------------------------
+* Results
+* ------------------------------------------------------------------- */
+uint32_t cyclesSparse;
+uint32_t cyclesDense;
+uint32_t bytesSparse;
+uint32_t bytesDense;
+
+arm_status status;   /* Status of the example */
+
+/* ----------------------------------------------------------------------
+* Cycle counter
+* ------------------------------------------------------------------- */
+#if defined (DWT_BASE)
+
+static void cycle_counter_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t cycle_count(void)
+{
+  return DWT->CYCCNT;
+}
+
+#else
+
+/* No device header: no cycle is counted */
+static void cycle_counter_init(void)
+{
+}
+
+static uint32_t cycle_count(void)
+{
+  return 0;
+}
+
+#endif
+
+/* ----------------------------------------------------------------------
+* Value of the element (row, col), when it is one of the non-zero values
+* ------------------------------------------------------------------- */
+static float32_t element(uint32_t row, uint32_t k)
+{
+  return (k == (NNZ_PER_ROW / 2)) ? 4.0f :
+    -0.25f + 0.01f * (float32_t) ((row * 7u + k * 3u) % 11u);
+}
+
+/* ----------------------------------------------------------------------
+* Column of the k-th non-zero value of a row
+* ------------------------------------------------------------------- */
+static uint32_t column(uint32_t row, uint32_t k)
+{
+  return (row + NUM_NODES + colOffset[k]) % NUM_NODES;
+}
+
+/* ----------------------------------------------------------------------
+* Checks that two vectors agree within DELTA
+* ------------------------------------------------------------------- */
+static void check(const float32_t * a, const float32_t * b, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    if(fabsf(a[i] - b[i]) > DELTA)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Sparse matrix example
+* ------------------------------------------------------------------- */
+int32_t main(void)
+{
+  arm_matrix_csr_instance_f32 A;     /* sparse matrix */
+  arm_matrix_csc_instance_f32 AT;    /* its transpose, sharing the arrays */
+  arm_matrix_csr_instance_f32 slab;  /* sparse form of the dense slab */
+  arm_matrix_instance_f32 dense;     /* dense slab of the first rows */
+  arm_matrix_instance_f32 vec;       /* input vector as a matrix */
+  arm_matrix_instance_f32 out;       /* dense product as a matrix */
+  float32_t dot, dotRef;             /* both sides of the transpose identity */
+  uint32_t row, k, n, start;
+
+  status = ARM_MATH_SUCCESS;
+
+  cycle_counter_init();
+
+  /* Build the CSR arrays row by row, the columns of each row in order */
+  n = 0;
+  for (row = 0; row < NUM_NODES; row++)
+  {
+    spRowPtr[row] = n;
+    for (k = 0; k < NNZ_PER_ROW; k++)
+    {
+      spColIdx[n + k] = (uint16_t) column(row, k);
+      spData[n + k] = element(row, k);
+    }
+
+    /* Insertion sort, the wrapped columns come out of order */
+    for (k = 1; k < NNZ_PER_ROW; k++)
+    {
+      uint32_t j = n + k;
+      while((j > n) && (spColIdx[j - 1] > spColIdx[j]))
+      {
+        uint16_t c = spColIdx[j];
+        float32_t v = spData[j];
+        spColIdx[j] = spColIdx[j - 1];
+        spData[j] = spData[j - 1];
+        spColIdx[j - 1] = c;
+        spData[j - 1] = v;
+        j--;
+      }
+    }
+    n += NNZ_PER_ROW;
+  }
+  spRowPtr[NUM_NODES] = n;
+
+  arm_mat_csr_init_f32(&A, NUM_NODES, NUM_NODES, NNZ, spData, spColIdx, spRowPtr);
+  arm_mat_csc_init_f32(&AT, NUM_NODES, NUM_NODES, NNZ, spData, spColIdx, spRowPtr);
+
+  for (n = 0; n < NUM_NODES; n++)
+  {
+    x[n] = arm_sin_f32(0.05f * (float32_t) n);
+  }
+
+  /* Sparse product over the whole matrix */
+  start = cycle_count();
+  arm_mat_csr_vec_mult_f32(&A, x, y);
+  cyclesSparse = cycle_count() - start;
+
+  /* Dense slab of the first rows, converted back to CSR */
+  arm_fill_f32(0.0f, denseData, DENSE_ROWS * NUM_NODES);
+  for (row = 0; row < DENSE_ROWS; row++)
+  {
+    for (k = 0; k < NNZ_PER_ROW; k++)
+    {
+      denseData[row * NUM_NODES + column(row, k)] = element(row, k);
+    }
+  }
+
+  arm_mat_init_f32(&dense, DENSE_ROWS, NUM_NODES, denseData);
+  arm_mat_init_f32(&vec, NUM_NODES, 1, x);
+  arm_mat_init_f32(&out, DENSE_ROWS, 1, yDense);
+
+  start = cycle_count();
+  if(arm_mat_mult_f32(&dense, &vec, &out) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  cyclesDense = (cycle_count() - start) * (NUM_NODES / DENSE_ROWS);
+
+  arm_mat_csr_init_f32(&slab, DENSE_ROWS, NUM_NODES, 0, slabData, slabColIdx, slabRowPtr);
+  if((arm_mat_csr_from_dense_f32(&dense, &slab, DENSE_ROWS * NNZ_PER_ROW) != ARM_MATH_SUCCESS) ||
+     (slab.nnz != DENSE_ROWS * NNZ_PER_ROW))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  arm_mat_csr_vec_mult_f32(&slab, x, ySlab);
+
+  check(yDense, y, DENSE_ROWS);
+  check(ySlab, y, DENSE_ROWS);
+
+  /* The CSC form of the transpose holds the same matrix: its transposed    
+   * product is A * x again */
+  arm_mat_csc_trans_vec_mult_f32(&AT, x, yt);
+  check(yt, y, NUM_NODES);
+
+  /* Transposed product, checked with the identity x' * (A * x) = (A' * x)' * x */
+  arm_mat_csr_trans_vec_mult_f32(&A, x, yt);
+  arm_dot_prod_f32(x, y, NUM_NODES, &dotRef);
+  arm_dot_prod_f32(yt, x, NUM_NODES, &dot);
+  if(fabsf(dot - dotRef) > DELTA * fabsf(dotRef))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  bytesDense = NUM_NODES * NUM_NODES * sizeof(float32_t);
+  bytesSparse = NNZ * (sizeof(float32_t) + sizeof(uint16_t)) +
+    (NUM_NODES + 1) * sizeof(uint32_t);
+
+  /* The sparse product must be the faster one */
+#if defined (DWT_BASE)
+  if(cyclesSparse >= cyclesDense)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+#endif
+
+  if( status != ARM_MATH_SUCCESS)
+  {
+    while(1);
+  }
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
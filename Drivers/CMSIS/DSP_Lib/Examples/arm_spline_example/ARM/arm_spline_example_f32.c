@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2012 ARM Limited. All rights reserved.
+*
+* $Date:         17. January 2013
+* $Revision:     V1.4.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_spline_example_f32.c
+*
+* Description:   Linearises a thermistor with a cubic spline.
+*
+* Target Processor: Cortex-M4/Cortex-M3
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup SplineExample Cubic Spline Sensor Linearisation Example
+ *
+ * \par Description:
+ * \par
+ * Converts the ADC reading of an NTC thermistor divider to a temperature.
+ * The calibration table holds eleven points measured at irregular ADC codes,
+ * denser where the curve bends the most.  A natural cubic spline through the
+ * points is compared with piecewise-linear interpolation of an evenly spaced
+ * table of the same size, over every ADC code, against the B-parameter model
+ * used to generate the calibration.
+ * \par
+ * The whole ADC range is converted with one call to each block function.
+ * Since the codes are increasing, both functions find their segment with the
+ * monotonic fast path.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c calCode      ADC codes of the calibration points
+ * \li \c calTemp      temperatures of the calibration points
+ * \li \c maxErrSpline largest error of the spline, in degrees Celsius
+ * \li \c maxErrLinear largest error of the linear table, in degrees Celsius
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_spline_init_f32()
+ * - arm_spline_f32()
+ * - arm_linear_interp_block_f32()
+ *
+ * <b> Refer  </b>
+ * \link arm_spline_example_f32.c \endlink
+ *
+ */
+
+
+/** \example arm_spline_example_f32.c
+  */
+
+#include <math.h>
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+* Sensor model: 10k NTC (B = 3950) to ground, 10k pull-up, 12-bit ADC
+* ------------------------------------------------------------------- */
+#define NUM_CAL         11
+#define CODE_MIN        400
+#define CODE_MAX        3700
+#define NUM_CODES       (CODE_MAX - CODE_MIN + 1)
+#define MAX_ERR_SPLINE  0.5f
+
+static float32_t ntc_temperature(float32_t code)
+{
+  float32_t r = 10000.0f * code / (4096.0f - code);
+
+  return 1.0f / (1.0f / 298.15f + logf(r / 10000.0f) / 3950.0f) - 273.15f;
+}
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+float32_t calCode[NUM_CAL] =
+{
+  400.0f, 600.0f, 850.0f, 1150.0f, 1500.0f, 1900.0f,
+  2300.0f, 2700.0f, 3100.0f, 3450.0f, 3700.0f
+};
+float32_t calTemp[NUM_CAL];
+float32_t splineCoeffs[3 * (NUM_CAL - 1)];
+float32_t splineTemp[2 * NUM_CAL];
+float32_t linTable[NUM_CAL];
+
+float32_t adcCodes[NUM_CODES];
+float32_t tempSpline[NUM_CODES];
+float32_t tempLinear[NUM_CODES];
+
+float32_t maxErrSpline;
+float32_t maxErrLinear;
+
+arm_status status;   /* Status of the example */
+
+int32_t main(void)
+{
+  uint32_t i;
+  float32_t ref, err;
+  arm_spline_instance_f32 S;
+  arm_linear_interp_instance_f32 L;
+
+  /* Calibration points and an evenly spaced table of the same size */
+  for (i = 0; i < NUM_CAL; i++)
+  {
+    calTemp[i] = ntc_temperature(calCode[i]);
+    linTable[i] = ntc_temperature(CODE_MIN + i * (float32_t) (CODE_MAX - CODE_MIN) / (NUM_CAL - 1));
+  }
+
+  L.nValues = NUM_CAL;
+  L.x1 = CODE_MIN;
+  L.xSpacing = (float32_t) (CODE_MAX - CODE_MIN) / (NUM_CAL - 1);
+  L.pYData = linTable;
+
+  status = arm_spline_init_f32(&S, ARM_SPLINE_NATURAL, calCode, calTemp, NUM_CAL,
+                               0.0f, 0.0f, splineCoeffs, splineTemp);
+
+  /* Convert every ADC code in the calibrated range */
+  for (i = 0; i < NUM_CODES; i++)
+  {
+    adcCodes[i] = (float32_t) (CODE_MIN + i);
+  }
+
+  arm_spline_f32(&S, adcCodes, tempSpline, NUM_CODES);
+  arm_linear_interp_block_f32(&L, adcCodes, tempLinear, NUM_CODES);
+
+  maxErrSpline = 0.0f;
+  maxErrLinear = 0.0f;
+
+  for (i = 0; i < NUM_CODES; i++)
+  {
+    ref = ntc_temperature(adcCodes[i]);
+
+    err = fabsf(tempSpline[i] - ref);
+    maxErrSpline = (err > maxErrSpline) ? err : maxErrSpline;
+
+    err = fabsf(tempLinear[i] - ref);
+    maxErrLinear = (err > maxErrLinear) ? err : maxErrLinear;
+  }
+
+  if((maxErrSpline > MAX_ERR_SPLINE) || (maxErrSpline > maxErrLinear))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  if( status != ARM_MATH_SUCCESS)
+  {
+    while(1);
+  }
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_pid_bank_init_q31.c    
+*    
+* Description:	Q31 PID controller bank initialization functions.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup PIDBank    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q31 PID controller bank.    
+ * @param[in,out] *S        points to an instance of the Q31 PID bank structure.    
+ * @param[in]     numLoops  number of control loops.    
+ * @param[in]     *pCoeffs  points to the gain buffer of 3*numLoops values.    
+ * @param[in]     *pState   points to the state buffer of 3*numLoops values.    
+ * @param[in]     *pLimits  points to the limit buffer of 2*numLoops values.    
+ * @return none.    
+ *    
+ * \par Description:    
+ * All the gains and states are set to zero and the limits to the full range    
+ * of the data type.  The gains and limits of each loop are then set with    
+ * arm_pid_bank_set_q31().    
+ */
+
+void arm_pid_bank_init_q31(
+  arm_pid_bank_instance_q31 * S,
+  uint16_t numLoops,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pLimits)
+{
+  uint32_t i;                                    /* loop counter */
+
+  /* Assign the number of loops and the buffers */
+  S->numLoops = numLoops;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pLimits = pLimits;
+
+  /* Clear the gains and the state */
+  memset(pCoeffs, 0, 3u * numLoops * sizeof(q31_t));
+  memset(pState, 0, 3u * numLoops * sizeof(q31_t));
+
+  /* No output limit */
+  for (i = 0u; i < numLoops; i++)
+  {
+    S->pLimits[i] = (q31_t) 0x80000000;
+    S->pLimits[numLoops + i] = 0x7FFFFFFF;
+  }
+}
+
+/**    
+ * @brief  Sets the gains and output limits of one loop of the Q31 PID controller bank.    
+ * @param[in,out] *S        points to an instance of the Q31 PID bank structure.    
+ * @param[in]     loop      index of the loop.    
+ * @param[in]     Kp        proportional gain.    
+ * @param[in]     Ki        integral gain.    
+ * @param[in]     Kd        derivative gain.    
+ * @param[in]     outMin    lowest output value.    
+ * @param[in]     outMax    highest output value.    
+ * @return none.    
+ *    
+ * \par Description:    
+ * The state of the loop is kept, so the gains can be scheduled while the    
+ * loop runs.    
+ */
+
+void arm_pid_bank_set_q31(
+  arm_pid_bank_instance_q31 * S,
+  uint16_t loop,
+  q31_t Kp,
+  q31_t Ki,
+  q31_t Kd,
+  q31_t outMin,
+  q31_t outMax)
+{
+  uint32_t numLoops = S->numLoops;               /* number of loops */
+
+  /* Derived gains, saturated as in arm_pid_init_q31() */
+  S->pCoeffs[loop] = clip_q63_to_q31((q63_t) clip_q63_to_q31((q63_t) Kp + Ki) + Kd);
+  S->pCoeffs[numLoops + loop] = -clip_q63_to_q31((q63_t) clip_q63_to_q31((q63_t) Kd + Kd) + Kp);
+  S->pCoeffs[(2u * numLoops) + loop] = Kd;
+
+  /* Output limits */
+  S->pLimits[loop] = outMin;
+  S->pLimits[numLoops + loop] = outMax;
+}
+
+/**    
+ * @brief  Reset function for the Q31 PID controller bank.    
+ * @param[in,out] *S points to an instance of the Q31 PID bank structure.    
+ * @return none.    
+ * \par Description:    
+ * The function resets the states of all the loops to zeros.    
+ */
+
+void arm_pid_bank_reset_q31(
+  arm_pid_bank_instance_q31 * S)
+{
+  /* Clear the state buffer.  The size is always 3*numLoops samples */
+  memset(S->pState, 0, 3u * S->numLoops * sizeof(q31_t));
+}
+
+/**    
+ * @} end of PIDBank group    
+ */
@@ -0,0 +1,226 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_pid_bank_q31.c    
+*    
+* Description:	Q31 PID controller bank processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup PIDBank    
+ * @{    
+ */
+
+/**    
+ * @brief  Processing function for the Q31 PID controller bank.    
+ * @param[in,out] *S    points to an instance of the Q31 PID bank structure.    
+ * @param[in]     *pIn  points to the errors of the numLoops loops.    
+ * @param[out]    *pOut points to the outputs of the numLoops loops.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The three products of each loop are accumulated in a 64-bit accumulator in    
+ * 2.62 format, which is shifted to 1.31 format and added to    
+ * <code>y[n-1]</code>.  Unlike arm_pid_q31(), the sum saturates instead of    
+ * wrapping around, before it is clamped to the limits of the loop.    
+ *    
+ * \par    
+ * With the limits left at the full range of the data type, the outputs are    
+ * the same as those of arm_pid_q31() called once per loop, as long as arm_pid_q31() does not overflow.    
+ */
+
+void arm_pid_bank_q31(
+  arm_pid_bank_instance_q31 * S,
+  const q31_t * pIn,
+  q31_t * pOut)
+{
+  uint32_t numLoops = S->numLoops;               /* number of loops */
+  const q31_t *pA0 = S->pCoeffs;                 /* gains A0 */
+  const q31_t *pA1 = pA0 + numLoops;             /* gains A1 */
+  const q31_t *pA2 = pA1 + numLoops;             /* gains A2 */
+  q31_t *pX1 = S->pState;                        /* states x[n-1] */
+  q31_t *pX2 = pX1 + numLoops;                   /* states x[n-2] */
+  q31_t *pY1 = pX2 + numLoops;                   /* states y[n-1] */
+  const q31_t *pMin = S->pLimits;                /* lower output limits */
+  const q31_t *pMax = pMin + numLoops;           /* upper output limits */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t in0, in1, out0, out1;                    /* errors and outputs of two loops */
+  q63_t acc0, acc1;                              /* accumulators */
+
+  /* Two loops are updated per iteration, which keeps the multiplier busy    
+   * while the loads of the other loop complete. */
+  blkCnt = numLoops >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    in0 = pIn[0];
+    in1 = pIn[1];
+
+    /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] in 2.62 format */
+    acc0 = (q63_t) pA0[0] * in0;
+    acc0 += (q63_t) pA1[0] * pX1[0];
+    acc0 += (q63_t) pA2[0] * pX2[0];
+
+    /* y[n] = y[n-1] + acc, saturated to 1.31 format */
+    out0 = clip_q63_to_q31((acc0 >> 31) + pY1[0]);
+
+    /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] in 2.62 format */
+    acc1 = (q63_t) pA0[1] * in1;
+    acc1 += (q63_t) pA1[1] * pX1[1];
+    acc1 += (q63_t) pA2[1] * pX2[1];
+
+    /* y[n] = y[n-1] + acc, saturated to 1.31 format */
+    out1 = clip_q63_to_q31((acc1 >> 31) + pY1[1]);
+
+    /* Output saturation, which is also the anti-windup clamp */
+    if(out0 < pMin[0])
+    {
+      out0 = pMin[0];
+    }
+    else if(out0 > pMax[0])
+    {
+      out0 = pMax[0];
+    }
+
+    /* Output saturation, which is also the anti-windup clamp */
+    if(out1 < pMin[1])
+    {
+      out1 = pMin[1];
+    }
+    else if(out1 > pMax[1])
+    {
+      out1 = pMax[1];
+    }
+
+    /* Update state */
+    pX2[0] = pX1[0];
+    pX1[0] = in0;
+    pY1[0] = out0;
+
+    /* Update state */
+    pX2[1] = pX1[1];
+    pX1[1] = in1;
+    pY1[1] = out1;
+
+    pOut[0] = out0;
+    pOut[1] = out1;
+
+    pIn += 2u;
+    pOut += 2u;
+    pA0 += 2u;
+    pA1 += 2u;
+    pA2 += 2u;
+    pX1 += 2u;
+    pX2 += 2u;
+    pY1 += 2u;
+    pMin += 2u;
+    pMax += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If numLoops is odd, update the last loop here */
+  blkCnt = numLoops & 0x1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q31_t in0, out0;                               /* error and output of one loop */
+  q63_t acc0;                                    /* accumulator */
+
+  blkCnt = numLoops;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    in0 = *pIn++;
+
+    /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] in 2.62 format */
+    acc0 = (q63_t) pA0[0] * in0;
+    acc0 += (q63_t) pA1[0] * pX1[0];
+    acc0 += (q63_t) pA2[0] * pX2[0];
+
+    /* y[n] = y[n-1] + acc, saturated to 1.31 format */
+    out0 = clip_q63_to_q31((acc0 >> 31) + pY1[0]);
+
+    /* Output saturation, which is also the anti-windup clamp */
+    if(out0 < pMin[0])
+    {
+      out0 = pMin[0];
+    }
+    else if(out0 > pMax[0])
+    {
+      out0 = pMax[0];
+    }
+
+    /* Update state */
+    pX2[0] = pX1[0];
+    pX1[0] = in0;
+    pY1[0] = out0;
+
+    *pOut++ = out0;
+
+    pA0++;
+    pA1++;
+    pA2++;
+    pX1++;
+    pX2++;
+    pY1++;
+    pMin++;
+    pMax++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of PIDBank group    
+ */
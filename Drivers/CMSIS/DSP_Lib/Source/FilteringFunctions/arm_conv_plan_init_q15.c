@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_conv_plan_init_q15.c    
+*    
+* Description:	Selection of the fastest Q15 convolution variant.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup Conv    
+ * @{    
+ */
+
+/**    
+ * @brief  Selects the fastest Q15 convolution variant for a pair of lengths and buffers.    
+ * @param[in,out] *P          points to an instance of the planner, or NULL to use the default variant.    
+ * @param[out]    *S          points to an instance of the planned convolution.    
+ * @param[in]     *pSrcA      points to the first input sequence.    
+ * @param[in]     srcALen     length of the first input sequence.    
+ * @param[in]     *pSrcB      points to the second input sequence.    
+ * @param[in]     srcBLen     length of the second input sequence.    
+ * @param[out]    *pDst       points to the output buffer of length srcALen+srcBLen-1.    
+ * @param[in]     *pScratch1  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2, or NULL.    
+ * @param[in]     *pScratch2  points to scratch buffer of size min(srcALen, srcBLen), or NULL.    
+ * @param[in]     flags       ARM_PLAN_ALLOW_FAST to consider the fast variants, ARM_PLAN_MEASURE to ignore the stored wisdom.    
+ * @param[in]     region      memory region tag of the buffers, see ARM_PLAN_REGION().    
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a length is 0.    
+ *    
+ * \par Description:    
+ * \par    
+ * The candidates are arm_conv_q15(), and arm_conv_opt_q15() when both    
+ * scratch buffers are given.  With <code>ARM_PLAN_ALLOW_FAST</code>,    
+ * arm_conv_fast_q15() and arm_conv_fast_opt_q15() are candidates too; they    
+ * use a 32-bit accumulator and so may give different results when the    
+ * intermediate sums overflow, see their description.  The variant is taken    
+ * from the wisdom of the planner if possible, otherwise measured with its    
+ * timer, otherwise the optimized variants are preferred, and the fast ones    
+ * when allowed.  See the \ref Planner "Kernel Planner" for the details.    
+ * \par    
+ * When the candidates are measured, each of them writes <code>pDst</code>;    
+ * the input sequences are left unchanged.    
+ */
+
+arm_status arm_conv_plan_init_q15(
+  arm_planner_instance * P,
+  arm_conv_plan_instance_q15 * S,
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch1,
+  q15_t * pScratch2,
+  uint8_t flags,
+  uint8_t region)
+{
+  const arm_plan_wisdom_entry *pWisdom = NULL;   /* Stored choice */
+  arm_plan_wisdom_entry entry;                   /* New choice */
+  uint32_t candidates;                           /* Bit mask of the candidate variants */
+  uint32_t variant;                              /* Variant under test */
+  uint32_t run, start, cycles, elapsed;          /* Measurement */
+
+  if((srcALen == 0u) || (srcBLen == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Initialise the parameters of the convolution */
+  S->srcALen = srcALen;
+  S->srcBLen = srcBLen;
+  S->pScratch1 = pScratch1;
+  S->pScratch2 = pScratch2;
+
+  /* Candidate variants */
+  candidates = (1u << ARM_CONV_VARIANT_Q15);
+
+  if((flags & ARM_PLAN_ALLOW_FAST) != 0u)
+  {
+    candidates |= (1u << ARM_CONV_VARIANT_FAST_Q15);
+  }
+
+  if((pScratch1 != NULL) && (pScratch2 != NULL))
+  {
+    candidates |= (candidates << ARM_CONV_VARIANT_OPT_Q15);
+  }
+
+  /* Default variant: the last candidate, the optimized and fast ones come    
+   * last */
+  variant = ARM_CONV_VARIANT_FAST_OPT_Q15;
+  while((candidates & (1u << variant)) == 0u)
+  {
+    variant--;
+  }
+
+  S->variant = (arm_conv_variant) variant;
+
+  /* Without a planner, keep the default variant */
+  if(P == NULL)
+  {
+    return (ARM_MATH_SUCCESS);
+  }
+
+  /* Look up the wisdom */
+  if((flags & ARM_PLAN_MEASURE) == 0u)
+  {
+    pWisdom = arm_planner_find(P, ARM_PLAN_CONV_Q15, (uint8_t) candidates,
+                               region, srcALen, srcBLen);
+  }
+
+  /* An entry naming a variant that is not a candidate is ignored */
+  if((pWisdom != NULL) && (pWisdom->variant <= ARM_CONV_VARIANT_FAST_OPT_Q15) &&
+     ((candidates & (1u << pWisdom->variant)) != 0u))
+  {
+    S->variant = (arm_conv_variant) pWisdom->variant;
+  }
+  else if(P->timer != NULL)
+  {
+    /* Measure every candidate on the buffers */
+    entry.variant = (uint8_t) S->variant;
+    entry.cycles = 0xFFFFFFFFu;
+
+    for (variant = 0u; variant <= ARM_CONV_VARIANT_FAST_OPT_Q15; variant++)
+    {
+      if((candidates & (1u << variant)) == 0u)
+      {
+        continue;
+      }
+
+      S->variant = (arm_conv_variant) variant;
+      cycles = 0xFFFFFFFFu;
+
+      /* Keep the fastest run, the first ones may warm up the caches */
+      for (run = 0u; run < ARM_PLAN_RUNS; run++)
+      {
+        start = P->timer();
+        arm_conv_plan_q15(S, pSrcA, pSrcB, pDst);
+        elapsed = P->timer() - start;
+        cycles = (elapsed < cycles) ? elapsed : cycles;
+      }
+
+      if(cycles < entry.cycles)
+      {
+        entry.variant = (uint8_t) variant;
+        entry.cycles = cycles;
+      }
+    }
+
+    S->variant = (arm_conv_variant) entry.variant;
+
+    /* Record the choice; a full table only means measuring again next time */
+    entry.kernel = ARM_PLAN_CONV_Q15;
+    entry.candidates = (uint8_t) candidates;
+    entry.region = region;
+    entry.len1 = srcALen;
+    entry.len2 = srcBLen;
+    (void) arm_planner_record(P, &entry);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of Conv group    
+ */
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_conv_plan_q15.c    
+*    
+* Description:	Processing function for the planned Q15 convolution.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup Conv    
+ * @{    
+ */
+
+/**    
+ * @brief  Processing function for the planned Q15 convolution.    
+ * @param[in]  *S      points to an instance of the planned convolution, see arm_conv_plan_init_q15().    
+ * @param[in]  *pSrcA  points to the first input sequence, of length srcALen.    
+ * @param[in]  *pSrcB  points to the second input sequence, of length srcBLen.    
+ * @param[out] *pDst   points to the output buffer of length srcALen+srcBLen-1.    
+ * @return none.    
+ *    
+ * \par    
+ * The lengths and the scratch buffers are those given to the plan; the    
+ * input and output buffers may differ from the ones it was measured with.    
+ */
+
+void arm_conv_plan_q15(
+  const arm_conv_plan_instance_q15 * S,
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst)
+{
+  switch (S->variant)
+  {
+  case ARM_CONV_VARIANT_FAST_Q15:
+    arm_conv_fast_q15(pSrcA, S->srcALen, pSrcB, S->srcBLen, pDst);
+    break;
+
+  case ARM_CONV_VARIANT_OPT_Q15:
+    arm_conv_opt_q15(pSrcA, S->srcALen, pSrcB, S->srcBLen, pDst,
+                     S->pScratch1, S->pScratch2);
+    break;
+
+  case ARM_CONV_VARIANT_FAST_OPT_Q15:
+    arm_conv_fast_opt_q15(pSrcA, S->srcALen, pSrcB, S->srcBLen, pDst,
+                          S->pScratch1, S->pScratch2);
+    break;
+
+  default:
+    arm_conv_q15(pSrcA, S->srcALen, pSrcB, S->srcBLen, pDst);
+    break;
+  }
+}
+
+/**    
+ * @} end of Conv group    
+ */
@@ -0,0 +1,256 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_gcc_phat_f32.c    
+*    
+* Description:	Floating-point GCC-PHAT time-delay estimation.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup GCCPHAT    
+ * @{    
+ */
+
+/**    
+ * @brief  Computes and keeps the spectrum of one channel of the current frame.    
+ * @param[in,out] *S        points to an instance of the GCC-PHAT structure.    
+ * @param[in]     *pSrc     points to the first sample of the channel.    
+ * @param[in]     stride    distance between successive samples of the channel: 1 for a    
+ *                          channel buffer, numChannels for interleaved samples.    
+ * @param[in]     channel   index of the channel.    
+ * @return none.    
+ *    
+ * \par    
+ * <code>frameLen</code> samples are read, so interleaved frames as delivered    
+ * by the SAI or I2S DMA can be used directly.  The spectrum is stored in    
+ * <code>pSpectra + channel * fftLen</code>.    
+ */
+
+void arm_gcc_phat_spectrum_f32(
+  arm_gcc_phat_instance_f32 * S,
+  const float32_t * pSrc,
+  uint16_t stride,
+  uint16_t channel)
+{
+  float32_t *pBuf = S->pScratch;                 /* FFT input buffer */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Gather the channel into the FFT buffer */
+  blkCnt = S->frameLen;
+
+  while(blkCnt > 0u)
+  {
+    *pBuf++ = *pSrc;
+    pSrc += stride;
+    blkCnt--;
+  }
+
+  /* Zero-pad to the FFT length */
+  arm_fill_f32(0.0f, pBuf, (uint32_t) S->fftLen - S->frameLen);
+
+  /* The real FFT overwrites its input, which is scratch here */
+  arm_rfft_fast_f32(&S->rfft, S->pScratch,
+                    S->pSpectra + (uint32_t) channel * S->fftLen, 0u);
+}
+
+/**    
+ * @brief  Estimates the delay of one channel relative to another from their spectra.    
+ * @param[in,out] *S        points to an instance of the GCC-PHAT structure.    
+ * @param[in]     chA       index of the reference channel.    
+ * @param[in]     chB       index of the delayed channel.    
+ * @param[out]    *pDelay   delay of chB relative to chA, in samples.    
+ * @param[out]    *pPeak    peak of the whitened cross-correlation, or NULL.    
+ * @return none.    
+ *    
+ * \par    
+ * The spectra of both channels must have been computed for the current frame    
+ * by arm_gcc_phat_spectrum_f32().  The peak is highest for a single    
+ * coherent source, close to 1 without zero-padding and lower with it, and    
+ * drops towards 0 for noise, so it can be used to reject unreliable    
+ * estimates.  The DC and Nyquist bins are excluded from the correlation.    
+ */
+
+void arm_gcc_phat_delay_f32(
+  arm_gcc_phat_instance_f32 * S,
+  uint16_t chA,
+  uint16_t chB,
+  float32_t * pDelay,
+  float32_t * pPeak)
+{
+  uint32_t fftLen = S->fftLen;                   /* FFT length */
+  const float32_t *pA = S->pSpectra + chA * fftLen;   /* spectrum of the reference channel */
+  const float32_t *pB = S->pSpectra + chB * fftLen;   /* spectrum of the delayed channel */
+  float32_t *pG = S->pScratch;                   /* cross-spectrum, whitened in place */
+  float32_t *pR = S->pScratch + fftLen;          /* cross-correlation */
+  float32_t aRe, aIm, bRe, bIm, gRe, gIm;        /* temporary complex values */
+  float32_t mag, y0, ym, yp, den, delta;         /* temporary variables */
+  int32_t lag, maxLag = S->maxLag;               /* lag search range */
+  int32_t bestLag;                               /* lag of the largest value */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* The DC and Nyquist bins carry offsets and no phase information */
+  pG[0] = 0.0f;
+  pG[1] = 0.0f;
+  pA += 2u;
+  pB += 2u;
+  pG += 2u;
+
+  /* Cross-spectrum G = B * conj(A), divided by its magnitude */
+  blkCnt = (fftLen >> 1u) - 1u;
+
+  while(blkCnt > 0u)
+  {
+    aRe = *pA++;
+    aIm = *pA++;
+    bRe = *pB++;
+    bIm = *pB++;
+
+    gRe = (bRe * aRe) + (bIm * aIm);
+    gIm = (bIm * aRe) - (bRe * aIm);
+
+    arm_sqrt_f32((gRe * gRe) + (gIm * gIm), &mag);
+
+    if(mag > 0.0f)
+    {
+      mag = 1.0f / mag;
+      *pG++ = gRe * mag;
+      *pG++ = gIm * mag;
+    }
+    else
+    {
+      /* No energy in this bin */
+      *pG++ = 0.0f;
+      *pG++ = 0.0f;
+    }
+
+    blkCnt--;
+  }
+
+  /* Whitened cross-correlation */
+  arm_rfft_fast_f32(&S->rfft, S->pScratch, pR, 1u);
+
+  /* Peak search over the lags -maxLag..maxLag.  Negative lags wrap around to    
+   * the end of the correlation. */
+  bestLag = 0;
+  y0 = pR[0];
+
+  for (lag = 1; lag <= maxLag; lag++)
+  {
+    if(pR[lag] > y0)
+    {
+      y0 = pR[lag];
+      bestLag = lag;
+    }
+
+    if(pR[fftLen - lag] > y0)
+    {
+      y0 = pR[fftLen - lag];
+      bestLag = -lag;
+    }
+  }
+
+  /* Parabolic interpolation through the peak and its two neighbours */
+  ym = pR[(uint32_t) (bestLag - 1 + (int32_t) fftLen) % fftLen];
+  yp = pR[(uint32_t) (bestLag + 1 + (int32_t) fftLen) % fftLen];
+  den = ym - (2.0f * y0) + yp;
+  delta = 0.0f;
+
+  if(den < 0.0f)
+  {
+    delta = 0.5f * (ym - yp) / den;
+
+    /* The vertex of a true peak lies within half a sample */
+    if(delta > 0.5f)
+    {
+      delta = 0.5f;
+    }
+    else if(delta < -0.5f)
+    {
+      delta = -0.5f;
+    }
+  }
+
+  *pDelay = (float32_t) bestLag + delta;
+
+  if(pPeak != NULL)
+  {
+    *pPeak = y0 - 0.25f * (ym - yp) * delta;
+  }
+}
+
+/**    
+ * @brief  Estimates the delays of all channel pairs from their spectra.    
+ * @param[in,out] *S        points to an instance of the GCC-PHAT structure.    
+ * @param[out]    *pDelays  delays of the numChannels*(numChannels-1)/2 pairs, in samples.    
+ * @param[out]    *pPeaks   peaks of the whitened cross-correlations, or NULL.    
+ * @return none.    
+ *    
+ * \par    
+ * The pairs are ordered (0,1), (0,2), ..., (0,M-1), (1,2), ..., (M-2,M-1),    
+ * where M is <code>numChannels</code>, and the delay of pair (a,b) is the    
+ * delay of channel b relative to channel a.  The spectra of all channels must    
+ * have been computed for the current frame.    
+ */
+
+void arm_gcc_phat_pairs_f32(
+  arm_gcc_phat_instance_f32 * S,
+  float32_t * pDelays,
+  float32_t * pPeaks)
+{
+  uint16_t chA, chB;                             /* channel indices */
+
+  for (chA = 0u; chA < S->numChannels - 1u; chA++)
+  {
+    for (chB = chA + 1u; chB < S->numChannels; chB++)
+    {
+      arm_gcc_phat_delay_f32(S, chA, chB, pDelays++, pPeaks);
+
+      if(pPeaks != NULL)
+      {
+        pPeaks++;
+      }
+    }
+  }
+}
+
+/**    
+ * @} end of GCCPHAT group    
+ */
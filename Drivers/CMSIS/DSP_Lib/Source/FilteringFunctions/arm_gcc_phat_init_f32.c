@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_gcc_phat_init_f32.c    
+*    
+* Description:	Floating-point GCC-PHAT time-delay estimator initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup GCCPHAT Generalized Cross-Correlation with Phase Transform    
+ *    
+ * Estimates the time delay between pairs of channels of a microphone array,    
+ * frame by frame, for direction-of-arrival estimation.    
+ *    
+ * \par Algorithm    
+ * For the spectra <code>Xa</code> and <code>Xb</code> of two channels, the    
+ * cross-spectrum is whitened so that only its phase is kept:    
+ * <pre>    
+ *     G[k] = Xb[k] * conj(Xa[k]) / |Xb[k] * conj(Xa[k])|    
+ * </pre>    
+ * The inverse FFT of <code>G</code> is a cross-correlation with a sharp peak    
+ * at the delay of <code>b</code> relative to <code>a</code>, whatever the    
+ * spectrum of the source and the reverberation.  The peak is searched over    
+ * the lags <code>-maxLag</code> to <code>+maxLag</code> and refined to a    
+ * fraction of a sample by fitting a parabola through the peak and its two    
+ * neighbours.    
+ *    
+ * \par    
+ * The spectrum of each channel is computed once per frame by    
+ * arm_gcc_phat_spectrum_f32() and kept in <code>pSpectra</code>, then reused    
+ * by every pair that the channel takes part in: an array of M microphones    
+ * needs M forward FFTs and M*(M-1)/2 inverse FFTs per frame, instead of    
+ * two forward FFTs per pair.  The cross-spectrum is built and whitened in    
+ * place in the scratch buffer, which avoids a separate weighting buffer.    
+ *    
+ * \par    
+ * The direct-form arm_correlate_f32() costs <code>frameLen^2</code>    
+ * multiply-accumulates per pair; GCC-PHAT costs one inverse FFT and    
+ * <code>fftLen/2</code> complex multiplications, square roots and divisions.    
+ * For a 4 microphone array and 512 sample frames at 16 kHz with    
+ * <code>fftLen = 1024</code>, each 32 ms frame takes 4 forward and 6 inverse    
+ * 1024 point real FFTs; the GCC-PHAT example measures the total with the    
+ * cycle counter.    
+ *    
+ * \par FFT length    
+ * The frame is zero-padded to <code>fftLen</code> samples.  With    
+ * <code>fftLen >= frameLen + maxLag</code> the correlation is linear.  With a    
+ * shorter FFT, down to <code>fftLen = frameLen</code>, it is circular: the    
+ * cost is halved but the ends of the frame wrap around, which adds a small    
+ * error when <code>maxLag</code> is a small part of the frame.    
+ *    
+ * \par Delay convention    
+ * The delay is positive when the signal reaches channel <code>chB</code>    
+ * after channel <code>chA</code>.    
+ */
+
+/**    
+ * @addtogroup GCCPHAT    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point GCC-PHAT time-delay estimator.    
+ * @param[in,out] *S           points to an instance of the GCC-PHAT structure.    
+ * @param[in]     fftLen       length of the real FFT: 32, 64, ..., 4096.    
+ * @param[in]     frameLen     number of samples of each channel per frame, at most fftLen.    
+ * @param[in]     numChannels  number of channels.    
+ * @param[in]     maxLag       largest delay searched, in samples, less than fftLen/2.    
+ * @param[in]     *pSpectra    points to the spectra buffer of numChannels*fftLen values.    
+ * @param[in]     *pScratch    points to the scratch buffer of 2*fftLen values.    
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR    
+ * if <code>fftLen</code> is not a supported length or the other arguments do    
+ * not fit in it.    
+ */
+
+arm_status arm_gcc_phat_init_f32(
+  arm_gcc_phat_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t frameLen,
+  uint16_t numChannels,
+  uint16_t maxLag,
+  float32_t * pSpectra,
+  float32_t * pScratch)
+{
+  arm_status status;                             /* status of the initialization */
+
+  if((frameLen == 0u) || (frameLen > fftLen) ||
+     (numChannels < 2u) || (2u * maxLag >= fftLen))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Initialize the real FFT, which also checks fftLen */
+  status = arm_rfft_fast_init_f32(&S->rfft, fftLen);
+
+  /* Assign the sizes */
+  S->fftLen = fftLen;
+  S->frameLen = frameLen;
+  S->numChannels = numChannels;
+  S->maxLag = maxLag;
+
+  /* Assign the buffers */
+  S->pSpectra = pSpectra;
+  S->pScratch = pScratch;
+
+  return (status);
+}
+
+/**    
+ * @} end of GCCPHAT group    
+ */
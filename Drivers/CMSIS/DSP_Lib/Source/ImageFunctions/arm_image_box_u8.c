@@ -0,0 +1,177 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_image_box_u8.c    
+*    
+* Description:	Box blur of 8-bit image lines.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupImage    
+ */
+
+/**    
+ * @addtogroup ImageFilter    
+ * @{    
+ */
+
+/**    
+ * @brief  Box blur of one output line.    
+ * @param[in]  **ppRows   points to kerSize input rows, top row first.    
+ * @param[in]  width      number of pixels in a line.    
+ * @param[in]  kerSize    kernel size, 3 or 5.    
+ * @param[in]  *pScratch  points to a scratch line of width samples.    
+ * @param[out] *pDst      points to the output line.    
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR    
+ * if kerSize is not 3 or 5.    
+ *    
+ * The column sums are accumulated into the scratch line and a running sum of    
+ * kerSize columns gives the window sum, so the cost per pixel does not depend    
+ * on the kernel size.  The division by kerSize*kerSize is done as    
+ * <code>(sum * 65536 / (kerSize*kerSize) + 32768) >> 16</code>, which is    
+ * within one LSB of the exact rounded mean.    
+ *    
+ * \par    
+ * On Cortex-M4 and Cortex-M3 the column sums of four pixels are accumulated    
+ * per word as two pairs of 16-bit lanes.    
+ */
+
+arm_status arm_image_box_u8(
+  const uint8_t ** ppRows,
+  uint16_t width,
+  uint8_t kerSize,
+  q15_t * pScratch,
+  uint8_t * pDst)
+{
+  uint32_t col, k;                               /* loop counters */
+  int32_t r = (int32_t) kerSize >> 1;            /* kernel radius */
+  int32_t last = (int32_t) width - 1;            /* index of the last column */
+  int32_t idx;                                   /* clamped column index */
+  q31_t sum;                                     /* window sum */
+  q31_t recip;                                   /* 65536 / (kerSize * kerSize) */
+
+  if(kerSize == 3u)
+  {
+    recip = 7282;
+  }
+  else if(kerSize == 5u)
+  {
+    recip = 2621;
+  }
+  else
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Column sums */
+  col = 0u;
+
+#if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q31_t in;                                    /* four pixels of a row */
+    q31_t sum02, sum13;                          /* sums of the even and odd columns */
+    uint32_t blkCnt = (uint32_t) width >> 2u;    /* loop counter */
+
+    while(blkCnt > 0u)
+    {
+      sum02 = 0;
+      sum13 = 0;
+
+      /* Each 16-bit lane holds at most 5 * 255, so plain adds cannot carry */
+      for (k = 0u; k < kerSize; k++)
+      {
+        in = _SIMD32_OFFSET(ppRows[k] + col);
+        sum02 += in & 0x00FF00FF;
+        sum13 += (q31_t) (((uint32_t) in >> 8) & 0x00FF00FFu);
+      }
+
+      *__SIMD32(pScratch)++ = __PKHBT(sum02, sum13, 16);
+      *__SIMD32(pScratch)++ = __PKHTB(sum13, sum02, 16);
+
+      col += 4u;
+      blkCnt--;
+    }
+
+    pScratch -= col;
+  }
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN) */
+
+  /* Remaining columns (all of them on Cortex-M0) */
+  while(col < width)
+  {
+    sum = 0;
+
+    for (k = 0u; k < kerSize; k++)
+    {
+      sum += ppRows[k][col];
+    }
+
+    pScratch[col] = (q15_t) sum;
+
+    col++;
+  }
+
+  /* Window sum of the first output pixel, with replicated borders */
+  sum = 0;
+
+  for (idx = -r; idx <= r; idx++)
+  {
+    sum += pScratch[(idx < 0) ? 0 : ((idx > last) ? last : idx)];
+  }
+
+  /* Running sum along the line */
+  for (col = 0u; col < width; col++)
+  {
+    pDst[col] = (uint8_t) ((sum * recip + 0x8000) >> 16);
+
+    idx = (int32_t) col + r + 1;
+    sum += pScratch[(idx > last) ? last : idx];
+
+    idx = (int32_t) col - r;
+    sum -= pScratch[(idx < 0) ? 0 : idx];
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of ImageFilter group    
+ */
@@ -0,0 +1,273 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_image_conv_sep_u8.c    
+*    
+* Description:	Separable 2D convolution of 8-bit image lines.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupImage    
+ */
+
+/**    
+ * @defgroup ImageFilter 2D Filters    
+ *    
+ * Line-streaming 2D filters.  Each call reads the K rows returned by the    
+ * line buffer (see \ref ImageLineBuf) and produces one output line, where K    
+ * is the height of the kernel.    
+ *    
+ * \par Separable convolution    
+ * The kernel is the outer product of a vertical and a horizontal vector of    
+ * 1.15 coefficients.  The vertical pass combines the K rows into a scratch    
+ * line of 16-bit samples holding <code>pixel * 128</code>, which keeps the    
+ * intermediate in range for kernels whose coefficients sum to at most 1.0.    
+ * The horizontal pass then runs over the scratch line and the result is    
+ * rounded and saturated to 0..255.    
+ *    
+ * \par    
+ * Gaussian and box blurs use the same two-pass structure with fixed kernels:    
+ * binomial [1 2 1]/4 and [1 4 6 4 1]/16 for the gaussian blur and a plain sum    
+ * followed by a reciprocal multiply for the box blur.  The Sobel operator    
+ * returns <code>min(255, (|Gx| + |Gy|) / 4)</code>.    
+ */
+
+/**    
+ * @addtogroup ImageFilter    
+ * @{    
+ */
+
+/**    
+ * @brief  Separable 2D convolution of one output line.    
+ * @param[in]  **ppRows   points to kerSize input rows, top row first.    
+ * @param[in]  width      number of pixels in a line.    
+ * @param[in]  *pCoeffsH  points to kerSize horizontal coefficients in 1.15 format.    
+ * @param[in]  *pCoeffsV  points to kerSize vertical coefficients in 1.15 format.    
+ * @param[in]  kerSize    kernel size, 3 or 5.    
+ * @param[in]  *pScratch  points to a scratch line of width samples.    
+ * @param[out] *pDst      points to the output line.    
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR    
+ * if kerSize is not 3 or 5.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The vertical pass is saturated to 16 bits and the output to 0..255.    
+ *    
+ * \par    
+ * On Cortex-M4 and Cortex-M3 the vertical pass converts four columns at a    
+ * time, pairing two rows per dual multiply-accumulate, and the horizontal    
+ * pass reads two neighbouring scratch samples per dual multiply-accumulate.    
+ */
+
+arm_status arm_image_conv_sep_u8(
+  const uint8_t ** ppRows,
+  uint16_t width,
+  const q15_t * pCoeffsH,
+  const q15_t * pCoeffsV,
+  uint8_t kerSize,
+  q15_t * pScratch,
+  uint8_t * pDst)
+{
+  uint32_t col, k;                               /* loop counters */
+  uint32_t r = (uint32_t) kerSize >> 1u;         /* kernel radius */
+  int32_t idx;                                   /* clamped column index */
+  q31_t acc;                                     /* accumulator */
+
+  if((kerSize != 3u) && (kerSize != 5u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Vertical pass: pScratch[x] = pixel * 128 */
+  col = 0u;
+
+#if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q31_t acc0, acc1, acc2, acc3;                /* accumulators of four columns */
+    q31_t inA, inB;                              /* four pixels of two rows */
+    q31_t a02, a13, b02, b13;                    /* even and odd columns widened to 16 bits */
+    q31_t coeff;                                 /* packed coefficients of two rows */
+    q15_t c;                                     /* coefficient of the last row */
+    uint32_t blkCnt = (uint32_t) width >> 2u;    /* loop counter */
+
+    while(blkCnt > 0u)
+    {
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      for (k = 0u; k < (uint32_t) kerSize - 1u; k += 2u)
+      {
+        inA = _SIMD32_OFFSET(ppRows[k] + col);
+        inB = _SIMD32_OFFSET(ppRows[k + 1u] + col);
+        coeff = __PKHBT(pCoeffsV[k], pCoeffsV[k + 1u], 16);
+
+        a02 = inA & 0x00FF00FF;
+        a13 = (q31_t) (((uint32_t) inA >> 8) & 0x00FF00FFu);
+        b02 = inB & 0x00FF00FF;
+        b13 = (q31_t) (((uint32_t) inB >> 8) & 0x00FF00FFu);
+
+        acc0 = __SMLAD(__PKHBT(a02, b02, 16), coeff, acc0);
+        acc1 = __SMLAD(__PKHBT(a13, b13, 16), coeff, acc1);
+        acc2 = __SMLAD(__PKHTB(b02, a02, 16), coeff, acc2);
+        acc3 = __SMLAD(__PKHTB(b13, a13, 16), coeff, acc3);
+      }
+
+      /* Last row */
+      inA = _SIMD32_OFFSET(ppRows[k] + col);
+      c = pCoeffsV[k];
+
+      acc0 += (inA & 0xFF) * c;
+      acc1 += (((uint32_t) inA >> 8) & 0xFFu) * c;
+      acc2 += (((uint32_t) inA >> 16) & 0xFFu) * c;
+      acc3 += ((uint32_t) inA >> 24) * c;
+
+      *__SIMD32(pScratch)++ =
+        __PKHBT(__SSAT((acc0 + 0x80) >> 8, 16), __SSAT((acc1 + 0x80) >> 8, 16), 16);
+      *__SIMD32(pScratch)++ =
+        __PKHBT(__SSAT((acc2 + 0x80) >> 8, 16), __SSAT((acc3 + 0x80) >> 8, 16), 16);
+
+      col += 4u;
+      blkCnt--;
+    }
+
+    pScratch -= col;
+  }
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN) */
+
+  /* Remaining columns (all of them on Cortex-M0) */
+  while(col < width)
+  {
+    acc = 0;
+
+    for (k = 0u; k < kerSize; k++)
+    {
+      acc += (q31_t) ppRows[k][col] * pCoeffsV[k];
+    }
+
+    pScratch[col] = (q15_t) __SSAT((acc + 0x80) >> 8, 16);
+
+    col++;
+  }
+
+  /* Horizontal pass */
+  col = 0u;
+
+#if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  if(width > 2u * r)
+  {
+    q31_t coeff01, coeff23;                      /* packed horizontal coefficients */
+    q15_t cLast = pCoeffsH[kerSize - 1u];        /* last horizontal coefficient */
+    const q15_t *pIn;                            /* first scratch sample under the kernel */
+
+    coeff01 = __PKHBT(pCoeffsH[0], pCoeffsH[1], 16);
+    coeff23 = (kerSize == 5u) ? __PKHBT(pCoeffsH[2], pCoeffsH[3], 16) : 0;
+
+    /* Left border */
+    while(col < r)
+    {
+      acc = 0;
+
+      for (k = 0u; k < kerSize; k++)
+      {
+        idx = (int32_t) (col + k) - (int32_t) r;
+        idx = (idx < 0) ? 0 : idx;
+        acc += (q31_t) pScratch[idx] * pCoeffsH[k];
+      }
+
+      acc = (acc + (1 << 21)) >> 22;
+      pDst[col] = (uint8_t) ((acc < 0) ? 0 : ((acc > 255) ? 255 : acc));
+
+      col++;
+    }
+
+    /* Interior, no clamping needed */
+    pIn = pScratch;
+
+    while(col < (uint32_t) width - r)
+    {
+      acc = __SMLAD(_SIMD32_OFFSET(pIn), coeff01, 0);
+
+      if(kerSize == 5u)
+      {
+        acc = __SMLAD(_SIMD32_OFFSET(pIn + 2), coeff23, acc);
+      }
+
+      acc += (q31_t) pIn[kerSize - 1u] * cLast;
+
+      acc = (acc + (1 << 21)) >> 22;
+      pDst[col] = (uint8_t) ((acc < 0) ? 0 : ((acc > 255) ? 255 : acc));
+
+      pIn++;
+      col++;
+    }
+  }
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN) */
+
+  /* Remaining columns with replicated borders (all of them on Cortex-M0) */
+  while(col < width)
+  {
+    acc = 0;
+
+    for (k = 0u; k < kerSize; k++)
+    {
+      idx = (int32_t) (col + k) - (int32_t) r;
+      idx = (idx < 0) ? 0 : ((idx >= (int32_t) width) ? (int32_t) width - 1 : idx);
+      acc += (q31_t) pScratch[idx] * pCoeffsH[k];
+    }
+
+    acc = (acc + (1 << 21)) >> 22;
+    pDst[col] = (uint8_t) ((acc < 0) ? 0 : ((acc > 255) ? 255 : acc));
+
+    col++;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of ImageFilter group    
+ */
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_image_gaussian_u8.c    
+*    
+* Description:	Gaussian blur of 8-bit image lines.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupImage    
+ */
+
+/**    
+ * @addtogroup ImageFilter    
+ * @{    
+ */
+
+/**    
+ * @brief Binomial 3-tap kernel [1 2 1]/4 in 1.15 format.    
+ */
+static const q15_t armImageGaussian3[3] = { 8192, 16384, 8192 };
+
+/**    
+ * @brief Binomial 5-tap kernel [1 4 6 4 1]/16 in 1.15 format.    
+ */
+static const q15_t armImageGaussian5[5] = { 2048, 8192, 12288, 8192, 2048 };
+
+/**    
+ * @brief  Gaussian blur of one output line.    
+ * @param[in]  **ppRows   points to kerSize input rows, top row first.    
+ * @param[in]  width      number of pixels in a line.    
+ * @param[in]  kerSize    kernel size, 3 or 5.    
+ * @param[in]  *pScratch  points to a scratch line of width samples.    
+ * @param[out] *pDst      points to the output line.    
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR    
+ * if kerSize is not 3 or 5.    
+ *    
+ * The binomial coefficients are powers of two divided by the kernel sum, so    
+ * both passes are exact and the only rounding happens on the output.    
+ */
+
+arm_status arm_image_gaussian_u8(
+  const uint8_t ** ppRows,
+  uint16_t width,
+  uint8_t kerSize,
+  q15_t * pScratch,
+  uint8_t * pDst)
+{
+  const q15_t *pCoeffs;                          /* binomial kernel */
+
+  if(kerSize == 3u)
+  {
+    pCoeffs = armImageGaussian3;
+  }
+  else if(kerSize == 5u)
+  {
+    pCoeffs = armImageGaussian5;
+  }
+  else
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  return (arm_image_conv_sep_u8(ppRows, width, pCoeffs, pCoeffs, kerSize,
+                                pScratch, pDst));
+}
+
+/**    
+ * @} end of ImageFilter group    
+ */
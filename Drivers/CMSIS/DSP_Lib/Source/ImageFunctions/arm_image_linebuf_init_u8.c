@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_image_linebuf_init_u8.c    
+*    
+* Description:	Initialization function for the image line buffer.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupImage    
+ */
+
+/**    
+ * @defgroup ImageLineBuf Line Buffer    
+ *    
+ * The 2D kernels of this group never need a full frame.  A line buffer holds    
+ * the last <code>numLines</code> lines of the image in a ring of    
+ * <code>numLines*width</code> bytes, and each call to    
+ * arm_image_linebuf_push_u8() returns the row pointers to hand to a kernel of    
+ * the same height.  A typical camera line handler is    
+ * <pre>    
+ *     arm_image_rgb565_to_gray_u8(pCameraLine, gray, WIDTH);    
+ *     arm_image_linebuf_push_u8(&lineBuf, gray, rows);    
+ *     arm_image_gaussian_u8(rows, WIDTH, 3, scratch, pOutLine);    
+ * </pre>    
+ *    
+ * \par Borders    
+ * The first line pushed after initialization is replicated into every slot,    
+ * which extends the image upwards.  With a kernel of height K the output    
+ * line produced after pushing input line n is centred on line n - K/2, so the    
+ * first K/2 outputs of a frame are discarded and, at the end of the frame,    
+ * the last line is pushed K/2 more times to flush the remaining outputs.    
+ * The kernels replicate the first and last pixel of a line horizontally.    
+ */
+
+/**    
+ * @addtogroup ImageLineBuf    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the image line buffer.    
+ * @param[in,out] *S        points to an instance of the line buffer structure.    
+ * @param[in]     width     number of pixels in a line.    
+ * @param[in]     numLines  number of lines to hold (the height of the kernel that is fed).    
+ * @param[in]     *pBuffer  points to the line storage of numLines*width bytes.    
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR    
+ * if width or numLines is zero.    
+ *    
+ * \par    
+ * Call this function again at the start of each frame.    
+ */
+
+arm_status arm_image_linebuf_init_u8(
+  arm_image_linebuf_instance_u8 * S,
+  uint16_t width,
+  uint16_t numLines,
+  uint8_t * pBuffer)
+{
+  if((width == 0u) || (numLines == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->width = width;
+  S->numLines = numLines;
+  S->numPushed = 0u;
+  S->head = 0u;
+  S->pBuffer = pBuffer;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of ImageLineBuf group    
+ */
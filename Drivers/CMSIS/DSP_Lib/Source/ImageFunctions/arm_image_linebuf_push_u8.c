@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_image_linebuf_push_u8.c    
+*    
+* Description:	Pushes a line into the image line buffer.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupImage    
+ */
+
+/**    
+ * @addtogroup ImageLineBuf    
+ * @{    
+ */
+
+/**    
+ * @brief  Pushes a line into the image line buffer.    
+ * @param[in,out] *S      points to an instance of the line buffer structure.    
+ * @param[in]     *pLine  points to the new line.    
+ * @param[out]    *ppRows receives numLines row pointers, oldest line first.    
+ * @return none.    
+ *    
+ * The line is copied, so <code>pLine</code> may be reused as soon as the    
+ * function returns.  The row pointers stay valid until the next push.    
+ */
+
+void arm_image_linebuf_push_u8(
+  arm_image_linebuf_instance_u8 * S,
+  const uint8_t * pLine,
+  const uint8_t ** ppRows)
+{
+  uint32_t width = S->width;                     /* line length */
+  uint32_t numLines = S->numLines;               /* ring size */
+  uint32_t i, slot;                              /* loop counter and slot index */
+
+  if(S->numPushed == 0u)
+  {
+    /* Replicate the first line of the frame into every slot */
+    for (i = 0u; i < numLines; i++)
+    {
+      arm_copy_q7((q7_t *) pLine, (q7_t *) (S->pBuffer + (i * width)), width);
+    }
+  }
+  else
+  {
+    arm_copy_q7((q7_t *) pLine, (q7_t *) (S->pBuffer + (S->head * width)),
+                width);
+  }
+
+  if(S->numPushed < 0xFFFFu)
+  {
+    S->numPushed++;
+  }
+
+  S->head = (S->head + 1u < numLines) ? (uint16_t) (S->head + 1u) : 0u;
+
+  /* The slot after the newest line holds the oldest one */
+  slot = S->head;
+
+  for (i = 0u; i < numLines; i++)
+  {
+    ppRows[i] = S->pBuffer + (slot * width);
+
+    slot = (slot + 1u < numLines) ? slot + 1u : 0u;
+  }
+}
+
+/**    
+ * @} end of ImageLineBuf group    
+ */
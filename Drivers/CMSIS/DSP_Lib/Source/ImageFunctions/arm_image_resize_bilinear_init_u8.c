@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_image_resize_bilinear_init_u8.c    
+*    
+* Description:	Initialization function for the streaming bilinear downscaler.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupImage    
+ */
+
+/**    
+ * @defgroup ImageResize Bilinear Downscale    
+ *    
+ * Reduces the size of an image while its lines are received.  Output pixel    
+ * (x, y) is sampled at the source position    
+ * <pre>    
+ *     ((x + 0.5) * srcWidth / dstWidth - 0.5, (y + 0.5) * srcHeight / dstHeight - 0.5)    
+ * </pre>    
+ * which keeps the two grids centred on each other.  Positions are tracked in    
+ * 16.16 format and interpolation weights are 8-bit fractions.    
+ *    
+ * \par    
+ * Each source line is passed to arm_image_resize_bilinear_u8() as soon as it    
+ * is available.  Because the output is never larger than the source, a    
+ * source line completes at most one output line; the function reports when    
+ * it has written one.  The only state kept between calls is a copy of the    
+ * previous source line, and the copy is only made when the next output line    
+ * needs it.    
+ */
+
+/**    
+ * @addtogroup ImageResize    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the streaming bilinear downscaler.    
+ * @param[in,out] *S          points to an instance of the downscaler structure.    
+ * @param[in]     srcWidth    width of the source lines.    
+ * @param[in]     srcHeight   number of lines in the source frame.    
+ * @param[in]     dstWidth    width of the output lines.    
+ * @param[in]     dstHeight   number of lines in the output frame.    
+ * @param[in]     *pPrevLine  points to a buffer of srcWidth bytes.    
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR    
+ * if a dimension is zero or the output is larger than the source.    
+ *    
+ * \par    
+ * Call this function again at the start of each frame.    
+ */
+
+arm_status arm_image_resize_bilinear_init_u8(
+  arm_image_resize_instance_u8 * S,
+  uint16_t srcWidth,
+  uint16_t srcHeight,
+  uint16_t dstWidth,
+  uint16_t dstHeight,
+  uint8_t * pPrevLine)
+{
+  if((dstWidth == 0u) || (dstHeight == 0u) ||
+     (dstWidth > srcWidth) || (dstHeight > srcHeight))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->srcWidth = srcWidth;
+  S->srcHeight = srcHeight;
+  S->dstWidth = dstWidth;
+  S->dstHeight = dstHeight;
+  S->stepX = ((uint32_t) srcWidth << 16) / dstWidth;
+  S->stepY = ((uint32_t) srcHeight << 16) / dstHeight;
+
+  /* Centre of the first output line, never negative since stepY >= 1.0 */
+  S->posY = (S->stepY >> 1) - 0x8000u;
+  S->lineIdx = 0u;
+  S->dstLine = 0u;
+  S->pPrevLine = pPrevLine;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of ImageResize group    
+ */
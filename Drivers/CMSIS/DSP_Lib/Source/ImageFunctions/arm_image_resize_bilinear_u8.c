@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_image_resize_bilinear_u8.c    
+*    
+* Description:	Streaming bilinear downscale of 8-bit image lines.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupImage    
+ */
+
+/**    
+ * @addtogroup ImageResize    
+ * @{    
+ */
+
+/**    
+ * @brief  Feeds one source line to the streaming bilinear downscaler.    
+ * @param[in,out] *S     points to an instance of the downscaler structure.    
+ * @param[in]     *pLine points to the source line.    
+ * @param[out]    *pDst  points to the output line of dstWidth pixels.    
+ * @return        1 if an output line was written to pDst, 0 otherwise.    
+ *    
+ * \par    
+ * On Cortex-M4 and Cortex-M3 the two horizontal neighbours of a sample are    
+ * packed into a halfword pair and weighted with one dual multiply.    
+ */
+
+uint32_t arm_image_resize_bilinear_u8(
+  arm_image_resize_instance_u8 * S,
+  const uint8_t * pLine,
+  uint8_t * pDst)
+{
+  const uint8_t *pTop;                           /* upper source line */
+  uint32_t iy = S->posY >> 16;                   /* upper source line index */
+  uint32_t fy = (S->posY >> 8) & 0xFFu;          /* vertical weight of the lower line */
+  uint32_t srcLast = (uint32_t) S->srcWidth - 1u;       /* index of the last source pixel */
+  uint32_t posX;                                 /* horizontal source position in 16.16 */
+  uint32_t ix, ix1, fx;                          /* source columns and horizontal weight */
+  uint32_t col;                                  /* loop counter */
+  q31_t top, bot;                                /* horizontally interpolated samples */
+  uint32_t produced = 0u;                        /* number of output lines written */
+
+#if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN)
+
+  q31_t coeff;                                   /* packed horizontal weights */
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN) */
+
+  if(S->dstLine < S->dstHeight)
+  {
+    if(iy + 1u == S->lineIdx)
+    {
+      /* Between the previous line and this one */
+      pTop = S->pPrevLine;
+      produced = 1u;
+    }
+    else if((iy == S->lineIdx) && (fy == 0u))
+    {
+      /* Exactly on this line */
+      pTop = pLine;
+      produced = 1u;
+    }
+
+    if(produced != 0u)
+    {
+      posX = (S->stepX >> 1) - 0x8000u;
+
+      for (col = 0u; col < S->dstWidth; col++)
+      {
+        ix = posX >> 16;
+        fx = (posX >> 8) & 0xFFu;
+        ix1 = (ix < srcLast) ? ix + 1u : srcLast;
+
+#if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN)
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        coeff = __PKHBT(256 - fx, fx, 16);
+        top = __SMUAD(__PKHBT(pTop[ix], pTop[ix1], 16), coeff);
+        bot = __SMUAD(__PKHBT(pLine[ix], pLine[ix1], 16), coeff);
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        top = (q31_t) (pTop[ix] * (256u - fx) + pTop[ix1] * fx);
+        bot = (q31_t) (pLine[ix] * (256u - fx) + pLine[ix1] * fx);
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN) */
+
+        pDst[col] = (uint8_t) ((top * (q31_t) (256u - fy) + bot * (q31_t) fy + 0x8000) >> 16);
+
+        posX += S->stepX;
+      }
+
+      S->posY += S->stepY;
+      S->dstLine++;
+    }
+  }
+
+  /* Keep this line only if the next output line starts on it */
+  if((S->posY >> 16) == S->lineIdx)
+  {
+    arm_copy_q7((q7_t *) pLine, (q7_t *) S->pPrevLine, S->srcWidth);
+  }
+
+  S->lineIdx++;
+
+  return (produced);
+}
+
+/**    
+ * @} end of ImageResize group    
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_image_rgb565_to_gray_u8.c    
+*    
+* Description:	RGB565 to 8-bit grayscale conversion.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupImage    
+ */
+
+/**    
+ * @defgroup ImagePoint Point Operations    
+ *    
+ * Pixel-wise operations that do not need neighbouring lines.  They can be    
+ * applied directly to each line delivered by the camera interface, before    
+ * the line is pushed into a line buffer.    
+ *    
+ * The grayscale conversion computes    
+ * <pre>    
+ *     gray = (630 * R + 608 * G + 240 * B + 128) >> 8    
+ * </pre>    
+ * on the 5-bit R, 6-bit G and 5-bit B fields of each RGB565 pixel.  The    
+ * weights are the ITU-R BT.601 luma coefficients rescaled to the field widths,    
+ * so that white maps to 255.    
+ */
+
+/**    
+ * @addtogroup ImagePoint    
+ * @{    
+ */
+
+/**    
+ * @brief  Converts RGB565 pixels to 8-bit grayscale.    
+ * @param[in]  *pSrc      points to the RGB565 pixels.    
+ * @param[out] *pDst      points to the grayscale pixels.    
+ * @param[in]  numPixels  number of pixels to convert.    
+ * @return none.    
+ *    
+ * On Cortex-M4 and Cortex-M3 two pixels are converted per word: the R and G    
+ * fields of each pixel are packed into a halfword pair and weighted with a    
+ * single dual multiply-accumulate.    
+ */
+
+void arm_image_rgb565_to_gray_u8(
+  const uint16_t * pSrc,
+  uint8_t * pDst,
+  uint32_t numPixels)
+{
+  uint32_t blkCnt;                               /* loop counter */
+  uint32_t in;                                   /* input pixel(s) */
+  q31_t acc;                                     /* weighted sum */
+
+#if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t r, g, b;                                 /* packed colour fields of two pixels */
+  q31_t coeffRG = (608 << 16) | 630;             /* packed G and R weights */
+
+  /*loop Unrolling */
+  blkCnt = numPixels >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* Read two pixels */
+    in = (uint32_t) * __SIMD32(pSrc)++;
+
+    r = (q31_t) ((in >> 11) & 0x001F001Fu);
+    g = (q31_t) ((in >> 5) & 0x003F003Fu);
+    b = (q31_t) (in & 0x001F001Fu);
+
+    /* First pixel: (R0, G0) pair and B0 */
+    acc = __SMLAD(__PKHBT(r, g, 16), coeffRG, (b & 0xFFFF) * 240);
+    *pDst++ = (uint8_t) ((acc + 128) >> 8);
+
+    /* Second pixel: (R1, G1) pair and B1 */
+    acc = __SMLAD(__PKHTB(g, r, 16), coeffRG, (b >> 16) * 240);
+    *pDst++ = (uint8_t) ((acc + 128) >> 8);
+
+    blkCnt--;
+  }
+
+  blkCnt = numPixels % 0x2u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = numPixels;
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN) */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    acc = (q31_t) (((in >> 11) & 0x1Fu) * 630u + ((in >> 5) & 0x3Fu) * 608u +
+                   (in & 0x1Fu) * 240u);
+    *pDst++ = (uint8_t) ((acc + 128) >> 8);
+
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of ImagePoint group    
+ */
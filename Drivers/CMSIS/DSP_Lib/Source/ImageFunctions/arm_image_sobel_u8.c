@@ -0,0 +1,199 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_image_sobel_u8.c    
+*    
+* Description:	Sobel gradient magnitude of 8-bit image lines.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupImage    
+ */
+
+/**    
+ * @addtogroup ImageFilter    
+ * @{    
+ */
+
+/**    
+ * @brief  Sobel gradient magnitude of one output line.    
+ * @param[in]  **ppRows   points to 3 input rows, top row first.    
+ * @param[in]  width      number of pixels in a line.    
+ * @param[in]  *pScratch  points to a scratch buffer of 2*width samples.    
+ * @param[out] *pDst      points to the output line.    
+ * @return none.    
+ *    
+ * Both Sobel kernels are separable.  The column pass stores the vertically    
+ * smoothed sum <code>S = r0 + 2*r1 + r2</code> and the vertical difference    
+ * <code>D = r2 - r0</code> of each column, then    
+ * <pre>    
+ *     Gx[x] = S[x+1] - S[x-1]    
+ *     Gy[x] = D[x-1] + 2*D[x] + D[x+1]    
+ *     out[x] = min(255, (|Gx| + |Gy|) >> 2)    
+ * </pre>    
+ *    
+ * \par    
+ * On Cortex-M4 and Cortex-M3 the column pass handles four pixels per word in    
+ * 16-bit lanes and the line pass computes Gx and Gy for two pixels at a time.    
+ */
+
+void arm_image_sobel_u8(
+  const uint8_t ** ppRows,
+  uint16_t width,
+  q15_t * pScratch,
+  uint8_t * pDst)
+{
+  q15_t *pS = pScratch;                          /* smoothed column sums */
+  q15_t *pD = pScratch + width;                  /* vertical differences */
+  uint32_t col;                                  /* loop counter */
+  int32_t last = (int32_t) width - 1;            /* index of the last column */
+  int32_t xl, xr;                                /* clamped neighbour indices */
+  q31_t gx, gy, mag;                             /* gradients and magnitude */
+
+  /* Column pass */
+  col = 0u;
+
+#if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  {
+    q31_t in0, in1, in2;                         /* four pixels of the three rows */
+    q31_t s02, s13, d02, d13;                    /* packed sums and differences */
+    uint32_t blkCnt = (uint32_t) width >> 2u;    /* loop counter */
+
+    while(blkCnt > 0u)
+    {
+      in0 = _SIMD32_OFFSET(ppRows[0] + col);
+      in1 = _SIMD32_OFFSET(ppRows[1] + col);
+      in2 = _SIMD32_OFFSET(ppRows[2] + col);
+
+      /* Even columns: lanes hold at most 4 * 255, so plain adds cannot carry */
+      s02 = (in0 & 0x00FF00FF) + ((in1 & 0x00FF00FF) << 1) + (in2 & 0x00FF00FF);
+      d02 = __QSUB16(in2 & 0x00FF00FF, in0 & 0x00FF00FF);
+
+      /* Odd columns */
+      in0 = (q31_t) (((uint32_t) in0 >> 8) & 0x00FF00FFu);
+      in1 = (q31_t) (((uint32_t) in1 >> 8) & 0x00FF00FFu);
+      in2 = (q31_t) (((uint32_t) in2 >> 8) & 0x00FF00FFu);
+      s13 = in0 + (in1 << 1) + in2;
+      d13 = __QSUB16(in2, in0);
+
+      _SIMD32_OFFSET(pS + col) = __PKHBT(s02, s13, 16);
+      _SIMD32_OFFSET(pS + col + 2u) = __PKHTB(s13, s02, 16);
+      _SIMD32_OFFSET(pD + col) = __PKHBT(d02, d13, 16);
+      _SIMD32_OFFSET(pD + col + 2u) = __PKHTB(d13, d02, 16);
+
+      col += 4u;
+      blkCnt--;
+    }
+  }
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN) */
+
+  /* Remaining columns (all of them on Cortex-M0) */
+  while(col < width)
+  {
+    pS[col] = (q15_t) (ppRows[0][col] + 2 * ppRows[1][col] + ppRows[2][col]);
+    pD[col] = (q15_t) (ppRows[2][col] - ppRows[0][col]);
+
+    col++;
+  }
+
+  /* Line pass */
+  col = 0u;
+
+#if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  if(width > 3u)
+  {
+    q31_t gx2, gy2, dMid;                        /* packed gradients of two pixels */
+    uint32_t blkCnt = ((uint32_t) width - 2u) >> 1u;    /* loop counter */
+
+    /* First pixel */
+    gx = pS[1] - pS[0];
+    gy = 3 * pD[0] + pD[1];
+    mag = ((gx < 0 ? -gx : gx) + (gy < 0 ? -gy : gy)) >> 2;
+    pDst[0] = (uint8_t) ((mag > 255) ? 255 : mag);
+
+    col = 1u;
+
+    /* Two interior pixels per iteration */
+    while(blkCnt > 0u)
+    {
+      gx2 = __QSUB16(_SIMD32_OFFSET(pS + col + 1u), _SIMD32_OFFSET(pS + col - 1u));
+      dMid = _SIMD32_OFFSET(pD + col);
+      gy2 = __QADD16(__QADD16(_SIMD32_OFFSET(pD + col - 1u),
+                              _SIMD32_OFFSET(pD + col + 1u)), __QADD16(dMid, dMid));
+
+      gx = (q15_t) gx2;
+      gy = (q15_t) gy2;
+      mag = ((gx < 0 ? -gx : gx) + (gy < 0 ? -gy : gy)) >> 2;
+      pDst[col] = (uint8_t) ((mag > 255) ? 255 : mag);
+
+      gx = gx2 >> 16;
+      gy = gy2 >> 16;
+      mag = ((gx < 0 ? -gx : gx) + (gy < 0 ? -gy : gy)) >> 2;
+      pDst[col + 1u] = (uint8_t) ((mag > 255) ? 255 : mag);
+
+      col += 2u;
+      blkCnt--;
+    }
+  }
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN) */
+
+  /* Remaining pixels with replicated borders (all of them on Cortex-M0) */
+  while(col < width)
+  {
+    xl = (col == 0u) ? 0 : (int32_t) col - 1;
+    xr = ((int32_t) col >= last) ? last : (int32_t) col + 1;
+
+    gx = pS[xr] - pS[xl];
+    gy = pD[xl] + 2 * pD[col] + pD[xr];
+    mag = ((gx < 0 ? -gx : gx) + (gy < 0 ? -gy : gy)) >> 2;
+    pDst[col] = (uint8_t) ((mag > 255) ? 255 : mag);
+
+    col++;
+  }
+}
+
+/**    
+ * @} end of ImageFilter group    
+ */
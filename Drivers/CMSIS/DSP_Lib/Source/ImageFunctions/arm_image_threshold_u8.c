@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_image_threshold_u8.c    
+*    
+* Description:	Binary threshold of 8-bit pixels.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupImage    
+ */
+
+/**    
+ * @addtogroup ImagePoint    
+ * @{    
+ */
+
+/**    
+ * @brief  Binary threshold of 8-bit pixels.    
+ * @param[in]  *pSrc      points to the input pixels.    
+ * @param[out] *pDst      points to the output pixels (0 or 255).    
+ * @param[in]  threshold  pixels greater than or equal to this value are set to 255.    
+ * @param[in]  numPixels  number of pixels.    
+ * @return none.    
+ *    
+ * On Cortex-M4 four pixels are compared per word with an unsigned byte    
+ * subtraction; the resulting GE flags select 0xFF or 0x00 for each lane.    
+ * In-place operation (pSrc == pDst) is supported.    
+ */
+
+void arm_image_threshold_u8(
+  const uint8_t * pSrc,
+  uint8_t * pDst,
+  uint8_t threshold,
+  uint32_t numPixels)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if (defined (ARM_MATH_CM4) || defined (ARM_MATH_CM7)) && !defined (ARM_MATH_BIG_ENDIAN)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  uint32_t thr4 = threshold * 0x01010101u;       /* threshold in every byte */
+  uint32_t in;                                   /* four input pixels */
+
+  /*loop Unrolling */
+  blkCnt = numPixels >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    in = (uint32_t) * __SIMD32(pSrc)++;
+
+    /* GE[n] is set for the lanes where in >= threshold */
+    (void) __USUB8(in, thr4);
+
+    *__SIMD32(pDst)++ = (q31_t) __SEL(0xFFFFFFFFu, 0u);
+
+    blkCnt--;
+  }
+
+  blkCnt = numPixels % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M3 and Cortex-M0 */
+
+  blkCnt = numPixels;
+
+#endif /* #if (defined (ARM_MATH_CM4) || defined (ARM_MATH_CM7)) && !defined (ARM_MATH_BIG_ENDIAN) */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (*pSrc++ >= threshold) ? 255u : 0u;
+
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of ImagePoint group    
+ */
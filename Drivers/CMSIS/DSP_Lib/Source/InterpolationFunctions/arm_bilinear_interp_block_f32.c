@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_bilinear_interp_block_f32.c    
+*    
+* Description:	Floating-point bilinear interpolation of a block of points.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupInterpolation    
+ */
+
+/**    
+ * @addtogroup BilinearInterpolate    
+ * @{    
+ */
+
+/**    
+ * @brief  Floating-point bilinear interpolation of a block of points.    
+ * @param[in]  *S         points to an instance of the interpolation structure.    
+ * @param[in]  *pX        points to the block of X (column) coordinates.    
+ * @param[in]  *pY        points to the block of Y (row) coordinates.    
+ * @param[out] *pDst      points to the block of interpolated values.    
+ * @param[in]  blockSize  number of points to interpolate.    
+ * @return none.    
+ *    
+ * \par    
+ * The block functions read table element (x, y) from    
+ * <code>pData[x + y*numCols]</code> and accept X in [0, numCols-1] and Y in    
+ * [0, numRows-1]; points outside the table return zero.  Points on the last    
+ * column or row reuse the edge values instead of reading past the table.    
+ *    
+ * \par    
+ * The four corner values, and the bilinear coefficients derived from them,    
+ * are kept from one point to the next.  When consecutive points fall in the    
+ * same cell, as they do when warping or upscaling an image along a line, only    
+ * the fractional parts are computed.    
+ */
+
+void arm_bilinear_interp_block_f32(
+  const arm_bilinear_interp_instance_f32 * S,
+  const float32_t * pX,
+  const float32_t * pY,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pData = S->pData;             /* pointer to the data table */
+  int32_t nCols = (int32_t) S->numCols;          /* number of columns */
+  int32_t lastCol = nCols - 1;                   /* index of the last column */
+  int32_t lastRow = (int32_t) S->numRows - 1;    /* index of the last row */
+  int32_t xIndex, yIndex;                        /* cell of the current point */
+  int32_t prevX = -1, prevY = -1;                /* cell of the previous point */
+  int32_t index0, index1, xStep;                 /* table indices */
+  float32_t X, Y;                                /* interpolation coordinates */
+  float32_t xdiff, ydiff;                        /* fractional parts */
+  float32_t f00, f01, f10, f11;                  /* corner values */
+  float32_t b1 = 0.0f, b2 = 0.0f, b3 = 0.0f, b4 = 0.0f;    /* bilinear coefficients */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    X = *pX++;
+    Y = *pY++;
+
+    /* Returns zero output when values are outside table boundary */
+    if((X < 0.0f) || (Y < 0.0f) || (X > (float32_t) lastCol) ||
+       (Y > (float32_t) lastRow))
+    {
+      *pDst++ = 0.0f;
+      blkCnt--;
+      continue;
+    }
+
+    xIndex = (int32_t) X;
+    yIndex = (int32_t) Y;
+
+    if((xIndex != prevX) || (yIndex != prevY))
+    {
+      /* Read the four corners of the new cell */
+      xStep = (xIndex < lastCol) ? 1 : 0;
+      index0 = xIndex + (yIndex * nCols);
+      index1 = (yIndex < lastRow) ? index0 + nCols : index0;
+
+      f00 = pData[index0];
+      f01 = pData[index0 + xStep];
+      f10 = pData[index1];
+      f11 = pData[index1 + xStep];
+
+      /* Calculation of intermediate values */
+      b1 = f00;
+      b2 = f01 - f00;
+      b3 = f10 - f00;
+      b4 = f00 - f01 - f10 + f11;
+
+      prevX = xIndex;
+      prevY = yIndex;
+    }
+
+    /* Calculation of fractional parts */
+    xdiff = X - (float32_t) xIndex;
+    ydiff = Y - (float32_t) yIndex;
+
+    /* Calculation of bi-linear interpolated output */
+    *pDst++ = b1 + (b2 * xdiff) + (b3 * ydiff) + (b4 * xdiff * ydiff);
+
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of BilinearInterpolate group    
+ */
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_bilinear_interp_block_q31.c    
+*    
+* Description:	Q31 bilinear interpolation of a block of points.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupInterpolation    
+ */
+
+/**    
+ * @addtogroup BilinearInterpolate    
+ * @{    
+ */
+
+/**    
+ * @brief  Q31 bilinear interpolation of a block of points.    
+ * @param[in]  *S         points to an instance of the interpolation structure.    
+ * @param[in]  *pX        points to the block of X (column) coordinates in 12.20 format.    
+ * @param[in]  *pY        points to the block of Y (row) coordinates in 12.20 format.    
+ * @param[out] *pDst      points to the block of interpolated values.    
+ * @param[in]  blockSize  number of points to interpolate.    
+ * @return none.    
+ *    
+ * \par    
+ * The arithmetic is the same as in arm_bilinear_interp_q31().  The table    
+ * layout, boundary handling and reuse of the corner values follow    
+ * arm_bilinear_interp_block_f32().    
+ */
+
+void arm_bilinear_interp_block_q31(
+  const arm_bilinear_interp_instance_q31 * S,
+  const q31_t * pX,
+  const q31_t * pY,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  const q31_t *pYData = S->pData;                /* pointer to output table values */
+  int32_t nCols = (int32_t) S->numCols;          /* number of columns */
+  int32_t lastCol = nCols - 1;                   /* index of the last column */
+  int32_t lastRow = (int32_t) S->numRows - 1;    /* index of the last row */
+  int32_t rI, cI;                                /* column and row of the current point */
+  int32_t prevR = -1, prevC = -1;                /* cell of the previous point */
+  int32_t index0, index1, xStep;                 /* table indices */
+  q31_t X, Y;                                    /* interpolation coordinates */
+  q31_t xfract, yfract;                          /* X, Y fractional parts */
+  q31_t x1 = 0, x2 = 0, y1 = 0, y2 = 0;          /* Nearest output values */
+  q31_t out, acc;                                /* Temporary output and accumulator */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    X = *pX++;
+    Y = *pY++;
+
+    /* Returns zero output when values are outside table boundary */
+    if((X < 0) || (Y < 0) || ((uint32_t) X > ((uint32_t) lastCol << 20)) ||
+       ((uint32_t) Y > ((uint32_t) lastRow << 20)))
+    {
+      *pDst++ = 0;
+      blkCnt--;
+      continue;
+    }
+
+    /* 12 bits for the table index */
+    rI = X >> 20;
+    cI = Y >> 20;
+
+    if((rI != prevR) || (cI != prevC))
+    {
+      /* Read the four corners of the new cell */
+      xStep = (rI < lastCol) ? 1 : 0;
+      index0 = rI + (cI * nCols);
+      index1 = (cI < lastRow) ? index0 + nCols : index0;
+
+      x1 = pYData[index0];
+      x2 = pYData[index0 + xStep];
+      y1 = pYData[index1];
+      y2 = pYData[index1 + xStep];
+
+      prevR = rI;
+      prevC = cI;
+    }
+
+    /* 20 bits for the fractional part, shifted to 1.31 format */
+    xfract = (X & 0x000FFFFF) << 11u;
+    yfract = (Y & 0x000FFFFF) << 11u;
+
+    /* x1 * (1-xfract) * (1-yfract) in 3.29(q29) format */
+    out = ((q31_t) (((q63_t) x1 * (0x7FFFFFFF - xfract)) >> 32));
+    acc = ((q31_t) (((q63_t) out * (0x7FFFFFFF - yfract)) >> 32));
+
+    /* x2 * (xfract) * (1-yfract) in 3.29(q29) and adding to acc */
+    out = ((q31_t) ((q63_t) x2 * (0x7FFFFFFF - yfract) >> 32));
+    acc += ((q31_t) ((q63_t) out * (xfract) >> 32));
+
+    /* y1 * (1 - xfract) * (yfract) in 3.29(q29) and adding to acc */
+    out = ((q31_t) ((q63_t) y1 * (0x7FFFFFFF - xfract) >> 32));
+    acc += ((q31_t) ((q63_t) out * (yfract) >> 32));
+
+    /* y2 * (xfract) * (yfract) in 3.29(q29) and adding to acc */
+    out = ((q31_t) ((q63_t) y2 * (xfract) >> 32));
+    acc += ((q31_t) ((q63_t) out * (yfract) >> 32));
+
+    /* Convert acc to 1.31(q31) format */
+    *pDst++ = acc << 2u;
+
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of BilinearInterpolate group    
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_linear_interp_block_f32.c    
+*    
+* Description:	Floating-point linear interpolation of a block of points.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupInterpolation    
+ */
+
+/**    
+ * @addtogroup LinearInterpolate    
+ * @{    
+ */
+
+/**    
+ * @brief  Floating-point linear interpolation of a block of points.    
+ * @param[in]  *S         points to an instance of the floating-point Linear Interpolation structure.    
+ * @param[in]  *pX        points to the block of interpolation points.    
+ * @param[out] *pY        points to the block of interpolated values.    
+ * @param[in]  blockSize  number of points to interpolate.    
+ * @return none.    
+ *    
+ * \par    
+ * The block functions give the same results as the single-point functions    
+ * but keep the segment found for the previous point.  A point that falls in    
+ * the same segment, or in the next one, is interpolated without recomputing    
+ * the table index, so resampling a table with increasing points costs one    
+ * multiply-accumulate per point.  Points in any order are still handled    
+ * correctly; they only take the slower path.    
+ *    
+ * \par    
+ * The division by <code>xSpacing</code> is replaced by a multiplication with    
+ * its reciprocal, computed once per call.  Points below the table return the    
+ * first value and points at or above the last table abscissa return the last    
+ * value.    
+ */
+
+void arm_linear_interp_block_f32(
+  const arm_linear_interp_instance_f32 * S,
+  const float32_t * pX,
+  float32_t * pY,
+  uint32_t blockSize)
+{
+  const float32_t *pYData = S->pYData;           /* pointer to output table */
+  float32_t xSpacing = S->xSpacing;              /* spacing between input values */
+  float32_t invSpacing = 1.0f / xSpacing;        /* reciprocal of the spacing */
+  int32_t last = (int32_t) S->nValues - 1;       /* index of the last table value */
+  float32_t xLo = 1.0f, xHi = 0.0f;              /* bounds of the current segment (empty) */
+  float32_t y0 = 0.0f, slope = 0.0f;             /* current segment */
+  float32_t x, t;                                /* input point and table position */
+  int32_t i = -1;                                /* current segment index */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pX++;
+
+    if((x < xLo) || (x >= xHi))
+    {
+      if((i >= 0) && (x >= xHi) && (x < xHi + xSpacing) && (i + 1 < last))
+      {
+        /* Monotonic fast path: step to the next segment */
+        i++;
+      }
+      else
+      {
+        t = (x - S->x1) * invSpacing;
+
+        if(t < 0.0f)
+        {
+          /* Below the table */
+          *pY++ = pYData[0];
+          blkCnt--;
+          continue;
+        }
+
+        i = (int32_t) t;
+
+        if(i >= last)
+        {
+          /* Above the table */
+          *pY++ = pYData[last];
+          i = -1;
+          xLo = 1.0f;
+          xHi = 0.0f;
+          blkCnt--;
+          continue;
+        }
+      }
+
+      /* Load the segment */
+      xLo = S->x1 + (float32_t) i * xSpacing;
+      xHi = xLo + xSpacing;
+      y0 = pYData[i];
+      slope = (pYData[i + 1] - y0) * invSpacing;
+    }
+
+    *pY++ = y0 + (x - xLo) * slope;
+
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of LinearInterpolate group    
+ */
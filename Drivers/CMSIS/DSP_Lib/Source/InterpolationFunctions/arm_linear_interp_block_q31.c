@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_linear_interp_block_q31.c    
+*    
+* Description:	Q31 linear interpolation of a block of points.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupInterpolation    
+ */
+
+/**    
+ * @addtogroup LinearInterpolate    
+ * @{    
+ */
+
+/**    
+ * @brief  Q31 linear interpolation of a block of points.    
+ * @param[in]  *pYData    points to the Q31 table.    
+ * @param[in]  nValues    number of table values.    
+ * @param[in]  *pX        points to the block of interpolation points in 12.20 format.    
+ * @param[out] *pY        points to the block of interpolated values.    
+ * @param[in]  blockSize  number of points to interpolate.    
+ * @return none.    
+ *    
+ * \par    
+ * In-range points give the same result as arm_linear_interp_q31().  The two    
+ * table values around the previous point are kept, so consecutive points in    
+ * the same segment skip the bounds checks and table reads.  Negative points    
+ * return the first table value and points at or beyond the last table entry    
+ * return the last value.    
+ */
+
+void arm_linear_interp_block_q31(
+  const q31_t * pYData,
+  uint32_t nValues,
+  const q31_t * pX,
+  q31_t * pY,
+  uint32_t blockSize)
+{
+  int32_t last = (int32_t) nValues - 1;          /* index of the last table value */
+  int32_t index;                                 /* segment of the current point */
+  int32_t prevIndex = 0x7FFFFFFF;                /* segment of the previous point (none) */
+  q31_t y0 = 0, y1 = 0;                          /* nearest table values */
+  q31_t x;                                       /* input point */
+  q31_t fract;                                   /* fractional part */
+  q31_t y;                                       /* output */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pX++;
+
+    /* 12 bits for the table index */
+    index = x >> 20;
+
+    if(index != prevIndex)
+    {
+      if(x < 0)
+      {
+        *pY++ = pYData[0];
+        blkCnt--;
+        continue;
+      }
+      else if(index >= last)
+      {
+        *pY++ = pYData[last];
+        blkCnt--;
+        continue;
+      }
+
+      /* Read two nearest output values from the index */
+      y0 = pYData[index];
+      y1 = pYData[index + 1];
+      prevIndex = index;
+    }
+
+    /* 20 bits for the fractional part, shifted to 1.31 format */
+    fract = (x & 0x000FFFFF) << 11;
+
+    /* y0 * (1-fract) + y1 * fract in 2.30 format */
+    y = ((q31_t) ((q63_t) y0 * (0x7FFFFFFF - fract) >> 32));
+    y += ((q31_t) (((q63_t) y1 * fract) >> 32));
+
+    /* Convert y to 1.31 format */
+    *pY++ = y << 1u;
+
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of LinearInterpolate group    
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_spline_f32.c    
+*    
+* Description:	Floating-point cubic spline interpolation of a block of points.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupInterpolation    
+ */
+
+/**    
+ * @addtogroup SplineInterpolate    
+ * @{    
+ */
+
+/**    
+ * @brief  Floating-point cubic spline interpolation of a block of points.    
+ * @param[in]  *S         points to an instance of the spline structure.    
+ * @param[in]  *pX        points to the block of interpolation points.    
+ * @param[out] *pY        points to the block of interpolated values.    
+ * @param[in]  blockSize  number of points to interpolate.    
+ * @return none.    
+ */
+
+void arm_spline_f32(
+  const arm_spline_instance_f32 * S,
+  const float32_t * pX,
+  float32_t * pY,
+  uint32_t blockSize)
+{
+  const float32_t *pXData = S->pXData;           /* knot abscissas */
+  const float32_t *pYData = S->pYData;           /* knot values */
+  const float32_t *pCoeffs = S->pCoeffs;         /* polynomial coefficients */
+  uint32_t lastInt = S->nValues - 2u;            /* index of the last interval */
+  float32_t xFirst = pXData[0];                  /* first knot */
+  float32_t xLast = pXData[lastInt + 1u];        /* last knot */
+  float32_t yLast = pYData[lastInt + 1u];        /* value at the last knot */
+  float32_t dyLast;                              /* slope at the last knot */
+  float32_t x, t, h;                             /* input point and offsets */
+  const float32_t *pC;                           /* coefficients of the current interval */
+  uint32_t i = 0u;                               /* current interval */
+  uint32_t lo, hi, mid;                          /* binary search bounds */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  /* Derivative of the last polynomial at the last knot */
+  pC = pCoeffs + (3u * lastInt);
+  h = xLast - pXData[lastInt];
+  dyLast = pC[0] + h * (2.0f * pC[1] + 3.0f * h * pC[2]);
+
+  while(blkCnt > 0u)
+  {
+    x = *pX++;
+
+    if(x < xFirst)
+    {
+      /* Tangent at the first knot */
+      *pY++ = pYData[0] + pCoeffs[0] * (x - xFirst);
+    }
+    else if(x >= xLast)
+    {
+      /* Tangent at the last knot */
+      *pY++ = yLast + dyLast * (x - xLast);
+    }
+    else
+    {
+      if((x < pXData[i]) || (x >= pXData[i + 1u]))
+      {
+        if((i < lastInt) && (x >= pXData[i + 1u]) && (x < pXData[i + 2u]))
+        {
+          /* Monotonic fast path: next interval */
+          i++;
+        }
+        else
+        {
+          /* Binary search for pXData[lo] <= x < pXData[lo + 1] */
+          lo = 0u;
+          hi = lastInt + 1u;
+
+          while(hi - lo > 1u)
+          {
+            mid = (lo + hi) >> 1u;
+
+            if(x < pXData[mid])
+            {
+              hi = mid;
+            }
+            else
+            {
+              lo = mid;
+            }
+          }
+
+          i = lo;
+        }
+      }
+
+      pC = pCoeffs + (3u * i);
+      t = x - pXData[i];
+
+      /* Horner evaluation of y[i] + b*t + c*t^2 + d*t^3 */
+      *pY++ = pYData[i] + t * (pC[0] + t * (pC[1] + t * pC[2]));
+    }
+
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of SplineInterpolate group    
+ */
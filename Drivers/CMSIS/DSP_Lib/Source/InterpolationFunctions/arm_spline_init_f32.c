@@ -0,0 +1,205 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_spline_init_f32.c    
+*    
+* Description:	Initialization function for the floating-point cubic spline.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupInterpolation    
+ */
+
+/**    
+ * @defgroup SplineInterpolate Cubic Spline Interpolation    
+ *    
+ * A cubic spline passes a piecewise third-order polynomial through a set of    
+ * knots <code>(x[i], y[i])</code> with continuous first and second    
+ * derivatives.  The knots do not need to be evenly spaced, which makes the    
+ * spline a good fit for sensor linearisation tables measured at irregular    
+ * points.    
+ *    
+ * \par Algorithm:    
+ * On the interval <code>x[i] <= x < x[i+1]</code> the spline is    
+ * <pre>    
+ *     S(x) = y[i] + b[i] * t + c[i] * t^2 + d[i] * t^3,   t = x - x[i]    
+ * </pre>    
+ * The coefficients are computed once by arm_spline_init_f32(), which solves    
+ * the tridiagonal system for <code>c[i]</code> with the Thomas algorithm.    
+ * Two end conditions are supported:    
+ * - ARM_SPLINE_NATURAL: the second derivative is zero at both ends.    
+ * - ARM_SPLINE_CLAMPED: the first derivative at both ends is given.    
+ *    
+ * \par    
+ * arm_spline_f32() evaluates a block of points.  The interval of the    
+ * previous point is kept, so increasing points usually find their interval    
+ * with a single comparison; other points fall back to a binary search.    
+ * Outside the knot range the spline is continued along its tangent at the    
+ * first or last knot.    
+ */
+
+/**    
+ * @addtogroup SplineInterpolate    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point cubic spline.    
+ * @param[in,out] *S         points to an instance of the spline structure.    
+ * @param[in]     type       end conditions of the spline.    
+ * @param[in]     *pXData    points to the knot abscissas, strictly increasing.    
+ * @param[in]     *pYData    points to the knot values.    
+ * @param[in]     nValues    number of knots, at least 2.    
+ * @param[in]     dyStart    first derivative at the first knot (ARM_SPLINE_CLAMPED only).    
+ * @param[in]     dyEnd      first derivative at the last knot (ARM_SPLINE_CLAMPED only).    
+ * @param[out]    *pCoeffs   points to the coefficient buffer of 3*(nValues-1) values.    
+ * @param[in]     *pTemp     points to a temporary buffer of 2*nValues values.    
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR    
+ * if there are fewer than 2 knots, the abscissas are not strictly increasing or    
+ * the type is unknown.    
+ *    
+ * \par    
+ * <code>pXData</code> and <code>pYData</code> are referenced by the instance    
+ * and must stay valid while the spline is used.  <code>pTemp</code> is only    
+ * used during initialization.    
+ */
+
+arm_status arm_spline_init_f32(
+  arm_spline_instance_f32 * S,
+  arm_spline_type type,
+  const float32_t * pXData,
+  const float32_t * pYData,
+  uint32_t nValues,
+  float32_t dyStart,
+  float32_t dyEnd,
+  float32_t * pCoeffs,
+  float32_t * pTemp)
+{
+  float32_t *pU = pTemp;                         /* modified super-diagonal */
+  float32_t *pZ = pTemp + nValues;               /* modified right-hand side, then c */
+  float32_t hPrev, h;                            /* interval widths */
+  float32_t sPrev, s;                            /* interval slopes */
+  float32_t m;                                   /* pivot */
+  uint32_t i;                                    /* loop counter */
+
+  if((nValues < 2u) ||
+     ((type != ARM_SPLINE_NATURAL) && (type != ARM_SPLINE_CLAMPED)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < nValues - 1u; i++)
+  {
+    if(pXData[i + 1u] <= pXData[i])
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  /* First row */
+  h = pXData[1] - pXData[0];
+  s = (pYData[1] - pYData[0]) / h;
+
+  if(type == ARM_SPLINE_CLAMPED)
+  {
+    /* 2*h0*c0 + h0*c1 = 3*(s0 - dyStart) */
+    pU[0] = 0.5f;
+    pZ[0] = 1.5f * (s - dyStart) / h;
+  }
+  else
+  {
+    /* c0 = 0 */
+    pU[0] = 0.0f;
+    pZ[0] = 0.0f;
+  }
+
+  /* Forward sweep over the interior knots:
+   * h[i-1]*c[i-1] + 2*(h[i-1]+h[i])*c[i] + h[i]*c[i+1] = 3*(s[i] - s[i-1]) */
+  for (i = 1u; i < nValues - 1u; i++)
+  {
+    hPrev = h;
+    sPrev = s;
+    h = pXData[i + 1u] - pXData[i];
+    s = (pYData[i + 1u] - pYData[i]) / h;
+
+    m = 2.0f * (hPrev + h) - hPrev * pU[i - 1u];
+    pU[i] = h / m;
+    pZ[i] = (3.0f * (s - sPrev) - hPrev * pZ[i - 1u]) / m;
+  }
+
+  /* Last row */
+  if(type == ARM_SPLINE_CLAMPED)
+  {
+    /* h[n-2]*c[n-2] + 2*h[n-2]*c[n-1] = 3*(dyEnd - s[n-2]) */
+    m = 2.0f * h - h * pU[nValues - 2u];
+    pZ[nValues - 1u] = (3.0f * (dyEnd - s) - h * pZ[nValues - 2u]) / m;
+  }
+  else
+  {
+    /* c[n-1] = 0 */
+    pZ[nValues - 1u] = 0.0f;
+  }
+
+  /* Back substitution, c[i] overwrites pZ[i] */
+  for (i = nValues - 1u; i > 0u; i--)
+  {
+    pZ[i - 1u] -= pU[i - 1u] * pZ[i];
+  }
+
+  /* Polynomial coefficients of each interval */
+  for (i = 0u; i < nValues - 1u; i++)
+  {
+    h = pXData[i + 1u] - pXData[i];
+    s = (pYData[i + 1u] - pYData[i]) / h;
+
+    pCoeffs[3u * i] = s - h * (2.0f * pZ[i] + pZ[i + 1u]) / 3.0f;
+    pCoeffs[3u * i + 1u] = pZ[i];
+    pCoeffs[3u * i + 2u] = (pZ[i + 1u] - pZ[i]) / (3.0f * h);
+  }
+
+  S->type = type;
+  S->pXData = pXData;
+  S->pYData = pYData;
+  S->nValues = nValues;
+  S->pCoeffs = pCoeffs;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of SplineInterpolate group    
+ */
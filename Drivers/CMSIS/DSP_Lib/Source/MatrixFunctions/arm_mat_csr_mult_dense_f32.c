@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_mat_csr_mult_dense_f32.c    
+*    
+* Description:	floating-point CSR sparse matrix times dense matrix    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup SparseMatrix    
+ * @{    
+ */
+
+/**    
+ * @brief  Floating-point multiplication of a CSR sparse matrix by a dense matrix.    
+ * @param[in]  *pSrcA     points to the CSR sparse matrix.    
+ * @param[in]  *pSrcB     points to the dense matrix.    
+ * @param[out] *pDst      points to the dense output matrix.    
+ * @return     		The function returns either    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.    
+ *    
+ * \par    
+ * The cost is proportional to <code>nnz * pSrcB->numCols</code> rather than    
+ * <code>numRows * numCols * pSrcB->numCols</code>.    
+ */
+
+arm_status arm_mat_csr_mult_dense_f32(
+  const arm_matrix_csr_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pA = pSrcA->pData;            /* stored values of A */
+  const float32_t *pB = pSrcB->pData;            /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pY;                                 /* output row pointer */
+  const float32_t *pIn;                          /* input row pointer of B */
+  float32_t a;                                   /* stored value of A */
+  uint16_t numRows = pSrcA->numRows;             /* number of rows of A */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of B */
+  uint32_t row, col, k;                          /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (row = 0u; row < numRows; row++)
+    {
+      /* Each row of the result is a sum of rows of B, scaled by the stored    
+       * values of the same row of A */
+      arm_fill_f32(0.0f, pOut, numColsB);
+
+      for (k = pSrcA->pRowPtr[row]; k < pSrcA->pRowPtr[row + 1u]; k++)
+      {
+        a = pA[k];
+        pIn = pB + (uint32_t) pSrcA->pColIdx[k] * numColsB;
+        pY = pOut;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolling */
+        col = numColsB >> 2u;
+
+        while(col > 0u)
+        {
+          pY[0] += a * pIn[0];
+          pY[1] += a * pIn[1];
+          pY[2] += a * pIn[2];
+          pY[3] += a * pIn[3];
+
+          pY += 4u;
+          pIn += 4u;
+          col--;
+        }
+
+        col = numColsB % 0x4u;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        col = numColsB;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        while(col > 0u)
+        {
+          *pY++ += a * *pIn++;
+          col--;
+        }
+      }
+
+      pOut += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of SparseMatrix group    
+ */
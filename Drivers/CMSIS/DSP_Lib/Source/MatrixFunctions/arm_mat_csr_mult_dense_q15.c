@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_mat_csr_mult_dense_q15.c    
+*    
+* Description:	Q15 CSR sparse matrix times dense matrix    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup SparseMatrix    
+ * @{    
+ */
+
+/**    
+ * @brief  Q15 multiplication of a CSR sparse matrix by a dense matrix.    
+ * @param[in]  *pSrcA     points to the CSR sparse matrix.    
+ * @param[in]  *pSrcB     points to the dense matrix.    
+ * @param[out] *pDst      points to the dense output matrix.    
+ * @return     		The function returns either    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * Each output is accumulated in a 64-bit accumulator in 34.30 format, which    
+ * is shifted right by 15 bits and saturated to 1.15 format.    
+ *    
+ * \par    
+ * The cost is proportional to <code>nnz * pSrcB->numCols</code> rather than    
+ * <code>numRows * numCols * pSrcB->numCols</code>.    
+ */
+
+arm_status arm_mat_csr_mult_dense_q15(
+  const arm_matrix_csr_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst)
+{
+  const q15_t *pA = pSrcA->pData;                /* stored values of A */
+  const q15_t *pB = pSrcB->pData;                /* input data matrix pointer B */
+  q15_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  q63_t sum;                                     /* accumulator */
+  uint16_t numRows = pSrcA->numRows;             /* number of rows of A */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of B */
+  uint32_t row, col, k;                          /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (row = 0u; row < numRows; row++)
+    {
+      for (col = 0u; col < numColsB; col++)
+      {
+        /* Dot product of the compressed row of A with one column of B */
+        sum = 0;
+
+        for (k = pSrcA->pRowPtr[row]; k < pSrcA->pRowPtr[row + 1u]; k++)
+        {
+          sum += (q63_t) pA[k] * pB[(uint32_t) pSrcA->pColIdx[k] * numColsB + col];
+        }
+
+        /* Convert the result from 34.30 to 1.15 format */
+        *pOut++ = (q15_t) __SSAT((sum >> 15), 16);
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of SparseMatrix group    
+ */
@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_mat_csr_trans_vec_mult_f32.c    
+*    
+* Description:	floating-point sparse matrix-vector multiplication (scatter form)    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup SparseMatrix    
+ * @{    
+ */
+
+/**    
+ * @brief Scatter kernel: each input sample is spread over one compressed row.    
+ */
+
+static void arm_mat_sparse_scatter_f32(
+  const float32_t * pData,
+  const uint16_t * pIdx,
+  const uint32_t * pPtr,
+  uint16_t numOuter,
+  uint16_t numInner,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  const float32_t *pA = pData + pPtr[0];         /* stored values */
+  const uint16_t *pI = pIdx + pPtr[0];           /* inner indices */
+  float32_t x;                                   /* current input sample */
+  uint32_t outer;                                /* outer loop counter */
+  uint32_t cnt;                                  /* inner loop counter */
+
+  arm_fill_f32(0.0f, pDst, numInner);
+
+  for (outer = 0u; outer < numOuter; outer++)
+  {
+    cnt = pPtr[outer + 1u] - pPtr[outer];
+    x = pVec[outer];
+
+    if(x == 0.0f)
+    {
+      /* Nothing to spread */
+      pA += cnt;
+      pI += cnt;
+      continue;
+    }
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling */
+    while(cnt >= 4u)
+    {
+      pDst[pI[0]] += pA[0] * x;
+      pDst[pI[1]] += pA[1] * x;
+      pDst[pI[2]] += pA[2] * x;
+      pDst[pI[3]] += pA[3] * x;
+
+      pA += 4u;
+      pI += 4u;
+      cnt -= 4u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(cnt > 0u)
+    {
+      pDst[*pI++] += *pA++ * x;
+      cnt--;
+    }
+  }
+}
+
+/**    
+ * @brief  Floating-point CSR sparse matrix-vector multiplication, y = A<sup>T</sup> * x.    
+ * @param[in]  *pSrcA     points to the sparse matrix.    
+ * @param[in]  *pVec      points to the input vector of numRows samples.    
+ * @param[out] *pDst      points to the output vector of numCols samples.    
+ * @return     none.    
+ *    
+ * \par    
+ * Input samples equal to zero are skipped.    
+ *    
+ */
+
+void arm_mat_csr_trans_vec_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  arm_mat_sparse_scatter_f32(pSrcA->pData, pSrcA->pColIdx, pSrcA->pRowPtr,
+                            pSrcA->numRows, pSrcA->numCols, pVec, pDst);
+}
+
+/**    
+ * @brief  Floating-point CSC sparse matrix-vector multiplication, y = A * x.    
+ * @param[in]  *pSrcA     points to the sparse matrix.    
+ * @param[in]  *pVec      points to the input vector of numCols samples.    
+ * @param[out] *pDst      points to the output vector of numRows samples.    
+ * @return     none.    
+ *    
+ * \par    
+ * Input samples equal to zero are skipped.    
+ *    
+ */
+
+void arm_mat_csc_vec_mult_f32(
+  const arm_matrix_csc_instance_f32 * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  arm_mat_sparse_scatter_f32(pSrcA->pData, pSrcA->pRowIdx, pSrcA->pColPtr,
+                            pSrcA->numCols, pSrcA->numRows, pVec, pDst);
+}
+
+/**    
+ * @} end of SparseMatrix group    
+ */
@@ -0,0 +1,177 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_mat_csr_trans_vec_mult_q31.c    
+*    
+* Description:	Q31 sparse matrix-vector multiplication (scatter form)    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup SparseMatrix    
+ * @{    
+ */
+
+/**    
+ * @brief Scatter kernel: each input sample is spread over one compressed row.    
+ */
+
+static void arm_mat_sparse_scatter_q31(
+  const q31_t * pData,
+  const uint16_t * pIdx,
+  const uint32_t * pPtr,
+  uint16_t numOuter,
+  uint16_t numInner,
+  const q31_t * pVec,
+  q31_t * pDst,
+  q63_t * pScratch)
+{
+  const q31_t *pA = pData + pPtr[0];             /* stored values */
+  const uint16_t *pI = pIdx + pPtr[0];           /* inner indices */
+  q31_t x;                                       /* current input sample */
+  uint32_t outer;                                /* outer loop counter */
+  uint32_t cnt;                                  /* inner loop counter */
+
+  for (cnt = 0u; cnt < numInner; cnt++)
+  {
+    pScratch[cnt] = 0;
+  }
+
+  for (outer = 0u; outer < numOuter; outer++)
+  {
+    cnt = pPtr[outer + 1u] - pPtr[outer];
+    x = pVec[outer];
+
+    if(x == 0)
+    {
+      /* Nothing to spread */
+      pA += cnt;
+      pI += cnt;
+      continue;
+    }
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling */
+    while(cnt >= 4u)
+    {
+      pScratch[pI[0]] += (q63_t) pA[0] * x;
+      pScratch[pI[1]] += (q63_t) pA[1] * x;
+      pScratch[pI[2]] += (q63_t) pA[2] * x;
+      pScratch[pI[3]] += (q63_t) pA[3] * x;
+
+      pA += 4u;
+      pI += 4u;
+      cnt -= 4u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(cnt > 0u)
+    {
+      pScratch[*pI++] += (q63_t) * pA++ * x;
+      cnt--;
+    }
+  }
+
+  /* Convert the results from 2.62 to 1.31 format */
+  for (cnt = 0u; cnt < numInner; cnt++)
+  {
+    pDst[cnt] = clip_q63_to_q31(pScratch[cnt] >> 31);
+  }
+}
+
+/**    
+ * @brief  Q31 CSR sparse matrix-vector multiplication, y = A<sup>T</sup> * x.    
+ * @param[in]  *pSrcA     points to the sparse matrix.    
+ * @param[in]  *pVec      points to the input vector of numRows samples.    
+ * @param[out] *pDst      points to the output vector of numCols samples.    
+ * @param[in]  *pScratch  points to a scratch buffer of numCols accumulators.    
+ * @return     none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The products are accumulated in the 64-bit scratch buffer in 2.62 format,    
+ * which is shifted right by 31 bits and saturated to 1.31 format.    
+ * Input samples equal to zero are skipped.    
+ *    
+ */
+
+void arm_mat_csr_trans_vec_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcA,
+  const q31_t * pVec,
+  q31_t * pDst,
+  q63_t * pScratch)
+{
+  arm_mat_sparse_scatter_q31(pSrcA->pData, pSrcA->pColIdx, pSrcA->pRowPtr,
+                            pSrcA->numRows, pSrcA->numCols, pVec, pDst, pScratch);
+}
+
+/**    
+ * @brief  Q31 CSC sparse matrix-vector multiplication, y = A * x.    
+ * @param[in]  *pSrcA     points to the sparse matrix.    
+ * @param[in]  *pVec      points to the input vector of numCols samples.    
+ * @param[out] *pDst      points to the output vector of numRows samples.    
+ * @param[in]  *pScratch  points to a scratch buffer of numRows accumulators.    
+ * @return     none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The products are accumulated in the 64-bit scratch buffer in 2.62 format,    
+ * which is shifted right by 31 bits and saturated to 1.31 format.    
+ * Input samples equal to zero are skipped.    
+ *    
+ */
+
+void arm_mat_csc_vec_mult_q31(
+  const arm_matrix_csc_instance_q31 * pSrcA,
+  const q31_t * pVec,
+  q31_t * pDst,
+  q63_t * pScratch)
+{
+  arm_mat_sparse_scatter_q31(pSrcA->pData, pSrcA->pRowIdx, pSrcA->pColPtr,
+                            pSrcA->numCols, pSrcA->numRows, pVec, pDst, pScratch);
+}
+
+/**    
+ * @} end of SparseMatrix group    
+ */
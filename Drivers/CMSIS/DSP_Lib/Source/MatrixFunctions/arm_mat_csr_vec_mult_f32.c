@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_mat_csr_vec_mult_f32.c    
+*    
+* Description:	floating-point sparse matrix-vector multiplication (gather form)    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup SparseMatrix    
+ * @{    
+ */
+
+/**    
+ * @brief Gather kernel: each output is the dot product of one compressed row.    
+ */
+
+static void arm_mat_sparse_gather_f32(
+  const float32_t * pData,
+  const uint16_t * pIdx,
+  const uint32_t * pPtr,
+  uint16_t numOuter,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  const float32_t *pA = pData + pPtr[0];         /* stored values */
+  const uint16_t *pI = pIdx + pPtr[0];           /* inner indices */
+  float32_t sum;                                 /* accumulator */
+  uint32_t outer = numOuter;                     /* outer loop counter */
+  uint32_t cnt;                                  /* inner loop counter */
+
+  while(outer > 0u)
+  {
+    cnt = pPtr[1] - pPtr[0];
+    pPtr++;
+
+    sum = 0.0f;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling */
+    while(cnt >= 4u)
+    {
+      sum += pA[0] * pVec[pI[0]];
+      sum += pA[1] * pVec[pI[1]];
+      sum += pA[2] * pVec[pI[2]];
+      sum += pA[3] * pVec[pI[3]];
+
+      pA += 4u;
+      pI += 4u;
+      cnt -= 4u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(cnt > 0u)
+    {
+      sum += *pA++ * pVec[*pI++];
+      cnt--;
+    }
+
+    *pDst++ = sum;
+
+    outer--;
+  }
+}
+
+/**    
+ * @brief  Floating-point CSR sparse matrix-vector multiplication, y = A * x.    
+ * @param[in]  *pSrcA     points to the sparse matrix.    
+ * @param[in]  *pVec      points to the input vector of numCols samples.    
+ * @param[out] *pDst      points to the output vector of numRows samples.    
+ * @return     none.    
+ *    
+ */
+
+void arm_mat_csr_vec_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  arm_mat_sparse_gather_f32(pSrcA->pData, pSrcA->pColIdx, pSrcA->pRowPtr,
+                           pSrcA->numRows, pVec, pDst);
+}
+
+/**    
+ * @brief  Floating-point CSC sparse matrix-vector multiplication, y = A<sup>T</sup> * x.    
+ * @param[in]  *pSrcA     points to the sparse matrix.    
+ * @param[in]  *pVec      points to the input vector of numRows samples.    
+ * @param[out] *pDst      points to the output vector of numCols samples.    
+ * @return     none.    
+ *    
+ */
+
+void arm_mat_csc_trans_vec_mult_f32(
+  const arm_matrix_csc_instance_f32 * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  arm_mat_sparse_gather_f32(pSrcA->pData, pSrcA->pRowIdx, pSrcA->pColPtr,
+                           pSrcA->numCols, pVec, pDst);
+}
+
+/**    
+ * @} end of SparseMatrix group    
+ */
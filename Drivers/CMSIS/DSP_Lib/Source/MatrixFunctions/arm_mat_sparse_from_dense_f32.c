@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_mat_sparse_from_dense_f32.c    
+*    
+* Description:	Conversion of floating-point dense matrices to sparse storage    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup SparseMatrix    
+ * @{    
+ */
+
+/**    
+ * @brief  Converts a floating-point dense matrix to CSR storage.    
+ * @param[in]     *pSrc    points to the dense matrix.    
+ * @param[in,out] *pDst    points to the CSR matrix, whose buffers are already assigned.    
+ * @param[in]     maxNnz   capacity of the pData and index buffers of pDst.    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the    
+ * dimensions differ, <code>ARM_MATH_LENGTH_ERROR</code> if the matrix has more than    
+ * maxNnz non-zero values, and <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * Only values that compare equal to zero are dropped.  <code>pDst->nnz</code>    
+ * is set to the number of stored values.    
+ */
+
+arm_status arm_mat_csr_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_csr_instance_f32 * pDst,
+  uint32_t maxNnz)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  uint16_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint16_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  uint32_t outer, inner;                         /* loop counters */
+  uint32_t nnz = 0u;                             /* number of stored values */
+  float32_t value;                               /* current value */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pDst->numRows != numRows) || (pDst->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (outer = 0u; outer < numRows; outer++)
+  {
+    pDst->pRowPtr[outer] = nnz;
+
+    for (inner = 0u; inner < numCols; inner++)
+    {
+      value = pIn[(outer * numCols) + inner];
+
+      if(value != 0)
+      {
+        if(nnz == maxNnz)
+        {
+          return (ARM_MATH_LENGTH_ERROR);
+        }
+
+        pDst->pData[nnz] = value;
+        pDst->pColIdx[nnz] = (uint16_t) inner;
+        nnz++;
+      }
+    }
+  }
+
+  pDst->pRowPtr[numRows] = nnz;
+  pDst->nnz = nnz;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @brief  Converts a floating-point dense matrix to CSC storage.    
+ * @param[in]     *pSrc    points to the dense matrix.    
+ * @param[in,out] *pDst    points to the CSC matrix, whose buffers are already assigned.    
+ * @param[in]     maxNnz   capacity of the pData and index buffers of pDst.    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the    
+ * dimensions differ, <code>ARM_MATH_LENGTH_ERROR</code> if the matrix has more than    
+ * maxNnz non-zero values, and <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * Only values that compare equal to zero are dropped.  <code>pDst->nnz</code>    
+ * is set to the number of stored values.    
+ */
+
+arm_status arm_mat_csc_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_csc_instance_f32 * pDst,
+  uint32_t maxNnz)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  uint16_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint16_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  uint32_t outer, inner;                         /* loop counters */
+  uint32_t nnz = 0u;                             /* number of stored values */
+  float32_t value;                               /* current value */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pDst->numRows != numRows) || (pDst->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (outer = 0u; outer < numCols; outer++)
+  {
+    pDst->pColPtr[outer] = nnz;
+
+    for (inner = 0u; inner < numRows; inner++)
+    {
+      value = pIn[(inner * numCols) + outer];
+
+      if(value != 0)
+      {
+        if(nnz == maxNnz)
+        {
+          return (ARM_MATH_LENGTH_ERROR);
+        }
+
+        pDst->pData[nnz] = value;
+        pDst->pRowIdx[nnz] = (uint16_t) inner;
+        nnz++;
+      }
+    }
+  }
+
+  pDst->pColPtr[numCols] = nnz;
+  pDst->nnz = nnz;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of SparseMatrix group    
+ */
@@ -0,0 +1,158 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_mat_sparse_init_f32.c    
+*    
+* Description:	floating-point sparse matrix initialization function    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup SparseMatrix Sparse Matrix Functions    
+ *    
+ * Sparse matrices store only their non-zero values.  Two layouts are    
+ * supported:    
+ * - CSR (compressed sparse row): the values are stored row by row,    
+ *   <code>pColIdx[k]</code> holds the column of <code>pData[k]</code> and row    
+ *   <code>i</code> occupies <code>pData[pRowPtr[i]]</code> to    
+ *   <code>pData[pRowPtr[i+1]-1]</code>.    
+ * - CSC (compressed sparse column): the same with rows and columns swapped,    
+ *   using <code>pRowIdx</code> and <code>pColPtr</code>.    
+ *    
+ * \par    
+ * A matrix with <code>nnz</code> values needs <code>nnz</code> values,    
+ * <code>nnz</code> 16-bit indices and <code>numRows+1</code> (CSR) or    
+ * <code>numCols+1</code> (CSC) 32-bit pointers, instead of    
+ * <code>numRows*numCols</code> values for the dense form.    
+ *    
+ * \par    
+ * The CSR layout of a matrix is the CSC layout of its transpose.  The    
+ * matrix-vector products therefore come in two shapes: a gather, where each    
+ * output is the dot product of one compressed row (CSR A*x, CSC A<sup>T</sup>*x),    
+ * and a scatter, where each input sample is spread over one compressed    
+ * column (CSR A<sup>T</sup>*x, CSC A*x).  The gather is the faster of the two.    
+ * The fixed-point scatter functions accumulate into a caller-supplied scratch    
+ * buffer so that they keep the precision of the gather.    
+ *    
+ * \par Fixed-Point Behavior    
+ * The Q31 products are accumulated in 2.62 format and the Q15 products in    
+ * 34.30 format; the results are saturated to 1.31 and 1.15.    
+ */
+
+/**    
+ * @addtogroup SparseMatrix    
+ * @{    
+ */
+
+/**    
+ * @brief  Floating-point CSR sparse matrix initialization.    
+ * @param[in,out] *S         points to an instance of the floating-point CSR matrix structure.    
+ * @param[in]     nRows      number of rows in the matrix.    
+ * @param[in]     nColumns   number of columns in the matrix.    
+ * @param[in]     nnz        number of stored values.    
+ * @param[in]     *pData     points to the stored values.    
+ * @param[in]     *pColIdx  points to the column indices.    
+ * @param[in]     *pRowPtr  points to the row pointers.    
+ * @return        none    
+ */
+
+void arm_mat_csr_init_f32(
+  arm_matrix_csr_instance_f32 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint32_t nnz,
+  float32_t * pData,
+  uint16_t * pColIdx,
+  uint32_t * pRowPtr)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Number of Columns */
+  S->numCols = nColumns;
+
+  /* Assign Number of stored values */
+  S->nnz = nnz;
+
+  /* Assign Data Array pointers */
+  S->pData = pData;
+  S->pColIdx = pColIdx;
+  S->pRowPtr = pRowPtr;
+}
+
+/**    
+ * @brief  Floating-point CSC sparse matrix initialization.    
+ * @param[in,out] *S         points to an instance of the floating-point CSC matrix structure.    
+ * @param[in]     nRows      number of rows in the matrix.    
+ * @param[in]     nColumns   number of columns in the matrix.    
+ * @param[in]     nnz        number of stored values.    
+ * @param[in]     *pData     points to the stored values.    
+ * @param[in]     *pRowIdx  points to the row indices.    
+ * @param[in]     *pColPtr  points to the column pointers.    
+ * @return        none    
+ */
+
+void arm_mat_csc_init_f32(
+  arm_matrix_csc_instance_f32 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint32_t nnz,
+  float32_t * pData,
+  uint16_t * pRowIdx,
+  uint32_t * pColPtr)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Number of Columns */
+  S->numCols = nColumns;
+
+  /* Assign Number of stored values */
+  S->nnz = nnz;
+
+  /* Assign Data Array pointers */
+  S->pData = pData;
+  S->pRowIdx = pRowIdx;
+  S->pColPtr = pColPtr;
+}
+
+/**    
+ * @} end of SparseMatrix group    
+ */
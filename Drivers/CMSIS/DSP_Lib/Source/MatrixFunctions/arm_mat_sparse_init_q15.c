@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_mat_sparse_init_q15.c    
+*    
+* Description:	Q15 sparse matrix initialization function    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup SparseMatrix    
+ * @{    
+ */
+
+/**    
+ * @brief  Q15 CSR sparse matrix initialization.    
+ * @param[in,out] *S         points to an instance of the Q15 CSR matrix structure.    
+ * @param[in]     nRows      number of rows in the matrix.    
+ * @param[in]     nColumns   number of columns in the matrix.    
+ * @param[in]     nnz        number of stored values.    
+ * @param[in]     *pData     points to the stored values.    
+ * @param[in]     *pColIdx  points to the column indices.    
+ * @param[in]     *pRowPtr  points to the row pointers.    
+ * @return        none    
+ */
+
+void arm_mat_csr_init_q15(
+  arm_matrix_csr_instance_q15 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint32_t nnz,
+  q15_t * pData,
+  uint16_t * pColIdx,
+  uint32_t * pRowPtr)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Number of Columns */
+  S->numCols = nColumns;
+
+  /* Assign Number of stored values */
+  S->nnz = nnz;
+
+  /* Assign Data Array pointers */
+  S->pData = pData;
+  S->pColIdx = pColIdx;
+  S->pRowPtr = pRowPtr;
+}
+
+/**    
+ * @brief  Q15 CSC sparse matrix initialization.    
+ * @param[in,out] *S         points to an instance of the Q15 CSC matrix structure.    
+ * @param[in]     nRows      number of rows in the matrix.    
+ * @param[in]     nColumns   number of columns in the matrix.    
+ * @param[in]     nnz        number of stored values.    
+ * @param[in]     *pData     points to the stored values.    
+ * @param[in]     *pRowIdx  points to the row indices.    
+ * @param[in]     *pColPtr  points to the column pointers.    
+ * @return        none    
+ */
+
+void arm_mat_csc_init_q15(
+  arm_matrix_csc_instance_q15 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint32_t nnz,
+  q15_t * pData,
+  uint16_t * pRowIdx,
+  uint32_t * pColPtr)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Number of Columns */
+  S->numCols = nColumns;
+
+  /* Assign Number of stored values */
+  S->nnz = nnz;
+
+  /* Assign Data Array pointers */
+  S->pData = pData;
+  S->pRowIdx = pRowIdx;
+  S->pColPtr = pColPtr;
+}
+
+/**    
+ * @} end of SparseMatrix group    
+ */
@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_mat_vec_mult_f16.c    
+*    
+* Description:	Half-precision matrix times floating-point vector.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixVectMult Matrix Vector Multiplication    
+ *    
+ * Multiplies a matrix by a vector, <code>pDst = pSrcMat * pVec</code>.    
+ * The matrix has <code>numRows</code> rows and <code>numCols</code> columns,    
+ * the input vector has <code>numCols</code> samples and the output vector    
+ * <code>numRows</code> samples.    
+ */
+
+/**    
+ * @addtogroup MatrixVectMult    
+ * @{    
+ */
+
+/**    
+ * @brief  Multiplication of a half-precision matrix by a floating-point vector.    
+ * @param[in]  *pSrcMat points to the half-precision matrix.    
+ * @param[in]  *pVec    points to the input vector of numCols samples.    
+ * @param[out] *pDst    points to the output vector of numRows samples.    
+ * @return     none.    
+ *    
+ * \par    
+ * The matrix is stored in half-precision, typically a weight matrix held in    
+ * external memory, and the vector in floating-point.  Each matrix element is    
+ * converted to floating-point before it is multiplied, so the result has the    
+ * precision of a floating-point product while the matrix takes half the    
+ * memory and half the bus traffic.  On Cortex-M4 and Cortex-M3 the matrix is    
+ * read two elements at a time with 32-bit loads.    
+ */
+
+void arm_mat_vec_mult_f16(
+  const arm_matrix_instance_f16 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  const float16_t *pA = pSrcMat->pData;          /* matrix data pointer */
+  const float32_t *pX;                           /* input vector pointer */
+  float32_t sum;                                 /* accumulator */
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row, col;                             /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t in1, in2;                                /* two packed matrix elements */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  for (row = 0u; row < numRows; row++)
+  {
+    pX = pVec;
+    sum = 0.0f;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling */
+    col = numCols >> 2u;
+
+    while(col > 0u)
+    {
+      /* Read two matrix elements with one load */
+      in1 = *__SIMD32(pA)++;
+      in2 = *__SIMD32(pA)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      sum += arm_float16_to_float32((float16_t) in1) * pX[0];
+      sum += arm_float16_to_float32((float16_t) (in1 >> 16)) * pX[1];
+      sum += arm_float16_to_float32((float16_t) in2) * pX[2];
+      sum += arm_float16_to_float32((float16_t) (in2 >> 16)) * pX[3];
+
+#else
+
+      sum += arm_float16_to_float32((float16_t) (in1 >> 16)) * pX[0];
+      sum += arm_float16_to_float32((float16_t) in1) * pX[1];
+      sum += arm_float16_to_float32((float16_t) (in2 >> 16)) * pX[2];
+      sum += arm_float16_to_float32((float16_t) in2) * pX[3];
+
+#endif /*      #ifndef ARM_MATH_BIG_ENDIAN    */
+
+      pX += 4u;
+      col--;
+    }
+
+    col = numCols % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    col = numCols;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(col > 0u)
+    {
+      sum += arm_float16_to_float32(*pA++) * *pX++;
+      col--;
+    }
+
+    *pDst++ = sum;
+  }
+}
+
+/**    
+ * @} end of MatrixVectMult group    
+ */
@@ -0,0 +1,225 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_nn_conv_HWC_q15.c    
+*    
+* Description:	Q15 convolution layer using im2col and a Q15 GEMM.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @addtogroup NNConv    
+ * @{    
+ */
+
+/**    
+ * @brief Q15 convolution layer (im2col + GEMM).    
+ * @param[in]  *S       points to an instance of the Q15 convolution structure.    
+ * @param[in]  *pSrc    points to the input feature map [dimInY][dimInX][chIn].    
+ * @param[out] *pDst    points to the output feature map [dimOutY][dimOutX][chOut].    
+ * @param[in]  *pBuffer points to the im2col scratch buffer, see arm_nn_conv_buffer_size_q15().    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The products are in 2.30 format and are accumulated in a 32-bit    
+ * accumulator together with the bias shifted left by <code>biasShift</code>.    
+ * There is no internal saturation, so the weights must be scaled such that    
+ * the accumulator does not wrap around.  The accumulator is rounded, shifted    
+ * right by <code>outShift</code> and saturated to 1.15 format.    
+ */
+
+void arm_nn_conv_HWC_q15(
+  const arm_nn_conv_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  q15_t * pBuffer)
+{
+  const q15_t *pIn;                              /* Temporary pointer to the input */
+  q15_t *pW;                                     /* Temporary pointer to the weights */
+  q15_t *pCol;                                   /* Temporary pointer to the column buffer */
+  q31_t acc0;                                    /* Accumulator */
+  q31_t round;                                   /* Rounding offset */
+  int32_t iy, ix;                                /* Input coordinates */
+  uint32_t ox, oy, kx, ky;                       /* Loop counters */
+  uint32_t ch, cnt;                              /* Loop counters */
+  uint32_t colLen = (uint32_t) S->chIn * S->dimKerX * S->dimKerY;       /* Column length */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t acc1;                                    /* Accumulator */
+  q31_t inB;                                     /* Temporary variable to hold the column */
+  q15_t *pW2;                                    /* Temporary pointer to the second filter */
+  const q15_t *pBias;                            /* Temporary pointer to the bias */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  round = (S->outShift > 0u) ? ((q31_t) 1 << (S->outShift - 1u)) : 0;
+
+  for (oy = 0u; oy < S->dimOutY; oy++)
+  {
+    for (ox = 0u; ox < S->dimOutX; ox++)
+    {
+      /* im2col: gather the receptive field */
+      pCol = pBuffer;
+
+      for (ky = 0u; ky < S->dimKerY; ky++)
+      {
+        iy = (int32_t) (oy * S->strideY + ky) - (int32_t) S->padY;
+
+        for (kx = 0u; kx < S->dimKerX; kx++)
+        {
+          ix = (int32_t) (ox * S->strideX + kx) - (int32_t) S->padX;
+
+          if((iy < 0) || (iy >= (int32_t) S->dimInY) ||
+             (ix < 0) || (ix >= (int32_t) S->dimInX))
+          {
+            /* Zero padding */
+            memset(pCol, 0, S->chIn * sizeof(q15_t));
+          }
+          else
+          {
+            pIn = pSrc + ((uint32_t) iy * S->dimInX + (uint32_t) ix) * S->chIn;
+            memcpy(pCol, pIn, S->chIn * sizeof(q15_t));
+          }
+
+          pCol += S->chIn;
+        }
+      }
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      pW = (q15_t *) S->pWeights;
+      pBias = S->pBias;
+
+      /* Compute two output channels at a time so that each column load    
+       ** is shared by two filters */
+      ch = S->chOut >> 1u;
+
+      while(ch > 0u)
+      {
+        acc0 = ((q31_t) * pBias++ << S->biasShift) + round;
+        acc1 = ((q31_t) * pBias++ << S->biasShift) + round;
+
+        pCol = pBuffer;
+        pW2 = pW + colLen;
+        cnt = colLen >> 1u;
+
+        while(cnt > 0u)
+        {
+          /* Read two column samples and multiply them with two weights of each filter */
+          inB = *__SIMD32(pCol)++;
+          acc0 = __SMLAD(*__SIMD32(pW)++, inB, acc0);
+          acc1 = __SMLAD(*__SIMD32(pW2)++, inB, acc1);
+
+          cnt--;
+        }
+
+        /* Process the last sample of the column, if any */
+        if((colLen & 0x1u) != 0u)
+        {
+          acc0 += (q31_t) * pCol * *pW++;
+          acc1 += (q31_t) * pCol * *pW2;
+        }
+
+        *pDst++ = (q15_t) __SSAT((acc0 >> S->outShift), 16);
+        *pDst++ = (q15_t) __SSAT((acc1 >> S->outShift), 16);
+
+        /* Skip over the second filter */
+        pW += colLen;
+
+        ch--;
+      }
+
+      /* Process the last output channel, if any */
+      if((S->chOut & 0x1u) != 0u)
+      {
+        acc0 = ((q31_t) * pBias << S->biasShift) + round;
+
+        pCol = pBuffer;
+        cnt = colLen >> 1u;
+
+        while(cnt > 0u)
+        {
+          acc0 = __SMLAD(*__SIMD32(pW)++, *__SIMD32(pCol)++, acc0);
+          cnt--;
+        }
+
+        if((colLen & 0x1u) != 0u)
+        {
+          acc0 += (q31_t) * pCol * *pW;
+        }
+
+        *pDst++ = (q15_t) __SSAT((acc0 >> S->outShift), 16);
+      }
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      pW = (q15_t *) S->pWeights;
+
+      for (ch = 0u; ch < S->chOut; ch++)
+      {
+        acc0 = ((q31_t) S->pBias[ch] << S->biasShift) + round;
+
+        pCol = pBuffer;
+        cnt = colLen;
+
+        while(cnt > 0u)
+        {
+          acc0 += (q31_t) * pCol++ * *pW++;
+          cnt--;
+        }
+
+        *pDst++ = (q15_t) __SSAT((acc0 >> S->outShift), 16);
+      }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    }
+  }
+}
+
+/**    
+ * @} end of NNConv group    
+ */
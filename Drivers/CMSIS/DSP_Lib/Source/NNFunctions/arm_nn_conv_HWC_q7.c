@@ -0,0 +1,302 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_nn_conv_HWC_q7.c    
+*    
+* Description:	Q7 convolution layer using im2col and a Q7 x Q15 GEMM.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @defgroup NNConv Convolution Layers    
+ *    
+ * Convolution of a feature map stored in HWC order with a bank of filters.    
+ * Each filter spans all input channels and produces one output channel.    
+ * The output element at (y, x, c) is    
+ * <pre>    
+ *    pDst[y][x][c] = sat((bias[c] << biasShift) +    
+ *                        sum(pSrc[iy][ix][k] * w[c][ky][kx][k]) >> outShift)    
+ * </pre>    
+ * where <code>iy = y * strideY - padY + ky</code>, <code>ix = x * strideX - padX + kx</code>    
+ * and samples outside the input are taken as zero.    
+ *    
+ * \par Algorithm    
+ * The receptive field of each output pixel is first copied into a column    
+ * buffer (im2col), which turns the convolution into a matrix-vector product    
+ * between the weights and the column.  On Cortex-M4 and Cortex-M3 the column    
+ * is widened to 1.15 format and the product uses dual 16-bit MACs (__SMLAD),    
+ * with the Q7 weights sign extended on the fly by __SXTB16.    
+ *    
+ * \par Scratch Memory    
+ * The column buffer must hold <code>chIn * dimKerX * dimKerY</code> q15_t samples.    
+ * arm_nn_conv_buffer_size_q7() and arm_nn_conv_buffer_size_q15() return its    
+ * size in bytes.    
+ *    
+ * \par 1D Convolution    
+ * A 1D layer is a 2D layer of height one.  Initialize it with    
+ * arm_nn_conv_1d_init_q7() and process it with arm_nn_conv_HWC_q7().    
+ */
+
+/**    
+ * @addtogroup NNConv    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 convolution layer (im2col + GEMM).    
+ * @param[in]  *S       points to an instance of the Q7 convolution structure.    
+ * @param[in]  *pSrc    points to the input feature map [dimInY][dimInX][chIn].    
+ * @param[out] *pDst    points to the output feature map [dimOutY][dimOutX][chOut].    
+ * @param[in]  *pBuffer points to the im2col scratch buffer, see arm_nn_conv_buffer_size_q7().    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The products are in 2.14 format and are accumulated in a 32-bit    
+ * accumulator together with the bias shifted left by <code>biasShift</code>.    
+ * The accumulator is rounded, shifted right by <code>outShift</code> and    
+ * saturated to 1.7 format.    
+ */
+
+void arm_nn_conv_HWC_q7(
+  const arm_nn_conv_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst,
+  q15_t * pBuffer)
+{
+  const q7_t *pIn;                               /* Temporary pointer to the input */
+  q7_t *pW;                                      /* Temporary pointer to the weights */
+  q15_t *pCol;                                   /* Temporary pointer to the column buffer */
+  q31_t acc0;                                    /* Accumulator */
+  q31_t round;                                   /* Rounding offset */
+  int32_t iy, ix;                                /* Input coordinates */
+  uint32_t ox, oy, kx, ky;                       /* Loop counters */
+  uint32_t ch, cnt;                              /* Loop counters */
+  uint32_t colLen = (uint32_t) S->chIn * S->dimKerX * S->dimKerY;       /* Column length */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t acc1;                                    /* Accumulator */
+  q31_t inW, inW1, inW2;                         /* Temporary variables to hold the weights */
+  q31_t inB1, inB2;                              /* Temporary variables to hold the column */
+  q7_t *pW2;                                     /* Temporary pointer to the second filter */
+  const q7_t *pBias;                             /* Temporary pointer to the bias */
+  q15_t swap;                                    /* Temporary variable for reordering */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  round = (S->outShift > 0u) ? ((q31_t) 1 << (S->outShift - 1u)) : 0;
+
+  for (oy = 0u; oy < S->dimOutY; oy++)
+  {
+    for (ox = 0u; ox < S->dimOutX; ox++)
+    {
+      /* im2col: gather the receptive field widened to 1.15 */
+      pCol = pBuffer;
+
+      for (ky = 0u; ky < S->dimKerY; ky++)
+      {
+        iy = (int32_t) (oy * S->strideY + ky) - (int32_t) S->padY;
+
+        for (kx = 0u; kx < S->dimKerX; kx++)
+        {
+          ix = (int32_t) (ox * S->strideX + kx) - (int32_t) S->padX;
+
+          if((iy < 0) || (iy >= (int32_t) S->dimInY) ||
+             (ix < 0) || (ix >= (int32_t) S->dimInX))
+          {
+            /* Zero padding */
+            cnt = S->chIn;
+            while(cnt > 0u)
+            {
+              *pCol++ = 0;
+              cnt--;
+            }
+          }
+          else
+          {
+            pIn = pSrc + ((uint32_t) iy * S->dimInX + (uint32_t) ix) * S->chIn;
+            cnt = S->chIn;
+            while(cnt > 0u)
+            {
+              *pCol++ = (q15_t) * pIn++;
+              cnt--;
+            }
+          }
+        }
+      }
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Reorder each group of four samples as x0, x2, x1, x3 so that    
+       ** it lines up with the two halves produced by __SXTB16 on the weights */
+      pCol = pBuffer;
+      cnt = colLen >> 2u;
+      while(cnt > 0u)
+      {
+        swap = pCol[1];
+        pCol[1] = pCol[2];
+        pCol[2] = swap;
+        pCol += 4u;
+        cnt--;
+      }
+
+      pW = (q7_t *) S->pWeights;
+      pBias = S->pBias;
+
+      /* Compute two output channels at a time so that each column load    
+       ** is shared by two filters */
+      ch = S->chOut >> 1u;
+
+      while(ch > 0u)
+      {
+        acc0 = ((q31_t) * pBias++ << S->biasShift) + round;
+        acc1 = ((q31_t) * pBias++ << S->biasShift) + round;
+
+        pCol = pBuffer;
+        pW2 = pW + colLen;
+        cnt = colLen >> 2u;
+
+        while(cnt > 0u)
+        {
+          /* Read four column samples */
+          inB1 = *__SIMD32(pCol)++;
+          inB2 = *__SIMD32(pCol)++;
+
+          /* Read four weights of the first filter and sign extend them */
+          inW = *__SIMD32(pW)++;
+          inW1 = __SXTB16(inW);
+          inW2 = __SXTB16(__ROR(inW, 8));
+          acc0 = __SMLAD(inW1, inB1, acc0);
+          acc0 = __SMLAD(inW2, inB2, acc0);
+
+          /* Read four weights of the second filter and sign extend them */
+          inW = *__SIMD32(pW2)++;
+          inW1 = __SXTB16(inW);
+          inW2 = __SXTB16(__ROR(inW, 8));
+          acc1 = __SMLAD(inW1, inB1, acc1);
+          acc1 = __SMLAD(inW2, inB2, acc1);
+
+          cnt--;
+        }
+
+        /* Process the remaining samples of the column */
+        cnt = colLen & 0x3u;
+        while(cnt > 0u)
+        {
+          acc0 += (q31_t) * pCol * *pW++;
+          acc1 += (q31_t) * pCol++ * *pW2++;
+          cnt--;
+        }
+
+        *pDst++ = (q7_t) __SSAT((acc0 >> S->outShift), 8);
+        *pDst++ = (q7_t) __SSAT((acc1 >> S->outShift), 8);
+
+        /* Skip over the second filter */
+        pW += colLen;
+
+        ch--;
+      }
+
+      /* Process the last output channel, if any */
+      if((S->chOut & 0x1u) != 0u)
+      {
+        acc0 = ((q31_t) * pBias << S->biasShift) + round;
+
+        pCol = pBuffer;
+        cnt = colLen >> 2u;
+
+        while(cnt > 0u)
+        {
+          inB1 = *__SIMD32(pCol)++;
+          inB2 = *__SIMD32(pCol)++;
+
+          inW = *__SIMD32(pW)++;
+          inW1 = __SXTB16(inW);
+          inW2 = __SXTB16(__ROR(inW, 8));
+          acc0 = __SMLAD(inW1, inB1, acc0);
+          acc0 = __SMLAD(inW2, inB2, acc0);
+
+          cnt--;
+        }
+
+        cnt = colLen & 0x3u;
+        while(cnt > 0u)
+        {
+          acc0 += (q31_t) * pCol++ * *pW++;
+          cnt--;
+        }
+
+        *pDst++ = (q7_t) __SSAT((acc0 >> S->outShift), 8);
+      }
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      pW = (q7_t *) S->pWeights;
+
+      for (ch = 0u; ch < S->chOut; ch++)
+      {
+        acc0 = ((q31_t) S->pBias[ch] << S->biasShift) + round;
+
+        pCol = pBuffer;
+        cnt = colLen;
+
+        while(cnt > 0u)
+        {
+          acc0 += (q31_t) * pCol++ * *pW++;
+          cnt--;
+        }
+
+        *pDst++ = (q7_t) __SSAT((acc0 >> S->outShift), 8);
+      }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    }
+  }
+}
+
+/**    
+ * @} end of NNConv group    
+ */
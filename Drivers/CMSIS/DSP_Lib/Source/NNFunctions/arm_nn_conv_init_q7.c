@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_nn_conv_init_q7.c    
+*    
+* Description:	Initialization function for the Q7 convolution layer.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @addtogroup NNConv    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q7 convolution layer.    
+ * @param[in,out] *S        points to an instance of the Q7 convolution structure.    
+ * @param[in]     dimInX    input width.    
+ * @param[in]     dimInY    input height.    
+ * @param[in]     chIn      number of input channels.    
+ * @param[in]     chOut     number of output channels.    
+ * @param[in]     dimKerX   kernel width.    
+ * @param[in]     dimKerY   kernel height.    
+ * @param[in]     padX      horizontal zero padding.    
+ * @param[in]     padY      vertical zero padding.    
+ * @param[in]     strideX   horizontal stride.    
+ * @param[in]     strideY   vertical stride.    
+ * @param[in]     biasShift left shift applied to the bias.    
+ * @param[in]     outShift  right shift applied to the accumulator.    
+ * @param[in]     *pWeights points to the weights, stored as [chOut][dimKerY][dimKerX][chIn].    
+ * @param[in]     *pBias    points to the bias, of length chOut.    
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR    
+ * if a stride is zero or the kernel does not fit in the padded input.    
+ *    
+ * \par Description:    
+ * \par    
+ * The output dimensions are derived from the input geometry as    
+ * <pre>    
+ *     dimOut = (dimIn + 2 * pad - dimKer) / stride + 1    
+ * </pre>    
+ * and stored in the instance so that the caller can size the output buffer.    
+ */
+
+arm_status arm_nn_conv_init_q7(
+  arm_nn_conv_instance_q7 * S,
+  uint16_t dimInX,
+  uint16_t dimInY,
+  uint16_t chIn,
+  uint16_t chOut,
+  uint16_t dimKerX,
+  uint16_t dimKerY,
+  uint16_t padX,
+  uint16_t padY,
+  uint16_t strideX,
+  uint16_t strideY,
+  uint16_t biasShift,
+  uint16_t outShift,
+  const q7_t * pWeights,
+  const q7_t * pBias)
+{
+  /* Check the geometry of the layer */
+  if((strideX == 0u) || (strideY == 0u) ||
+     (dimKerX > (dimInX + 2u * padX)) || (dimKerY > (dimInY + 2u * padY)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->dimInX = dimInX;
+  S->dimInY = dimInY;
+  S->chIn = chIn;
+  S->chOut = chOut;
+  S->dimKerX = dimKerX;
+  S->dimKerY = dimKerY;
+  S->padX = padX;
+  S->padY = padY;
+  S->strideX = strideX;
+  S->strideY = strideY;
+  S->biasShift = biasShift;
+  S->outShift = outShift;
+  S->pWeights = pWeights;
+  S->pBias = pBias;
+
+  /* Compute the output feature map size */
+  S->dimOutX = (uint16_t) (((dimInX + 2u * padX) - dimKerX) / strideX + 1u);
+  S->dimOutY = (uint16_t) (((dimInY + 2u * padY) - dimKerY) / strideY + 1u);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @brief  Initialization function for a Q7 1D convolution layer.    
+ * @param[in,out] *S        points to an instance of the Q7 convolution structure.    
+ * @param[in]     dimIn     input length.    
+ * @param[in]     chIn      number of input channels.    
+ * @param[in]     chOut     number of output channels.    
+ * @param[in]     dimKer    kernel length.    
+ * @param[in]     pad       zero padding added on both ends.    
+ * @param[in]     stride    stride.    
+ * @param[in]     biasShift left shift applied to the bias.    
+ * @param[in]     outShift  right shift applied to the accumulator.    
+ * @param[in]     *pWeights points to the weights, stored as [chOut][dimKer][chIn].    
+ * @param[in]     *pBias    points to the bias, of length chOut.    
+ * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the geometry is invalid.    
+ *    
+ * A 1D convolution over a [dimIn][chIn] sequence is a 2D convolution with a    
+ * feature map and a kernel of height one, so the instance can be passed    
+ * straight to arm_nn_conv_HWC_q7().    
+ */
+
+arm_status arm_nn_conv_1d_init_q7(
+  arm_nn_conv_instance_q7 * S,
+  uint16_t dimIn,
+  uint16_t chIn,
+  uint16_t chOut,
+  uint16_t dimKer,
+  uint16_t pad,
+  uint16_t stride,
+  uint16_t biasShift,
+  uint16_t outShift,
+  const q7_t * pWeights,
+  const q7_t * pBias)
+{
+  return (arm_nn_conv_init_q7(S, dimIn, 1u, chIn, chOut, dimKer, 1u, pad, 0u,
+                              stride, 1u, biasShift, outShift, pWeights,
+                              pBias));
+}
+
+/**    
+ * @brief  Scratch buffer size required by arm_nn_conv_HWC_q7().    
+ * @param[in] *S points to an instance of the Q7 convolution structure.    
+ * @return    size of the im2col buffer in bytes.    
+ *    
+ * The buffer holds one im2col column, i.e. one receptive field    
+ * widened to 1.15 format.    
+ */
+
+uint32_t arm_nn_conv_buffer_size_q7(
+  const arm_nn_conv_instance_q7 * S)
+{
+  return ((uint32_t) S->chIn * S->dimKerX * S->dimKerY * sizeof(q15_t));
+}
+
+/**    
+ * @} end of NNConv group    
+ */
@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_nn_depthwise_conv_HWC_q7.c    
+*    
+* Description:	Q7 depthwise convolution layer.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @addtogroup NNConv    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 depthwise convolution layer (channel multiplier of one).    
+ * @param[in]  *S       points to an instance of the Q7 convolution structure with chOut equal to chIn.    
+ *                      The weights are stored as [dimKerY][dimKerX][chIn].    
+ * @param[in]  *pSrc    points to the input feature map [dimInY][dimInX][chIn].    
+ * @param[out] *pDst    points to the output feature map [dimOutY][dimOutX][chIn].    
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH    
+ * if the number of output channels differs from the number of input channels.    
+ *    
+ * \par Description:    
+ * \par    
+ * Each channel is filtered by its own dimKerX x dimKerY kernel.  Since both the    
+ * feature map and the weights are channel-interleaved, the kernel walks the    
+ * window once and updates every channel of the output pixel, so no im2col    
+ * buffer is needed.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * Same as arm_nn_conv_HWC_q7().    
+ */
+
+arm_status arm_nn_depthwise_conv_HWC_q7(
+  const arm_nn_conv_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst)
+{
+  const q7_t *pIn;                               /* Temporary pointer to the input */
+  const q7_t *pW;                                /* Temporary pointer to the weights */
+  q31_t acc0, acc1;                              /* Accumulators */
+  q31_t round;                                   /* Rounding offset */
+  int32_t iy, ix;                                /* Input coordinates */
+  uint32_t ox, oy, kx, ky;                       /* Loop counters */
+  uint32_t ch;                                   /* Channel index */
+  uint32_t numCh = S->chIn;                      /* Number of channels */
+
+  if(S->chOut != S->chIn)
+  {
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+  round = (S->outShift > 0u) ? ((q31_t) 1 << (S->outShift - 1u)) : 0;
+
+  for (oy = 0u; oy < S->dimOutY; oy++)
+  {
+    for (ox = 0u; ox < S->dimOutX; ox++)
+    {
+      /* Compute two channels at a time */
+      for (ch = 0u; (ch + 1u) < numCh; ch += 2u)
+      {
+        acc0 = ((q31_t) S->pBias[ch] << S->biasShift) + round;
+        acc1 = ((q31_t) S->pBias[ch + 1u] << S->biasShift) + round;
+
+        for (ky = 0u; ky < S->dimKerY; ky++)
+        {
+          iy = (int32_t) (oy * S->strideY + ky) - (int32_t) S->padY;
+
+          if((iy < 0) || (iy >= (int32_t) S->dimInY))
+          {
+            continue;
+          }
+
+          for (kx = 0u; kx < S->dimKerX; kx++)
+          {
+            ix = (int32_t) (ox * S->strideX + kx) - (int32_t) S->padX;
+
+            if((ix < 0) || (ix >= (int32_t) S->dimInX))
+            {
+              continue;
+            }
+
+            pIn = pSrc + ((uint32_t) iy * S->dimInX + (uint32_t) ix) * numCh + ch;
+            pW = S->pWeights + (ky * S->dimKerX + kx) * numCh + ch;
+
+            acc0 += (q31_t) pIn[0] * pW[0];
+            acc1 += (q31_t) pIn[1] * pW[1];
+          }
+        }
+
+        *pDst++ = (q7_t) __SSAT((acc0 >> S->outShift), 8);
+        *pDst++ = (q7_t) __SSAT((acc1 >> S->outShift), 8);
+      }
+
+      /* Process the last channel, if any */
+      if(ch < numCh)
+      {
+        acc0 = ((q31_t) S->pBias[ch] << S->biasShift) + round;
+
+        for (ky = 0u; ky < S->dimKerY; ky++)
+        {
+          iy = (int32_t) (oy * S->strideY + ky) - (int32_t) S->padY;
+
+          if((iy < 0) || (iy >= (int32_t) S->dimInY))
+          {
+            continue;
+          }
+
+          for (kx = 0u; kx < S->dimKerX; kx++)
+          {
+            ix = (int32_t) (ox * S->strideX + kx) - (int32_t) S->padX;
+
+            if((ix < 0) || (ix >= (int32_t) S->dimInX))
+            {
+              continue;
+            }
+
+            acc0 += (q31_t) pSrc[((uint32_t) iy * S->dimInX + (uint32_t) ix) * numCh + ch] *
+              S->pWeights[(ky * S->dimKerX + kx) * numCh + ch];
+          }
+        }
+
+        *pDst++ = (q7_t) __SSAT((acc0 >> S->outShift), 8);
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of NNConv group    
+ */
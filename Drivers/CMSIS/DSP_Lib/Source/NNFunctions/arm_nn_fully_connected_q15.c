@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_nn_fully_connected_q15.c    
+*    
+* Description:	Q15 fully-connected layer.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @addtogroup NNFullyConnected    
+ * @{    
+ */
+
+/**    
+ * @brief Q15 fully-connected layer.    
+ * @param[in]  *pSrc      points to the input vector.    
+ * @param[in]  *pWeights  points to the weight matrix [numRows][dimVec].    
+ * @param[in]  dimVec     length of the input vector.    
+ * @param[in]  numRows    number of outputs.    
+ * @param[in]  biasShift  left shift applied to the bias.    
+ * @param[in]  outShift   right shift applied to the accumulator.    
+ * @param[in]  *pBias     points to the bias.    
+ * @param[out] *pDst      points to the output vector.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The products are in 2.30 format and are accumulated in a 32-bit    
+ * accumulator without saturation.  The result is rounded, shifted right by    
+ * <code>outShift</code> and saturated to 1.15 format.    
+ */
+
+void arm_nn_fully_connected_q15(
+  const q15_t * pSrc,
+  const q15_t * pWeights,
+  uint16_t dimVec,
+  uint16_t numRows,
+  uint16_t biasShift,
+  uint16_t outShift,
+  const q15_t * pBias,
+  q15_t * pDst)
+{
+  q15_t *pW = (q15_t *) pWeights;                /* Temporary pointer to the weights */
+  q15_t *pB;                                     /* Temporary pointer to the input */
+  q31_t acc0;                                    /* Accumulator */
+  q31_t round;                                   /* Rounding offset */
+  uint32_t row, cnt;                             /* Loop counters */
+
+  round = (outShift > 0u) ? ((q31_t) 1 << (outShift - 1u)) : 0;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t acc1;                                    /* Accumulator */
+  q31_t inB;                                     /* Temporary variable to hold the input */
+  q15_t *pW2;                                    /* Temporary pointer to the second row */
+
+  /* Compute two rows at a time */
+  row = numRows >> 1u;
+
+  while(row > 0u)
+  {
+    acc0 = ((q31_t) * pBias++ << biasShift) + round;
+    acc1 = ((q31_t) * pBias++ << biasShift) + round;
+
+    pB = (q15_t *) pSrc;
+    pW2 = pW + dimVec;
+    cnt = dimVec >> 1u;
+
+    while(cnt > 0u)
+    {
+      inB = *__SIMD32(pB)++;
+      acc0 = __SMLAD(*__SIMD32(pW)++, inB, acc0);
+      acc1 = __SMLAD(*__SIMD32(pW2)++, inB, acc1);
+      cnt--;
+    }
+
+    if((dimVec & 0x1u) != 0u)
+    {
+      acc0 += (q31_t) * pB * *pW++;
+      acc1 += (q31_t) * pB * *pW2;
+    }
+
+    *pDst++ = (q15_t) __SSAT((acc0 >> outShift), 16);
+    *pDst++ = (q15_t) __SSAT((acc1 >> outShift), 16);
+
+    /* Skip over the second row */
+    pW += dimVec;
+
+    row--;
+  }
+
+  /* Process the last row, if any */
+  if((numRows & 0x1u) != 0u)
+  {
+    acc0 = ((q31_t) * pBias << biasShift) + round;
+
+    pB = (q15_t *) pSrc;
+    cnt = dimVec >> 1u;
+
+    while(cnt > 0u)
+    {
+      acc0 = __SMLAD(*__SIMD32(pW)++, *__SIMD32(pB)++, acc0);
+      cnt--;
+    }
+
+    if((dimVec & 0x1u) != 0u)
+    {
+      acc0 += (q31_t) * pB * *pW;
+    }
+
+    *pDst = (q15_t) __SSAT((acc0 >> outShift), 16);
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  for (row = 0u; row < numRows; row++)
+  {
+    acc0 = ((q31_t) pBias[row] << biasShift) + round;
+
+    pB = (q15_t *) pSrc;
+    cnt = dimVec;
+
+    while(cnt > 0u)
+    {
+      acc0 += (q31_t) * pB++ * *pW++;
+      cnt--;
+    }
+
+    *pDst++ = (q15_t) __SSAT((acc0 >> outShift), 16);
+  }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+}
+
+/**    
+ * @} end of NNFullyConnected group    
+ */
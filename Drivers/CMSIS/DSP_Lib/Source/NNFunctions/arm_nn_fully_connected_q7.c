@@ -0,0 +1,254 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_nn_fully_connected_q7.c    
+*    
+* Description:	Q7 fully-connected layer.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @defgroup NNFullyConnected Fully-Connected Layers    
+ *    
+ * Computes <code>pDst = sat(((pBias << biasShift) + pWeights * pSrc) >> outShift)</code>,    
+ * where <code>pWeights</code> is a row-major <code>numRows x dimVec</code> matrix.    
+ * The Q7 version widens the input vector once into the scratch buffer and    
+ * then runs two rows at a time with dual 16-bit MACs (__SMLAD).    
+ */
+
+/**    
+ * @addtogroup NNFullyConnected    
+ * @{    
+ */
+
+/**    
+ * @brief  Scratch buffer size required by arm_nn_fully_connected_q7().    
+ * @param[in] dimVec length of the input vector.    
+ * @return    size of the scratch buffer in bytes.    
+ */
+
+uint32_t arm_nn_fully_connected_buffer_size_q7(
+  uint16_t dimVec)
+{
+  return ((uint32_t) dimVec * sizeof(q15_t));
+}
+
+/**    
+ * @brief Q7 fully-connected layer.    
+ * @param[in]  *pSrc      points to the input vector.    
+ * @param[in]  *pWeights  points to the weight matrix [numRows][dimVec].    
+ * @param[in]  dimVec     length of the input vector.    
+ * @param[in]  numRows    number of outputs.    
+ * @param[in]  biasShift  left shift applied to the bias.    
+ * @param[in]  outShift   right shift applied to the accumulator.    
+ * @param[in]  *pBias     points to the bias.    
+ * @param[out] *pDst      points to the output vector.    
+ * @param[in]  *pBuffer   points to the scratch buffer, see arm_nn_fully_connected_buffer_size_q7().    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The products are in 2.14 format and are accumulated in a 32-bit    
+ * accumulator.  The result is rounded, shifted right by <code>outShift</code>    
+ * and saturated to 1.7 format.    
+ */
+
+void arm_nn_fully_connected_q7(
+  const q7_t * pSrc,
+  const q7_t * pWeights,
+  uint16_t dimVec,
+  uint16_t numRows,
+  uint16_t biasShift,
+  uint16_t outShift,
+  const q7_t * pBias,
+  q7_t * pDst,
+  q15_t * pBuffer)
+{
+  q7_t *pW = (q7_t *) pWeights;                  /* Temporary pointer to the weights */
+  q31_t acc0;                                    /* Accumulator */
+  q31_t round;                                   /* Rounding offset */
+  uint32_t row, cnt;                             /* Loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t acc1;                                    /* Accumulator */
+  q31_t inW, inW1, inW2;                         /* Temporary variables to hold the weights */
+  q31_t inB1, inB2;                              /* Temporary variables to hold the input */
+  q7_t *pW2;                                     /* Temporary pointer to the second row */
+  q15_t *pB;                                     /* Temporary pointer to the widened input */
+  const q7_t *pIn = pSrc;                        /* Temporary pointer to the input */
+
+  round = (outShift > 0u) ? ((q31_t) 1 << (outShift - 1u)) : 0;
+
+  /* Widen the input to 1.15, reordering each group of four samples as    
+   ** x0, x2, x1, x3 to match the halves produced by __SXTB16 */
+  pB = pBuffer;
+  cnt = dimVec >> 2u;
+  while(cnt > 0u)
+  {
+    pB[0] = (q15_t) pIn[0];
+    pB[1] = (q15_t) pIn[2];
+    pB[2] = (q15_t) pIn[1];
+    pB[3] = (q15_t) pIn[3];
+    pB += 4u;
+    pIn += 4u;
+    cnt--;
+  }
+
+  cnt = dimVec & 0x3u;
+  while(cnt > 0u)
+  {
+    *pB++ = (q15_t) * pIn++;
+    cnt--;
+  }
+
+  /* Compute two rows at a time */
+  row = numRows >> 1u;
+
+  while(row > 0u)
+  {
+    acc0 = ((q31_t) * pBias++ << biasShift) + round;
+    acc1 = ((q31_t) * pBias++ << biasShift) + round;
+
+    pB = pBuffer;
+    pW2 = pW + dimVec;
+    cnt = dimVec >> 2u;
+
+    while(cnt > 0u)
+    {
+      inB1 = *__SIMD32(pB)++;
+      inB2 = *__SIMD32(pB)++;
+
+      inW = *__SIMD32(pW)++;
+      inW1 = __SXTB16(inW);
+      inW2 = __SXTB16(__ROR(inW, 8));
+      acc0 = __SMLAD(inW1, inB1, acc0);
+      acc0 = __SMLAD(inW2, inB2, acc0);
+
+      inW = *__SIMD32(pW2)++;
+      inW1 = __SXTB16(inW);
+      inW2 = __SXTB16(__ROR(inW, 8));
+      acc1 = __SMLAD(inW1, inB1, acc1);
+      acc1 = __SMLAD(inW2, inB2, acc1);
+
+      cnt--;
+    }
+
+    cnt = dimVec & 0x3u;
+    while(cnt > 0u)
+    {
+      acc0 += (q31_t) * pB * *pW++;
+      acc1 += (q31_t) * pB++ * *pW2++;
+      cnt--;
+    }
+
+    *pDst++ = (q7_t) __SSAT((acc0 >> outShift), 8);
+    *pDst++ = (q7_t) __SSAT((acc1 >> outShift), 8);
+
+    /* Skip over the second row */
+    pW += dimVec;
+
+    row--;
+  }
+
+  /* Process the last row, if any */
+  if((numRows & 0x1u) != 0u)
+  {
+    acc0 = ((q31_t) * pBias << biasShift) + round;
+
+    pB = pBuffer;
+    cnt = dimVec >> 2u;
+
+    while(cnt > 0u)
+    {
+      inB1 = *__SIMD32(pB)++;
+      inB2 = *__SIMD32(pB)++;
+
+      inW = *__SIMD32(pW)++;
+      inW1 = __SXTB16(inW);
+      inW2 = __SXTB16(__ROR(inW, 8));
+      acc0 = __SMLAD(inW1, inB1, acc0);
+      acc0 = __SMLAD(inW2, inB2, acc0);
+
+      cnt--;
+    }
+
+    cnt = dimVec & 0x3u;
+    while(cnt > 0u)
+    {
+      acc0 += (q31_t) * pB++ * *pW++;
+      cnt--;
+    }
+
+    *pDst = (q7_t) __SSAT((acc0 >> outShift), 8);
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  round = (outShift > 0u) ? ((q31_t) 1 << (outShift - 1u)) : 0;
+
+  /* The scratch buffer is not needed by the scalar path */
+  (void) pBuffer;
+
+  for (row = 0u; row < numRows; row++)
+  {
+    acc0 = ((q31_t) pBias[row] << biasShift) + round;
+
+    cnt = 0u;
+    while(cnt < dimVec)
+    {
+      acc0 += (q31_t) pSrc[cnt] * *pW++;
+      cnt++;
+    }
+
+    *pDst++ = (q7_t) __SSAT((acc0 >> outShift), 8);
+  }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+}
+
+/**    
+ * @} end of NNFullyConnected group    
+ */
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_nn_maxpool_HWC_q7.c    
+*    
+* Description:	Q7 max pooling layer.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @defgroup NNPool Pooling Layers    
+ *    
+ * Max and average pooling over dimKerX x dimKerY windows of a feature map    
+ * stored in HWC order.  Window positions that fall in the padding are    
+ * ignored, so the average is taken over the valid samples only.    
+ */
+
+/**    
+ * @addtogroup NNPool    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 max pooling layer.    
+ * @param[in]  *S    points to an instance of the Q7 pooling structure.    
+ * @param[in]  *pSrc points to the input feature map [dimInY][dimInX][ch].    
+ * @param[out] *pDst points to the output feature map [dimOutY][dimOutX][ch].    
+ * @return none.    
+ *    
+ * The channels of one input pixel are contiguous, so the window is walked    
+ * once per output pixel and the running maxima of all channels are kept in    
+ * the output buffer itself.    
+ */
+
+void arm_nn_maxpool_HWC_q7(
+  const arm_nn_pool_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst)
+{
+  const q7_t *pIn;                               /* Temporary pointer to the input */
+  q7_t *pOut;                                    /* Temporary pointer to the output */
+  int32_t iy, ix;                                /* Input coordinates */
+  uint32_t ox, oy, kx, ky;                       /* Loop counters */
+  uint32_t cnt;                                  /* Loop counter */
+
+  for (oy = 0u; oy < S->dimOutY; oy++)
+  {
+    for (ox = 0u; ox < S->dimOutX; ox++)
+    {
+      /* Start from the smallest value */
+      memset(pDst, 0x80, S->ch);
+
+      for (ky = 0u; ky < S->dimKerY; ky++)
+      {
+        iy = (int32_t) (oy * S->strideY + ky) - (int32_t) S->padY;
+
+        if((iy < 0) || (iy >= (int32_t) S->dimInY))
+        {
+          continue;
+        }
+
+        for (kx = 0u; kx < S->dimKerX; kx++)
+        {
+          ix = (int32_t) (ox * S->strideX + kx) - (int32_t) S->padX;
+
+          if((ix < 0) || (ix >= (int32_t) S->dimInX))
+          {
+            continue;
+          }
+
+          pIn = pSrc + ((uint32_t) iy * S->dimInX + (uint32_t) ix) * S->ch;
+          pOut = pDst;
+          cnt = S->ch;
+
+          while(cnt > 0u)
+          {
+            if(*pIn > *pOut)
+            {
+              *pOut = *pIn;
+            }
+            pIn++;
+            pOut++;
+            cnt--;
+          }
+        }
+      }
+
+      pDst += S->ch;
+    }
+  }
+}
+
+/**    
+ * @} end of NNPool group    
+ */
@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_nn_pool_init_q7.c    
+*    
+* Description:	Initialization function for the Q7 pooling layers.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @addtogroup NNPool    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q7 pooling layers.    
+ * @param[in,out] *S      points to an instance of the Q7 pooling structure.    
+ * @param[in]     dimInX  input width.    
+ * @param[in]     dimInY  input height.    
+ * @param[in]     ch      number of channels.    
+ * @param[in]     dimKerX pooling window width.    
+ * @param[in]     dimKerY pooling window height.    
+ * @param[in]     padX    horizontal padding.    
+ * @param[in]     padY    vertical padding.    
+ * @param[in]     strideX horizontal stride.    
+ * @param[in]     strideY vertical stride.    
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR    
+ * if a stride is zero or the window does not fit in the padded input.    
+ */
+
+arm_status arm_nn_pool_init_q7(
+  arm_nn_pool_instance_q7 * S,
+  uint16_t dimInX,
+  uint16_t dimInY,
+  uint16_t ch,
+  uint16_t dimKerX,
+  uint16_t dimKerY,
+  uint16_t padX,
+  uint16_t padY,
+  uint16_t strideX,
+  uint16_t strideY)
+{
+  /* Check the geometry of the layer */
+  if((strideX == 0u) || (strideY == 0u) ||
+     (dimKerX > (dimInX + 2u * padX)) || (dimKerY > (dimInY + 2u * padY)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->dimInX = dimInX;
+  S->dimInY = dimInY;
+  S->ch = ch;
+  S->dimKerX = dimKerX;
+  S->dimKerY = dimKerY;
+  S->padX = padX;
+  S->padY = padY;
+  S->strideX = strideX;
+  S->strideY = strideY;
+
+  /* Compute the output feature map size */
+  S->dimOutX = (uint16_t) (((dimInX + 2u * padX) - dimKerX) / strideX + 1u);
+  S->dimOutY = (uint16_t) (((dimInY + 2u * padY) - dimKerY) / strideY + 1u);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of NNPool group    
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_nn_relu_q7.c    
+*    
+* Description:	Q7 ReLU activation.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @defgroup NNActivation Activation Functions    
+ *    
+ * Element-wise activation functions applied to a layer output.    
+ * ReLU clamps negative samples to zero in place.  Softmax maps a vector of    
+ * scores to probabilities using a base-2 approximation of the exponential.    
+ */
+
+/**    
+ * @addtogroup NNActivation    
+ * @{    
+ */
+
+/**    
+ * @brief In-place Q7 ReLU activation.    
+ * @param[in,out] *pSrcDst  points to the data.    
+ * @param[in]     blockSize number of samples.    
+ * @return none.    
+ *    
+ * On Cortex-M4 and Cortex-M3 four samples are processed per word: the sign    
+ * bit of each byte is spread into a byte mask that clears the negative lanes.    
+ */
+
+void arm_nn_relu_q7(
+  q7_t * pSrcDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t in;                                      /* Temporary variable to hold four samples */
+  q31_t mask;                                    /* Mask of the negative lanes */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    in = *__SIMD32(pSrcDst);
+
+    /* 0xFF in every byte whose sign bit is set */
+    mask = (q31_t) ((((uint32_t) in >> 7u) & 0x01010101u) * 0xFFu);
+
+    *__SIMD32(pSrcDst)++ = in & ~mask;
+
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    if(*pSrcDst < 0)
+    {
+      *pSrcDst = 0;
+    }
+    pSrcDst++;
+
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of NNActivation group    
+ */
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_nn_softmax_q7.c    
+*    
+* Description:	Q7 softmax activation.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @addtogroup NNActivation    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 softmax (base-2 approximation).    
+ * @param[in]  *pSrc     points to the input vector.    
+ * @param[in]  blockSize length of the vector.    
+ * @param[out] *pDst     points to the output probabilities in 1.7 format.    
+ * @return none.    
+ *    
+ * \par Description:    
+ * \par    
+ * The exponential is replaced by a power of two, i.e. the output is    
+ * <pre>    
+ *     pDst[n] = 2^pSrc[n] / sum(2^pSrc[k])    
+ * </pre>    
+ * so one input LSB doubles the probability.  Scores more than 8 below the    
+ * maximum would round to zero in 1.7 format and are ignored.  The ranking of    
+ * the outputs is the same as with a true softmax, which is what classification    
+ * needs, and no table or division per element is required.    
+ */
+
+void arm_nn_softmax_q7(
+  const q7_t * pSrc,
+  uint16_t blockSize,
+  q7_t * pDst)
+{
+  q31_t base;                                    /* Smallest score taken into account */
+  q31_t shift;                                   /* Exponent of the current element */
+  uint32_t sum;                                  /* Sum of the powers of two */
+  uint32_t outBase;                              /* 2^20 / sum */
+  uint32_t i;                                    /* Loop counter */
+
+  /* Find the maximum score */
+  base = -128;
+  for (i = 0u; i < blockSize; i++)
+  {
+    if(pSrc[i] > base)
+    {
+      base = pSrc[i];
+    }
+  }
+
+  base = base - 8;
+
+  /* Accumulate 2^(x - base) for the significant scores */
+  sum = 0u;
+  for (i = 0u; i < blockSize; i++)
+  {
+    if(pSrc[i] > base)
+    {
+      shift = pSrc[i] - base;
+      sum += 1u << shift;
+    }
+  }
+
+  /* The maximum contributes 2^8, so outBase is at most 2^12 */
+  outBase = 0x100000u / sum;
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    if(pSrc[i] > base)
+    {
+      /* 2^(x - base) * 2^20 / sum in 1.7 format */
+      shift = pSrc[i] - base;
+      pDst[i] = (q7_t) __SSAT((q31_t) ((outBase << shift) >> 13u), 8);
+    }
+    else
+    {
+      pDst[i] = 0;
+    }
+  }
+}
+
+/**    
+ * @} end of NNActivation group    
+ */
@@ -0,0 +1,239 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_graph_edge.c    
+*    
+* Description:	Ring buffer edges of the DSP graph.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* Orders the sample accesses before the index update.  A host build of the    
+ * library (schedule simulation) has no DMB instruction: a full compiler and    
+ * processor barrier is used instead. */
+#if defined(__GNUC__) && !defined(__ARM_ARCH)
+#define ARM_GRAPH_BARRIER()   __sync_synchronize()
+#else
+#define ARM_GRAPH_BARRIER()   __DMB()
+#endif
+
+/**    
+ * @ingroup groupSupport    
+ */
+
+/**    
+ * @addtogroup DspGraph    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for a DSP graph edge.    
+ * @param[out] *E         points to an instance of the edge.    
+ * @param[in]  type       type of the samples.    
+ * @param[in]  *pBuffer   points to the storage of the edge.    
+ * @param[in]  capacity   capacity of the edge in samples.    
+ * @return none.    
+ *    
+ * \par    
+ * <code>pBuffer</code> holds <code>capacity</code> samples of the given type    
+ * and must be aligned for it.  It may be NULL for an edge that is only used    
+ * by arm_graph_simulate().    
+ *    
+ * \par Description:    
+ * \par    
+ * The read and write indices run modulo <code>2*capacity</code>, so that a    
+ * full edge is told apart from an empty one without a shared counter: the    
+ * producer only writes <code>writeIndex</code> and the consumer only writes    
+ * <code>readIndex</code>, and either may be in an interrupt handler.    
+ */
+
+void arm_graph_edge_init(
+  arm_graph_edge * E,
+  arm_graph_type type,
+  void * pBuffer,
+  uint32_t capacity)
+{
+  /* Assign the storage */
+  E->pBuffer = pBuffer;
+  E->capacity = capacity;
+  E->type = type;
+  E->elemSize = (type == ARM_GRAPH_Q7) ? 1u : ((type == ARM_GRAPH_Q15) ? 2u : 4u);
+
+  /* Start empty */
+  E->readIndex = 0u;
+  E->writeIndex = 0u;
+  E->maxCount = 0u;
+}
+
+/**    
+ * @brief  Number of samples held by a DSP graph edge.    
+ * @param[in] *E  points to an instance of the edge.    
+ * @return number of samples that can be read.    
+ */
+
+uint32_t arm_graph_edge_count(
+  const arm_graph_edge * E)
+{
+  uint32_t readIndex = E->readIndex;             /* Snapshot of the read index */
+  uint32_t writeIndex = E->writeIndex;           /* Snapshot of the write index */
+
+  return ((writeIndex >= readIndex) ? (writeIndex - readIndex) :
+          ((writeIndex + 2u * E->capacity) - readIndex));
+}
+
+/**    
+ * @brief  Gets the space for a block of samples to write in a DSP graph edge.    
+ * @param[in] *E         points to an instance of the edge.    
+ * @param[in] numSamples number of samples to write.    
+ * @return points to the space for the block, or NULL if it is not available in one piece.    
+ *    
+ * \par    
+ * The block is added to the edge by arm_graph_edge_commit().  Blocks whose    
+ * size divides the capacity of the edge never wrap around its end.    
+ */
+
+void *arm_graph_edge_write_ptr(
+  const arm_graph_edge * E,
+  uint32_t numSamples)
+{
+  uint32_t offset;                               /* Write offset in the storage */
+
+  /* Room for the block */
+  if((E->capacity - arm_graph_edge_count(E)) < numSamples)
+  {
+    return (NULL);
+  }
+
+  /* In one piece */
+  offset = (E->writeIndex < E->capacity) ? E->writeIndex : (E->writeIndex - E->capacity);
+  if((offset + numSamples) > E->capacity)
+  {
+    return (NULL);
+  }
+
+  return ((uint8_t *) E->pBuffer + (offset * E->elemSize));
+}
+
+/**    
+ * @brief  Adds a block of samples written with arm_graph_edge_write_ptr() to a DSP graph edge.    
+ * @param[in,out] *E         points to an instance of the edge.    
+ * @param[in]     numSamples number of samples written.    
+ * @return none.    
+ */
+
+void arm_graph_edge_commit(
+  arm_graph_edge * E,
+  uint32_t numSamples)
+{
+  uint32_t writeIndex;                           /* New write index */
+  uint32_t count;                                /* Samples held after the commit */
+
+  writeIndex = E->writeIndex + numSamples;
+  if(writeIndex >= 2u * E->capacity)
+  {
+    writeIndex -= 2u * E->capacity;
+  }
+
+  /* The samples must be in memory before the consumer can see them */
+  ARM_GRAPH_BARRIER();
+  E->writeIndex = writeIndex;
+
+  /* Keep the largest fill for sizing */
+  count = arm_graph_edge_count(E);
+  if(count > E->maxCount)
+  {
+    E->maxCount = count;
+  }
+}
+
+/**    
+ * @brief  Gets a block of samples to read from a DSP graph edge.    
+ * @param[in] *E         points to an instance of the edge.    
+ * @param[in] numSamples number of samples to read.    
+ * @return points to the block, or NULL if it is not available in one piece.    
+ *    
+ * \par    
+ * The block is removed from the edge by arm_graph_edge_release().    
+ */
+
+void *arm_graph_edge_read_ptr(
+  const arm_graph_edge * E,
+  uint32_t numSamples)
+{
+  uint32_t offset;                               /* Read offset in the storage */
+
+  /* Enough samples */
+  if(arm_graph_edge_count(E) < numSamples)
+  {
+    return (NULL);
+  }
+
+  /* In one piece */
+  offset = (E->readIndex < E->capacity) ? E->readIndex : (E->readIndex - E->capacity);
+  if((offset + numSamples) > E->capacity)
+  {
+    return (NULL);
+  }
+
+  return ((uint8_t *) E->pBuffer + (offset * E->elemSize));
+}
+
+/**    
+ * @brief  Removes a block of samples read with arm_graph_edge_read_ptr() from a DSP graph edge.    
+ * @param[in,out] *E         points to an instance of the edge.    
+ * @param[in]     numSamples number of samples read.    
+ * @return none.    
+ */
+
+void arm_graph_edge_release(
+  arm_graph_edge * E,
+  uint32_t numSamples)
+{
+  uint32_t readIndex;                            /* New read index */
+
+  readIndex = E->readIndex + numSamples;
+  if(readIndex >= 2u * E->capacity)
+  {
+    readIndex -= 2u * E->capacity;
+  }
+
+  /* The samples must have been read before the producer can overwrite them */
+  ARM_GRAPH_BARRIER();
+  E->readIndex = readIndex;
+}
+
+/**    
+ * @} end of DspGraph group    
+ */
@@ -0,0 +1,231 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_graph_init.c    
+*    
+* Description:	Initialization functions for the DSP graph.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupSupport    
+ */
+
+/**    
+ * @defgroup DspGraph DSP Graph    
+ *    
+ * A DSP graph chains block kernels, such as a filter, a decimator, an FFT and    
+ * a magnitude, without intermediate copies and without dynamic allocation.    
+ *    
+ * \par Edges    
+ * The samples flow between the kernels through edges, arm_graph_edge, which    
+ * are ring buffers of one sample type whose storage is given by the    
+ * application and sized when it is built.  Every kernel reads its input block    
+ * from its input edge and writes its output block straight into its output    
+ * edge: an edge holding two blocks is a ping-pong buffer, a larger one lets    
+ * its producer run ahead.  A block is only handed to a kernel in one piece,    
+ * so the capacity of an edge must be a multiple of the blocks of its producer    
+ * and of its consumer, which is checked by arm_graph_init().    
+ *    
+ * \par    
+ * An edge has a single producer and a single consumer, which update only    
+ * their own index.  The edges that no node writes, the sources, are filled by    
+ * the application with arm_graph_edge_write_ptr() and    
+ * arm_graph_edge_commit(), for instance from the DMA interrupt of an audio    
+ * interface while the graph runs in the main loop.  The edges that no node    
+ * reads, the sinks, are emptied the same way with arm_graph_edge_read_ptr()    
+ * and arm_graph_edge_release().    
+ *    
+ * \par Nodes    
+ * A node, arm_graph_node, runs a kernel on a block of <code>inBlock</code>    
+ * samples of its input edge and produces <code>outBlock</code> samples on its    
+ * output edge; the sample rates may differ, as for a decimator.  Nodes for    
+ * the FIR filters, the FIR decimators, the biquad cascades, the real FFTs and    
+ * the complex magnitudes of the library are made by arm_graph_node_fir_f32()    
+ * and the other node functions, which take the block sizes and the types from    
+ * the kernel instances.  Any other kernel can be wrapped by    
+ * arm_graph_node_init() with a function of type arm_graph_kernel.  A kernel    
+ * may modify its input block, which is released after it ran.    
+ *    
+ * \par Scheduling    
+ * arm_graph_run() goes over the nodes in the order of the array and runs each    
+ * node whose input edge holds a block and whose output edge has room for a    
+ * block, then starts over until no node can run.  The nodes should be given    
+ * producers first, so that a block goes through the whole chain in one pass.    
+ * When the graph has a timer, every node counts its runs, the cycles spent in    
+ * its kernel and the cycles of its longest run.    
+ *    
+ * \par    
+ * arm_graph_simulate() runs the same scheduler without calling the kernels:    
+ * it feeds the source edges, empties the sink edges and records the order of    
+ * the runs.  It validates a graph on the host or on the target before any    
+ * signal is available, and the largest fill of every edge,    
+ * <code>maxCount</code>, shows how small its storage can be.    
+ */
+
+/**    
+ * @addtogroup DspGraph    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for a DSP graph node with a user kernel.    
+ * @param[out] *N         points to an instance of the node.    
+ * @param[in]  kernel     processing function.    
+ * @param[in]  *pInstance points to the instance of the kernel.    
+ * @param[in]  *pIn       input edge.    
+ * @param[in]  inType     type of the input samples.    
+ * @param[in]  inBlock    number of samples consumed by a run.    
+ * @param[in]  *pOut      output edge, or NULL for a sink node.    
+ * @param[in]  outType    type of the output samples.    
+ * @param[in]  outBlock   number of samples produced by a run.    
+ * @return none.    
+ *    
+ * \par    
+ * The kernel is called with <code>inBlock</code> as its block size.    
+ */
+
+void arm_graph_node_init(
+  arm_graph_node * N,
+  arm_graph_kernel kernel,
+  void * pInstance,
+  arm_graph_edge * pIn,
+  arm_graph_type inType,
+  uint32_t inBlock,
+  arm_graph_edge * pOut,
+  arm_graph_type outType,
+  uint32_t outBlock)
+{
+  /* Assign the kernel and its instance */
+  N->kernel = kernel;
+  N->pInstance = pInstance;
+
+  /* Assign the edges and the block sizes */
+  N->pIn = pIn;
+  N->pOut = pOut;
+  N->inBlock = inBlock;
+  N->outBlock = (pOut != NULL) ? outBlock : 0u;
+  N->inType = inType;
+  N->outType = outType;
+
+  /* Clear the statistics */
+  N->runs = 0u;
+  N->cycles = 0u;
+  N->maxCycles = 0u;
+}
+
+/**    
+ * @brief  Initialization function for a DSP graph.    
+ * @param[out] *G        points to an instance of the graph.    
+ * @param[in]  *pNodes   points to the nodes, producers before consumers.    
+ * @param[in]  numNodes  number of nodes.    
+ * @param[in]  timer     cycle counter for the node statistics, or NULL.    
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if a node is not valid or    
+ * an edge has more than one producer or consumer, or ARM_MATH_SIZE_MISMATCH    
+ * if the type or the capacity of an edge does not suit its nodes.    
+ *    
+ * \par    
+ * The edges must have been initialized by arm_graph_edge_init().  The graph    
+ * is reset, see arm_graph_reset().    
+ */
+
+arm_status arm_graph_init(
+  arm_graph_instance * G,
+  arm_graph_node * pNodes,
+  uint16_t numNodes,
+  arm_plan_timer timer)
+{
+  const arm_graph_node *pNode;                   /* Node being checked */
+  uint32_t i, j;                                 /* Loop counters */
+
+  /* Assign the nodes and the cycle counter */
+  G->pNodes = pNodes;
+  G->numNodes = numNodes;
+  G->timer = timer;
+
+  for (i = 0u; i < numNodes; i++)
+  {
+    pNode = &pNodes[i];
+
+    /* Every node needs a kernel, an input edge and an input block */
+    if((pNode->kernel == NULL) || (pNode->pIn == NULL) || (pNode->inBlock == 0u) ||
+       (pNode->pIn == pNode->pOut))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* The input edge must carry the input type and hold whole blocks */
+    if((pNode->pIn->type != pNode->inType) ||
+       ((pNode->pIn->capacity % pNode->inBlock) != 0u))
+    {
+      return (ARM_MATH_SIZE_MISMATCH);
+    }
+
+    if(pNode->pOut != NULL)
+    {
+      /* Same for the output edge */
+      if(pNode->outBlock == 0u)
+      {
+        return (ARM_MATH_ARGUMENT_ERROR);
+      }
+
+      if((pNode->pOut->type != pNode->outType) ||
+         ((pNode->pOut->capacity % pNode->outBlock) != 0u))
+      {
+        return (ARM_MATH_SIZE_MISMATCH);
+      }
+    }
+
+    /* An edge has one consumer and one producer */
+    for (j = 0u; j < i; j++)
+    {
+      if((pNodes[j].pIn == pNode->pIn) ||
+         ((pNode->pOut != NULL) && (pNodes[j].pOut == pNode->pOut)))
+      {
+        return (ARM_MATH_ARGUMENT_ERROR);
+      }
+    }
+  }
+
+  /* Start with empty edges and clear statistics */
+  arm_graph_reset(G);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of DspGraph group    
+ */
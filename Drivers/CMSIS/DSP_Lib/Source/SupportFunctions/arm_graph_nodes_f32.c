@@ -0,0 +1,219 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_graph_nodes_f32.c    
+*    
+* Description:	Floating-point kernel nodes of the DSP graph.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupSupport    
+ */
+
+/**    
+ * @addtogroup DspGraph    
+ * @{    
+ */
+
+/* Adapters from the kernels of the library to arm_graph_kernel */
+
+static void arm_graph_fir_f32(
+  void * pInstance,
+  void * pSrc,
+  void * pDst,
+  uint32_t blockSize)
+{
+  arm_fir_f32((const arm_fir_instance_f32 *) pInstance, (float32_t *) pSrc,
+              (float32_t *) pDst, blockSize);
+}
+
+static void arm_graph_fir_decimate_f32(
+  void * pInstance,
+  void * pSrc,
+  void * pDst,
+  uint32_t blockSize)
+{
+  arm_fir_decimate_f32((const arm_fir_decimate_instance_f32 *) pInstance,
+                       (float32_t *) pSrc, (float32_t *) pDst, blockSize);
+}
+
+static void arm_graph_biquad_cascade_df1_f32(
+  void * pInstance,
+  void * pSrc,
+  void * pDst,
+  uint32_t blockSize)
+{
+  arm_biquad_cascade_df1_f32((const arm_biquad_casd_df1_inst_f32 *) pInstance,
+                             (float32_t *) pSrc, (float32_t *) pDst, blockSize);
+}
+
+static void arm_graph_rfft_fast_f32(
+  void * pInstance,
+  void * pSrc,
+  void * pDst,
+  uint32_t blockSize)
+{
+  (void) blockSize;
+
+  /* The input block is used as a work buffer */
+  arm_rfft_fast_f32((arm_rfft_fast_instance_f32 *) pInstance, (float32_t *) pSrc,
+                    (float32_t *) pDst, 0u);
+}
+
+static void arm_graph_cmplx_mag_f32(
+  void * pInstance,
+  void * pSrc,
+  void * pDst,
+  uint32_t blockSize)
+{
+  (void) pInstance;
+
+  arm_cmplx_mag_f32((float32_t *) pSrc, (float32_t *) pDst, blockSize / 2u);
+}
+
+/**    
+ * @brief  Initialization function for a DSP graph node running arm_fir_f32().    
+ * @param[out] *N         points to an instance of the node.    
+ * @param[in]  *S         points to an initialized instance of the filter.    
+ * @param[in]  *pIn       input edge.    
+ * @param[in]  *pOut      output edge.    
+ * @param[in]  blockSize  number of samples processed by a run.    
+ * @return none.    
+ */
+
+void arm_graph_node_fir_f32(
+  arm_graph_node * N,
+  arm_fir_instance_f32 * S,
+  arm_graph_edge * pIn,
+  arm_graph_edge * pOut,
+  uint32_t blockSize)
+{
+  arm_graph_node_init(N, arm_graph_fir_f32, S, pIn, ARM_GRAPH_F32, blockSize,
+                      pOut, ARM_GRAPH_F32, blockSize);
+}
+
+/**    
+ * @brief  Initialization function for a DSP graph node running arm_fir_decimate_f32().    
+ * @param[out] *N         points to an instance of the node.    
+ * @param[in]  *S         points to an initialized instance of the decimator.    
+ * @param[in]  *pIn       input edge.    
+ * @param[in]  *pOut      output edge.    
+ * @param[in]  blockSize  number of input samples processed by a run, a multiple of the decimation factor.    
+ * @return none.    
+ *    
+ * \par    
+ * A run produces <code>blockSize/M</code> samples.    
+ */
+
+void arm_graph_node_fir_decimate_f32(
+  arm_graph_node * N,
+  arm_fir_decimate_instance_f32 * S,
+  arm_graph_edge * pIn,
+  arm_graph_edge * pOut,
+  uint32_t blockSize)
+{
+  arm_graph_node_init(N, arm_graph_fir_decimate_f32, S, pIn, ARM_GRAPH_F32, blockSize,
+                      pOut, ARM_GRAPH_F32, blockSize / S->M);
+}
+
+/**    
+ * @brief  Initialization function for a DSP graph node running arm_biquad_cascade_df1_f32().    
+ * @param[out] *N         points to an instance of the node.    
+ * @param[in]  *S         points to an initialized instance of the filter.    
+ * @param[in]  *pIn       input edge.    
+ * @param[in]  *pOut      output edge.    
+ * @param[in]  blockSize  number of samples processed by a run.    
+ * @return none.    
+ */
+
+void arm_graph_node_biquad_cascade_df1_f32(
+  arm_graph_node * N,
+  arm_biquad_casd_df1_inst_f32 * S,
+  arm_graph_edge * pIn,
+  arm_graph_edge * pOut,
+  uint32_t blockSize)
+{
+  arm_graph_node_init(N, arm_graph_biquad_cascade_df1_f32, S, pIn, ARM_GRAPH_F32, blockSize,
+                      pOut, ARM_GRAPH_F32, blockSize);
+}
+
+/**    
+ * @brief  Initialization function for a DSP graph node running the forward arm_rfft_fast_f32().    
+ * @param[out] *N    points to an instance of the node.    
+ * @param[in]  *S    points to an initialized instance of the real FFT.    
+ * @param[in]  *pIn  input edge, from which fftLen real samples are consumed.    
+ * @param[in]  *pOut output edge, on which fftLen values of the packed spectrum are produced.    
+ * @return none.    
+ *    
+ * \par    
+ * The spectrum is packed as by arm_rfft_fast_f32(): the real parts of the    
+ * DC and Nyquist bins come first, followed by the complex bins 1 to    
+ * <code>fftLen/2-1</code>.    
+ */
+
+void arm_graph_node_rfft_fast_f32(
+  arm_graph_node * N,
+  arm_rfft_fast_instance_f32 * S,
+  arm_graph_edge * pIn,
+  arm_graph_edge * pOut)
+{
+  arm_graph_node_init(N, arm_graph_rfft_fast_f32, S, pIn, ARM_GRAPH_F32, S->fftLenRFFT,
+                      pOut, ARM_GRAPH_F32, S->fftLenRFFT);
+}
+
+/**    
+ * @brief  Initialization function for a DSP graph node running arm_cmplx_mag_f32().    
+ * @param[out] *N          points to an instance of the node.    
+ * @param[in]  *pIn        input edge.    
+ * @param[in]  *pOut       output edge.    
+ * @param[in]  numSamples  number of complex samples processed by a run.    
+ * @return none.    
+ */
+
+void arm_graph_node_cmplx_mag_f32(
+  arm_graph_node * N,
+  arm_graph_edge * pIn,
+  arm_graph_edge * pOut,
+  uint32_t numSamples)
+{
+  arm_graph_node_init(N, arm_graph_cmplx_mag_f32, NULL, pIn, ARM_GRAPH_F32, 2u * numSamples,
+                      pOut, ARM_GRAPH_F32, numSamples);
+}
+
+/**    
+ * @} end of DspGraph group    
+ */
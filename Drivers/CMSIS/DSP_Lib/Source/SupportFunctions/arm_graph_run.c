@@ -0,0 +1,328 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_graph_run.c    
+*    
+* Description:	Scheduler and simulator of the DSP graph.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupSupport    
+ */
+
+/**    
+ * @addtogroup DspGraph    
+ * @{    
+ */
+
+/**    
+ * @brief  Runs the ready nodes of a DSP graph until none of them can run.    
+ * @param[in,out] *G        points to an instance of the graph.    
+ * @param[in]     simulate  flag that skips the kernels (simulate=1).    
+ * @param[out]    *pTrace   points to the node indices in run order, or NULL.    
+ * @param[in]     maxTrace  capacity of the trace.    
+ * @param[in,out] *pNumRuns number of node runs, incremented.    
+ * @return none.    
+ */
+
+static void arm_graph_schedule(
+  arm_graph_instance * G,
+  uint32_t simulate,
+  uint16_t * pTrace,
+  uint32_t maxTrace,
+  uint32_t * pNumRuns)
+{
+  arm_graph_node *pNode;                         /* Node being scheduled */
+  void *pSrc, *pDst;                             /* Input and output blocks */
+  uint32_t start, cycles;                        /* Cycle counts */
+  uint32_t ran;                                  /* Runs in the current pass */
+  uint16_t i;                                    /* Loop counter */
+
+  do
+  {
+    ran = 0u;
+
+    for (i = 0u; i < G->numNodes; i++)
+    {
+      pNode = &G->pNodes[i];
+
+      /* A node runs when its input holds a block and its output has room for one */
+      if(arm_graph_edge_count(pNode->pIn) < pNode->inBlock)
+      {
+        continue;
+      }
+
+      if((pNode->pOut != NULL) &&
+         ((pNode->pOut->capacity - arm_graph_edge_count(pNode->pOut)) < pNode->outBlock))
+      {
+        continue;
+      }
+
+      if(simulate == 0u)
+      {
+        /* The capacities are multiples of the blocks, so that the blocks never wrap */
+        pSrc = arm_graph_edge_read_ptr(pNode->pIn, pNode->inBlock);
+        pDst = (pNode->pOut != NULL) ? arm_graph_edge_write_ptr(pNode->pOut, pNode->outBlock) : NULL;
+
+        if(G->timer != NULL)
+        {
+          start = G->timer();
+          pNode->kernel(pNode->pInstance, pSrc, pDst, pNode->inBlock);
+          cycles = G->timer() - start;
+
+          pNode->cycles += cycles;
+          if(cycles > pNode->maxCycles)
+          {
+            pNode->maxCycles = cycles;
+          }
+        }
+        else
+        {
+          pNode->kernel(pNode->pInstance, pSrc, pDst, pNode->inBlock);
+        }
+      }
+
+      /* Hand the output block to the consumer and give back the input block */
+      if(pNode->pOut != NULL)
+      {
+        arm_graph_edge_commit(pNode->pOut, pNode->outBlock);
+      }
+      arm_graph_edge_release(pNode->pIn, pNode->inBlock);
+
+      if((pTrace != NULL) && (*pNumRuns < maxTrace))
+      {
+        pTrace[*pNumRuns] = i;
+      }
+
+      pNode->runs++;
+      (*pNumRuns)++;
+      ran++;
+    }
+  } while(ran != 0u);
+}
+
+/**    
+ * @brief  Tells whether an edge of a DSP graph is written by one of its nodes.    
+ * @param[in] *G  points to an instance of the graph.    
+ * @param[in] *E  points to the edge.    
+ * @return 1 if a node writes the edge, 0 if the edge is a source.    
+ */
+
+static uint32_t arm_graph_is_produced(
+  const arm_graph_instance * G,
+  const arm_graph_edge * E)
+{
+  uint16_t i;                                    /* Loop counter */
+
+  for (i = 0u; i < G->numNodes; i++)
+  {
+    if(G->pNodes[i].pOut == E)
+    {
+      return (1u);
+    }
+  }
+
+  return (0u);
+}
+
+/**    
+ * @brief  Tells whether an edge of a DSP graph is read by one of its nodes.    
+ * @param[in] *G  points to an instance of the graph.    
+ * @param[in] *E  points to the edge.    
+ * @return 1 if a node reads the edge, 0 if the edge is a sink.    
+ */
+
+static uint32_t arm_graph_is_consumed(
+  const arm_graph_instance * G,
+  const arm_graph_edge * E)
+{
+  uint16_t i;                                    /* Loop counter */
+
+  for (i = 0u; i < G->numNodes; i++)
+  {
+    if(G->pNodes[i].pIn == E)
+    {
+      return (1u);
+    }
+  }
+
+  return (0u);
+}
+
+/**    
+ * @brief  Empties the edges of a DSP graph and clears its statistics.    
+ * @param[in,out] *G  points to an instance of the graph.    
+ * @return none.    
+ *    
+ * \par    
+ * The source edges must not be written while the graph is reset.    
+ */
+
+void arm_graph_reset(
+  arm_graph_instance * G)
+{
+  arm_graph_node *pNode;                         /* Node being reset */
+  uint16_t i;                                    /* Loop counter */
+
+  for (i = 0u; i < G->numNodes; i++)
+  {
+    pNode = &G->pNodes[i];
+
+    /* Empty the edges */
+    pNode->pIn->readIndex = 0u;
+    pNode->pIn->writeIndex = 0u;
+    pNode->pIn->maxCount = 0u;
+
+    if(pNode->pOut != NULL)
+    {
+      pNode->pOut->readIndex = 0u;
+      pNode->pOut->writeIndex = 0u;
+      pNode->pOut->maxCount = 0u;
+    }
+
+    /* Clear the statistics */
+    pNode->runs = 0u;
+    pNode->cycles = 0u;
+    pNode->maxCycles = 0u;
+  }
+}
+
+/**    
+ * @brief  Runs the nodes of a DSP graph until none of them can run.    
+ * @param[in,out] *G  points to an instance of the graph.    
+ * @return number of node runs.    
+ *    
+ * \par    
+ * Called whenever new samples have been written to the source edges, for    
+ * instance from the main loop after a DMA interrupt.  The nodes are taken in    
+ * the order of the array, and the array is gone over again as long as one of    
+ * them could run.    
+ */
+
+uint32_t arm_graph_run(
+  arm_graph_instance * G)
+{
+  uint32_t numRuns = 0u;                         /* Number of node runs */
+
+  arm_graph_schedule(G, 0u, NULL, 0u, &numRuns);
+
+  return (numRuns);
+}
+
+/**    
+ * @brief  Simulates a DSP graph without running its kernels, to validate its schedule and size its edges.    
+ * @param[in,out] *G           points to an instance of the graph.    
+ * @param[in]     numSamples   number of samples fed to every source edge.    
+ * @param[in]     sourceBlock  number of samples written to a source edge at a time.    
+ * @param[out]    *pTrace      points to the node indices in run order, or NULL.    
+ * @param[in]     maxTrace     capacity of the trace.    
+ * @param[out]    *pNumRuns    number of node runs, which may exceed maxTrace.    
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH if a source edge    
+ * stops accepting blocks of sourceBlock samples.    
+ *    
+ * \par    
+ * The graph is reset, then every source edge is given blocks of    
+ * <code>sourceBlock</code> samples, as the application would write them, and    
+ * the graph is scheduled after each round of blocks.  The sink edges are    
+ * emptied after each round.  Only the indices of the edges are updated: the    
+ * kernels are not called and the storage of the edges is not accessed.    
+ *    
+ * \par    
+ * On return, <code>runs</code> of every node and <code>maxCount</code> of    
+ * every edge hold the result of the simulation; arm_graph_reset() must be    
+ * called before the graph is run.    
+ */
+
+arm_status arm_graph_simulate(
+  arm_graph_instance * G,
+  uint32_t numSamples,
+  uint32_t sourceBlock,
+  uint16_t * pTrace,
+  uint32_t maxTrace,
+  uint32_t * pNumRuns)
+{
+  arm_graph_edge *pEdge;                         /* Source or sink edge */
+  uint32_t fed = 0u;                             /* Samples fed to each source */
+  uint32_t n;                                    /* Samples fed in the current round */
+  uint16_t i;                                    /* Loop counter */
+
+  arm_graph_reset(G);
+  *pNumRuns = 0u;
+
+  while(fed < numSamples)
+  {
+    n = ((numSamples - fed) < sourceBlock) ? (numSamples - fed) : sourceBlock;
+
+    /* Feed the source edges, which must accept the block in one piece */
+    for (i = 0u; i < G->numNodes; i++)
+    {
+      pEdge = G->pNodes[i].pIn;
+
+      if(arm_graph_is_produced(G, pEdge) == 0u)
+      {
+        if(((pEdge->capacity - arm_graph_edge_count(pEdge)) < n) ||
+           ((pEdge->capacity % sourceBlock) != 0u))
+        {
+          return (ARM_MATH_SIZE_MISMATCH);
+        }
+
+        arm_graph_edge_commit(pEdge, n);
+      }
+    }
+
+    fed += n;
+
+    arm_graph_schedule(G, 1u, pTrace, maxTrace, pNumRuns);
+
+    /* Empty the sink edges */
+    for (i = 0u; i < G->numNodes; i++)
+    {
+      pEdge = G->pNodes[i].pOut;
+
+      if((pEdge != NULL) && (arm_graph_is_consumed(G, pEdge) == 0u))
+      {
+        arm_graph_edge_release(pEdge, arm_graph_edge_count(pEdge));
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of DspGraph group    
+ */
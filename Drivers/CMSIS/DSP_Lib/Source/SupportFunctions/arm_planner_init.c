@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_planner_init.c    
+*    
+* Description:	Initialization function for the kernel planner.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupSupport    
+ */
+
+/**    
+ * @defgroup Planner Kernel Planner    
+ *    
+ * The library often offers several variants of the same operation:    
+ * arm_conv_q15(), arm_conv_fast_q15(), arm_conv_opt_q15() and    
+ * arm_conv_fast_opt_q15() for the Q15 convolution, or arm_cfft_f32(),    
+ * arm_cfft_radix2_f32() and arm_cfft_radix4_f32() for the floating-point    
+ * complex FFT.  Which one is fastest depends on the sizes, on the device and    
+ * on the memory that holds the buffers: a kernel that wins on zero wait state    
+ * SRAM or CCM can lose on external SDRAM.    
+ *    
+ * The plan functions, arm_conv_plan_init_q15() and arm_cfft_plan_init_f32(),    
+ * pick the variant once at initialization and store it in a plan instance;    
+ * the matching processing functions, arm_conv_plan_q15() and    
+ * arm_cfft_plan_f32(), then dispatch to it with no further cost than a    
+ * switch.  The choice is made in this order:    
+ * - if the planner wisdom holds an entry for the same kernel family, sizes,    
+ * memory region and candidate variants, its variant is used;    
+ * - otherwise, if the planner has a cycle counter, every candidate is run on    
+ * the buffers given to the plan function, the fastest one is used and    
+ * recorded in the wisdom;    
+ * - otherwise a default variant that is usually the fastest is used.    
+ *    
+ * \par Wisdom    
+ * The wisdom is a table of arm_plan_wisdom_entry owned by the caller.  After    
+ * the plans of an application have been made once with a cycle counter, the    
+ * first <code>numEntries</code> entries of the table can be saved, in flash    
+ * for instance, and given back to arm_planner_init() at the next start so    
+ * that no measurement is needed.  The flag <code>ARM_PLAN_MEASURE</code>    
+ * forces a new measurement, which then replaces the stored entry.    
+ *    
+ * \par Memory regions    
+ * The region tag given to the plan functions is only a key of the wisdom; the    
+ * measurement itself is always done on the buffers given, so it reflects    
+ * their actual placement.  <code>ARM_PLAN_REGION()</code> derives a tag from    
+ * the top byte of an address, which is enough to tell apart SRAM, CCM and    
+ * external memory on most devices.    
+ *    
+ * \par Cycle counter    
+ * The timer is any function returning a free running counter, such as the    
+ * DWT cycle counter of the Cortex-M3 and Cortex-M4:    
+ * <pre>    
+ *     uint32_t cycles(void) { return DWT->CYCCNT; }    
+ * </pre>    
+ * Every candidate is run <code>ARM_PLAN_RUNS</code> times and its fastest run    
+ * is kept, so that the first run can warm up the flash accelerator and caches.    
+ */
+
+/**    
+ * @addtogroup Planner    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the kernel planner.    
+ * @param[out] *P          points to an instance of the planner.    
+ * @param[in]  timer       cycle counter, or NULL to rely on the wisdom and the defaults.    
+ * @param[in]  *pWisdom    points to the wisdom table.    
+ * @param[in]  numEntries  number of valid entries already in the table.    
+ * @param[in]  maxEntries  capacity of the table.    
+ * @return none.    
+ *    
+ * \par    
+ * <code>pWisdom</code> may be NULL with <code>maxEntries</code> equal to 0,    
+ * in which case every plan is measured, or set to its default without a timer.    
+ */
+
+void arm_planner_init(
+  arm_planner_instance * P,
+  arm_plan_timer timer,
+  arm_plan_wisdom_entry * pWisdom,
+  uint16_t numEntries,
+  uint16_t maxEntries)
+{
+  /* Assign the cycle counter */
+  P->timer = timer;
+
+  /* Assign the wisdom table */
+  P->pWisdom = pWisdom;
+  P->maxEntries = maxEntries;
+  P->numEntries = (numEntries < maxEntries) ? numEntries : maxEntries;
+}
+
+/**    
+ * @} end of Planner group    
+ */
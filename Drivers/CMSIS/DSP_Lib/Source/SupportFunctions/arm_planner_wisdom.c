@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_planner_wisdom.c    
+*    
+* Description:	Look-up and recording of the kernel planner wisdom.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupSupport    
+ */
+
+/**    
+ * @addtogroup Planner    
+ * @{    
+ */
+
+/**    
+ * @brief  Looks up the wisdom of the planner.    
+ * @param[in] *P          points to an instance of the planner.    
+ * @param[in] kernel      kernel family, ARM_PLAN_CONV_Q15 or ARM_PLAN_CFFT_F32.    
+ * @param[in] candidates  bit mask of the candidate variants.    
+ * @param[in] region      memory region tag.    
+ * @param[in] len1        first size: fftLen or srcALen.    
+ * @param[in] len2        second size: srcBLen, or 0.    
+ * @return points to the matching entry, or NULL if there is none.    
+ */
+
+const arm_plan_wisdom_entry *arm_planner_find(
+  const arm_planner_instance * P,
+  uint8_t kernel,
+  uint8_t candidates,
+  uint8_t region,
+  uint32_t len1,
+  uint32_t len2)
+{
+  const arm_plan_wisdom_entry *pEntry = P->pWisdom;  /* Current entry */
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0u; i < P->numEntries; i++)
+  {
+    if((pEntry->kernel == kernel) && (pEntry->candidates == candidates) &&
+       (pEntry->region == region) && (pEntry->len1 == len1) &&
+       (pEntry->len2 == len2))
+    {
+      return (pEntry);
+    }
+
+    pEntry++;
+  }
+
+  return (NULL);
+}
+
+/**    
+ * @brief  Adds an entry to the wisdom of the planner, or replaces the entry with the same key.    
+ * @param[in,out] *P       points to an instance of the planner.    
+ * @param[in]     *pEntry  points to the entry to record.    
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the table is full.    
+ *    
+ * \par    
+ * The key of an entry is made of its kernel family, candidate mask, region    
+ * and sizes.  A full table is left unchanged: the plan still uses the variant    
+ * it measured, the next start only has to measure it again.    
+ */
+
+arm_status arm_planner_record(
+  arm_planner_instance * P,
+  const arm_plan_wisdom_entry * pEntry)
+{
+  arm_plan_wisdom_entry *pDst;                   /* Entry to write */
+
+  /* Replace the entry with the same key, or append a new one */
+  pDst = (arm_plan_wisdom_entry *) arm_planner_find(P, pEntry->kernel,
+                                                    pEntry->candidates,
+                                                    pEntry->region,
+                                                    pEntry->len1, pEntry->len2);
+
+  if(pDst == NULL)
+  {
+    if(P->numEntries >= P->maxEntries)
+    {
+      return (ARM_MATH_LENGTH_ERROR);
+    }
+
+    pDst = &P->pWisdom[P->numEntries];
+    P->numEntries++;
+  }
+
+  *pDst = *pEntry;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of Planner group    
+ */
@@ -0,0 +1,304 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_cfft_bfp_q15.c    
+*    
+* Description:	Block floating-point complex FFT for Q15 data.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @defgroup ComplexFFTBFP Block Floating-Point Complex FFT    
+ *    
+ * \par    
+ * The fixed-point functions arm_cfft_q15() and arm_cfft_q31() scale the data    
+ * down at every stage so that they can never overflow, which costs one bit of    
+ * precision per radix-2 stage whatever the signal level is.  A 1024-point Q15    
+ * transform therefore loses about ten bits, and low-level tones sink into the    
+ * rounding noise.    
+ *    
+ * \par    
+ * The block floating-point variants share a single exponent across the whole    
+ * buffer.  Before each radix-2 stage the largest component magnitude of the    
+ * data (tracked while the previous stage writes its outputs) is compared with    
+ * the worst-case growth of a butterfly, which is 2*sqrt(2).  The stage shifts    
+ * its inputs right by 0, 1 or 2 bits, the smallest amount that keeps the    
+ * outputs in range, and the shift is added to the exponent.  Signals that do    
+ * not use the full range, or that grow slower than the worst case, keep their    
+ * resolution.    
+ *    
+ * \par    
+ * On return the transform result is <code>p1[n] * 2^(*pExponent)</code>, where    
+ * the forward transform is the unnormalized DFT    
+ * <pre>    
+ *     X[k] = sum(x[n] * exp(-j * 2 * pi * n * k / fftLen))    
+ * </pre>    
+ * and the inverse transform is the same sum with a positive exponent and no    
+ * <code>1/fftLen</code> factor.  The output is in bit reversed order if    
+ * bitReverseFlag is zero.    
+ *    
+ * \par    
+ * The functions take the same constant instance structures as arm_cfft_q15()    
+ * and arm_cfft_q31() (<code>arm_cfft_sR_q15_lenN</code>, <code>arm_cfft_sR_q31_lenN</code>),    
+ * and support the same lengths.  On Cortex-M4 and Cortex-M3 the Q15 butterflies    
+ * are computed two lanes at a time with __QADD16/__SHADD16 and the twiddle    
+ * multiplication uses __SMUAD/__SMUSDX.    
+ */
+
+/**    
+ * @addtogroup ComplexFFTBFP    
+ * @{    
+ */
+
+extern void arm_bitreversal_16(
+    uint16_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+/**    
+ * @brief  Smallest right shift that keeps a radix-2 stage in Q15 range.    
+ * @param[in] maxVal largest absolute component value of the stage input.    
+ * @return    shift of 0, 1 or 2 bits.    
+ */
+
+static __INLINE uint32_t arm_cfft_bfp_shift_q15(
+  q31_t maxVal)
+{
+  /* A butterfly output component is bounded by 2 * sqrt(2) * maxVal */
+  return (maxVal <= 11584) ? 0u : ((maxVal <= 23169) ? 1u : 2u);
+}
+
+/**    
+ * @brief Processing function for the Q15 block floating-point complex FFT.    
+ * @param[in]      *S              points to an instance of the Q15 CFFT structure.    
+ * @param[in, out] *p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.    
+ * @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.    
+ * @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.    
+ * @param[out]     *pExponent      block exponent of the output: the result is <code>p1 * 2^(*pExponent)</code>.    
+ * @return none.    
+ */
+
+void arm_cfft_bfp_q15(
+  const arm_cfft_instance_q15 * S,
+  q15_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag,
+  int32_t * pExponent)
+{
+  uint32_t fftLen = S->fftLen;                   /* length of the FFT */
+  uint32_t n1, n2;                               /* butterfly span */
+  uint32_t twidStep;                             /* twiddle step for the stage */
+  uint32_t i, j, k, l, ia;                       /* loop indices */
+  uint32_t shift;                                /* shift applied in the current stage */
+  q31_t maxVal, nextMax;                         /* largest magnitude before/after a stage */
+  q31_t xt, yt, outR, outI;                      /* temporary variables */
+  int32_t exponent = 0;                          /* accumulated exponent */
+
+#if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t T, U, R, coeff;                          /* packed samples and twiddle */
+
+#else
+
+  q31_t cosVal, sinVal;                          /* twiddle factor */
+
+#endif
+
+  /* Initial scan for the largest component magnitude */
+  maxVal = 0;
+  for (i = 0u; i < (fftLen << 1u); i++)
+  {
+    xt = p1[i];
+    xt = (xt > 0) ? xt : -xt;
+    if(xt > maxVal)
+    {
+      maxVal = xt;
+    }
+  }
+
+  n2 = fftLen;
+  twidStep = 1u;
+
+  /* Radix-2 decimation in frequency stages */
+  while(n2 > 1u)
+  {
+    n1 = n2;
+    n2 = n2 >> 1u;
+
+    /* Scale only as much as the worst-case growth of this stage requires */
+    shift = arm_cfft_bfp_shift_q15(maxVal);
+    exponent += (int32_t) shift;
+    nextMax = 0;
+
+    ia = 0u;
+
+    for (j = 0u; j < n2; j++)
+    {
+
+#if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN)
+
+      coeff = _SIMD32_OFFSET(S->pTwiddle + (2u * ia));
+
+#else
+
+      cosVal = S->pTwiddle[2u * ia];
+      sinVal = S->pTwiddle[(2u * ia) + 1u];
+
+#endif
+
+      ia += twidStep;
+
+      for (k = j; k < fftLen; k += n1)
+      {
+        l = k + n2;
+
+#if !defined (ARM_MATH_CM0_FAMILY) && !defined (ARM_MATH_BIG_ENDIAN)
+
+        T = _SIMD32_OFFSET(p1 + (2u * k));
+        U = _SIMD32_OFFSET(p1 + (2u * l));
+
+        if(shift == 2u)
+        {
+          /* SIMD arithmetic shift right by 1, the second bit is below */
+          T = __SHADD16(T, 0);
+          U = __SHADD16(U, 0);
+        }
+
+        if(shift == 0u)
+        {
+          R = __QSUB16(T, U);
+          T = __QADD16(T, U);
+        }
+        else
+        {
+          R = __SHSUB16(T, U);
+          T = __SHADD16(T, U);
+        }
+
+        _SIMD32_OFFSET(p1 + (2u * k)) = T;
+
+        if(ifftFlag == 0u)
+        {
+          /* (xt + j*yt) * (cos - j*sin) */
+          outR = __SMUAD(coeff, R) >> 15;
+          outI = __SMUSDX(coeff, R) >> 15;
+        }
+        else
+        {
+          /* (xt + j*yt) * (cos + j*sin) */
+          outR = __SMUSD(coeff, R) >> 15;
+          outI = __SMUADX(coeff, R) >> 15;
+        }
+
+        outR = __SSAT(outR, 16);
+        outI = __SSAT(outI, 16);
+
+        _SIMD32_OFFSET(p1 + (2u * l)) = __PKHBT(outR, outI, 16);
+
+        /* Track the largest magnitude for the next stage */
+        xt = (q15_t) T;
+        yt = (q15_t) (T >> 16);
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        xt = ((q31_t) p1[2u * k] - p1[2u * l]) >> shift;
+        yt = ((q31_t) p1[(2u * k) + 1u] - p1[(2u * l) + 1u]) >> shift;
+
+        p1[2u * k] = (q15_t) __SSAT((((q31_t) p1[2u * k] + p1[2u * l]) >> shift), 16);
+        p1[(2u * k) + 1u] =
+          (q15_t) __SSAT((((q31_t) p1[(2u * k) + 1u] + p1[(2u * l) + 1u]) >> shift), 16);
+
+        if(ifftFlag == 0u)
+        {
+          outR = (xt * cosVal + yt * sinVal) >> 15;
+          outI = (yt * cosVal - xt * sinVal) >> 15;
+        }
+        else
+        {
+          outR = (xt * cosVal - yt * sinVal) >> 15;
+          outI = (yt * cosVal + xt * sinVal) >> 15;
+        }
+
+        outR = __SSAT(outR, 16);
+        outI = __SSAT(outI, 16);
+
+        p1[2u * l] = (q15_t) outR;
+        p1[(2u * l) + 1u] = (q15_t) outI;
+
+        xt = p1[2u * k];
+        yt = p1[(2u * k) + 1u];
+
+#endif
+
+        xt = (xt > 0) ? xt : -xt;
+        yt = (yt > 0) ? yt : -yt;
+        outR = (outR > 0) ? outR : -outR;
+        outI = (outI > 0) ? outI : -outI;
+
+        if(xt > nextMax)
+          nextMax = xt;
+        if(yt > nextMax)
+          nextMax = yt;
+        if(outR > nextMax)
+          nextMax = outR;
+        if(outI > nextMax)
+          nextMax = outI;
+      }
+    }
+
+    maxVal = nextMax;
+    twidStep = twidStep << 1u;
+  }
+
+  if(bitReverseFlag)
+  {
+    arm_bitreversal_16((uint16_t *) p1, S->bitRevLength, S->pBitRevTable);
+  }
+
+  *pExponent = exponent;
+}
+
+/**    
+ * @} end of ComplexFFTBFP group    
+ */
@@ -0,0 +1,203 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_cfft_bfp_q31.c    
+*    
+* Description:	Block floating-point complex FFT for Q31 data.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup ComplexFFTBFP    
+ * @{    
+ */
+
+extern void arm_bitreversal_32(
+    uint32_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+/**    
+ * @brief  Smallest right shift that keeps a radix-2 stage in Q31 range.    
+ * @param[in] maxVal largest absolute component value of the stage input.    
+ * @return    shift of 0, 1 or 2 bits.    
+ */
+
+static __INLINE uint32_t arm_cfft_bfp_shift_q31(
+  q31_t maxVal)
+{
+  /* A butterfly output component is bounded by 2 * sqrt(2) * maxVal */
+  return (maxVal <= 759250124) ? 0u : ((maxVal <= 1518500249) ? 1u : 2u);
+}
+
+/**    
+ * @brief Processing function for the Q31 block floating-point complex FFT.    
+ * @param[in]      *S              points to an instance of the Q31 CFFT structure.    
+ * @param[in, out] *p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.    
+ * @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.    
+ * @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.    
+ * @param[out]     *pExponent      block exponent of the output: the result is <code>p1 * 2^(*pExponent)</code>.    
+ * @return none.    
+ *    
+ * The twiddle multiplication uses 64-bit intermediate products, so the only    
+ * loss of precision comes from the truncation of the products to 1.31 and    
+ * from the shifts actually required by the signal.    
+ */
+
+void arm_cfft_bfp_q31(
+  const arm_cfft_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag,
+  int32_t * pExponent)
+{
+  uint32_t fftLen = S->fftLen;                   /* length of the FFT */
+  uint32_t n1, n2;                               /* butterfly span */
+  uint32_t twidStep;                             /* twiddle step for the stage */
+  uint32_t i, j, k, l, ia;                       /* loop indices */
+  uint32_t shift;                                /* shift applied in the current stage */
+  q31_t maxVal, nextMax;                         /* largest magnitude before/after a stage */
+  q31_t ar, ai, br, bi;                          /* butterfly inputs */
+  q31_t xt, yt, outR, outI;                      /* temporary variables */
+  q31_t cosVal, sinVal;                          /* twiddle factor */
+  int32_t exponent = 0;                          /* accumulated exponent */
+
+  /* Initial scan for the largest component magnitude */
+  maxVal = 0;
+  for (i = 0u; i < (fftLen << 1u); i++)
+  {
+    xt = p1[i];
+
+    /* Saturate -1.0 so that its magnitude is representable */
+    xt = (xt > 0) ? xt : ((xt == INT32_MIN) ? INT32_MAX : -xt);
+    if(xt > maxVal)
+    {
+      maxVal = xt;
+    }
+  }
+
+  n2 = fftLen;
+  twidStep = 1u;
+
+  /* Radix-2 decimation in frequency stages */
+  while(n2 > 1u)
+  {
+    n1 = n2;
+    n2 = n2 >> 1u;
+
+    /* Scale only as much as the worst-case growth of this stage requires */
+    shift = arm_cfft_bfp_shift_q31(maxVal);
+    exponent += (int32_t) shift;
+    nextMax = 0;
+
+    ia = 0u;
+
+    for (j = 0u; j < n2; j++)
+    {
+      cosVal = S->pTwiddle[2u * ia];
+      sinVal = S->pTwiddle[(2u * ia) + 1u];
+      ia += twidStep;
+
+      for (k = j; k < fftLen; k += n1)
+      {
+        l = k + n2;
+
+        /* Apply the stage shift before adding so that nothing wraps around */
+        ar = p1[2u * k] >> shift;
+        ai = p1[(2u * k) + 1u] >> shift;
+        br = p1[2u * l] >> shift;
+        bi = p1[(2u * l) + 1u] >> shift;
+
+        xt = ar - br;
+        yt = ai - bi;
+        ar = ar + br;
+        ai = ai + bi;
+
+        p1[2u * k] = ar;
+        p1[(2u * k) + 1u] = ai;
+
+        if(ifftFlag == 0u)
+        {
+          /* (xt + j*yt) * (cos - j*sin) */
+          outR = (q31_t) (((q63_t) xt * cosVal + (q63_t) yt * sinVal) >> 31);
+          outI = (q31_t) (((q63_t) yt * cosVal - (q63_t) xt * sinVal) >> 31);
+        }
+        else
+        {
+          /* (xt + j*yt) * (cos + j*sin) */
+          outR = (q31_t) (((q63_t) xt * cosVal - (q63_t) yt * sinVal) >> 31);
+          outI = (q31_t) (((q63_t) yt * cosVal + (q63_t) xt * sinVal) >> 31);
+        }
+
+        p1[2u * l] = outR;
+        p1[(2u * l) + 1u] = outI;
+
+        /* Track the largest magnitude for the next stage */
+        ar = (ar > 0) ? ar : -ar;
+        ai = (ai > 0) ? ai : -ai;
+        outR = (outR > 0) ? outR : -outR;
+        outI = (outI > 0) ? outI : -outI;
+
+        if(ar > nextMax)
+          nextMax = ar;
+        if(ai > nextMax)
+          nextMax = ai;
+        if(outR > nextMax)
+          nextMax = outR;
+        if(outI > nextMax)
+          nextMax = outI;
+      }
+    }
+
+    maxVal = nextMax;
+    twidStep = twidStep << 1u;
+  }
+
+  if(bitReverseFlag)
+  {
+    arm_bitreversal_32((uint32_t *) p1, S->bitRevLength, S->pBitRevTable);
+  }
+
+  *pExponent = exponent;
+}
+
+/**    
+ * @} end of ComplexFFTBFP group    
+ */
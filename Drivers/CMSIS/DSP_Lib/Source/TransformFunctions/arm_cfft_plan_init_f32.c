@@ -0,0 +1,219 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_cfft_plan_init_f32.c    
+*    
+* Description:	Selection of the fastest floating-point complex FFT variant.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup ComplexFFT    
+ * @{    
+ */
+
+/**    
+ * @brief  Selects the fastest floating-point CFFT variant for a length and a buffer.    
+ * @param[in,out] *P              points to an instance of the planner, or NULL to use the default variant.    
+ * @param[out]    *S              points to an instance of the planned CFFT.    
+ * @param[in]     fftLen          length of the FFT.    
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.    
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.    
+ * @param[in]     *pBuffer        points to the buffer of size <code>2*fftLen</code> that will be transformed.    
+ * @param[in]     flags           ARM_PLAN_MEASURE to ignore the stored wisdom.    
+ * @param[in]     region          memory region tag of the buffer, see ARM_PLAN_REGION().    
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.    
+ *    
+ * \par Description:    
+ * \par    
+ * The candidates are arm_cfft_f32() and arm_cfft_radix2_f32() for every    
+ * length, and arm_cfft_radix4_f32() when the length is a power of 4.  They    
+ * compute the same transform, scaled by 1/fftLen for the inverse one.  The    
+ * variant is taken from the wisdom of the planner if possible, otherwise    
+ * measured with its timer, otherwise arm_cfft_f32() is used.  See the    
+ * \ref Planner "Kernel Planner" for the details.    
+ * \par    
+ * Supported FFT lengths are 16, 32, 64, 128, 256, 512, 1024, 2048 and 4096.    
+ * \par    
+ * When the candidates are measured, <code>pBuffer</code> is cleared and then    
+ * transformed in place several times; its previous contents are lost.    
+ */
+
+arm_status arm_cfft_plan_init_f32(
+  arm_planner_instance * P,
+  arm_cfft_plan_instance_f32 * S,
+  uint16_t fftLen,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag,
+  float32_t * pBuffer,
+  uint8_t flags,
+  uint8_t region)
+{
+  const arm_plan_wisdom_entry *pWisdom = NULL;   /* Stored choice */
+  arm_plan_wisdom_entry entry;                   /* New choice */
+  uint32_t candidates;                           /* Bit mask of the candidate variants */
+  uint32_t variant;                              /* Variant under test */
+  uint32_t run, start, cycles, elapsed;          /* Measurement */
+
+  /* Initialise the parameters of the transform */
+  S->fftLen = fftLen;
+  S->ifftFlag = ifftFlag;
+  S->bitReverseFlag = bitReverseFlag;
+  S->variant = ARM_CFFT_VARIANT_F32;
+
+  /* Instance of arm_cfft_f32 */
+  switch (fftLen)
+  {
+  case 16u:
+    S->pCfft = &arm_cfft_sR_f32_len16;
+    break;
+  case 32u:
+    S->pCfft = &arm_cfft_sR_f32_len32;
+    break;
+  case 64u:
+    S->pCfft = &arm_cfft_sR_f32_len64;
+    break;
+  case 128u:
+    S->pCfft = &arm_cfft_sR_f32_len128;
+    break;
+  case 256u:
+    S->pCfft = &arm_cfft_sR_f32_len256;
+    break;
+  case 512u:
+    S->pCfft = &arm_cfft_sR_f32_len512;
+    break;
+  case 1024u:
+    S->pCfft = &arm_cfft_sR_f32_len1024;
+    break;
+  case 2048u:
+    S->pCfft = &arm_cfft_sR_f32_len2048;
+    break;
+  case 4096u:
+    S->pCfft = &arm_cfft_sR_f32_len4096;
+    break;
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The radix-2 variant supports the same lengths, the radix-4 one only the    
+   * powers of 4 */
+  arm_cfft_radix2_init_f32(&S->radix2, fftLen, ifftFlag, bitReverseFlag);
+
+  candidates = (1u << ARM_CFFT_VARIANT_F32) | (1u << ARM_CFFT_VARIANT_RADIX2_F32);
+
+  if(arm_cfft_radix4_init_f32(&S->radix4, fftLen, ifftFlag, bitReverseFlag) ==
+     ARM_MATH_SUCCESS)
+  {
+    candidates |= (1u << ARM_CFFT_VARIANT_RADIX4_F32);
+  }
+
+  /* Without a planner, keep the default variant */
+  if(P == NULL)
+  {
+    return (ARM_MATH_SUCCESS);
+  }
+
+  /* Look up the wisdom */
+  if((flags & ARM_PLAN_MEASURE) == 0u)
+  {
+    pWisdom = arm_planner_find(P, ARM_PLAN_CFFT_F32, (uint8_t) candidates,
+                               region, fftLen, 0u);
+  }
+
+  /* An entry naming a variant that is not a candidate is ignored */
+  if((pWisdom != NULL) && (pWisdom->variant <= ARM_CFFT_VARIANT_RADIX4_F32) &&
+     ((candidates & (1u << pWisdom->variant)) != 0u))
+  {
+    S->variant = (arm_cfft_variant) pWisdom->variant;
+  }
+  else if(P->timer != NULL)
+  {
+    /* Measure every candidate on the buffer, cleared so that repeated    
+     * transforms cannot overflow */
+    arm_fill_f32(0.0f, pBuffer, 2u * fftLen);
+
+    entry.variant = ARM_CFFT_VARIANT_F32;
+    entry.cycles = 0xFFFFFFFFu;
+
+    for (variant = 0u; variant <= ARM_CFFT_VARIANT_RADIX4_F32; variant++)
+    {
+      if((candidates & (1u << variant)) == 0u)
+      {
+        continue;
+      }
+
+      S->variant = (arm_cfft_variant) variant;
+      cycles = 0xFFFFFFFFu;
+
+      /* Keep the fastest run, the first ones may warm up the caches */
+      for (run = 0u; run < ARM_PLAN_RUNS; run++)
+      {
+        start = P->timer();
+        arm_cfft_plan_f32(S, pBuffer);
+        elapsed = P->timer() - start;
+        cycles = (elapsed < cycles) ? elapsed : cycles;
+      }
+
+      if(cycles < entry.cycles)
+      {
+        entry.variant = (uint8_t) variant;
+        entry.cycles = cycles;
+      }
+    }
+
+    S->variant = (arm_cfft_variant) entry.variant;
+
+    /* Record the choice; a full table only means measuring again next time */
+    entry.kernel = ARM_PLAN_CFFT_F32;
+    entry.candidates = (uint8_t) candidates;
+    entry.region = region;
+    entry.len1 = fftLen;
+    entry.len2 = 0u;
+    (void) arm_planner_record(P, &entry);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of ComplexFFT group    
+ */
@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        12. March 2014
+* $Revision: 	V1.4.4
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_idct8x8_q15.c    
+*    
+* Description:	Q15 8x8 two-dimensional inverse DCT-II.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup DCT8x8    
+ * @{    
+ */
+
+/* Coefficients of one pass, in pairs: 4 k(u) cos((2n+1)u pi/16) for    
+ * u = 0, 2, 4, 6 then u = 1, 3, 5, 7.  They are half the coefficients of the    
+ * inverse pass, which reach sqrt(2) */
+static const q31_t idct8Coef[16] = {
+  0x539F4000, 0x22A34000, 0x4B4258C5, 0x11A83249,  /* x[0]:  16384,  21407,  16384,   8867 |  22725,  19266,  12873,   4520 */
+  0x22A34000, 0xAC61C000, 0xEE584B42, 0xCDB7A73B,  /* x[1]:  16384,   8867, -16384, -21407 |  19266,  -4520, -22725, -12873 */
+  0xDD5D4000, 0x539FC000, 0xA73B3249, 0x4B4211A8,  /* x[2]:  16384,  -8867, -16384,  21407 |  12873, -22725,   4520,  19266 */
+  0xAC614000, 0xDD5D4000, 0xCDB711A8, 0xA73B4B42   /* x[3]:  16384, -21407,  16384,  -8867 |   4520, -12873,  19266, -22725 */
+};
+
+/**    
+ * @brief  One pass of the 8x8 inverse DCT-II: transforms 8 rows and stores them transposed.    
+ * @param[in]  *pSrc  points to the input block.    
+ * @param[out] *pDst  points to the output block.    
+ * @param[in]  shift  right shift of the results: 14 for the gain of the inverse transform, 15 for half of it, 13 for twice.    
+ * @return none.    
+ */
+
+static void arm_idct8_pass_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t shift)
+{
+  q31_t rounding = (q31_t) 1 << (shift - 1u);    /* Rounding constant */
+  const q31_t *pCoef;                            /* Coefficient pointer */
+  q31_t even, odd;                               /* Even and odd parts of an output pair */
+  uint32_t row, n;                               /* Loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t x02, x46, x13, x57;                      /* Packed inputs */
+
+  for (row = 0u; row < 8u; row++)
+  {
+    /* Pack the even and the odd frequencies */
+    x02 = __PKHBT(pSrc[0], pSrc[2], 16);
+    x46 = __PKHBT(pSrc[4], pSrc[6], 16);
+    x13 = __PKHBT(pSrc[1], pSrc[3], 16);
+    x57 = __PKHBT(pSrc[5], pSrc[7], 16);
+
+    /* x[n] = even + odd and x[7-n] = even - odd */
+    pCoef = idct8Coef;
+    for (n = 0u; n < 4u; n++)
+    {
+      even = __SMLAD(x46, pCoef[1], __SMLAD(x02, pCoef[0], rounding));
+      odd = __SMLAD(x57, pCoef[3], __SMUAD(x13, pCoef[2]));
+
+      pDst[n * 8u] = (q15_t) __SSAT(__QADD(even, odd) >> shift, 16);
+      pDst[(7u - n) * 8u] = (q15_t) __SSAT(__QSUB(even, odd) >> shift, 16);
+
+      pCoef += 4u;
+    }
+
+    pSrc += 8u;
+    pDst++;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q31_t c0, c1, c2, c3;                          /* Coefficient pairs */
+
+  for (row = 0u; row < 8u; row++)
+  {
+    /* x[n] = even + odd and x[7-n] = even - odd */
+    pCoef = idct8Coef;
+    for (n = 0u; n < 4u; n++)
+    {
+      c0 = pCoef[0];
+      c1 = pCoef[1];
+      c2 = pCoef[2];
+      c3 = pCoef[3];
+
+      even = rounding + pSrc[0] * (q15_t) c0 + pSrc[2] * (c0 >> 16) +
+        pSrc[4] * (q15_t) c1 + pSrc[6] * (c1 >> 16);
+      odd = pSrc[1] * (q15_t) c2 + pSrc[3] * (c2 >> 16) +
+        pSrc[5] * (q15_t) c3 + pSrc[7] * (c3 >> 16);
+
+      pDst[n * 8u] = (q15_t) __SSAT(__QADD(even, odd) >> shift, 16);
+      pDst[(7u - n) * 8u] = (q15_t) __SSAT(__QSUB(even, odd) >> shift, 16);
+
+      pCoef += 4u;
+    }
+
+    pSrc += 8u;
+    pDst++;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+}
+
+/**    
+ * @brief  Q15 8x8 two-dimensional inverse DCT-II.    
+ * @param[in]  *pSrc  points to the input block of 64 coefficients, in row order.    
+ * @param[out] *pDst  points to the output block of 64 samples, in row order.    
+ * @return none.    
+ *    
+ * \par    
+ * Inverts arm_dct8x8_q15(): <code>pSrc[8*u + v]</code> holds the coefficient    
+ * of vertical frequency <code>u</code> and horizontal frequency    
+ * <code>v</code>, scaled as its outputs.  The transform may be computed in    
+ * place.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * Blocks of coefficients produced by arm_dct8x8_q15() give samples in the    
+ * Q15 range.  Other blocks, such as dequantized JPEG coefficients, may give    
+ * samples out of range, which are saturated.  The intermediate results have    
+ * one bit of headroom, so the saturation is only applied to the samples as    
+ * long as the rows of the block stay within twice the Q15 range.    
+ */
+
+void arm_idct8x8_q15(
+  const q15_t * pSrc,
+  q15_t * pDst)
+{
+  q15_t tmp[64];                                 /* Block after the row pass */
+
+  /* Rows into the transposed temporary block, then its rows (the columns of    
+   * the input) into the transposed output block.  The temporary block is    
+   * kept at half scale, as the coefficients of a quantized block can make    
+   * the rows exceed the Q15 range even when the samples do not */
+  arm_idct8_pass_q15(pSrc, tmp, 15u);
+  arm_idct8_pass_q15(tmp, pDst, 13u);
+}
+
+/**    
+ * @} end of DCT8x8 group    
+ */
@@ -87,16 +87,69 @@ typedef struct
 
   __IO HAL_CRC_StateTypeDef   State;      /*!< CRC communication state */
 
+  DMA_HandleTypeDef           *hdma;      /*!< Memory to memory DMA handle feeding the data register,
+                                               NULL when DMA is not used                            */
+
+  struct __CRC_ContextTypeDef *pContext;  /*!< Context updated by the DMA transfer in progress    */
+
+  uint8_t                     *pBuffPtr;  /*!< Pointer to the data of the DMA transfer            */
+
+  __IO uint32_t               XferCount;  /*!< Number of words left to transfer by DMA            */
+
+  uint32_t                    XferSize;   /*!< Number of words of the current DMA transfer        */
+
 }CRC_HandleTypeDef;
 /** 
   * @}
   */
 
+/** @defgroup CRC_Exported_Types_Group3 CRC Context Structure definition   
+  * @{
+  */ 
+typedef struct __CRC_ContextTypeDef
+{
+  uint32_t                    Algorithm;  /*!< CRC algorithm.
+                                               This parameter can be a value of @ref CRC_Algorithm     */
+
+  uint32_t                    Crc;        /*!< Current CRC register, before the final XOR           */
+
+  uint8_t                     Pending[4]; /*!< Bytes of an incomplete word (CRC_ALGO_CRC32_STM32)   */
+
+  uint32_t                    NbPending;  /*!< Number of bytes in Pending                           */
+
+}CRC_ContextTypeDef;
+/** 
+  * @}
+  */
+
 /**
   * @}
   */ 
 
 /* Exported constants --------------------------------------------------------*/
+/** @defgroup CRC_Exported_Constants CRC Exported Constants
+  * @{
+  */
+
+/** @defgroup CRC_Algorithm CRC Algorithm
+  * @brief    CRC algorithms of the context API, with the CRC of "123456789"
+  * @{
+  */
+#define CRC_ALGO_CRC32_STM32    ((uint32_t)0x00000000)  /*!< Hardware unit: CRC-32/MPEG-2 over little endian
+                                                             32-bit words, a 1 to 3 byte tail is processed
+                                                             byte by byte (check 0xBF99399C)              */
+#define CRC_ALGO_CRC32_MPEG2    ((uint32_t)0x00000001)  /*!< CRC-32/MPEG-2 over bytes (check 0x0376E6E7)     */
+#define CRC_ALGO_CRC32          ((uint32_t)0x00000002)  /*!< Reflected CRC-32 of Ethernet and zlib
+                                                             (check 0xCBF43926)                             */
+#define CRC_ALGO_CRC16_CCITT    ((uint32_t)0x00000003)  /*!< CRC-16/CCITT-FALSE, software only (check 0x29B1) */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
 /* Exported macro ------------------------------------------------------------*/
 /** @defgroup CRC_Exported_Macros CRC Exported Macros
   * @{
@@ -154,6 +207,12 @@ void HAL_CRC_MspDeInit(CRC_HandleTypeDef *hcrc);
   */
 uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
 uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+HAL_StatusTypeDef HAL_CRC_ContextInit(CRC_ContextTypeDef *pContext, uint32_t Algorithm);
+HAL_StatusTypeDef HAL_CRC_ContextUpdate(CRC_HandleTypeDef *hcrc, CRC_ContextTypeDef *pContext, const uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef HAL_CRC_ContextUpdate_DMA(CRC_HandleTypeDef *hcrc, CRC_ContextTypeDef *pContext, const uint8_t *pData, uint32_t Size);
+uint32_t HAL_CRC_ContextFinal(CRC_ContextTypeDef *pContext);
+void HAL_CRC_CpltCallback(CRC_HandleTypeDef *hcrc);
+void HAL_CRC_ErrorCallback(CRC_HandleTypeDef *hcrc);
 /**
   * @}
   */ 
@@ -209,6 +268,10 @@ HAL_CRC_StateTypeDef HAL_CRC_GetState(CRC_HandleTypeDef *hcrc);
 /** @defgroup CRC_Private_Macros CRC Private Macros
   * @{
   */
+#define IS_CRC_ALGORITHM(ALGORITHM) (((ALGORITHM) == CRC_ALGO_CRC32_STM32) || \
+                                     ((ALGORITHM) == CRC_ALGO_CRC32_MPEG2) || \
+                                     ((ALGORITHM) == CRC_ALGO_CRC32)       || \
+                                     ((ALGORITHM) == CRC_ALGO_CRC16_CCITT))
 
 /**
   * @}
@@ -162,6 +162,9 @@ typedef struct
       HAL_LockTypeDef          Lock;             /*!< CRYP locking object */
 
    __IO  HAL_CRYP_STATETypeDef State;            /*!< CRYP peripheral state */
+
+      struct __CRYP_ContextTypeDef *pContext;    /*!< Context loaded in the CRYP peripheral by the
+                                                      CRYPEx context functions, NULL if none */
 }CRYP_HandleTypeDef;
 
 /** 
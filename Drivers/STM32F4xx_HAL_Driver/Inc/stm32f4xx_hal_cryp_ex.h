@@ -56,6 +56,90 @@
   */
 
 /* Exported types ------------------------------------------------------------*/ 
+/** @defgroup CRYPEx_Exported_Types CRYPEx Exported Types
+  * @{
+  */
+
+/** 
+  * @brief  Data segment of a DMA context update. Segments are chained in a list
+  *         processed in order.
+  */
+typedef struct __CRYP_SegmentTypeDef
+{
+  uint8_t  *pInBuffer;                      /*!< Input data, word aligned                                */
+
+  uint8_t  *pOutBuffer;                     /*!< Output data, word aligned, may be equal to pInBuffer   */
+
+  uint32_t Size;                            /*!< Number of bytes, a multiple of 16 except for the last
+                                                 segment of the list                                     */
+
+  struct __CRYP_SegmentTypeDef *pNext;      /*!< Next segment, NULL for the last one                     */
+}CRYP_SegmentTypeDef;
+
+/** 
+  * @brief  AES-CTR or AES-GCM stream context. It holds a message in progress
+  *         while another message is processed by the CRYP peripheral.
+  */
+typedef struct __CRYP_ContextTypeDef
+{
+  uint32_t AlgoModeDirection;               /*!< CRYP_CR_ALGOMODE_AES_CTR_ENCRYPT, CRYP_CR_ALGOMODE_AES_CTR_DECRYPT,
+                                                 CRYP_CR_ALGOMODE_AES_GCM_ENCRYPT or CRYP_CR_ALGOMODE_AES_GCM_DECRYPT */
+
+  uint8_t  *pKey;                           /*!< Key, kept by the application until the message is
+                                                 finished                                                */
+
+  uint32_t KeySize;                         /*!< CRYP_KEYSIZE_128B, CRYP_KEYSIZE_192B or CRYP_KEYSIZE_256B */
+
+  uint32_t Engine;                          /*!< Message processed by the CRYP peripheral or by software,
+                                                 set by the first update                                 */
+
+  uint32_t Phase;                           /*!< CRYP_PHASE_HEADER, CRYP_PHASE_PAYLOAD, or CRYP_PHASE_FINAL
+                                                 once the message is finished                            */
+
+  uint32_t Cr;                              /*!< Saved CRYP_CR register                                  */
+
+  uint32_t Iv[4];                           /*!< Counter block, saved CRYP_IVxR registers               */
+
+  uint32_t Csgcmccm[8];                     /*!< Saved CRYP_CSGCMCCMxR registers                         */
+
+  uint32_t Csgcm[8];                        /*!< Saved CRYP_CSGCMxR registers                            */
+
+  uint32_t HeaderSize;                      /*!< Number of header bytes processed                       */
+
+  uint32_t PayloadSize;                     /*!< Number of payload bytes processed                      */
+
+  uint8_t  Buffer[16];                      /*!< Incomplete block: header, input (CRYP peripheral) or
+                                                 cyphertext (software)                                   */
+
+  uint32_t NbBuffer;                        /*!< Number of bytes in Buffer                               */
+
+  CRYP_SegmentTypeDef *pInSegment;          /*!< Segment transferred by the input DMA stream            */
+
+  CRYP_SegmentTypeDef *pOutSegment;         /*!< Segment transferred by the output DMA stream           */
+
+  uint32_t InOffset;                        /*!< Bytes of pInSegment already transferred                */
+
+  uint32_t OutOffset;                       /*!< Bytes of pOutSegment already transferred               */
+
+  uint32_t RoundKey[60];                    /*!< Key schedule of the software computation                */
+
+  uint32_t Rounds;                          /*!< Number of rounds of the software computation            */
+
+  uint8_t  KeyStream[16];                   /*!< Key stream of the current block (software)              */
+
+  uint8_t  Ghash[16];                       /*!< GHASH accumulator (software)                            */
+
+  uint8_t  TagMask[16];                     /*!< Encrypted initial counter block (software)              */
+
+  uint64_t HashTableL[16];                  /*!< Multiples of the hash subkey, low halves (software)     */
+
+  uint64_t HashTableH[16];                  /*!< Multiples of the hash subkey, high halves (software)    */
+}CRYP_ContextTypeDef;
+
+/**
+  * @}
+  */
+
 /* Exported constants --------------------------------------------------------*/
    
 /** @defgroup CRYPEx_Exported_Constants   CRYPEx Exported Constants
@@ -149,6 +233,21 @@ HAL_StatusTypeDef HAL_CRYPEx_AESCCM_Decrypt_DMA(CRYP_HandleTypeDef *hcryp, uint8
     
 void HAL_CRYPEx_GCMCCM_IRQHandler(CRYP_HandleTypeDef *hcryp);
 
+/**
+  * @}
+  */ 
+
+/** @addtogroup CRYPEx_Exported_Functions_Group3
+  * @{
+  */  
+
+HAL_StatusTypeDef HAL_CRYPEx_ContextInit(CRYP_ContextTypeDef *pContext, uint32_t AlgoModeDirection, uint8_t *pKey, uint32_t KeySize, uint8_t *pInitVect);
+HAL_StatusTypeDef HAL_CRYPEx_ContextHeader(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint8_t *pHeader, uint32_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_CRYPEx_ContextUpdate(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size, uint8_t *pOutBuffer, uint32_t Timeout);
+HAL_StatusTypeDef HAL_CRYPEx_ContextUpdate_DMA(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, CRYP_SegmentTypeDef *pSegment);
+HAL_StatusTypeDef HAL_CRYPEx_ContextFinish(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint8_t *pAuthTag, uint32_t Timeout);
+HAL_StatusTypeDef HAL_CRYPEx_ContextRelease(CRYP_HandleTypeDef *hcryp, uint32_t Timeout);
+
 /**
   * @}
   */ 
@@ -189,6 +288,10 @@ void HAL_CRYPEx_GCMCCM_IRQHandler(CRYP_HandleTypeDef *hcryp);
 /** @defgroup CRYPEx_Private_Macros CRYPEx Private Macros
   * @{
   */
+#define IS_CRYP_CONTEXT_ALGOMODE(__ALGOMODE__) (((__ALGOMODE__) == CRYP_CR_ALGOMODE_AES_CTR_ENCRYPT) || \
+                                                ((__ALGOMODE__) == CRYP_CR_ALGOMODE_AES_CTR_DECRYPT) || \
+                                                ((__ALGOMODE__) == CRYP_CR_ALGOMODE_AES_GCM_ENCRYPT) || \
+                                                ((__ALGOMODE__) == CRYP_CR_ALGOMODE_AES_GCM_DECRYPT))
 
  /**
   * @}
@@ -54,6 +54,35 @@
   * @{
   */ 
 
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup DMAEx_Exported_Constants DMAEx Exported Constants
+  * @brief DMAEx Exported constants
+  * @{
+  */
+
+/** @defgroup DMAEx_Buffer_Stream_Size DMAEx Buffer Stream Size
+  * @brief    Maximum number of buffers of a buffer stream
+  * @{
+  */
+#define DMA_BUFFER_STREAM_MAX_BUFFERS   ((uint32_t)16)   /* Power of 2, at most 32 */
+/**
+  * @}
+  */
+
+/** @defgroup DMAEx_Copy_Type DMAEx Copy Type
+  * @brief    DMA memory copy request types
+  * @{
+  */
+#define DMA_COPY_MEMCPY                 ((uint32_t)0x00000000)  /*!< Copy pSrc to pDst             */
+#define DMA_COPY_FILL                   ((uint32_t)0x00000001)  /*!< Fill pDst with Pattern        */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
 /* Exported types ------------------------------------------------------------*/
 /** @defgroup DMAEx_Exported_Types DMAEx Exported Types
   * @brief DMAEx Exported types
@@ -70,6 +99,128 @@ typedef enum
 
 }HAL_DMA_MemoryTypeDef;
 
+/** 
+  * @brief  DMA stream request candidate, used by the stream allocator
+  */ 
+typedef struct
+{
+  DMA_Stream_TypeDef         *Instance;   /*!< Stream able to serve the request, e.g. DMA2_Stream0        */
+
+  uint32_t                   Channel;     /*!< Channel of the request on this stream.
+                                               This parameter can be a value of @ref DMA_Channel_selection */
+}DMA_StreamRequestTypeDef;
+
+/** 
+  * @brief  DMA buffer stream statistics
+  */ 
+typedef struct
+{
+  uint32_t                   Buffers;     /*!< Number of buffers handed over between the DMA and the application */
+
+  uint32_t                   Overruns;    /*!< Peripheral to memory: buffers overwritten because the
+                                               application held every free buffer                         */
+
+  uint32_t                   Underruns;   /*!< Memory to peripheral: buffers sent again because the
+                                               application did not submit a new one in time               */
+
+  uint32_t                   Errors;      /*!< Number of DMA error interrupts                                */
+}DMA_BufferStreamStatsTypeDef;
+
+/** 
+  * @brief  DMA buffer stream definition
+  * @note   The fields from hdma to pContext are set by the user before
+  *         HAL_DMAEx_BufferStreamStart(), the others are managed by the driver.
+  */ 
+typedef struct __DMA_BufferStreamTypeDef
+{
+  DMA_HandleTypeDef          *hdma;           /*!< Initialized DMA handle, peripheral to memory or
+                                                   memory to peripheral                               */
+
+  uint32_t                   PeriphAddress;   /*!< Address of the peripheral data register            */
+
+  void                       **pBuffers;      /*!< Table of NbBuffers buffer addresses                 */
+
+  uint32_t                   NbBuffers;       /*!< Number of buffers, from 3 to DMA_BUFFER_STREAM_MAX_BUFFERS */
+
+  uint32_t                   BufferLength;    /*!< Number of data items in each buffer                 */
+
+  void                       (* BufferCallback)(struct __DMA_BufferStreamTypeDef *hstream); /*!< Called from the DMA
+                                                   interrupt each time a buffer is completed              */
+
+  void                       (* ErrorCallback)(struct __DMA_BufferStreamTypeDef *hstream);  /*!< Called from the DMA
+                                                   interrupt when the stream has been stopped on error    */
+
+  void                       *pContext;       /*!< User context, not used by the driver                */
+
+  __IO uint8_t               Free[DMA_BUFFER_STREAM_MAX_BUFFERS];  /*!< Ring of buffers waiting to be filled    */
+
+  __IO uint8_t               Ready[DMA_BUFFER_STREAM_MAX_BUFFERS]; /*!< Ring of buffers waiting to be consumed  */
+
+  __IO uint32_t              FreeIn;          /*!< Free ring write counter                              */
+
+  __IO uint32_t              FreeOut;         /*!< Free ring read counter                               */
+
+  __IO uint32_t              ReadyIn;         /*!< Ready ring write counter                             */
+
+  __IO uint32_t              ReadyOut;        /*!< Ready ring read counter                              */
+
+  uint32_t                   Held;            /*!< Bit mask of the buffers owned by the application     */
+
+  __IO uint8_t               Active[2];       /*!< Buffers loaded in the memory 0 and memory 1 address registers */
+
+  __IO HAL_DMA_StateTypeDef  State;           /*!< Buffer stream state                                  */
+
+  DMA_BufferStreamStatsTypeDef Stats;         /*!< Buffer stream statistics                             */
+}DMA_BufferStreamTypeDef;
+
+/** 
+  * @brief  DMA memory copy request definition
+  * @note   The request is owned by the driver from HAL_DMAEx_CopyQueue() until
+  *         its XferCpltCallback is called.
+  */ 
+typedef struct __DMA_CopyTypeDef
+{
+  uint32_t                   Type;        /*!< Copy or fill.
+                                               This parameter can be a value of @ref DMAEx_Copy_Type        */
+
+  void                       *pDst;       /*!< Destination buffer                                           */
+
+  const void                 *pSrc;       /*!< Source buffer, not used by a fill                            */
+
+  uint32_t                   Pattern;     /*!< Fill pattern, written in little endian order. A byte or
+                                               half-word value must be replicated on 32 bits               */
+
+  uint32_t                   Size;        /*!< Number of bytes to copy or fill, no upper limit             */
+
+  void                       (* XferCpltCallback)(struct __DMA_HandleTypeDef *hdma, struct __DMA_CopyTypeDef *pCopy); /*!< Called
+                                               from the DMA interrupt when the request is complete           */
+
+  void                       *pContext;   /*!< User context, e.g. an RTOS semaphore to release             */
+
+  __IO uint32_t              ErrorCode;   /*!< DMA error code of the request, HAL_DMA_ERROR_NONE on success */
+
+  uint32_t                   Offset;      /*!< Number of bytes already transferred, managed by the driver  */
+
+  struct __DMA_CopyTypeDef   *pNext;      /*!< Next queued request, managed by the driver                  */
+}DMA_CopyTypeDef;
+
+/** 
+  * @brief  DMA memory copy engine definition
+  */ 
+typedef struct
+{
+  DMA_HandleTypeDef          *hdma;          /*!< DMA2 stream initialized in memory to memory mode and
+                                                  dedicated to the engine                                */
+
+  DMA_CopyTypeDef            *pQueueHead;    /*!< First request waiting for the stream                  */
+
+  DMA_CopyTypeDef            *pQueueTail;    /*!< Last request waiting for the stream                   */
+
+  DMA_CopyTypeDef            *pQueueActive;  /*!< Request being transferred                             */
+
+  uint32_t                   ChunkSize;      /*!< Number of bytes of the transfer in progress           */
+}DMA_CopyEngineTypeDef;
+
 /**
   * @}
   */
@@ -90,6 +241,39 @@ HAL_StatusTypeDef HAL_DMAEx_MultiBufferStart(DMA_HandleTypeDef *hdma, uint32_t S
 HAL_StatusTypeDef HAL_DMAEx_MultiBufferStart_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t SecondMemAddress, uint32_t DataLength);
 HAL_StatusTypeDef HAL_DMAEx_ChangeMemory(DMA_HandleTypeDef *hdma, uint32_t Address, HAL_DMA_MemoryTypeDef memory);
 
+/**
+  * @}
+  */
+
+/** @defgroup DMAEx_Exported_Functions_Group2 Stream allocation functions
+  * @brief   Stream allocation functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_AllocStream(DMA_HandleTypeDef *hdma, const DMA_StreamRequestTypeDef *pRequests, uint32_t NbRequests);
+HAL_StatusTypeDef HAL_DMAEx_FreeStream(DMA_HandleTypeDef *hdma);
+DMA_HandleTypeDef *HAL_DMAEx_GetStreamOwner(DMA_Stream_TypeDef *Instance);
+/**
+  * @}
+  */
+
+/** @defgroup DMAEx_Exported_Functions_Group3 Buffer stream functions
+  * @brief   Buffer stream functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_BufferStreamStart(DMA_BufferStreamTypeDef *hstream);
+HAL_StatusTypeDef HAL_DMAEx_BufferStreamStop(DMA_BufferStreamTypeDef *hstream);
+void *HAL_DMAEx_BufferStreamGet(DMA_BufferStreamTypeDef *hstream);
+HAL_StatusTypeDef HAL_DMAEx_BufferStreamRelease(DMA_BufferStreamTypeDef *hstream, void *pBuffer);
+void HAL_DMAEx_BufferStreamGetStats(DMA_BufferStreamTypeDef *hstream, DMA_BufferStreamStatsTypeDef *pStats);
+/**
+  * @}
+  */
+
+/** @defgroup DMAEx_Exported_Functions_Group4 Memory copy functions
+  * @brief   Memory copy functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_CopyQueue(DMA_CopyEngineTypeDef *hengine, DMA_CopyTypeDef *pCopy);
 /**
   * @}
   */
@@ -98,6 +282,16 @@ HAL_StatusTypeDef HAL_DMAEx_ChangeMemory(DMA_HandleTypeDef *hdma, uint32_t Addre
   */
          
 /* Private functions ---------------------------------------------------------*/
+/** @defgroup DMAEx_Private_Macros DMAEx Private Macros
+  * @brief DMAEx private macros
+  * @{
+  */
+#define IS_DMA_COPY_TYPE(TYPE) (((TYPE) == DMA_COPY_MEMCPY) || \
+                                ((TYPE) == DMA_COPY_FILL))
+/**
+  * @}
+  */
+
 /** @defgroup DMAEx_Private_Functions DMAEx Private Functions
   * @brief DMAEx Private functions
   * @{
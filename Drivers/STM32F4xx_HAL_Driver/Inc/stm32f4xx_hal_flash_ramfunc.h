@@ -43,8 +43,6 @@
  extern "C" {
 #endif
 
-#if defined(STM32F411xE) || defined(STM32F446xx)
-
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f4xx_hal_def.h"
 
@@ -66,10 +64,20 @@
 /** @addtogroup FLASHRAMFUNC_Exported_Functions_Group1
   * @{
   */   
+#if defined(STM32F411xE) || defined(STM32F446xx)
 __RAM_FUNC HAL_FLASHEx_StopFlashInterfaceClk(void);
 __RAM_FUNC HAL_FLASHEx_StartFlashInterfaceClk(void);
 __RAM_FUNC HAL_FLASHEx_EnableFlashSleepMode(void);
 __RAM_FUNC HAL_FLASHEx_DisableFlashSleepMode(void);
+#endif /* STM32F411xE || STM32F446xx */
+/**
+  * @}
+  */ 
+
+/** @addtogroup FLASHRAMFUNC_Exported_Functions_Group2
+  * @{
+  */   
+__RAM_FUNC HAL_FLASHEx_ProgramBuffer(uint32_t VoltageRange, uint32_t Address, uint32_t *pData, uint32_t Size);
 /**
   * @}
   */ 
@@ -77,7 +85,6 @@ __RAM_FUNC HAL_FLASHEx_DisableFlashSleepMode(void);
 /**
   * @}
   */
-#endif /* STM32F411xE */
 
 /**
   * @}
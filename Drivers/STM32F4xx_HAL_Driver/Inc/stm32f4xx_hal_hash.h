@@ -138,6 +138,9 @@ typedef struct
       HAL_LockTypeDef            Lock;              /*!< HASH locking object            */
 
      __IO HAL_HASH_STATETypeDef  State;             /*!< HASH peripheral state          */
+
+      struct __HASH_ContextTypeDef *pContext;       /*!< Context loaded in the HASH peripheral by
+                                                         the HASHEx context functions, NULL if none */
 } HASH_HandleTypeDef;
 
 /** 
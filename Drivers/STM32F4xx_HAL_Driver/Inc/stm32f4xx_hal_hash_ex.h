@@ -56,8 +56,60 @@
   *  @{
   */ 
   
-/* Exported types ------------------------------------------------------------*/ 
 /* Exported constants --------------------------------------------------------*/
+/** @defgroup HASHEx_Exported_Constants HASHEx Exported Constants
+  * @{
+  */
+#define HASH_CONTEXT_CSR_NUMBER    ((uint32_t)54)  /*!< Context swap registers saved for an HMAC context */
+#define HASH_CONTEXT_BLOCK_SIZE    ((uint32_t)64)  /*!< SHA-224/SHA-256 block size in bytes               */
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/ 
+/** @defgroup HASHEx_Exported_Types HASHEx Exported Types
+  * @{
+  */
+
+/** 
+  * @brief  SHA-224/SHA-256 digest context. It holds a message digest in progress
+  *         while another message is processed by the HASH peripheral.
+  */
+typedef struct __HASH_ContextTypeDef
+{
+  uint32_t Algorithm;                       /*!< HASH_ALGOSELECTION_SHA224 or HASH_ALGOSELECTION_SHA256 */
+
+  uint32_t AlgoMode;                        /*!< HASH_ALGOMODE_HASH or HASH_ALGOMODE_HMAC                */
+
+  uint8_t  *pKey;                           /*!< HMAC key, kept by the application until the digest
+                                                 is finished                                             */
+
+  uint32_t KeySize;                         /*!< HMAC key size in bytes                                  */
+
+  uint32_t Engine;                          /*!< Digest computed by the HASH peripheral or by software,
+                                                 set by the first update                                 */
+
+  uint32_t Imr;                             /*!< Saved HASH_IMR register                                 */
+
+  uint32_t Str;                             /*!< Saved HASH_STR register                                 */
+
+  uint32_t Cr;                              /*!< Saved HASH_CR register                                  */
+
+  uint32_t Csr[HASH_CONTEXT_CSR_NUMBER];    /*!< Saved HASH_CSRx registers                               */
+
+  uint32_t Digest[8];                       /*!< Intermediate digest of the software computation         */
+
+  uint32_t Length;                          /*!< Number of bytes processed by the software computation   */
+
+  uint8_t  Buffer[HASH_CONTEXT_BLOCK_SIZE]; /*!< Incomplete word (HASH peripheral) or block (software)   */
+
+  uint32_t NbBuffer;                        /*!< Number of bytes in Buffer                               */
+}HASH_ContextTypeDef;
+
+/**
+  * @}
+  */
+
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 
@@ -129,6 +181,20 @@ HAL_StatusTypeDef HAL_HMACEx_SHA256_Start_DMA(HASH_HandleTypeDef *hhash, uint8_t
   
 void HAL_HASHEx_IRQHandler(HASH_HandleTypeDef *hhash);
 
+/**
+  * @}
+  */ 
+
+/** @defgroup HASHEx_Exported_Functions_Group7 HASHEx multi-context processing functions
+  * @{
+  */
+
+HAL_StatusTypeDef HAL_HASHEx_ContextInit(HASH_ContextTypeDef *pContext, uint32_t Algorithm, uint8_t *pKey, uint32_t KeySize);
+HAL_StatusTypeDef HAL_HASHEx_ContextUpdate(HASH_HandleTypeDef *hhash, HASH_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size);
+HAL_StatusTypeDef HAL_HASHEx_ContextUpdate_DMA(HASH_HandleTypeDef *hhash, HASH_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size);
+HAL_StatusTypeDef HAL_HASHEx_ContextFinish(HASH_HandleTypeDef *hhash, HASH_ContextTypeDef *pContext, uint8_t *pOutBuffer, uint32_t Timeout);
+HAL_StatusTypeDef HAL_HASHEx_ContextRelease(HASH_HandleTypeDef *hhash, uint32_t Timeout);
+
 /**
   * @}
   */ 
@@ -168,6 +234,8 @@ void HAL_HASHEx_IRQHandler(HASH_HandleTypeDef *hhash);
 /** @defgroup HASHEx_Private_Macros HASHEx Private Macros
   * @{
   */
+#define IS_HASH_CONTEXT_ALGOSELECTION(__ALGOSELECTION__) (((__ALGOSELECTION__) == HASH_ALGOSELECTION_SHA224) || \
+                                                          ((__ALGOSELECTION__) == HASH_ALGOSELECTION_SHA256))
 
 /**
   * @}
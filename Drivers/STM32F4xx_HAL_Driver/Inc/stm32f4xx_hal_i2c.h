@@ -107,10 +107,48 @@ typedef enum
 
 }HAL_I2C_StateTypeDef;
 
+struct __I2C_HandleTypeDef;
+
+/**
+  * @brief  I2C queued transaction definition
+  */
+typedef struct __I2C_TransactionTypeDef
+{
+  uint32_t                   Type;         /*!< Kind of transfer.
+                                                This parameter can be a value of @ref I2C_Transaction_Type   */
+
+  uint16_t                   DevAddress;   /*!< Target device address                                       */
+
+  uint16_t                   MemAddress;   /*!< Internal memory or register address of the memory transfers */
+
+  uint16_t                   MemAddSize;   /*!< Size of the internal memory address.
+                                                This parameter can be a value of @ref I2C_Memory_Address_Size */
+
+  uint8_t                    *pData;       /*!< Data to send or buffer of the received data                 */
+
+  uint16_t                   Size;         /*!< Number of bytes to send or receive                          */
+
+  uint32_t                   PollTrials;   /*!< Number of acknowledge polling attempts after a write, one per
+                                                HAL_I2C_QueuePollHandler() call, or 0 to complete right away.
+                                                Decremented by the driver                                     */
+
+  void                       (* XferCpltCallback)(struct __I2C_HandleTypeDef *hi2c,
+                                                  struct __I2C_TransactionTypeDef *pTrans);
+                                           /*!< Called once the transaction and its polling are over, or NULL */
+
+  void                       *pContext;    /*!< User context, not used by the driver                        */
+
+  __IO uint32_t              ErrorCode;    /*!< Result of the transaction, set before the callback.
+                                                This parameter can be a value of @ref I2C_Error_Code         */
+
+  struct __I2C_TransactionTypeDef *pNext;  /*!< Next queued transaction, managed by the driver              */
+
+}I2C_TransactionTypeDef;
+
 /**
   * @brief  I2C handle Structure definition
   */
-typedef struct
+typedef struct __I2C_HandleTypeDef
 {
   I2C_TypeDef                *Instance;  /*!< I2C registers base address     */
 
@@ -132,6 +170,18 @@ typedef struct
 
   __IO uint32_t              ErrorCode;  /*!<  I2C Error code                */
 
+  I2C_TransactionTypeDef     *pQueueHead;   /*!< I2C queue: first waiting transaction          */
+
+  I2C_TransactionTypeDef     *pQueueTail;   /*!< I2C queue: last waiting transaction           */
+
+  I2C_TransactionTypeDef     *pQueueActive; /*!< I2C queue: transaction owning the bus          */
+
+  I2C_TransactionTypeDef     *pQueuePoll;   /*!< I2C queue: write waiting for its acknowledge   */
+
+  __IO uint32_t              QueuePhase;    /*!< I2C queue: step of the transfer on the bus     */
+
+  uint32_t                   QueueTickstart; /*!< I2C queue: tick of the last step started      */
+
 }I2C_HandleTypeDef;
 /**
   * @}
@@ -211,6 +261,17 @@ typedef struct
   * @}
   */
 
+/** @defgroup I2C_Transaction_Type I2C Transaction Type
+  * @{
+  */
+#define I2C_TRANSACTION_WRITE           ((uint32_t)0x00000000)   /*!< Master transmit                           */
+#define I2C_TRANSACTION_READ            ((uint32_t)0x00000001)   /*!< Master receive                            */
+#define I2C_TRANSACTION_MEM_WRITE       ((uint32_t)0x00000002)   /*!< Memory address then data write            */
+#define I2C_TRANSACTION_MEM_READ        ((uint32_t)0x00000003)   /*!< Memory address write then data read       */
+/**
+  * @}
+  */
+
 /** @defgroup I2C_Interrupt_configuration_definition I2C Interrupt configuration definition
   * @{
   */
@@ -419,6 +480,9 @@ HAL_StatusTypeDef HAL_I2C_Slave_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint8_t *p
 HAL_StatusTypeDef HAL_I2C_Slave_Receive_DMA(I2C_HandleTypeDef *hi2c, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Queue_DMA(I2C_HandleTypeDef *hi2c, I2C_TransactionTypeDef *pTrans);
+void HAL_I2C_QueuePollHandler(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_QueueAbort(I2C_HandleTypeDef *hi2c, I2C_TransactionTypeDef *pTrans);
 
 /******* I2C IRQHandler and Callbacks used in non blocking modes (Interrupt and DMA) */
 void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c);
@@ -497,6 +561,10 @@ uint32_t HAL_I2C_GetError(I2C_HandleTypeDef *hi2c);
                                     ((STRETCH) == I2C_NOSTRETCH_ENABLE))
 #define IS_I2C_MEMADD_SIZE(SIZE) (((SIZE) == I2C_MEMADD_SIZE_8BIT) || \
                                   ((SIZE) == I2C_MEMADD_SIZE_16BIT))
+#define IS_I2C_TRANSACTION_TYPE(TYPE) (((TYPE) == I2C_TRANSACTION_WRITE)     || \
+                                       ((TYPE) == I2C_TRANSACTION_READ)      || \
+                                       ((TYPE) == I2C_TRANSACTION_MEM_WRITE) || \
+                                       ((TYPE) == I2C_TRANSACTION_MEM_READ))
 #define IS_I2C_CLOCK_SPEED(SPEED) (((SPEED) > 0) && ((SPEED) <= 400000))
 #define IS_I2C_OWN_ADDRESS1(ADDRESS1) (((ADDRESS1) & (uint32_t)(0xFFFFFC00)) == 0)
 #define IS_I2C_OWN_ADDRESS2(ADDRESS2) (((ADDRESS2) & (uint32_t)(0xFFFFFF01)) == 0)
@@ -118,6 +118,78 @@ typedef enum
     
 }HAL_SPI_StateTypeDef;
 
+struct __SPI_HandleTypeDef;
+
+/** 
+  * @brief  SPI bus device definition: the settings applied while one of the
+  *         devices sharing the bus is selected
+  */
+typedef struct
+{
+  GPIO_TypeDef               *CSPort;      /*!< GPIO port of the active low chip select, or NULL when
+                                                the chip select is not driven by the driver            */
+
+  uint16_t                   CSPin;        /*!< GPIO pin of the chip select.
+                                                This parameter can be a value of @ref GPIO_pins_define */
+
+  uint32_t                   CLKPolarity;  /*!< Serial clock steady state of the device.
+                                                This parameter can be a value of @ref SPI_Clock_Polarity */
+
+  uint32_t                   CLKPhase;     /*!< Clock active edge of the device.
+                                                This parameter can be a value of @ref SPI_Clock_Phase */
+
+  uint32_t                   BaudRatePrescaler; /*!< SCK prescaler for the device.
+                                                This parameter can be a value of @ref SPI_BaudRate_Prescaler */
+
+  uint32_t                   FirstBit;     /*!< Bit order of the device.
+                                                This parameter can be a value of @ref SPI_MSB_LSB_transmission */
+
+}SPI_DeviceTypeDef;
+
+/** 
+  * @brief  SPI bus transaction definition
+  */
+typedef struct __SPI_TransactionTypeDef
+{
+  SPI_DeviceTypeDef          *pDevice;     /*!< Device selected during the transaction                 */
+
+  const uint8_t              *pTxData;     /*!< Data to send, or NULL to send 0xFF                     */
+
+  uint8_t                    *pRxData;     /*!< Buffer of the received data, or NULL to discard them   */
+
+  uint16_t                   Size;         /*!< Number of data frames to exchange                      */
+
+  void                       (* XferCpltCallback)(struct __SPI_HandleTypeDef *hspi,
+                                                  struct __SPI_TransactionTypeDef *pTrans);
+                                           /*!< Called from the DMA or SPI interrupt once the chip
+                                                select is released, or NULL                            */
+
+  void                       *pContext;    /*!< User context, not used by the driver                   */
+
+  __IO uint32_t              ErrorCode;    /*!< Result of the transaction, set before the callback.
+                                                This parameter can be a value of @ref SPI_Error_Code   */
+
+  struct __SPI_TransactionTypeDef *pNext;  /*!< Next queued transaction, managed by the driver         */
+
+}SPI_TransactionTypeDef;
+
+/** 
+  * @brief  SPI bus queue counters definition
+  */
+typedef struct
+{
+  uint32_t Bytes;                          /*!< Number of data frames exchanged through the queue      */
+
+  uint32_t Transfers;                      /*!< Number of transactions completed                       */
+
+  uint32_t Pending;                        /*!< Number of transactions queued or ongoing               */
+
+  uint32_t MaxPending;                     /*!< Highest number of transactions queued at once          */
+
+  uint32_t Reconfigurations;               /*!< Number of clock settings changes between devices       */
+
+}SPI_QueueStatsTypeDef;
+
 /** 
   * @brief  SPI handle Structure definition
   */
@@ -153,6 +225,14 @@ typedef struct __SPI_HandleTypeDef
 
   __IO uint32_t              ErrorCode;    /* SPI Error code */
 
+  SPI_TransactionTypeDef     *pQueueHead;  /* SPI bus queue: ongoing transaction */
+
+  SPI_TransactionTypeDef     *pQueueTail;  /* SPI bus queue: last queued transaction */
+
+  __IO uint32_t              QueueBsyCount; /* SPI bus queue: SPI interrupts left to wait for the end of a transaction */
+
+  SPI_QueueStatsTypeDef      QueueStats;   /* SPI bus queue: counters */
+
 }SPI_HandleTypeDef;
 /**
   * @}
@@ -446,6 +526,7 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, uint8_t *p
 HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_Queue_DMA(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans);
 HAL_StatusTypeDef HAL_SPI_DMAPause(SPI_HandleTypeDef *hspi);
 HAL_StatusTypeDef HAL_SPI_DMAResume(SPI_HandleTypeDef *hspi);
 HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi);
@@ -468,6 +549,7 @@ void HAL_SPI_TxRxHalfCpltCallback(SPI_HandleTypeDef *hspi);
 /* Peripheral State and Control functions  **************************************/
 HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef *hspi);
 uint32_t HAL_SPI_GetError(SPI_HandleTypeDef *hspi);
+void HAL_SPI_GetQueueStats(SPI_HandleTypeDef *hspi, SPI_QueueStatsTypeDef *pStats);
 
 /**
   * @}
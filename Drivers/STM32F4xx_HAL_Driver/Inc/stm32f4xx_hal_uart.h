@@ -109,10 +109,48 @@ typedef enum
   HAL_UART_STATE_ERROR             = 0x04     /*!< Error                                              */      
 }HAL_UART_StateTypeDef;
 
+struct __UART_HandleTypeDef;
+
 /** 
-  * @brief  UART handle Structure definition  
+  * @brief  UART Tx queue descriptor definition  
+  */  
+typedef struct __UART_TxDescTypeDef
+{
+  const uint8_t                 *pData;           /*!< Data to send. They are not copied and must remain
+                                                       valid until the descriptor callback               */
+
+  uint16_t                      Size;             /*!< Number of bytes to send                            */
+
+  void                          (* XferCpltCallback)(struct __UART_HandleTypeDef *huart,
+                                                     struct __UART_TxDescTypeDef *pDesc);
+                                                  /*!< Called from the DMA interrupt once the data have
+                                                       been handed to the UART, or NULL                   */
+
+  void                          *pContext;        /*!< User context, not used by the driver               */
+
+  struct __UART_TxDescTypeDef   *pNext;           /*!< Next queued descriptor, managed by the driver      */
+
+}UART_TxDescTypeDef;
+
+/** 
+  * @brief  UART Tx queue counters definition  
   */  
 typedef struct
+{
+  uint32_t Bytes;                                 /*!< Number of bytes sent through the Tx queue          */
+
+  uint32_t Transfers;                             /*!< Number of descriptors completed                    */
+
+  uint32_t Pending;                               /*!< Number of descriptors queued or being sent         */
+
+  uint32_t MaxPending;                            /*!< Highest number of descriptors queued at once       */
+
+}UART_TxQueueStatsTypeDef;
+
+/** 
+  * @brief  UART handle Structure definition  
+  */  
+typedef struct __UART_HandleTypeDef
 {
   USART_TypeDef                 *Instance;        /*!< UART registers base address        */
   
@@ -140,6 +178,23 @@ typedef struct
   
   __IO uint32_t                 ErrorCode;        /*!< UART Error code                    */
 
+  __IO uint32_t                 RxHead;           /*!< UART Rx circular mode: number of bytes written by the DMA   */
+
+  __IO uint32_t                 RxTail;           /*!< UART Rx circular mode: number of bytes read by the user     */
+
+  uint16_t                      RxReadPos;        /*!< UART Rx circular mode: read offset in the Rx buffer         */
+
+  __IO uint32_t                 RxLostCount;      /*!< UART Rx circular mode: bytes dropped because the DMA wrapped
+                                                       over data that had not been read yet                        */
+
+  __IO uint32_t                 RxOreCount;       /*!< UART Rx circular mode: number of UART overrun errors        */
+
+  UART_TxDescTypeDef            *pTxQueueHead;    /*!< UART Tx queue: descriptor being sent                        */
+
+  UART_TxDescTypeDef            *pTxQueueTail;    /*!< UART Tx queue: last queued descriptor                       */
+
+  UART_TxQueueStatsTypeDef      TxQueueStats;     /*!< UART Tx queue: counters                                     */
+
 }UART_HandleTypeDef;
 /**
   * @}
@@ -597,15 +652,22 @@ HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, uint8_t *pData
 HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_TransmitQueue_DMA(UART_HandleTypeDef *huart, UART_TxDescTypeDef *pDesc);
 HAL_StatusTypeDef HAL_UART_DMAPause(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_DMAResume(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_ReceiveCircular_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+uint16_t HAL_UART_RxCircularAvailable(UART_HandleTypeDef *huart);
+uint16_t HAL_UART_RxCircularRead(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+uint16_t HAL_UART_RxCircularPeek(UART_HandleTypeDef *huart, uint8_t **ppData);
+void HAL_UART_RxCircularRelease(UART_HandleTypeDef *huart, uint16_t Size);
 void HAL_UART_IRQHandler(UART_HandleTypeDef *huart);
 void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
 void HAL_UART_TxHalfCpltCallback(UART_HandleTypeDef *huart);
 void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart);
 void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart);
 void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+void HAL_UART_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
 /**
   * @}
   */
@@ -629,6 +691,8 @@ HAL_StatusTypeDef HAL_HalfDuplex_EnableReceiver(UART_HandleTypeDef *huart);
 /* Peripheral State functions  **************************************************/
 HAL_UART_StateTypeDef HAL_UART_GetState(UART_HandleTypeDef *huart);
 uint32_t              HAL_UART_GetError(UART_HandleTypeDef *huart);
+uint32_t              HAL_UART_GetRxOverrun(UART_HandleTypeDef *huart);
+void                  HAL_UART_GetTxQueueStats(UART_HandleTypeDef *huart, UART_TxQueueStatsTypeDef *pStats);
 /**
   * @}
   */ 
@@ -643,6 +643,9 @@ HAL_StatusTypeDef HAL_CRYP_Init(CRYP_HandleTypeDef *hcryp)
   /* Set the default CRYP phase */
   hcryp->Phase = HAL_CRYP_PHASE_READY;
   
+  /* No context loaded in the CRYP peripheral */
+  hcryp->pContext = NULL;
+  
   /* Return function status */
   return HAL_OK;
 }
@@ -667,6 +670,9 @@ HAL_StatusTypeDef HAL_CRYP_DeInit(CRYP_HandleTypeDef *hcryp)
   /* Set the default CRYP phase */
   hcryp->Phase = HAL_CRYP_PHASE_READY;
   
+  /* No context loaded in the CRYP peripheral */
+  hcryp->pContext = NULL;
+  
   /* Reset CrypInCount and CrypOutCount */
   hcryp->CrypInCount = 0;
   hcryp->CrypOutCount = 0;
@@ -8,6 +8,7 @@
   *          This file provides firmware functions to manage the following 
   *          functionalities of CRYP extension peripheral:
   *           + Extended AES processing functions     
+  *           + Context processing functions
   *  
   @verbatim
   ==============================================================================
@@ -63,6 +64,17 @@
     @note: For CCM Encrypt/Decrypt API's, only DataType = 8-bit is supported by this version.
     @note: The HAL_CRYPEx_AESGCM_xxxx() implementation is limited to 32bits inputs data length 
            (Plain/Cyphertext, Header) compared with GCM standards specifications (800-38D).
+    (#)Several AES-CTR and AES-GCM messages can be in progress at the same time
+       with a CRYP_ContextTypeDef context each:
+        (##) Call HAL_CRYPEx_ContextInit() to start a message, then
+             HAL_CRYPEx_ContextHeader() to add the GCM header
+        (##) Call HAL_CRYPEx_ContextUpdate() or HAL_CRYPEx_ContextUpdate_DMA()
+             with any data length, then HAL_CRYPEx_ContextFinish() to get the
+             GCM authentication tag
+        (##) The key of the loaded context stays in the CRYP peripheral, the
+             state of a message is saved and restored on a change of context only
+        (##) Call HAL_CRYPEx_ContextRelease() before using the other processing
+             functions or HAL_CRYP_Init()
     (#)Call HAL_CRYP_DeInit() to deinitialize the CRYP peripheral.
 
   @endverbatim
@@ -118,12 +130,117 @@
   * @{
   */
 #define CRYPEx_TIMEOUT_VALUE  1
+#define CRYPEx_CONTEXT_ENGINE_NONE  ((uint32_t)0x00000000)  /* No data processed yet      */
+#define CRYPEx_CONTEXT_ENGINE_HW    ((uint32_t)0x00000001)  /* Processed by the CRYP peripheral */
+#define CRYPEx_CONTEXT_ENGINE_SW    ((uint32_t)0x00000002)  /* Processed by software      */
+#define CRYPEx_CONTEXT_TIMEOUT      10                      /* Context save/restore timeout (ms) */
+#define CRYPEx_CONTEXT_DMA_MAX_SIZE ((uint32_t)0x0003FFF0)  /* Largest DMA transfer in bytes, multiple of 16 */
+#define CRYPEx_CONTEXT_CR_MASK      (CRYP_CR_ALGODIR | CRYP_CR_ALGOMODE | CRYP_CR_DATATYPE | CRYP_CR_KEYSIZE | CRYP_CR_GCM_CCMPH)
 /**
   * @}
   */ 
   
 /* Private macro -------------------------------------------------------------*/
+/** @addtogroup CRYPEx_Private_Macros
+  * @{
+  */
+#define CRYPEx_IS_GCM(__CONTEXT__)   (((__CONTEXT__)->AlgoModeDirection & CRYP_CR_ALGOMODE) == CRYP_CR_ALGOMODE_AES_GCM_ENCRYPT)
+
+#define CRYPEx_GET_WORD(__PTR__)     ((uint32_t)(__PTR__)[0] | ((uint32_t)(__PTR__)[1] << 8) | \
+                                      ((uint32_t)(__PTR__)[2] << 16) | ((uint32_t)(__PTR__)[3] << 24))
+
+#define CRYPEx_GET_BE32(__PTR__)     (((uint32_t)(__PTR__)[0] << 24) | ((uint32_t)(__PTR__)[1] << 16) | \
+                                      ((uint32_t)(__PTR__)[2] << 8) | (uint32_t)(__PTR__)[3])
+
+#define CRYPEx_PUT_BE32(__PTR__, __VALUE__)  do{(__PTR__)[0] = (uint8_t)((__VALUE__) >> 24);\
+                                                (__PTR__)[1] = (uint8_t)((__VALUE__) >> 16);\
+                                                (__PTR__)[2] = (uint8_t)((__VALUE__) >> 8);\
+                                                (__PTR__)[3] = (uint8_t)(__VALUE__);}while(0)
+
+#define CRYPEx_ROTR(__VALUE__, __SHIFT__)    (((__VALUE__) >> (__SHIFT__)) | ((__VALUE__) << (32 - (__SHIFT__))))
+
+#define CRYPEx_SUB_ROW(__S0__, __S1__, __S2__, __S3__) (((uint32_t)CRYPEx_AES_SBox[(__S0__) >> 24] << 24) | \
+                                                     ((uint32_t)CRYPEx_AES_SBox[((__S1__) >> 16) & 0xFF] << 16) | \
+                                                     ((uint32_t)CRYPEx_AES_SBox[((__S2__) >> 8) & 0xFF] << 8) | \
+                                                     (uint32_t)CRYPEx_AES_SBox[(__S3__) & 0xFF])
+
+#define CRYPEx_SUB_WORD(__WORD__)    CRYPEx_SUB_ROW((__WORD__), (__WORD__), (__WORD__), (__WORD__))
+/**
+  * @}
+  */
+
 /* Private variables ---------------------------------------------------------*/
+/** @addtogroup CRYPEx_Private_Variables
+  * @{
+  */
+/* AES S-box */
+static const uint8_t CRYPEx_AES_SBox[256] =
+{
+  0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+  0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+  0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+  0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+  0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+  0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+  0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+  0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+  0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+  0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+  0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+  0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+  0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+  0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+  0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+  0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16
+};
+
+/* AES round table: MixColumns of the S-box output, the other columns are rotations */
+static const uint32_t CRYPEx_AES_Te0[256] =
+{
+  0xC66363A5, 0xF87C7C84, 0xEE777799, 0xF67B7B8D, 0xFFF2F20D, 0xD66B6BBD, 0xDE6F6FB1, 0x91C5C554,
+  0x60303050, 0x02010103, 0xCE6767A9, 0x562B2B7D, 0xE7FEFE19, 0xB5D7D762, 0x4DABABE6, 0xEC76769A,
+  0x8FCACA45, 0x1F82829D, 0x89C9C940, 0xFA7D7D87, 0xEFFAFA15, 0xB25959EB, 0x8E4747C9, 0xFBF0F00B,
+  0x41ADADEC, 0xB3D4D467, 0x5FA2A2FD, 0x45AFAFEA, 0x239C9CBF, 0x53A4A4F7, 0xE4727296, 0x9BC0C05B,
+  0x75B7B7C2, 0xE1FDFD1C, 0x3D9393AE, 0x4C26266A, 0x6C36365A, 0x7E3F3F41, 0xF5F7F702, 0x83CCCC4F,
+  0x6834345C, 0x51A5A5F4, 0xD1E5E534, 0xF9F1F108, 0xE2717193, 0xABD8D873, 0x62313153, 0x2A15153F,
+  0x0804040C, 0x95C7C752, 0x46232365, 0x9DC3C35E, 0x30181828, 0x379696A1, 0x0A05050F, 0x2F9A9AB5,
+  0x0E070709, 0x24121236, 0x1B80809B, 0xDFE2E23D, 0xCDEBEB26, 0x4E272769, 0x7FB2B2CD, 0xEA75759F,
+  0x1209091B, 0x1D83839E, 0x582C2C74, 0x341A1A2E, 0x361B1B2D, 0xDC6E6EB2, 0xB45A5AEE, 0x5BA0A0FB,
+  0xA45252F6, 0x763B3B4D, 0xB7D6D661, 0x7DB3B3CE, 0x5229297B, 0xDDE3E33E, 0x5E2F2F71, 0x13848497,
+  0xA65353F5, 0xB9D1D168, 0x00000000, 0xC1EDED2C, 0x40202060, 0xE3FCFC1F, 0x79B1B1C8, 0xB65B5BED,
+  0xD46A6ABE, 0x8DCBCB46, 0x67BEBED9, 0x7239394B, 0x944A4ADE, 0x984C4CD4, 0xB05858E8, 0x85CFCF4A,
+  0xBBD0D06B, 0xC5EFEF2A, 0x4FAAAAE5, 0xEDFBFB16, 0x864343C5, 0x9A4D4DD7, 0x66333355, 0x11858594,
+  0x8A4545CF, 0xE9F9F910, 0x04020206, 0xFE7F7F81, 0xA05050F0, 0x783C3C44, 0x259F9FBA, 0x4BA8A8E3,
+  0xA25151F3, 0x5DA3A3FE, 0x804040C0, 0x058F8F8A, 0x3F9292AD, 0x219D9DBC, 0x70383848, 0xF1F5F504,
+  0x63BCBCDF, 0x77B6B6C1, 0xAFDADA75, 0x42212163, 0x20101030, 0xE5FFFF1A, 0xFDF3F30E, 0xBFD2D26D,
+  0x81CDCD4C, 0x180C0C14, 0x26131335, 0xC3ECEC2F, 0xBE5F5FE1, 0x359797A2, 0x884444CC, 0x2E171739,
+  0x93C4C457, 0x55A7A7F2, 0xFC7E7E82, 0x7A3D3D47, 0xC86464AC, 0xBA5D5DE7, 0x3219192B, 0xE6737395,
+  0xC06060A0, 0x19818198, 0x9E4F4FD1, 0xA3DCDC7F, 0x44222266, 0x542A2A7E, 0x3B9090AB, 0x0B888883,
+  0x8C4646CA, 0xC7EEEE29, 0x6BB8B8D3, 0x2814143C, 0xA7DEDE79, 0xBC5E5EE2, 0x160B0B1D, 0xADDBDB76,
+  0xDBE0E03B, 0x64323256, 0x743A3A4E, 0x140A0A1E, 0x924949DB, 0x0C06060A, 0x4824246C, 0xB85C5CE4,
+  0x9FC2C25D, 0xBDD3D36E, 0x43ACACEF, 0xC46262A6, 0x399191A8, 0x319595A4, 0xD3E4E437, 0xF279798B,
+  0xD5E7E732, 0x8BC8C843, 0x6E373759, 0xDA6D6DB7, 0x018D8D8C, 0xB1D5D564, 0x9C4E4ED2, 0x49A9A9E0,
+  0xD86C6CB4, 0xAC5656FA, 0xF3F4F407, 0xCFEAEA25, 0xCA6565AF, 0xF47A7A8E, 0x47AEAEE9, 0x10080818,
+  0x6FBABAD5, 0xF0787888, 0x4A25256F, 0x5C2E2E72, 0x381C1C24, 0x57A6A6F1, 0x73B4B4C7, 0x97C6C651,
+  0xCBE8E823, 0xA1DDDD7C, 0xE874749C, 0x3E1F1F21, 0x964B4BDD, 0x61BDBDDC, 0x0D8B8B86, 0x0F8A8A85,
+  0xE0707090, 0x7C3E3E42, 0x71B5B5C4, 0xCC6666AA, 0x904848D8, 0x06030305, 0xF7F6F601, 0x1C0E0E12,
+  0xC26161A3, 0x6A35355F, 0xAE5757F9, 0x69B9B9D0, 0x17868691, 0x99C1C158, 0x3A1D1D27, 0x279E9EB9,
+  0xD9E1E138, 0xEBF8F813, 0x2B9898B3, 0x22111133, 0xD26969BB, 0xA9D9D970, 0x078E8E89, 0x339494A7,
+  0x2D9B9BB6, 0x3C1E1E22, 0x15878792, 0xC9E9E920, 0x87CECE49, 0xAA5555FF, 0x50282878, 0xA5DFDF7A,
+  0x038C8C8F, 0x59A1A1F8, 0x09898980, 0x1A0D0D17, 0x65BFBFDA, 0xD7E6E631, 0x844242C6, 0xD06868B8,
+  0x824141C3, 0x299999B0, 0x5A2D2D77, 0x1E0F0F11, 0x7BB0B0CB, 0xA85454FC, 0x6DBBBBD6, 0x2C16163A
+};
+
+/* GHASH reduction of the 4 bits shifted out */
+static const uint16_t CRYPEx_GHASH_Last4[16] =
+{
+  0x0000, 0x1C20, 0x3840, 0x2460, 0x7080, 0x6CA0, 0x48C0, 0x54E0,
+  0xE100, 0xFD20, 0xD940, 0xC560, 0x9180, 0x8DA0, 0xA9C0, 0xB5E0
+};
+/**
+  * @}
+  */
+
 /* Private function prototypes -----------------------------------------------*/
 /** @defgroup CRYPEx_Private_Functions_prototypes  CRYP Private Functions Prototypes
   * @{
@@ -136,6 +253,32 @@ static void CRYPEx_GCMCCM_DMAInCplt(DMA_HandleTypeDef *hdma);
 static void CRYPEx_GCMCCM_DMAOutCplt(DMA_HandleTypeDef *hdma);
 static void CRYPEx_GCMCCM_DMAError(DMA_HandleTypeDef *hdma);
 static void CRYPEx_GCMCCM_SetDMAConfig(CRYP_HandleTypeDef *hcryp, uint32_t inputaddr, uint16_t Size, uint32_t outputaddr);
+static HAL_StatusTypeDef CRYPEx_WaitStatus(__IO uint32_t *pRegister, uint32_t Mask, uint32_t Value, uint32_t Timeout);
+static void CRYPEx_Copy(uint8_t *pDst, uint8_t *pSrc, uint32_t Size);
+static void CRYPEx_Zero(uint8_t *pDst, uint32_t Size);
+static void CRYPEx_WriteBlock(CRYP_HandleTypeDef *hcryp, uint8_t *pBlock);
+static void CRYPEx_ReadBlock(CRYP_HandleTypeDef *hcryp, uint8_t *pBlock);
+static HAL_StatusTypeDef CRYPEx_ProcessBlocks(CRYP_HandleTypeDef *hcryp, uint8_t *pInBuffer, uint8_t *pOutBuffer, uint32_t NbBlocks, uint32_t Timeout);
+static HAL_StatusTypeDef CRYPEx_WriteHeader(CRYP_HandleTypeDef *hcryp, uint8_t *pBlock, uint32_t Timeout);
+static HAL_StatusTypeDef CRYPEx_ContextSave(CRYP_HandleTypeDef *hcryp, uint32_t Timeout);
+static HAL_StatusTypeDef CRYPEx_ContextLoad(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext);
+static HAL_StatusTypeDef CRYPEx_ContextPayloadPhase(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint32_t Timeout);
+static HAL_StatusTypeDef CRYPEx_ProcessPartial(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint8_t *pOutBlock, uint32_t Timeout);
+static HAL_StatusTypeDef CRYPEx_ContextProcess(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size, uint8_t *pOutBuffer, uint32_t Timeout);
+static HAL_StatusTypeDef CRYPEx_ContextLastBlock(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint32_t Timeout);
+static uint32_t CRYPEx_ContextDMANext(CRYP_SegmentTypeDef **ppSegment, uint32_t *pOffset);
+static void CRYPEx_ContextDMAEnd(CRYP_HandleTypeDef *hcryp);
+static void CRYPEx_ContextDMAInCplt(DMA_HandleTypeDef *hdma);
+static void CRYPEx_ContextDMAOutCplt(DMA_HandleTypeDef *hdma);
+static void CRYPEx_ContextDMAError(DMA_HandleTypeDef *hdma);
+static void CRYPEx_SwEncrypt(CRYP_ContextTypeDef *pContext, uint32_t *pIn, uint8_t *pOutBlock);
+static void CRYPEx_SwGhashMultiply(CRYP_ContextTypeDef *pContext);
+static void CRYPEx_SwGhash(CRYP_ContextTypeDef *pContext, uint8_t *pBlock);
+static void CRYPEx_SwStart(CRYP_ContextTypeDef *pContext);
+static void CRYPEx_SwHeader(CRYP_ContextTypeDef *pContext, uint8_t *pHeader, uint32_t Size);
+static void CRYPEx_SwPayloadPhase(CRYP_ContextTypeDef *pContext);
+static void CRYPEx_SwUpdate(CRYP_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size, uint8_t *pOutBuffer);
+static void CRYPEx_SwFinal(CRYP_ContextTypeDef *pContext, uint8_t *pAuthTag);
 /**
   * @}
   */ 
@@ -459,6 +602,966 @@ static void CRYPEx_GCMCCM_SetDMAConfig(CRYP_HandleTypeDef *hcryp, uint32_t input
   hcryp->Instance->DMACR |= CRYP_DMACR_DOEN;
 }
 
+/**
+  * @brief  Waits until the masked bits of a register reach a value.
+  * @param  pRegister: Pointer to the register
+  * @param  Mask: Bits to check
+  * @param  Value: Expected value of the bits
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYPEx_WaitStatus(__IO uint32_t *pRegister, uint32_t Mask, uint32_t Value, uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while((*pRegister & Mask) != Value)
+  {
+    if(Timeout != HAL_MAX_DELAY)
+    {
+      if((Timeout == 0)||((HAL_GetTick() - tickstart ) > Timeout))
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copies bytes.
+  * @param  pDst: Pointer to the destination
+  * @param  pSrc: Pointer to the source
+  * @param  Size: Number of bytes
+  * @retval None
+  */
+static void CRYPEx_Copy(uint8_t *pDst, uint8_t *pSrc, uint32_t Size)
+{
+  while(Size-- != 0)
+  {
+    *pDst++ = *pSrc++;
+  }
+}
+
+/**
+  * @brief  Clears bytes.
+  * @param  pDst: Pointer to the destination
+  * @param  Size: Number of bytes
+  * @retval None
+  */
+static void CRYPEx_Zero(uint8_t *pDst, uint32_t Size)
+{
+  while(Size-- != 0)
+  {
+    *pDst++ = 0;
+  }
+}
+
+/**
+  * @brief  Writes a block in the IN FIFO.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pBlock: Pointer to the 16 bytes block, no alignment required
+  * @retval None
+  */
+static void CRYPEx_WriteBlock(CRYP_HandleTypeDef *hcryp, uint8_t *pBlock)
+{
+  uint32_t *pwords = (uint32_t *)pBlock;
+
+  if(((uint32_t)pBlock & 3) == 0)
+  {
+    hcryp->Instance->DR = pwords[0];
+    hcryp->Instance->DR = pwords[1];
+    hcryp->Instance->DR = pwords[2];
+    hcryp->Instance->DR = pwords[3];
+  }
+  else
+  {
+    hcryp->Instance->DR = CRYPEx_GET_WORD(pBlock);
+    hcryp->Instance->DR = CRYPEx_GET_WORD(pBlock + 4);
+    hcryp->Instance->DR = CRYPEx_GET_WORD(pBlock + 8);
+    hcryp->Instance->DR = CRYPEx_GET_WORD(pBlock + 12);
+  }
+}
+
+/**
+  * @brief  Reads a block from the OUT FIFO.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pBlock: Pointer to the 16 bytes block, no alignment required
+  * @retval None
+  */
+static void CRYPEx_ReadBlock(CRYP_HandleTypeDef *hcryp, uint8_t *pBlock)
+{
+  uint32_t *pwords = (uint32_t *)pBlock;
+  uint32_t index = 0, word = 0;
+
+  if(((uint32_t)pBlock & 3) == 0)
+  {
+    pwords[0] = hcryp->Instance->DOUT;
+    pwords[1] = hcryp->Instance->DOUT;
+    pwords[2] = hcryp->Instance->DOUT;
+    pwords[3] = hcryp->Instance->DOUT;
+  }
+  else
+  {
+    for(index = 0; index < 16; index += 4)
+    {
+      word = hcryp->Instance->DOUT;
+      pBlock[index]     = (uint8_t)word;
+      pBlock[index + 1] = (uint8_t)(word >> 8);
+      pBlock[index + 2] = (uint8_t)(word >> 16);
+      pBlock[index + 3] = (uint8_t)(word >> 24);
+    }
+  }
+}
+
+/**
+  * @brief  Processes whole blocks in polling mode. The IN FIFO is kept one
+  *         block ahead of the block read from the OUT FIFO.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pInBuffer: Pointer to the input blocks
+  * @param  pOutBuffer: Pointer to the output blocks, may be equal to pInBuffer
+  * @param  NbBlocks: Number of blocks
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYPEx_ProcessBlocks(CRYP_HandleTypeDef *hcryp, uint8_t *pInBuffer, uint8_t *pOutBuffer, uint32_t NbBlocks, uint32_t Timeout)
+{
+  if(NbBlocks == 0)
+  {
+    return HAL_OK;
+  }
+
+  CRYPEx_WriteBlock(hcryp, pInBuffer);
+  pInBuffer += 16;
+
+  while(NbBlocks-- != 0)
+  {
+    if(NbBlocks != 0)
+    {
+      CRYPEx_WriteBlock(hcryp, pInBuffer);
+      pInBuffer += 16;
+    }
+
+    if(CRYPEx_WaitStatus(&hcryp->Instance->SR, CRYP_FLAG_OFNE, CRYP_FLAG_OFNE, Timeout) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+
+    CRYPEx_ReadBlock(hcryp, pOutBuffer);
+    pOutBuffer += 16;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Writes a header block, once the IN FIFO is empty.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pBlock: Pointer to the 16 bytes block
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYPEx_WriteHeader(CRYP_HandleTypeDef *hcryp, uint8_t *pBlock, uint32_t Timeout)
+{
+  if(CRYPEx_WaitStatus(&hcryp->Instance->SR, CRYP_FLAG_IFEM, CRYP_FLAG_IFEM, Timeout) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  CRYPEx_WriteBlock(hcryp, pBlock);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Saves the context loaded in the CRYP peripheral, once the current
+  *         block is processed, and disables the peripheral.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYPEx_ContextSave(CRYP_HandleTypeDef *hcryp, uint32_t Timeout)
+{
+  CRYP_ContextTypeDef *pcontext = hcryp->pContext;
+  uint32_t index = 0;
+
+  if(pcontext == NULL)
+  {
+    return HAL_OK;
+  }
+
+  /* Both FIFOs empty and no block in progress */
+  if(CRYPEx_WaitStatus(&hcryp->Instance->SR, CRYP_FLAG_IFEM | CRYP_FLAG_OFNE | CRYP_FLAG_BUSY, CRYP_FLAG_IFEM, Timeout) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  __HAL_CRYP_DISABLE(hcryp);
+
+  pcontext->Cr = hcryp->Instance->CR & CRYPEx_CONTEXT_CR_MASK;
+  pcontext->Iv[0] = hcryp->Instance->IV0LR;
+  pcontext->Iv[1] = hcryp->Instance->IV0RR;
+  pcontext->Iv[2] = hcryp->Instance->IV1LR;
+  pcontext->Iv[3] = hcryp->Instance->IV1RR;
+
+  if(CRYPEx_IS_GCM(pcontext))
+  {
+    for(index = 0; index < 8; index++)
+    {
+      pcontext->Csgcmccm[index] = (&hcryp->Instance->CSGCMCCM0R)[index];
+      pcontext->Csgcm[index] = (&hcryp->Instance->CSGCM0R)[index];
+    }
+  }
+
+  hcryp->pContext = NULL;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Loads a context in the CRYP peripheral. The context already loaded,
+  *         if any, is saved. A context without data processed yet starts
+  *         a new message.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pContext: Pointer to the context
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYPEx_ContextLoad(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext)
+{
+  uint32_t index = 0;
+
+  if(hcryp->pContext == pContext)
+  {
+    if(pContext->Engine == CRYPEx_CONTEXT_ENGINE_HW)
+    {
+      return HAL_OK;
+    }
+
+    /* Context initialized again: the loaded state is dropped */
+    hcryp->pContext = NULL;
+  }
+
+  if(CRYPEx_ContextSave(hcryp, CRYPEx_CONTEXT_TIMEOUT) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* The other processing functions have to initialize the peripheral again */
+  hcryp->Phase = HAL_CRYP_PHASE_READY;
+  hcryp->Instance->DMACR = 0;
+  __HAL_CRYP_DISABLE(hcryp);
+
+  if(pContext->Engine == CRYPEx_CONTEXT_ENGINE_HW)
+  {
+    /* Restore the configuration, the key, the counter and the GCM context */
+    hcryp->Instance->CR = pContext->Cr;
+    CRYPEx_GCMCCM_SetKey(hcryp, pContext->pKey, pContext->KeySize);
+    hcryp->Instance->IV0LR = pContext->Iv[0];
+    hcryp->Instance->IV0RR = pContext->Iv[1];
+    hcryp->Instance->IV1LR = pContext->Iv[2];
+    hcryp->Instance->IV1RR = pContext->Iv[3];
+
+    if(CRYPEx_IS_GCM(pContext))
+    {
+      for(index = 0; index < 8; index++)
+      {
+        (&hcryp->Instance->CSGCMCCM0R)[index] = pContext->Csgcmccm[index];
+        (&hcryp->Instance->CSGCM0R)[index] = pContext->Csgcm[index];
+      }
+    }
+
+    __HAL_CRYP_FIFO_FLUSH(hcryp);
+    __HAL_CRYP_ENABLE(hcryp);
+  }
+  else
+  {
+    hcryp->Instance->CR = pContext->AlgoModeDirection | CRYP_DATATYPE_8B | pContext->KeySize;
+    CRYPEx_GCMCCM_SetKey(hcryp, pContext->pKey, pContext->KeySize);
+    hcryp->Instance->IV0LR = pContext->Iv[0];
+    hcryp->Instance->IV0RR = pContext->Iv[1];
+    hcryp->Instance->IV1LR = pContext->Iv[2];
+    hcryp->Instance->IV1RR = pContext->Iv[3];
+    __HAL_CRYP_FIFO_FLUSH(hcryp);
+    __HAL_CRYP_ENABLE(hcryp);
+
+    if(CRYPEx_IS_GCM(pContext))
+    {
+      /* The init phase computes the hash subkey then clears CRYPEN */
+      if(CRYPEx_WaitStatus(&hcryp->Instance->CR, CRYP_CR_CRYPEN, 0, CRYPEx_CONTEXT_TIMEOUT) != HAL_OK)
+      {
+        return HAL_TIMEOUT;
+      }
+      __HAL_CRYP_SET_PHASE(hcryp, CRYP_PHASE_HEADER);
+      __HAL_CRYP_ENABLE(hcryp);
+    }
+
+    pContext->Engine = CRYPEx_CONTEXT_ENGINE_HW;
+  }
+
+  hcryp->pContext = pContext;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Ends the GCM header phase of the loaded context: the incomplete
+  *         header block is completed with zeros, then the payload phase starts.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pContext: Pointer to the context
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYPEx_ContextPayloadPhase(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint32_t Timeout)
+{
+  if(pContext->NbBuffer != 0)
+  {
+    CRYPEx_Zero(&pContext->Buffer[pContext->NbBuffer], 16 - pContext->NbBuffer);
+    if(CRYPEx_WriteHeader(hcryp, pContext->Buffer, Timeout) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+    pContext->NbBuffer = 0;
+  }
+
+  if(CRYPEx_WaitStatus(&hcryp->Instance->SR, CRYP_FLAG_IFEM | CRYP_FLAG_BUSY, CRYP_FLAG_IFEM, Timeout) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  __HAL_CRYP_DISABLE(hcryp);
+  __HAL_CRYP_SET_PHASE(hcryp, CRYP_PHASE_PAYLOAD);
+  __HAL_CRYP_ENABLE(hcryp);
+
+  pContext->Phase = CRYP_PHASE_PAYLOAD;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Processes the incomplete block of the loaded context, completed
+  *         with zeros, then comes back to the state preceding the block, so
+  *         that the block is processed again once complete.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pContext: Pointer to the context
+  * @param  pOutBlock: Pointer to the 16 bytes output block
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYPEx_ProcessPartial(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint8_t *pOutBlock, uint32_t Timeout)
+{
+  uint8_t block[16];
+
+  /* The saved context is the state preceding the block */
+  if((CRYPEx_ContextSave(hcryp, Timeout) != HAL_OK) || (CRYPEx_ContextLoad(hcryp, pContext) != HAL_OK))
+  {
+    return HAL_TIMEOUT;
+  }
+
+  CRYPEx_Copy(block, pContext->Buffer, pContext->NbBuffer);
+  CRYPEx_Zero(&block[pContext->NbBuffer], 16 - pContext->NbBuffer);
+
+  if(CRYPEx_ProcessBlocks(hcryp, block, pOutBlock, 1, Timeout) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* Drop the peripheral state: the saved one is restored by the next load */
+  __HAL_CRYP_DISABLE(hcryp);
+  hcryp->pContext = NULL;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Processes payload data of any length with the loaded context. The
+  *         output of an incomplete block is provided at once, its input is kept
+  *         in the context until the block is complete.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pContext: Pointer to the context
+  * @param  pInBuffer: Pointer to the input data
+  * @param  Size: Number of bytes
+  * @param  pOutBuffer: Pointer to the output data
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYPEx_ContextProcess(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size, uint8_t *pOutBuffer, uint32_t Timeout)
+{
+  uint8_t block[16];
+  uint32_t done = 0, nbbytes = 0;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Complete the block started by a previous update */
+  if(pContext->NbBuffer != 0)
+  {
+    done = pContext->NbBuffer;
+    nbbytes = 16 - done;
+    if(nbbytes > Size)
+    {
+      nbbytes = Size;
+    }
+    CRYPEx_Copy(&pContext->Buffer[done], pInBuffer, nbbytes);
+    pContext->NbBuffer += nbbytes;
+    pInBuffer += nbbytes;
+    Size -= nbbytes;
+
+    if(pContext->NbBuffer == 16)
+    {
+      status = CRYPEx_ProcessBlocks(hcryp, pContext->Buffer, block, 1, Timeout);
+      pContext->NbBuffer = 0;
+    }
+    else
+    {
+      status = CRYPEx_ProcessPartial(hcryp, pContext, block, Timeout);
+    }
+    CRYPEx_Copy(pOutBuffer, &block[done], nbbytes);
+    pOutBuffer += nbbytes;
+  }
+
+  if((status == HAL_OK) && (Size >= 16))
+  {
+    status = CRYPEx_ProcessBlocks(hcryp, pInBuffer, pOutBuffer, Size / 16, Timeout);
+    pInBuffer += Size & ~15U;
+    pOutBuffer += Size & ~15U;
+  }
+
+  if((status == HAL_OK) && ((Size & 15) != 0))
+  {
+    CRYPEx_Copy(pContext->Buffer, pInBuffer, Size & 15);
+    pContext->NbBuffer = Size & 15;
+    status = CRYPEx_ProcessPartial(hcryp, pContext, block, Timeout);
+    CRYPEx_Copy(pOutBuffer, block, Size & 15);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Processes the last incomplete GCM payload block of the loaded
+  *         context. The cyphertext completed with zeros is authenticated: in
+  *         encryption, the block is encrypted, then the context is restored in
+  *         decryption direction to authenticate the cyphertext.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pContext: Pointer to the context
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYPEx_ContextLastBlock(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint32_t Timeout)
+{
+  uint8_t block[16];
+  uint8_t output[16];
+
+  if((pContext->AlgoModeDirection & CRYP_CR_ALGODIR) != 0)
+  {
+    CRYPEx_Copy(block, pContext->Buffer, pContext->NbBuffer);
+    CRYPEx_Zero(&block[pContext->NbBuffer], 16 - pContext->NbBuffer);
+  }
+  else
+  {
+    if(CRYPEx_ProcessPartial(hcryp, pContext, block, Timeout) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+    CRYPEx_Zero(&block[pContext->NbBuffer], 16 - pContext->NbBuffer);
+
+    pContext->Cr |= CRYP_CR_ALGODIR;
+    if(CRYPEx_ContextLoad(hcryp, pContext) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  pContext->NbBuffer = 0;
+
+  return CRYPEx_ProcessBlocks(hcryp, block, output, 1, Timeout);
+}
+
+/**
+  * @brief  Provides the size of the next DMA transfer of a segment list, and
+  *         moves to the next segment once a segment is transferred. The list
+  *         stays on its last segment.
+  * @param  ppSegment: Pointer to the current segment
+  * @param  pOffset: Pointer to the bytes of the current segment already transferred
+  * @retval Number of bytes, 0 when the whole blocks of the list are transferred
+  */
+static uint32_t CRYPEx_ContextDMANext(CRYP_SegmentTypeDef **ppSegment, uint32_t *pOffset)
+{
+  uint32_t size = 0;
+
+  while(1)
+  {
+    size = ((*ppSegment)->Size & ~15U) - *pOffset;
+    if(size != 0)
+    {
+      return (size > CRYPEx_CONTEXT_DMA_MAX_SIZE) ? CRYPEx_CONTEXT_DMA_MAX_SIZE : size;
+    }
+    if((*ppSegment)->pNext == NULL)
+    {
+      return 0;
+    }
+    *ppSegment = (*ppSegment)->pNext;
+    *pOffset = 0;
+  }
+}
+
+/**
+  * @brief  Ends a DMA context update: the incomplete last block, if any, is
+  *         processed by the CPU.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @retval None
+  */
+static void CRYPEx_ContextDMAEnd(CRYP_HandleTypeDef *hcryp)
+{
+  CRYP_ContextTypeDef *pcontext = hcryp->pContext;
+  CRYP_SegmentTypeDef *psegment = pcontext->pOutSegment;
+  uint32_t offset = psegment->Size & ~15U;
+
+  hcryp->Instance->DMACR = 0;
+
+  /* A late input transfer complete interrupt is ignored */
+  hcryp->hdmain->XferCpltCallback = NULL;
+
+  if(CRYPEx_ContextProcess(hcryp, pcontext, psegment->pInBuffer + offset, psegment->Size & 15,
+                           psegment->pOutBuffer + offset, CRYPEx_CONTEXT_TIMEOUT) != HAL_OK)
+  {
+    hcryp->pContext = NULL;
+    pcontext->Phase = CRYP_PHASE_FINAL;
+    hcryp->State = HAL_CRYP_STATE_TIMEOUT;
+    __HAL_UNLOCK(hcryp);
+    HAL_CRYP_ErrorCallback(hcryp);
+    return;
+  }
+
+  /* Change the CRYP peripheral state */
+  hcryp->State = HAL_CRYP_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hcryp);
+
+  /* Call output data transfer complete callback */
+  HAL_CRYP_OutCpltCallback(hcryp);
+}
+
+/**
+  * @brief  DMA context update input transfer complete callback: the next input
+  *         transfer is started.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void CRYPEx_ContextDMAInCplt(DMA_HandleTypeDef *hdma)
+{
+  CRYP_HandleTypeDef* hcryp = ( CRYP_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+  CRYP_ContextTypeDef *pcontext = hcryp->pContext;
+  uint32_t size = 0;
+
+  pcontext->InOffset += CRYPEx_ContextDMANext(&pcontext->pInSegment, &pcontext->InOffset);
+  size = CRYPEx_ContextDMANext(&pcontext->pInSegment, &pcontext->InOffset);
+
+  if(size != 0)
+  {
+    HAL_DMA_Start_IT(hcryp->hdmain, (uint32_t)(pcontext->pInSegment->pInBuffer + pcontext->InOffset),
+                     (uint32_t)&hcryp->Instance->DR, size / 4);
+  }
+  else
+  {
+    hcryp->Instance->DMACR &= (uint32_t)(~CRYP_DMACR_DIEN);
+  }
+}
+
+/**
+  * @brief  DMA context update output transfer complete callback: the next
+  *         output transfer is started, or the update ends.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void CRYPEx_ContextDMAOutCplt(DMA_HandleTypeDef *hdma)
+{
+  CRYP_HandleTypeDef* hcryp = ( CRYP_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+  CRYP_ContextTypeDef *pcontext = hcryp->pContext;
+  uint32_t size = 0;
+
+  pcontext->OutOffset += CRYPEx_ContextDMANext(&pcontext->pOutSegment, &pcontext->OutOffset);
+  size = CRYPEx_ContextDMANext(&pcontext->pOutSegment, &pcontext->OutOffset);
+
+  if(size != 0)
+  {
+    HAL_DMA_Start_IT(hcryp->hdmaout, (uint32_t)&hcryp->Instance->DOUT,
+                     (uint32_t)(pcontext->pOutSegment->pOutBuffer + pcontext->OutOffset), size / 4);
+  }
+  else
+  {
+    CRYPEx_ContextDMAEnd(hcryp);
+  }
+}
+
+/**
+  * @brief  DMA context update error callback.
+  * @note   A FIFO error does not stop the transfer and is ignored. Otherwise
+  *         the loaded context is lost and its message must be started again.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void CRYPEx_ContextDMAError(DMA_HandleTypeDef *hdma)
+{
+  CRYP_HandleTypeDef* hcryp = ( CRYP_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  if((hdma->Instance->CR & DMA_SxCR_EN) != 0)
+  {
+    return;
+  }
+
+  hcryp->Instance->DMACR = 0;
+  __HAL_CRYP_DISABLE(hcryp);
+
+  if(hcryp->pContext != NULL)
+  {
+    hcryp->pContext->Phase = CRYP_PHASE_FINAL;
+    hcryp->pContext = NULL;
+  }
+  hcryp->State = HAL_CRYP_STATE_ERROR;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hcryp);
+
+  HAL_CRYP_ErrorCallback(hcryp);
+}
+
+/**
+  * @brief  Encrypts a block by software.
+  * @param  pContext: Pointer to the context
+  * @param  pIn: Input block, as four big endian words
+  * @param  pOutBlock: Pointer to the 16 bytes output block
+  * @retval None
+  */
+static void CRYPEx_SwEncrypt(CRYP_ContextTypeDef *pContext, uint32_t *pIn, uint8_t *pOutBlock)
+{
+  uint32_t *prk = pContext->RoundKey;
+  uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
+  uint32_t round = 0;
+
+  s0 = pIn[0] ^ prk[0];
+  s1 = pIn[1] ^ prk[1];
+  s2 = pIn[2] ^ prk[2];
+  s3 = pIn[3] ^ prk[3];
+
+  for(round = 1; round < pContext->Rounds; round++)
+  {
+    prk += 4;
+    t0 = CRYPEx_AES_Te0[s0 >> 24] ^ CRYPEx_ROTR(CRYPEx_AES_Te0[(s1 >> 16) & 0xFF], 8) ^
+         CRYPEx_ROTR(CRYPEx_AES_Te0[(s2 >> 8) & 0xFF], 16) ^ CRYPEx_ROTR(CRYPEx_AES_Te0[s3 & 0xFF], 24) ^ prk[0];
+    t1 = CRYPEx_AES_Te0[s1 >> 24] ^ CRYPEx_ROTR(CRYPEx_AES_Te0[(s2 >> 16) & 0xFF], 8) ^
+         CRYPEx_ROTR(CRYPEx_AES_Te0[(s3 >> 8) & 0xFF], 16) ^ CRYPEx_ROTR(CRYPEx_AES_Te0[s0 & 0xFF], 24) ^ prk[1];
+    t2 = CRYPEx_AES_Te0[s2 >> 24] ^ CRYPEx_ROTR(CRYPEx_AES_Te0[(s3 >> 16) & 0xFF], 8) ^
+         CRYPEx_ROTR(CRYPEx_AES_Te0[(s0 >> 8) & 0xFF], 16) ^ CRYPEx_ROTR(CRYPEx_AES_Te0[s1 & 0xFF], 24) ^ prk[2];
+    t3 = CRYPEx_AES_Te0[s3 >> 24] ^ CRYPEx_ROTR(CRYPEx_AES_Te0[(s0 >> 16) & 0xFF], 8) ^
+         CRYPEx_ROTR(CRYPEx_AES_Te0[(s1 >> 8) & 0xFF], 16) ^ CRYPEx_ROTR(CRYPEx_AES_Te0[s2 & 0xFF], 24) ^ prk[3];
+    s0 = t0;
+    s1 = t1;
+    s2 = t2;
+    s3 = t3;
+  }
+
+  /* Last round, without MixColumns */
+  prk += 4;
+  t0 = CRYPEx_SUB_ROW(s0, s1, s2, s3) ^ prk[0];
+  t1 = CRYPEx_SUB_ROW(s1, s2, s3, s0) ^ prk[1];
+  t2 = CRYPEx_SUB_ROW(s2, s3, s0, s1) ^ prk[2];
+  t3 = CRYPEx_SUB_ROW(s3, s0, s1, s2) ^ prk[3];
+
+  CRYPEx_PUT_BE32(pOutBlock, t0);
+  CRYPEx_PUT_BE32(pOutBlock + 4, t1);
+  CRYPEx_PUT_BE32(pOutBlock + 8, t2);
+  CRYPEx_PUT_BE32(pOutBlock + 12, t3);
+}
+
+/**
+  * @brief  Multiplies the GHASH accumulator by the hash subkey, 4 bits at a time.
+  * @param  pContext: Pointer to the context
+  * @retval None
+  */
+static void CRYPEx_SwGhashMultiply(CRYP_ContextTypeDef *pContext)
+{
+  uint64_t zh = 0, zl = 0;
+  uint32_t index = 0, rem = 0, nibble = 0;
+  int32_t byte = 0;
+
+  for(byte = 15; byte >= 0; byte--)
+  {
+    for(index = 0; index < 2; index++)
+    {
+      nibble = (index == 0) ? (pContext->Ghash[byte] & 0x0F) : (pContext->Ghash[byte] >> 4);
+      if((byte != 15) || (index != 0))
+      {
+        rem = (uint32_t)zl & 0x0F;
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4) ^ ((uint64_t)CRYPEx_GHASH_Last4[rem] << 48);
+      }
+      zh ^= pContext->HashTableH[nibble];
+      zl ^= pContext->HashTableL[nibble];
+    }
+  }
+
+  CRYPEx_PUT_BE32(pContext->Ghash, (uint32_t)(zh >> 32));
+  CRYPEx_PUT_BE32(pContext->Ghash + 4, (uint32_t)zh);
+  CRYPEx_PUT_BE32(pContext->Ghash + 8, (uint32_t)(zl >> 32));
+  CRYPEx_PUT_BE32(pContext->Ghash + 12, (uint32_t)zl);
+}
+
+/**
+  * @brief  Adds a block to the GHASH of a software context.
+  * @param  pContext: Pointer to the context
+  * @param  pBlock: Pointer to the 16 bytes block
+  * @retval None
+  */
+static void CRYPEx_SwGhash(CRYP_ContextTypeDef *pContext, uint8_t *pBlock)
+{
+  uint32_t index = 0;
+
+  for(index = 0; index < 16; index++)
+  {
+    pContext->Ghash[index] ^= pBlock[index];
+  }
+  CRYPEx_SwGhashMultiply(pContext);
+}
+
+/**
+  * @brief  Starts a software computation: key schedule and, for GCM, hash
+  *         subkey tables and encrypted initial counter block.
+  * @param  pContext: Pointer to the context
+  * @retval None
+  */
+static void CRYPEx_SwStart(CRYP_ContextTypeDef *pContext)
+{
+  uint32_t *prk = pContext->RoundKey;
+  uint32_t nk = 0, index = 0, temp = 0, rcon = 0x01;
+  uint32_t block[4] = {0, 0, 0, 0};
+  uint64_t vh = 0, vl = 0;
+  uint8_t h[16];
+
+  /* Key schedule */
+  nk = (pContext->KeySize == CRYP_KEYSIZE_256B) ? 8 : ((pContext->KeySize == CRYP_KEYSIZE_192B) ? 6 : 4);
+  pContext->Rounds = nk + 6;
+  for(index = 0; index < nk; index++)
+  {
+    prk[index] = CRYPEx_GET_BE32(pContext->pKey + (4 * index));
+  }
+  for(index = nk; index < (4 * (pContext->Rounds + 1)); index++)
+  {
+    temp = prk[index - 1];
+    if((index % nk) == 0)
+    {
+      temp = CRYPEx_SUB_WORD((temp << 8) | (temp >> 24)) ^ (rcon << 24);
+      rcon = (rcon << 1) ^ (((rcon & 0x80) != 0) ? 0x1B : 0x00);
+    }
+    else if((nk == 8) && ((index % nk) == 4))
+    {
+      temp = CRYPEx_SUB_WORD(temp);
+    }
+    prk[index] = prk[index - nk] ^ temp;
+  }
+
+  if(CRYPEx_IS_GCM(pContext))
+  {
+    /* Hash subkey H = E(K, 0) and its multiples by the 4-bit values */
+    CRYPEx_SwEncrypt(pContext, block, h);
+    vh = ((uint64_t)CRYPEx_GET_BE32(h) << 32) | CRYPEx_GET_BE32(h + 4);
+    vl = ((uint64_t)CRYPEx_GET_BE32(h + 8) << 32) | CRYPEx_GET_BE32(h + 12);
+    pContext->HashTableH[0] = 0;
+    pContext->HashTableL[0] = 0;
+    pContext->HashTableH[8] = vh;
+    pContext->HashTableL[8] = vl;
+    for(index = 4; index > 0; index >>= 1)
+    {
+      temp = (uint32_t)(vl & 1) * 0xE1000000;
+      vl = (vh << 63) | (vl >> 1);
+      vh = (vh >> 1) ^ ((uint64_t)temp << 32);
+      pContext->HashTableH[index] = vh;
+      pContext->HashTableL[index] = vl;
+    }
+    for(index = 2; index <= 8; index *= 2)
+    {
+      for(temp = 1; temp < index; temp++)
+      {
+        pContext->HashTableH[index + temp] = pContext->HashTableH[index] ^ pContext->HashTableH[temp];
+        pContext->HashTableL[index + temp] = pContext->HashTableL[index] ^ pContext->HashTableL[temp];
+      }
+    }
+
+    /* Encrypted initial counter block J0, the counter of the first payload block being 2 */
+    block[0] = pContext->Iv[0];
+    block[1] = pContext->Iv[1];
+    block[2] = pContext->Iv[2];
+    block[3] = 1;
+    CRYPEx_SwEncrypt(pContext, block, pContext->TagMask);
+    CRYPEx_Zero(pContext->Ghash, 16);
+  }
+
+  pContext->Engine = CRYPEx_CONTEXT_ENGINE_SW;
+}
+
+/**
+  * @brief  Adds header data to a software GCM context.
+  * @param  pContext: Pointer to the context
+  * @param  pHeader: Pointer to the header data
+  * @param  Size: Number of bytes
+  * @retval None
+  */
+static void CRYPEx_SwHeader(CRYP_ContextTypeDef *pContext, uint8_t *pHeader, uint32_t Size)
+{
+  uint32_t nbbytes = 0;
+
+  while(Size != 0)
+  {
+    if((pContext->NbBuffer == 0) && (Size >= 16))
+    {
+      CRYPEx_SwGhash(pContext, pHeader);
+      nbbytes = 16;
+    }
+    else
+    {
+      nbbytes = 16 - pContext->NbBuffer;
+      if(nbbytes > Size)
+      {
+        nbbytes = Size;
+      }
+      CRYPEx_Copy(&pContext->Buffer[pContext->NbBuffer], pHeader, nbbytes);
+      pContext->NbBuffer += nbbytes;
+      if(pContext->NbBuffer == 16)
+      {
+        CRYPEx_SwGhash(pContext, pContext->Buffer);
+        pContext->NbBuffer = 0;
+      }
+    }
+    pHeader += nbbytes;
+    Size -= nbbytes;
+  }
+}
+
+/**
+  * @brief  Ends the header of a software GCM context, the incomplete header
+  *         block being completed with zeros.
+  * @param  pContext: Pointer to the context
+  * @retval None
+  */
+static void CRYPEx_SwPayloadPhase(CRYP_ContextTypeDef *pContext)
+{
+  if(pContext->NbBuffer != 0)
+  {
+    CRYPEx_Zero(&pContext->Buffer[pContext->NbBuffer], 16 - pContext->NbBuffer);
+    CRYPEx_SwGhash(pContext, pContext->Buffer);
+    pContext->NbBuffer = 0;
+  }
+  pContext->Phase = CRYP_PHASE_PAYLOAD;
+}
+
+/**
+  * @brief  Processes payload data by software. The key stream of an incomplete
+  *         block is kept for the next update.
+  * @param  pContext: Pointer to the context
+  * @param  pInBuffer: Pointer to the input data
+  * @param  Size: Number of bytes
+  * @param  pOutBuffer: Pointer to the output data, may be equal to pInBuffer
+  * @retval None
+  */
+static void CRYPEx_SwUpdate(CRYP_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size, uint8_t *pOutBuffer)
+{
+  uint32_t gcm = CRYPEx_IS_GCM(pContext);
+  uint32_t decrypt = pContext->AlgoModeDirection & CRYP_CR_ALGODIR;
+  uint32_t index = 0;
+  uint8_t byte = 0;
+
+  while(Size != 0)
+  {
+    if((pContext->NbBuffer == 0) && (Size >= 16))
+    {
+      CRYPEx_SwEncrypt(pContext, pContext->Iv, pContext->KeyStream);
+      pContext->Iv[3]++;
+      if(gcm && decrypt)
+      {
+        CRYPEx_SwGhash(pContext, pInBuffer);
+      }
+      for(index = 0; index < 16; index++)
+      {
+        pOutBuffer[index] = pInBuffer[index] ^ pContext->KeyStream[index];
+      }
+      if(gcm && !decrypt)
+      {
+        CRYPEx_SwGhash(pContext, pOutBuffer);
+      }
+      pInBuffer += 16;
+      pOutBuffer += 16;
+      Size -= 16;
+    }
+    else
+    {
+      if(pContext->NbBuffer == 0)
+      {
+        CRYPEx_SwEncrypt(pContext, pContext->Iv, pContext->KeyStream);
+        pContext->Iv[3]++;
+      }
+      byte = *pInBuffer++ ^ pContext->KeyStream[pContext->NbBuffer];
+      pContext->Buffer[pContext->NbBuffer] = decrypt ? pInBuffer[-1] : byte;
+      *pOutBuffer++ = byte;
+      Size--;
+      if(++pContext->NbBuffer == 16)
+      {
+        if(gcm)
+        {
+          CRYPEx_SwGhash(pContext, pContext->Buffer);
+        }
+        pContext->NbBuffer = 0;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Computes the authentication tag of a software GCM context.
+  * @param  pContext: Pointer to the context
+  * @param  pAuthTag: Pointer to the 16 bytes authentication tag
+  * @retval None
+  */
+static void CRYPEx_SwFinal(CRYP_ContextTypeDef *pContext, uint8_t *pAuthTag)
+{
+  uint8_t block[16];
+  uint64_t headerlength = (uint64_t)pContext->HeaderSize * 8;
+  uint64_t inputlength = (uint64_t)pContext->PayloadSize * 8;
+  uint32_t index = 0;
+
+  if(pContext->Phase == CRYP_PHASE_HEADER)
+  {
+    CRYPEx_SwPayloadPhase(pContext);
+  }
+  if(pContext->NbBuffer != 0)
+  {
+    CRYPEx_Zero(&pContext->Buffer[pContext->NbBuffer], 16 - pContext->NbBuffer);
+    CRYPEx_SwGhash(pContext, pContext->Buffer);
+    pContext->NbBuffer = 0;
+  }
+
+  /* Lengths block: header and payload lengths in bits */
+  CRYPEx_PUT_BE32(block, (uint32_t)(headerlength >> 32));
+  CRYPEx_PUT_BE32(block + 4, (uint32_t)headerlength);
+  CRYPEx_PUT_BE32(block + 8, (uint32_t)(inputlength >> 32));
+  CRYPEx_PUT_BE32(block + 12, (uint32_t)inputlength);
+  CRYPEx_SwGhash(pContext, block);
+
+  for(index = 0; index < 16; index++)
+  {
+    pAuthTag[index] = pContext->Ghash[index] ^ pContext->TagMask[index];
+  }
+}
+
 /**
   * @}
   */ 
@@ -3022,6 +4125,491 @@ void HAL_CRYPEx_GCMCCM_IRQHandler(CRYP_HandleTypeDef *hcryp)
   }
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup CRYPEx_Exported_Functions_Group3 CRYPEx context processing functions
+ *  @brief   AES-CTR and AES-GCM processing with several messages in progress.
+ *
+@verbatim   
+  ==============================================================================
+                ##### Context processing functions #####
+  ==============================================================================  
+[..]  This section provides functions processing AES-CTR and AES-GCM messages
+      through a CRYP_ContextTypeDef context, so that several messages can be
+      in progress at the same time:
+      (+) HAL_CRYPEx_ContextInit() starts a message: algorithm, direction, key
+          and initialization vector (12 bytes in GCM mode, 16 bytes counter
+          block in CTR mode).
+      (+) HAL_CRYPEx_ContextHeader() adds GCM header (additional authenticated
+          data), of any length, before the payload.
+      (+) HAL_CRYPEx_ContextUpdate() processes payload data of any length in
+          polling mode. The CRYP peripheral is fed one block ahead of the block
+          read, and the input and output buffers may be the same.
+      (+) HAL_CRYPEx_ContextUpdate_DMA() processes a list of payload segments
+          with the two DMA streams, chained from one segment to the next one
+          in the DMA interrupts. HAL_CRYP_OutCpltCallback() is called at the
+          end of the list.
+      (+) HAL_CRYPEx_ContextFinish() ends the message and provides the GCM
+          authentication tag.
+      (+) HAL_CRYPEx_ContextRelease() saves the loaded context and frees the
+          CRYP peripheral for the other processing functions. It is called
+          before HAL_CRYP_Init(), which forgets the loaded context.
+[..]  The key and the peripheral state of the loaded context stay in the CRYP
+      peripheral between two calls: only a change of context saves the state
+      of the current message and restores the state of the next one. The key
+      buffer is kept by the application until the message is finished.
+[..]  When the handle is NULL, the message is processed by software. A message
+      is processed either by the CRYP peripheral or by software from its first
+      update to its end.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes a context and starts a new message.
+  * @param  pContext: Pointer to the context
+  * @param  AlgoModeDirection: CRYP_CR_ALGOMODE_AES_CTR_ENCRYPT, CRYP_CR_ALGOMODE_AES_CTR_DECRYPT,
+  *         CRYP_CR_ALGOMODE_AES_GCM_ENCRYPT or CRYP_CR_ALGOMODE_AES_GCM_DECRYPT
+  * @param  pKey: Pointer to the key, kept by the application until the message is finished
+  * @param  KeySize: CRYP_KEYSIZE_128B, CRYP_KEYSIZE_192B or CRYP_KEYSIZE_256B
+  * @param  pInitVect: Pointer to the 12 bytes initialization vector (GCM) or to the
+  *         16 bytes initial counter block (CTR)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_ContextInit(CRYP_ContextTypeDef *pContext, uint32_t AlgoModeDirection, uint8_t *pKey, uint32_t KeySize, uint8_t *pInitVect)
+{
+  if((pContext == NULL) || (pKey == NULL) || (pInitVect == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_CRYP_CONTEXT_ALGOMODE(AlgoModeDirection));
+  assert_param(IS_CRYP_KEYSIZE(KeySize));
+
+  pContext->AlgoModeDirection = AlgoModeDirection;
+  pContext->pKey = pKey;
+  pContext->KeySize = KeySize;
+  pContext->Engine = CRYPEx_CONTEXT_ENGINE_NONE;
+  pContext->HeaderSize = 0;
+  pContext->PayloadSize = 0;
+  pContext->NbBuffer = 0;
+
+  pContext->Iv[0] = CRYPEx_GET_BE32(pInitVect);
+  pContext->Iv[1] = CRYPEx_GET_BE32(pInitVect + 4);
+  pContext->Iv[2] = CRYPEx_GET_BE32(pInitVect + 8);
+
+  if(CRYPEx_IS_GCM(pContext))
+  {
+    /* The counter of the first payload block is 2 */
+    pContext->Iv[3] = 2;
+    pContext->Phase = CRYP_PHASE_HEADER;
+  }
+  else
+  {
+    pContext->Iv[3] = CRYPEx_GET_BE32(pInitVect + 12);
+    pContext->Phase = CRYP_PHASE_PAYLOAD;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Adds header data to a GCM message, before its payload.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module, NULL to process the
+  *         message by software
+  * @param  pContext: Pointer to the context
+  * @param  pHeader: Pointer to the header data
+  * @param  Size: Number of bytes, any value
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_ContextHeader(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint8_t *pHeader, uint32_t Size, uint32_t Timeout)
+{
+  uint32_t nbbytes = 0;
+
+  if((pContext == NULL) || !CRYPEx_IS_GCM(pContext) || (pContext->Phase != CRYP_PHASE_HEADER))
+  {
+    return HAL_ERROR;
+  }
+
+  if(hcryp == NULL)
+  {
+    if(pContext->Engine == CRYPEx_CONTEXT_ENGINE_NONE)
+    {
+      CRYPEx_SwStart(pContext);
+    }
+    if(pContext->Engine != CRYPEx_CONTEXT_ENGINE_SW)
+    {
+      return HAL_ERROR;
+    }
+    CRYPEx_SwHeader(pContext, pHeader, Size);
+    pContext->HeaderSize += Size;
+    return HAL_OK;
+  }
+
+  if(pContext->Engine == CRYPEx_CONTEXT_ENGINE_SW)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hcryp);
+
+  /* Change the CRYP peripheral state */
+  hcryp->State = HAL_CRYP_STATE_BUSY;
+
+  if(CRYPEx_ContextLoad(hcryp, pContext) != HAL_OK)
+  {
+    hcryp->State = HAL_CRYP_STATE_TIMEOUT;
+    __HAL_UNLOCK(hcryp);
+    return HAL_TIMEOUT;
+  }
+
+  pContext->HeaderSize += Size;
+
+  while(Size != 0)
+  {
+    if((pContext->NbBuffer == 0) && (Size >= 16))
+    {
+      if(CRYPEx_WriteHeader(hcryp, pHeader, Timeout) != HAL_OK)
+      {
+        break;
+      }
+      nbbytes = 16;
+    }
+    else
+    {
+      nbbytes = 16 - pContext->NbBuffer;
+      if(nbbytes > Size)
+      {
+        nbbytes = Size;
+      }
+      CRYPEx_Copy(&pContext->Buffer[pContext->NbBuffer], pHeader, nbbytes);
+      pContext->NbBuffer += nbbytes;
+      if(pContext->NbBuffer == 16)
+      {
+        if(CRYPEx_WriteHeader(hcryp, pContext->Buffer, Timeout) != HAL_OK)
+        {
+          break;
+        }
+        pContext->NbBuffer = 0;
+      }
+    }
+    pHeader += nbbytes;
+    Size -= nbbytes;
+  }
+
+  if(Size != 0)
+  {
+    hcryp->State = HAL_CRYP_STATE_TIMEOUT;
+    __HAL_UNLOCK(hcryp);
+    return HAL_TIMEOUT;
+  }
+
+  /* Change the CRYP peripheral state */
+  hcryp->State = HAL_CRYP_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hcryp);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Processes payload data of a message in polling mode.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module, NULL to process the
+  *         message by software
+  * @param  pContext: Pointer to the context
+  * @param  pInBuffer: Pointer to the input data
+  * @param  Size: Number of bytes, any value
+  * @param  pOutBuffer: Pointer to the output data, may be equal to pInBuffer
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_ContextUpdate(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size, uint8_t *pOutBuffer, uint32_t Timeout)
+{
+  if((pContext == NULL) || (pContext->Phase == CRYP_PHASE_FINAL))
+  {
+    return HAL_ERROR;
+  }
+
+  if(hcryp == NULL)
+  {
+    if(pContext->Engine == CRYPEx_CONTEXT_ENGINE_NONE)
+    {
+      CRYPEx_SwStart(pContext);
+    }
+    if(pContext->Engine != CRYPEx_CONTEXT_ENGINE_SW)
+    {
+      return HAL_ERROR;
+    }
+    if(pContext->Phase == CRYP_PHASE_HEADER)
+    {
+      CRYPEx_SwPayloadPhase(pContext);
+    }
+    CRYPEx_SwUpdate(pContext, pInBuffer, Size, pOutBuffer);
+    pContext->PayloadSize += Size;
+    return HAL_OK;
+  }
+
+  if(pContext->Engine == CRYPEx_CONTEXT_ENGINE_SW)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hcryp);
+
+  /* Change the CRYP peripheral state */
+  hcryp->State = HAL_CRYP_STATE_BUSY;
+
+  if((CRYPEx_ContextLoad(hcryp, pContext) != HAL_OK) ||
+     ((pContext->Phase == CRYP_PHASE_HEADER) && (CRYPEx_ContextPayloadPhase(hcryp, pContext, Timeout) != HAL_OK)) ||
+     (CRYPEx_ContextProcess(hcryp, pContext, pInBuffer, Size, pOutBuffer, Timeout) != HAL_OK))
+  {
+    hcryp->State = HAL_CRYP_STATE_TIMEOUT;
+    __HAL_UNLOCK(hcryp);
+    return HAL_TIMEOUT;
+  }
+
+  pContext->PayloadSize += Size;
+
+  /* Change the CRYP peripheral state */
+  hcryp->State = HAL_CRYP_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hcryp);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Processes a list of payload segments of a message with the DMA.
+  * @note   The buffers are word aligned and all the segments but the last one
+  *         are a multiple of 16 bytes. The incomplete last block of the list
+  *         is processed by the CPU in the output DMA interrupt.
+  * @note   The CRYP handle stays locked until HAL_CRYP_OutCpltCallback().
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pContext: Pointer to the context, without incomplete payload block
+  * @param  pSegment: Pointer to the first segment of the list, kept by the
+  *         application until the end of the processing
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_ContextUpdate_DMA(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, CRYP_SegmentTypeDef *pSegment)
+{
+  CRYP_SegmentTypeDef *psegment = pSegment;
+  uint32_t size = 0, insize = 0, outsize = 0;
+
+  if((hcryp == NULL) || (pContext == NULL) || (pSegment == NULL) ||
+     (pContext->Phase == CRYP_PHASE_FINAL) || (pContext->Engine == CRYPEx_CONTEXT_ENGINE_SW) ||
+     ((pContext->Phase == CRYP_PHASE_PAYLOAD) && (pContext->NbBuffer != 0)))
+  {
+    return HAL_ERROR;
+  }
+
+  for(psegment = pSegment; psegment != NULL; psegment = psegment->pNext)
+  {
+    if(((((uint32_t)psegment->pInBuffer | (uint32_t)psegment->pOutBuffer) & 3) != 0) ||
+       ((psegment->pNext != NULL) && ((psegment->Size & 15) != 0)))
+    {
+      return HAL_ERROR;
+    }
+    size += psegment->Size;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hcryp);
+
+  /* Change the CRYP peripheral state */
+  hcryp->State = HAL_CRYP_STATE_BUSY;
+
+  if((CRYPEx_ContextLoad(hcryp, pContext) != HAL_OK) ||
+     ((pContext->Phase == CRYP_PHASE_HEADER) && (CRYPEx_ContextPayloadPhase(hcryp, pContext, CRYPEx_CONTEXT_TIMEOUT) != HAL_OK)))
+  {
+    hcryp->State = HAL_CRYP_STATE_TIMEOUT;
+    __HAL_UNLOCK(hcryp);
+    return HAL_TIMEOUT;
+  }
+
+  pContext->PayloadSize += size;
+  pContext->pInSegment = pSegment;
+  pContext->pOutSegment = pSegment;
+  pContext->InOffset = 0;
+  pContext->OutOffset = 0;
+
+  insize = CRYPEx_ContextDMANext(&pContext->pInSegment, &pContext->InOffset);
+  outsize = CRYPEx_ContextDMANext(&pContext->pOutSegment, &pContext->OutOffset);
+
+  if(insize == 0)
+  {
+    /* Less than one block: processed by the CPU */
+    CRYPEx_ContextDMAEnd(hcryp);
+    return HAL_OK;
+  }
+
+  /* Set the CRYP DMA transfer callbacks */
+  hcryp->hdmain->XferCpltCallback = CRYPEx_ContextDMAInCplt;
+  hcryp->hdmain->XferErrorCallback = CRYPEx_ContextDMAError;
+  hcryp->hdmaout->XferCpltCallback = CRYPEx_ContextDMAOutCplt;
+  hcryp->hdmaout->XferErrorCallback = CRYPEx_ContextDMAError;
+
+  /* Enable the output stream first, then the input stream */
+  if((HAL_DMA_Start_IT(hcryp->hdmaout, (uint32_t)&hcryp->Instance->DOUT, (uint32_t)pContext->pOutSegment->pOutBuffer, outsize / 4) != HAL_OK) ||
+     (HAL_DMA_Start_IT(hcryp->hdmain, (uint32_t)pContext->pInSegment->pInBuffer, (uint32_t)&hcryp->Instance->DR, insize / 4) != HAL_OK))
+  {
+    HAL_DMA_Abort(hcryp->hdmaout);
+    __HAL_CRYP_DISABLE(hcryp);
+    pContext->Phase = CRYP_PHASE_FINAL;
+    hcryp->pContext = NULL;
+    hcryp->State = HAL_CRYP_STATE_ERROR;
+    __HAL_UNLOCK(hcryp);
+    return HAL_ERROR;
+  }
+
+  /* Enable the input and output DMA requests */
+  hcryp->Instance->DMACR = CRYP_DMACR_DIEN | CRYP_DMACR_DOEN;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Ends a message and provides its GCM authentication tag.
+  * @note   The context has to be initialized again to start a new message.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module, NULL if the message
+  *         is processed by software
+  * @param  pContext: Pointer to the context
+  * @param  pAuthTag: Pointer to the 16 bytes authentication tag (GCM), unused (CTR)
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_ContextFinish(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pContext, uint8_t *pAuthTag, uint32_t Timeout)
+{
+  uint64_t headerlength = 0, inputlength = 0;
+
+  if((pContext == NULL) || (pContext->Phase == CRYP_PHASE_FINAL) ||
+     (CRYPEx_IS_GCM(pContext) && (pAuthTag == NULL)))
+  {
+    return HAL_ERROR;
+  }
+
+  if(hcryp == NULL)
+  {
+    if(pContext->Engine == CRYPEx_CONTEXT_ENGINE_NONE)
+    {
+      CRYPEx_SwStart(pContext);
+    }
+    if(pContext->Engine != CRYPEx_CONTEXT_ENGINE_SW)
+    {
+      return HAL_ERROR;
+    }
+    if(CRYPEx_IS_GCM(pContext))
+    {
+      CRYPEx_SwFinal(pContext, pAuthTag);
+    }
+    CRYPEx_Zero((uint8_t *)pContext->RoundKey, sizeof(pContext->RoundKey));
+    pContext->Phase = CRYP_PHASE_FINAL;
+    return HAL_OK;
+  }
+
+  if(pContext->Engine == CRYPEx_CONTEXT_ENGINE_SW)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hcryp);
+
+  /* Change the CRYP peripheral state */
+  hcryp->State = HAL_CRYP_STATE_BUSY;
+
+  if(CRYPEx_IS_GCM(pContext))
+  {
+    headerlength = (uint64_t)pContext->HeaderSize * 8;
+    inputlength = (uint64_t)pContext->PayloadSize * 8;
+
+    if((CRYPEx_ContextLoad(hcryp, pContext) != HAL_OK) ||
+       ((pContext->Phase == CRYP_PHASE_HEADER) && (CRYPEx_ContextPayloadPhase(hcryp, pContext, Timeout) != HAL_OK)) ||
+       ((pContext->NbBuffer != 0) && (CRYPEx_ContextLastBlock(hcryp, pContext, Timeout) != HAL_OK)) ||
+       (CRYPEx_WaitStatus(&hcryp->Instance->SR, CRYP_FLAG_IFEM | CRYP_FLAG_BUSY, CRYP_FLAG_IFEM, Timeout) != HAL_OK))
+    {
+      hcryp->State = HAL_CRYP_STATE_TIMEOUT;
+      __HAL_UNLOCK(hcryp);
+      return HAL_TIMEOUT;
+    }
+
+    /* Disable CRYP to start the final phase, in encryption direction */
+    __HAL_CRYP_DISABLE(hcryp);
+    __HAL_CRYP_SET_PHASE(hcryp, CRYP_PHASE_FINAL);
+    hcryp->Instance->CR &= (uint32_t)(~CRYP_CR_ALGODIR);
+    __HAL_CRYP_ENABLE(hcryp);
+
+    /* Write the number of bits in header (64 bits) followed by the number of bits
+       in the payload */
+    hcryp->Instance->DR = __REV(headerlength >> 32);
+    hcryp->Instance->DR = __REV(headerlength);
+    hcryp->Instance->DR = __REV(inputlength >> 32);
+    hcryp->Instance->DR = __REV(inputlength);
+
+    if(CRYPEx_WaitStatus(&hcryp->Instance->SR, CRYP_FLAG_OFNE, CRYP_FLAG_OFNE, Timeout) != HAL_OK)
+    {
+      hcryp->State = HAL_CRYP_STATE_TIMEOUT;
+      __HAL_UNLOCK(hcryp);
+      return HAL_TIMEOUT;
+    }
+
+    /* Read the Auth TAG in the OUT FIFO */
+    CRYPEx_ReadBlock(hcryp, pAuthTag);
+  }
+
+  /* The state of the message is not saved */
+  if(hcryp->pContext == pContext)
+  {
+    __HAL_CRYP_DISABLE(hcryp);
+    hcryp->pContext = NULL;
+  }
+  pContext->Phase = CRYP_PHASE_FINAL;
+
+  /* Change the CRYP peripheral state */
+  hcryp->State = HAL_CRYP_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hcryp);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Saves the context loaded in the CRYP peripheral, if any, before the
+  *         CRYP peripheral is used by the other processing functions.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_ContextRelease(CRYP_HandleTypeDef *hcryp, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Process Locked */
+  __HAL_LOCK(hcryp);
+
+  status = CRYPEx_ContextSave(hcryp, Timeout);
+  hcryp->Phase = HAL_CRYP_PHASE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hcryp);
+
+  return status;
+}
+
 /**
   * @}
   */
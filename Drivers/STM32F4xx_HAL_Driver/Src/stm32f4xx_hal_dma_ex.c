@@ -8,6 +8,9 @@
   *         This file provides firmware functions to manage the following 
   *         functionalities of the DMA Extension peripheral:
   *           + Extended features functions
+  *           + Stream allocation functions
+  *           + Buffer stream functions
+  *           + Memory copy functions
   *
   @verbatim
   ==============================================================================
@@ -22,7 +25,68 @@
      -@-  When Multi (Double) Buffer mode is enabled the, transfer is circular by default.
      -@-  In Multi (Double) buffer mode, it is possible to update the base address for 
           the AHB memory port on the fly (DMA_SxM0AR or DMA_SxM1AR) when the stream is enabled. 
-  
+
+   (#) Instead of hard-coding the stream in the MSP initialization, a driver can
+       allocate it with HAL_DMAEx_AllocStream(): give the list of stream/channel
+       pairs able to serve the peripheral request (see the DMA request mapping
+       table of the reference manual), the first stream not owned by another
+       handle is written in the Instance and Init.Channel fields of the handle.
+       HAL_BUSY is returned when all the candidates are already owned, and
+       HAL_DMAEx_GetStreamOwner() gives the handle holding a stream.
+       Release the stream with HAL_DMAEx_FreeStream() in the MSP de-initialization.
+       A fixed stream is claimed the same way with a single candidate, so two
+       drivers configured on the same stream are detected.
+
+   (#) A buffer stream runs a peripheral to memory or memory to peripheral DMA
+       continuously in double buffer mode over a pool of application buffers
+       (ADC, I2S, SAI or DCMI streaming):
+       (++) Initialize the DMA handle with HAL_DMA_Init(), then fill the hdma,
+            PeriphAddress, pBuffers, NbBuffers, BufferLength and optionally the
+            BufferCallback, ErrorCallback and pContext fields of a
+            DMA_BufferStreamTypeDef structure.
+       (++) Call HAL_DMAEx_BufferStreamStart(): the DMA starts on pBuffers[0] and
+            pBuffers[1] (fill them first for a memory to peripheral stream), then
+            enable the DMA request of the peripheral.
+       (++) Call HAL_DMAEx_BufferStreamGet() to take ownership of the next buffer
+            without copy: a filled buffer for a peripheral to memory stream, a
+            free buffer to fill for a memory to peripheral stream. NULL is
+            returned when there is none yet.
+       (++) Give the buffer back with HAL_DMAEx_BufferStreamRelease() once it has
+            been processed (or filled). Buffers can be released in any order.
+       (++) Each time the DMA completes a buffer, the freed memory address register
+            is loaded with the next buffer owned by the driver and BufferCallback is
+            called from the DMA interrupt. When there is none, the same buffer is
+            transferred again and the event is counted as an overrun (data lost)
+            or an underrun (data repeated), see HAL_DMAEx_BufferStreamGetStats().
+       (++) Stop the stream with HAL_DMAEx_BufferStreamStop().
+
+     -@-  The buffer stream uses the XferCpltCallback, XferM1CpltCallback,
+          XferErrorCallback and Parent fields of the DMA handle: do not link the
+          DMA handle to a peripheral handle driving the same stream.
+
+   (#) Memory copies and fills can be offloaded to a DMA2 stream with a copy engine:
+       (++) Initialize a DMA2 stream with HAL_DMA_Init() in memory to memory mode,
+            enable its interrupt, and set the hdma field of a zero-initialized
+            DMA_CopyEngineTypeDef structure. Call HAL_DMA_IRQHandler() from the
+            stream interrupt handler.
+       (++) Fill a DMA_CopyTypeDef request (Type, pDst, pSrc or Pattern, Size,
+            XferCpltCallback, pContext) and give it to HAL_DMAEx_CopyQueue().
+            Requests are served in order; the caller keeps the request memory
+            until its XferCpltCallback is called from the DMA interrupt, with
+            ErrorCode set. To wait from a task, release an RTOS semaphore passed
+            in pContext from the callback.
+       (++) Each request is cut into transfers of at most 65535 items. The data
+            size of each port follows the alignment of its address, the FIFO is
+            used to pack bytes into words when the source and the destination
+            alignments differ, and 4-beat bursts are used when both addresses are
+            aligned on 16 bytes.
+
+     -@-  The DMA cannot access the CCM data RAM: requests with a buffer (or, for
+          a fill, the request itself) located there are rejected.
+     -@-  Below a few hundred bytes a CPU memcpy() is usually faster than the
+          interrupt driven DMA: see the DMA_MemCopy example to measure the
+          crossover size on the target memories.
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -69,14 +133,48 @@
 #ifdef HAL_DMA_MODULE_ENABLED
 
 /* Private types -------------------------------------------------------------*/
-/* Private variables ---------------------------------------------------------*/
 /* Private Constants ---------------------------------------------------------*/
+#define DMAEX_STREAM_NB       ((uint32_t)16)
+/* Private variables ---------------------------------------------------------*/
+/* Streams of DMA1 and DMA2 */
+static DMA_Stream_TypeDef * const DMAEx_Streams[DMAEX_STREAM_NB] =
+{
+  DMA1_Stream0, DMA1_Stream1, DMA1_Stream2, DMA1_Stream3,
+  DMA1_Stream4, DMA1_Stream5, DMA1_Stream6, DMA1_Stream7,
+  DMA2_Stream0, DMA2_Stream1, DMA2_Stream2, DMA2_Stream3,
+  DMA2_Stream4, DMA2_Stream5, DMA2_Stream6, DMA2_Stream7
+};
+
+/* Handle owning each stream, NULL when the stream is free */
+static DMA_HandleTypeDef *DMAEx_StreamOwner[DMAEX_STREAM_NB];
 /* Private macros ------------------------------------------------------------*/
+#define DMAEX_RING_INDEX(__COUNT__)  ((__COUNT__) & (DMA_BUFFER_STREAM_MAX_BUFFERS - 1))
+
+#define DMAEX_COPY_BURST             ((uint32_t)16)    /* Bytes of a 4-beat word burst */
+#define DMAEX_COPY_CR_MASK           ((uint32_t)(DMA_SxCR_PSIZE | DMA_SxCR_MSIZE | DMA_SxCR_PINC | \
+                                                 DMA_SxCR_MINC  | DMA_SxCR_PBURST | DMA_SxCR_MBURST))
+
+#if defined(CCMDATARAM_END)
+#define DMAEX_IS_CCM(__ADDRESS__, __SIZE__)  (((uint32_t)(__ADDRESS__) <= CCMDATARAM_END) && \
+                                             (((uint32_t)(__ADDRESS__) + (__SIZE__)) > CCMDATARAM_BASE))
+#else
+#define DMAEX_IS_CCM(__ADDRESS__, __SIZE__)  0
+#endif /* CCMDATARAM_END */
 /* Private functions ---------------------------------------------------------*/
 /** @addtogroup DMAEx_Private_Functions
   * @{
   */
 static void DMA_MultiBufferSetConfig(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+static uint32_t DMA_GetStreamIndex(DMA_Stream_TypeDef *Instance);
+static void DMA_BufferStreamCplt(DMA_BufferStreamTypeDef *hstream, HAL_DMA_MemoryTypeDef Memory);
+static void DMA_BufferStreamM0Cplt(DMA_HandleTypeDef *hdma);
+static void DMA_BufferStreamM1Cplt(DMA_HandleTypeDef *hdma);
+static void DMA_BufferStreamError(DMA_HandleTypeDef *hdma);
+static void DMA_CopyStart(DMA_CopyEngineTypeDef *hengine);
+static HAL_StatusTypeDef DMA_CopyChunk(DMA_CopyEngineTypeDef *hengine);
+static uint32_t DMA_CopyAlign(uint32_t Address, uint32_t Size);
+static void DMA_CopyCplt(DMA_HandleTypeDef *hdma);
+static void DMA_CopyError(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */
@@ -245,6 +343,445 @@ HAL_StatusTypeDef HAL_DMAEx_ChangeMemory(DMA_HandleTypeDef *hdma, uint32_t Addre
   return HAL_OK;
 }
 
+/**
+  * @}
+  */
+
+/** @addtogroup DMAEx_Exported_Functions_Group2
+  *
+@verbatim   
+ ===============================================================================
+                #####  Stream allocation functions  #####
+ ===============================================================================  
+    [..]  This section provides functions allowing to:
+      (+) Allocate a stream among the candidates able to serve a request
+      (+) Free an allocated stream
+      (+) Get the handle owning a stream
+      
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Allocates a DMA stream to a handle.
+  * @param  hdma:       pointer to a DMA_HandleTypeDef structure. On success the
+  *                     Instance and Init.Channel fields are set.
+  * @param  pRequests:  pointer to the stream/channel pairs able to serve the
+  *                     request, in order of preference
+  * @param  NbRequests: number of candidates
+  * @note   A handle owns at most one stream: if it already owns one of the
+  *         candidates it is kept, if it owns another stream HAL_ERROR is returned.
+  * @retval HAL status, HAL_BUSY when all the candidates are owned by other handles
+  */
+HAL_StatusTypeDef HAL_DMAEx_AllocStream(DMA_HandleTypeDef *hdma, const DMA_StreamRequestTypeDef *pRequests, uint32_t NbRequests)
+{
+  HAL_StatusTypeDef status = HAL_BUSY;
+  uint32_t primask = 0;
+  uint32_t index = 0, i = 0;
+
+  if((hdma == NULL) || (pRequests == NULL) || (NbRequests == 0))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  /* Check whether the handle already owns a stream */
+  for(index = 0; index < DMAEX_STREAM_NB; index++)
+  {
+    if(DMAEx_StreamOwner[index] == hdma)
+    {
+      status = HAL_ERROR;
+      break;
+    }
+  }
+
+  for(i = 0; i < NbRequests; i++)
+  {
+    assert_param(IS_DMA_STREAM_ALL_INSTANCE(pRequests[i].Instance));
+    assert_param(IS_DMA_CHANNEL(pRequests[i].Channel));
+
+    index = DMA_GetStreamIndex(pRequests[i].Instance);
+
+    if((index < DMAEX_STREAM_NB) && ((DMAEx_StreamOwner[index] == NULL) || (DMAEx_StreamOwner[index] == hdma)))
+    {
+      if((status != HAL_ERROR) || (DMAEx_StreamOwner[index] == hdma))
+      {
+        DMAEx_StreamOwner[index] = hdma;
+        hdma->Instance = pRequests[i].Instance;
+        hdma->Init.Channel = pRequests[i].Channel;
+        status = HAL_OK;
+        break;
+      }
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Frees the DMA stream allocated to a handle.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure.
+  * @note   The stream must have been stopped and de-initialized before.
+  * @retval HAL status, HAL_ERROR when the handle owns no stream
+  */
+HAL_StatusTypeDef HAL_DMAEx_FreeStream(DMA_HandleTypeDef *hdma)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  uint32_t primask = 0;
+  uint32_t index = 0;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  for(index = 0; index < DMAEX_STREAM_NB; index++)
+  {
+    if((hdma != NULL) && (DMAEx_StreamOwner[index] == hdma))
+    {
+      DMAEx_StreamOwner[index] = NULL;
+      status = HAL_OK;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Returns the handle owning a DMA stream.
+  * @param  Instance: DMA stream, e.g. DMA2_Stream0
+  * @retval Owning handle, NULL when the stream is free
+  */
+DMA_HandleTypeDef *HAL_DMAEx_GetStreamOwner(DMA_Stream_TypeDef *Instance)
+{
+  uint32_t index = DMA_GetStreamIndex(Instance);
+
+  return (index < DMAEX_STREAM_NB) ? DMAEx_StreamOwner[index] : NULL;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup DMAEx_Exported_Functions_Group3
+  *
+@verbatim   
+ ===============================================================================
+                #####  Buffer stream functions  #####
+ ===============================================================================  
+    [..]  This section provides functions allowing to:
+      (+) Start and stop a double buffer stream over a pool of buffers
+      (+) Take and give back the ownership of a buffer without copy
+      (+) Get the overrun and underrun statistics
+      
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Starts a buffer stream.
+  * @param  hstream: pointer to a DMA_BufferStreamTypeDef structure.
+  * @note   The DMA starts on pBuffers[0] (memory 0) and pBuffers[1] (memory 1),
+  *         the other buffers are owned by the driver (peripheral to memory) or
+  *         available to HAL_DMAEx_BufferStreamGet() (memory to peripheral).
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_BufferStreamStart(DMA_BufferStreamTypeDef *hstream)
+{
+  DMA_HandleTypeDef *hdma = NULL;
+  uint32_t i = 0;
+
+  if((hstream == NULL) || (hstream->hdma == NULL) || (hstream->pBuffers == NULL) ||
+     (hstream->NbBuffers < 3) || (hstream->NbBuffers > DMA_BUFFER_STREAM_MAX_BUFFERS) ||
+     (hstream->BufferLength == 0) || (hstream->BufferLength > 0xFFFF) ||
+     (hstream->hdma->Init.Direction == DMA_MEMORY_TO_MEMORY))
+  {
+    return HAL_ERROR;
+  }
+
+  if(hstream->State == HAL_DMA_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+
+  hdma = hstream->hdma;
+
+  /* Memory 0 and memory 1 get the first two buffers, the others are free */
+  hstream->Active[0] = 0;
+  hstream->Active[1] = 1;
+  for(i = 2; i < hstream->NbBuffers; i++)
+  {
+    hstream->Free[i - 2] = (uint8_t)i;
+  }
+  hstream->FreeIn = hstream->NbBuffers - 2;
+  hstream->FreeOut = 0;
+  hstream->ReadyIn = 0;
+  hstream->ReadyOut = 0;
+  hstream->Held = 0;
+  hstream->Stats.Buffers = 0;
+  hstream->Stats.Overruns = 0;
+  hstream->Stats.Underruns = 0;
+  hstream->Stats.Errors = 0;
+
+  hdma->Parent = hstream;
+  hdma->XferCpltCallback = DMA_BufferStreamM0Cplt;
+  hdma->XferM1CpltCallback = DMA_BufferStreamM1Cplt;
+  hdma->XferHalfCpltCallback = NULL;
+  hdma->XferErrorCallback = DMA_BufferStreamError;
+
+  /* Start on memory 0 with no event left from a previous transfer */
+  hdma->Instance->CR &= ~(uint32_t)DMA_SxCR_CT;
+  __HAL_DMA_CLEAR_FLAG(hdma, __HAL_DMA_GET_TC_FLAG_INDEX(hdma));
+  __HAL_DMA_CLEAR_FLAG(hdma, __HAL_DMA_GET_HT_FLAG_INDEX(hdma));
+  __HAL_DMA_CLEAR_FLAG(hdma, __HAL_DMA_GET_TE_FLAG_INDEX(hdma));
+  __HAL_DMA_CLEAR_FLAG(hdma, __HAL_DMA_GET_FE_FLAG_INDEX(hdma));
+  __HAL_DMA_CLEAR_FLAG(hdma, __HAL_DMA_GET_DME_FLAG_INDEX(hdma));
+
+  hstream->State = HAL_DMA_STATE_BUSY;
+
+  if(hdma->Init.Direction == DMA_PERIPH_TO_MEMORY)
+  {
+    if(HAL_DMAEx_MultiBufferStart_IT(hdma, hstream->PeriphAddress, (uint32_t)hstream->pBuffers[0], (uint32_t)hstream->pBuffers[1], hstream->BufferLength) != HAL_OK)
+    {
+      hstream->State = HAL_DMA_STATE_READY;
+      return HAL_BUSY;
+    }
+  }
+  else
+  {
+    if(HAL_DMAEx_MultiBufferStart_IT(hdma, (uint32_t)hstream->pBuffers[0], hstream->PeriphAddress, (uint32_t)hstream->pBuffers[1], hstream->BufferLength) != HAL_OK)
+    {
+      hstream->State = HAL_DMA_STATE_READY;
+      return HAL_BUSY;
+    }
+  }
+
+  /* Only the buffer completions are of interest */
+  __HAL_DMA_DISABLE_IT(hdma, DMA_IT_HT);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stops a buffer stream.
+  * @param  hstream: pointer to a DMA_BufferStreamTypeDef structure.
+  * @note   Buffers still owned by the application must not be released after
+  *         this call: a new start gives all of them back to the driver.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_BufferStreamStop(DMA_BufferStreamTypeDef *hstream)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if((hstream == NULL) || (hstream->hdma == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if(hstream->State == HAL_DMA_STATE_RESET)
+  {
+    return HAL_OK;
+  }
+
+  status = HAL_DMA_Abort(hstream->hdma);
+
+  /* Leave the stream in single buffer mode */
+  hstream->hdma->Instance->CR &= ~(uint32_t)(DMA_SxCR_DBM | DMA_SxCR_CT);
+
+  hstream->State = HAL_DMA_STATE_READY;
+
+  return status;
+}
+
+/**
+  * @brief  Takes the ownership of the next buffer of a buffer stream.
+  * @param  hstream: pointer to a DMA_BufferStreamTypeDef structure.
+  * @note   Peripheral to memory: the oldest filled buffer. Memory to peripheral:
+  *         a free buffer to fill and submit with HAL_DMAEx_BufferStreamRelease().
+  * @note   This function must not be called concurrently for the same stream.
+  * @retval Buffer address, NULL when no buffer is available
+  */
+void *HAL_DMAEx_BufferStreamGet(DMA_BufferStreamTypeDef *hstream)
+{
+  uint32_t index = 0;
+
+  if((hstream == NULL) || (hstream->State != HAL_DMA_STATE_BUSY))
+  {
+    return NULL;
+  }
+
+  if(hstream->hdma->Init.Direction == DMA_PERIPH_TO_MEMORY)
+  {
+    if(hstream->ReadyOut == hstream->ReadyIn)
+    {
+      return NULL;
+    }
+    index = hstream->Ready[DMAEX_RING_INDEX(hstream->ReadyOut)];
+    hstream->ReadyOut++;
+  }
+  else
+  {
+    if(hstream->FreeOut == hstream->FreeIn)
+    {
+      return NULL;
+    }
+    index = hstream->Free[DMAEX_RING_INDEX(hstream->FreeOut)];
+    hstream->FreeOut++;
+  }
+
+  hstream->Held |= ((uint32_t)1 << index);
+
+  return hstream->pBuffers[index];
+}
+
+/**
+  * @brief  Gives the ownership of a buffer back to a buffer stream.
+  * @param  hstream: pointer to a DMA_BufferStreamTypeDef structure.
+  * @param  pBuffer: buffer returned by HAL_DMAEx_BufferStreamGet()
+  * @note   Peripheral to memory: the buffer can be filled again. Memory to
+  *         peripheral: the buffer is queued for transmission.
+  * @note   This function must not be called concurrently for the same stream.
+  * @retval HAL status, HAL_ERROR when the buffer is not owned by the application
+  */
+HAL_StatusTypeDef HAL_DMAEx_BufferStreamRelease(DMA_BufferStreamTypeDef *hstream, void *pBuffer)
+{
+  uint32_t index = 0;
+
+  if((hstream == NULL) || (hstream->State != HAL_DMA_STATE_BUSY))
+  {
+    return HAL_ERROR;
+  }
+
+  for(index = 0; index < hstream->NbBuffers; index++)
+  {
+    if((hstream->pBuffers[index] == pBuffer) && ((hstream->Held & ((uint32_t)1 << index)) != 0))
+    {
+      break;
+    }
+  }
+
+  if(index == hstream->NbBuffers)
+  {
+    return HAL_ERROR;
+  }
+
+  hstream->Held &= ~((uint32_t)1 << index);
+
+  /* The ring entry is written before the counter publishing it */
+  if(hstream->hdma->Init.Direction == DMA_PERIPH_TO_MEMORY)
+  {
+    hstream->Free[DMAEX_RING_INDEX(hstream->FreeIn)] = (uint8_t)index;
+    hstream->FreeIn++;
+  }
+  else
+  {
+    hstream->Ready[DMAEX_RING_INDEX(hstream->ReadyIn)] = (uint8_t)index;
+    hstream->ReadyIn++;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Returns the statistics of a buffer stream.
+  * @param  hstream: pointer to a DMA_BufferStreamTypeDef structure.
+  * @param  pStats:  pointer to the structure receiving the statistics
+  * @retval None
+  */
+void HAL_DMAEx_BufferStreamGetStats(DMA_BufferStreamTypeDef *hstream, DMA_BufferStreamStatsTypeDef *pStats)
+{
+  uint32_t primask = 0;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  *pStats = hstream->Stats;
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup DMAEx_Exported_Functions_Group4
+  *
+@verbatim   
+ ===============================================================================
+                #####  Memory copy functions  #####
+ ===============================================================================  
+    [..]  This section provides functions allowing to:
+      (+) Queue memory copy and fill requests on a memory to memory DMA stream
+      
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Queues a memory copy or fill request on a copy engine.
+  * @param  hengine: pointer to a DMA_CopyEngineTypeDef structure.
+  * @param  pCopy:   pointer to the request, owned by the driver until its
+  *                  XferCpltCallback is called
+  * @note   This function can be called from the XferCpltCallback of a request.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_CopyQueue(DMA_CopyEngineTypeDef *hengine, DMA_CopyTypeDef *pCopy)
+{
+  uint32_t primask = 0;
+
+  if((hengine == NULL) || (hengine->hdma == NULL) || (pCopy == NULL) || (pCopy->pDst == NULL) || (pCopy->Size == 0) ||
+     (hengine->hdma->Init.Direction != DMA_MEMORY_TO_MEMORY))
+  {
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_DMA_COPY_TYPE(pCopy->Type));
+
+  if(pCopy->Type == DMA_COPY_FILL)
+  {
+    if(DMAEX_IS_CCM(&pCopy->Pattern, sizeof(pCopy->Pattern)))
+    {
+      return HAL_ERROR;
+    }
+  }
+  else if((pCopy->pSrc == NULL) || DMAEX_IS_CCM(pCopy->pSrc, pCopy->Size))
+  {
+    return HAL_ERROR;
+  }
+
+  if(DMAEX_IS_CCM(pCopy->pDst, pCopy->Size))
+  {
+    return HAL_ERROR;
+  }
+
+  pCopy->ErrorCode = HAL_DMA_ERROR_NONE;
+  pCopy->Offset = 0;
+  pCopy->pNext = NULL;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if(hengine->pQueueTail == NULL)
+  {
+    hengine->pQueueHead = pCopy;
+  }
+  else
+  {
+    hengine->pQueueTail->pNext = pCopy;
+  }
+  hengine->pQueueTail = pCopy;
+
+  __set_PRIMASK(primask);
+
+  DMA_CopyStart(hengine);
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -291,6 +828,360 @@ static void DMA_MultiBufferSetConfig(DMA_HandleTypeDef *hdma, uint32_t SrcAddres
   }
 }
 
+/**
+  * @brief  Returns the index of a stream in the stream owner table.
+  * @param  Instance: DMA stream
+  * @retval Index, DMAEX_STREAM_NB when the stream is unknown
+  */
+static uint32_t DMA_GetStreamIndex(DMA_Stream_TypeDef *Instance)
+{
+  uint32_t index = 0;
+
+  while((index < DMAEX_STREAM_NB) && (DMAEx_Streams[index] != Instance))
+  {
+    index++;
+  }
+
+  return index;
+}
+
+/**
+  * @brief  Buffer stream completion of one memory, called from the DMA interrupt.
+  * @param  hstream: pointer to a DMA_BufferStreamTypeDef structure.
+  * @param  Memory:  memory address register whose transfer is complete
+  * @retval None
+  */
+static void DMA_BufferStreamCplt(DMA_BufferStreamTypeDef *hstream, HAL_DMA_MemoryTypeDef Memory)
+{
+  DMA_HandleTypeDef *hdma = hstream->hdma;
+  uint32_t completed = hstream->Active[Memory];
+  uint32_t next = completed;
+  HAL_DMA_MemoryTypeDef current = ((hdma->Instance->CR & DMA_SxCR_CT) != 0) ? MEMORY1 : MEMORY0;
+
+  /* The address register can only be changed while the DMA runs on the other
+     memory: otherwise the interrupt came too late and the buffer is reused */
+  if(current != Memory)
+  {
+    if(hdma->Init.Direction == DMA_PERIPH_TO_MEMORY)
+    {
+      if(hstream->FreeOut != hstream->FreeIn)
+      {
+        next = hstream->Free[DMAEX_RING_INDEX(hstream->FreeOut)];
+        hstream->FreeOut++;
+        HAL_DMAEx_ChangeMemory(hdma, (uint32_t)hstream->pBuffers[next], Memory);
+
+        /* Hand the filled buffer over to the application */
+        hstream->Ready[DMAEX_RING_INDEX(hstream->ReadyIn)] = (uint8_t)completed;
+        hstream->ReadyIn++;
+      }
+    }
+    else
+    {
+      if(hstream->ReadyOut != hstream->ReadyIn)
+      {
+        next = hstream->Ready[DMAEX_RING_INDEX(hstream->ReadyOut)];
+        hstream->ReadyOut++;
+        HAL_DMAEx_ChangeMemory(hdma, (uint32_t)hstream->pBuffers[next], Memory);
+
+        /* Give the sent buffer back to the application */
+        hstream->Free[DMAEX_RING_INDEX(hstream->FreeIn)] = (uint8_t)completed;
+        hstream->FreeIn++;
+      }
+    }
+  }
+
+  if(next != completed)
+  {
+    hstream->Active[Memory] = (uint8_t)next;
+    hstream->Stats.Buffers++;
+  }
+  else if(hdma->Init.Direction == DMA_PERIPH_TO_MEMORY)
+  {
+    hstream->Stats.Overruns++;
+  }
+  else
+  {
+    hstream->Stats.Underruns++;
+  }
+
+  if(hstream->BufferCallback != NULL)
+  {
+    hstream->BufferCallback(hstream);
+  }
+}
+
+/**
+  * @brief  Buffer stream memory 0 transfer complete callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure.
+  * @retval None
+  */
+static void DMA_BufferStreamM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  DMA_BufferStreamCplt((DMA_BufferStreamTypeDef *)hdma->Parent, MEMORY0);
+}
+
+/**
+  * @brief  Buffer stream memory 1 transfer complete callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure.
+  * @retval None
+  */
+static void DMA_BufferStreamM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  DMA_BufferStreamCplt((DMA_BufferStreamTypeDef *)hdma->Parent, MEMORY1);
+}
+
+/**
+  * @brief  Buffer stream DMA error callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure.
+  * @note   A FIFO error does not stop the stream and is only counted.
+  * @retval None
+  */
+static void DMA_BufferStreamError(DMA_HandleTypeDef *hdma)
+{
+  DMA_BufferStreamTypeDef *hstream = (DMA_BufferStreamTypeDef *)hdma->Parent;
+
+  hstream->Stats.Errors++;
+
+  if((hdma->Instance->CR & DMA_SxCR_EN) == 0)
+  {
+    hstream->State = HAL_DMA_STATE_ERROR;
+
+    if(hstream->ErrorCallback != NULL)
+    {
+      hstream->ErrorCallback(hstream);
+    }
+  }
+}
+
+/**
+  * @brief  Starts the first queued request of a copy engine if the stream is idle.
+  * @param  hengine: pointer to a DMA_CopyEngineTypeDef structure.
+  * @retval None
+  */
+static void DMA_CopyStart(DMA_CopyEngineTypeDef *hengine)
+{
+  DMA_CopyTypeDef *pCopy = NULL;
+  uint32_t primask = 0;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if((hengine->pQueueActive == NULL) && (hengine->pQueueHead != NULL))
+  {
+    pCopy = hengine->pQueueHead;
+    hengine->pQueueHead = pCopy->pNext;
+    if(hengine->pQueueHead == NULL)
+    {
+      hengine->pQueueTail = NULL;
+    }
+    pCopy->pNext = NULL;
+    hengine->pQueueActive = pCopy;
+  }
+
+  __set_PRIMASK(primask);
+
+  if(pCopy == NULL)
+  {
+    return;
+  }
+
+  hengine->hdma->Parent = hengine;
+  hengine->hdma->XferCpltCallback = DMA_CopyCplt;
+  hengine->hdma->XferHalfCpltCallback = NULL;
+  hengine->hdma->XferErrorCallback = DMA_CopyError;
+  hengine->hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+
+  if(DMA_CopyChunk(hengine) != HAL_OK)
+  {
+    /* The stream is locked by another user: put the request back, it is
+       started by the next HAL_DMAEx_CopyQueue() */
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    pCopy->pNext = hengine->pQueueHead;
+    hengine->pQueueHead = pCopy;
+    if(hengine->pQueueTail == NULL)
+    {
+      hengine->pQueueTail = pCopy;
+    }
+    hengine->pQueueActive = NULL;
+
+    __set_PRIMASK(primask);
+  }
+}
+
+/**
+  * @brief  Configures and starts the next transfer of the active copy request.
+  * @param  hengine: pointer to a DMA_CopyEngineTypeDef structure.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DMA_CopyChunk(DMA_CopyEngineTypeDef *hengine)
+{
+  DMA_HandleTypeDef *hdma = hengine->hdma;
+  DMA_CopyTypeDef *pCopy = hengine->pQueueActive;
+  uint32_t remaining = pCopy->Size - pCopy->Offset;
+  uint32_t dst = (uint32_t)pCopy->pDst + pCopy->Offset;
+  uint32_t src = 0, srcalign = 0, dstalign = 0, chunk = 0, max = 0;
+  uint32_t cr = DMA_MINC_ENABLE;
+
+  dstalign = DMA_CopyAlign(dst, remaining);
+
+  if(pCopy->Type == DMA_COPY_FILL)
+  {
+    /* The source port reads the pattern with the data size of the destination */
+    src = (uint32_t)&pCopy->Pattern;
+    srcalign = dstalign;
+  }
+  else
+  {
+    src = (uint32_t)pCopy->pSrc + pCopy->Offset;
+    srcalign = DMA_CopyAlign(src, remaining);
+    cr |= DMA_PINC_ENABLE;
+  }
+
+  chunk = remaining;
+
+  if((srcalign == 4) && (dstalign == 4) && (remaining >= DMAEX_COPY_BURST))
+  {
+    if((dst & (DMAEX_COPY_BURST - 1)) != 0)
+    {
+      /* Single transfers up to the burst alignment, if the source gets aligned too */
+      if((pCopy->Type == DMA_COPY_FILL) || (((src ^ dst) & (DMAEX_COPY_BURST - 1)) == 0))
+      {
+        chunk = DMAEX_COPY_BURST - (dst & (DMAEX_COPY_BURST - 1));
+      }
+    }
+    else if(pCopy->Type == DMA_COPY_FILL)
+    {
+      chunk = remaining & ~(DMAEX_COPY_BURST - 1);
+      cr |= DMA_MBURST_INC4;
+    }
+    else if((src & (DMAEX_COPY_BURST - 1)) == 0)
+    {
+      chunk = remaining & ~(DMAEX_COPY_BURST - 1);
+      cr |= DMA_MBURST_INC4 | DMA_PBURST_INC4;
+    }
+  }
+
+  /* At most 65535 items, keeping whole items on both ports and whole bursts */
+  max = 0xFFFF * srcalign;
+  if((cr & DMA_SxCR_MBURST) != 0)
+  {
+    max &= ~(DMAEX_COPY_BURST - 1);
+  }
+  else
+  {
+    max &= ~(((srcalign > dstalign) ? srcalign : dstalign) - 1);
+  }
+  if(chunk > max)
+  {
+    chunk = max;
+  }
+
+  cr |= (srcalign == 4) ? DMA_PDATAALIGN_WORD : ((srcalign == 2) ? DMA_PDATAALIGN_HALFWORD : DMA_PDATAALIGN_BYTE);
+  cr |= (dstalign == 4) ? DMA_MDATAALIGN_WORD : ((dstalign == 2) ? DMA_MDATAALIGN_HALFWORD : DMA_MDATAALIGN_BYTE);
+
+  if(hdma->Lock == HAL_LOCKED)
+  {
+    return HAL_BUSY;
+  }
+
+  /* The stream is disabled between two transfers */
+  hdma->Instance->CR = (hdma->Instance->CR & ~DMAEX_COPY_CR_MASK) | cr;
+  hdma->Instance->FCR = (hdma->Instance->FCR & ~(uint32_t)(DMA_SxFCR_DMDIS | DMA_SxFCR_FTH)) |
+                        DMA_FIFOMODE_ENABLE | DMA_FIFO_THRESHOLD_FULL;
+
+  hengine->ChunkSize = chunk;
+
+  if(HAL_DMA_Start_IT(hdma, src, dst, chunk / srcalign) != HAL_OK)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Only the end of the transfer is of interest */
+  __HAL_DMA_DISABLE_IT(hdma, DMA_IT_HT);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Returns the widest data size, in bytes, allowed by an address and a size.
+  * @param  Address: start address
+  * @param  Size:    number of bytes
+  * @retval 4, 2 or 1
+  */
+static uint32_t DMA_CopyAlign(uint32_t Address, uint32_t Size)
+{
+  if(((Address | Size) & 3) == 0)
+  {
+    return 4;
+  }
+  else if(((Address | Size) & 1) == 0)
+  {
+    return 2;
+  }
+
+  return 1;
+}
+
+/**
+  * @brief  Copy engine transfer complete callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure.
+  * @retval None
+  */
+static void DMA_CopyCplt(DMA_HandleTypeDef *hdma)
+{
+  DMA_CopyEngineTypeDef *hengine = (DMA_CopyEngineTypeDef *)hdma->Parent;
+  DMA_CopyTypeDef *pCopy = hengine->pQueueActive;
+
+  pCopy->Offset += hengine->ChunkSize;
+
+  if(pCopy->Offset < pCopy->Size)
+  {
+    if(DMA_CopyChunk(hengine) == HAL_OK)
+    {
+      return;
+    }
+    pCopy->ErrorCode = HAL_DMA_ERROR_TIMEOUT;
+  }
+
+  /* Start the next request before notifying this one */
+  hengine->pQueueActive = NULL;
+  DMA_CopyStart(hengine);
+
+  if(pCopy->XferCpltCallback != NULL)
+  {
+    pCopy->XferCpltCallback(hdma, pCopy);
+  }
+}
+
+/**
+  * @brief  Copy engine DMA error callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure.
+  * @note   A FIFO error does not stop the stream and is ignored.
+  * @retval None
+  */
+static void DMA_CopyError(DMA_HandleTypeDef *hdma)
+{
+  DMA_CopyEngineTypeDef *hengine = (DMA_CopyEngineTypeDef *)hdma->Parent;
+  DMA_CopyTypeDef *pCopy = hengine->pQueueActive;
+
+  if(((hdma->Instance->CR & DMA_SxCR_EN) != 0) || (pCopy == NULL))
+  {
+    return;
+  }
+
+  pCopy->ErrorCode = hdma->ErrorCode;
+
+  hengine->pQueueActive = NULL;
+  DMA_CopyStart(hengine);
+
+  if(pCopy->XferCpltCallback != NULL)
+  {
+    pCopy->XferCpltCallback(hdma, pCopy);
+  }
+}
+
 /**
   * @}
   */
@@ -9,6 +9,7 @@
   *          executed from internal SRAM
   *            + Stop/Start the flash interface while System Run
   *            + Enable/Disable the flash sleep while System Run
+  *            + Program a buffer without fetching code from the flash
   @verbatim
   ==============================================================================
                     ##### APIs executed from Internal RAM #####
@@ -77,10 +78,16 @@
 
 #ifdef HAL_FLASH_MODULE_ENABLED
 
-#if defined(STM32F411xE) || defined(STM32F446xx)
-
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @defgroup FLASHRAMFUNC_Private_Constants FLASH RAMFUNC Private Constants
+  * @{
+  */
+#define FLASH_RAMFUNC_TIMEOUT_VALUE  ((uint32_t)0x00100000) /* Busy flag polling loops for one write */
+#define FLASH_RAMFUNC_ERROR_FLAGS    (FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR)
+/**
+  * @}
+  */
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
@@ -105,6 +112,7 @@
   * @{
   */
 
+#if defined(STM32F411xE) || defined(STM32F446xx)
 /**
   * @brief Stop the flash interface while System Run
   * @note  This mode is only available for STM32F411xx devices. 
@@ -172,6 +180,143 @@ __RAM_FUNC HAL_FLASHEx_DisableFlashSleepMode(void)
   
   return HAL_OK;
 }
+#endif /* STM32F411xE || STM32F446xx */
+
+/**
+  * @}
+  */
+
+/** @defgroup FLASHRAMFUNC_Exported_Functions_Group2 Programming functions executed from internal RAM 
+  *  @brief Programming functions executed from internal RAM 
+  *
+@verbatim   
+
+ ===============================================================================
+                      ##### ramfunc programming functions #####
+ ===============================================================================  
+    [..]
+    This subsection provides a buffer programming function which does not fetch
+    any code nor constant from the flash while the flash is busy:
+      (+) On dual bank devices (STM32F42xxx/STM32F43xxx), the application code
+          located in the other bank keeps running (interrupt handlers, DMA
+          services) while a sector is programmed.
+      (+) The parallelism is set once for the whole buffer and the busy flag is
+          polled without the HAL_GetTick() calls of HAL_FLASH_Program().
+    [..]
+    The flash must be unlocked and the programmed area erased. Interrupts are
+    not masked: a handler located in the bank being programmed stalls until the
+    current write is completed.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Program a buffer in flash with the parallelism of the device voltage range.
+  * @param  VoltageRange: The device voltage range which defines the programming parallelism.
+  *          This parameter can be one of the following values:
+  *            @arg FLASH_VOLTAGE_RANGE_1: 1.8V to 2.1V, the buffer is programmed by byte
+  *            @arg FLASH_VOLTAGE_RANGE_2: 2.1V to 2.7V, the buffer is programmed by half word
+  *            @arg FLASH_VOLTAGE_RANGE_3: 2.7V to 3.6V, the buffer is programmed by word
+  *            @arg FLASH_VOLTAGE_RANGE_4: 2.7V to 3.6V + External Vpp, the buffer is
+  *                                        programmed by double word
+  * @param  Address: Flash address to program, 64-bit aligned with FLASH_VOLTAGE_RANGE_4
+  *         and 32-bit aligned otherwise.
+  * @param  pData: Pointer to the data buffer (32-bit aligned).
+  * @param  Size: Number of bytes to program, multiple of 8 with FLASH_VOLTAGE_RANGE_4
+  *         and multiple of 4 otherwise.
+  * @note   On error the flash status flags are left set for the caller.
+  * @retval HAL status
+  */
+__RAM_FUNC HAL_FLASHEx_ProgramBuffer(uint32_t VoltageRange, uint32_t Address, uint32_t *pData, uint32_t Size)
+{
+  uint8_t *pbuffer = (uint8_t *)pData;
+  uint32_t timeout = FLASH_RAMFUNC_TIMEOUT_VALUE;
+  uint32_t step = 0;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Wait for the end of a previous operation */
+  while(((FLASH->SR & FLASH_FLAG_BSY) != 0) && (timeout != 0))
+  {
+    timeout--;
+  }
+  if(timeout == 0)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* Select the parallelism once for the whole buffer */
+  FLASH->CR &= CR_PSIZE_MASK;
+  if(VoltageRange == FLASH_VOLTAGE_RANGE_1)
+  {
+    FLASH->CR |= FLASH_PSIZE_BYTE;
+    step = 1;
+  }
+  else if(VoltageRange == FLASH_VOLTAGE_RANGE_2)
+  {
+    FLASH->CR |= FLASH_PSIZE_HALF_WORD;
+    step = 2;
+  }
+  else if(VoltageRange == FLASH_VOLTAGE_RANGE_3)
+  {
+    FLASH->CR |= FLASH_PSIZE_WORD;
+    step = 4;
+  }
+  else
+  {
+    FLASH->CR |= FLASH_PSIZE_DOUBLE_WORD;
+    step = 8;
+  }
+  FLASH->CR |= FLASH_CR_PG;
+
+  while((Size >= step) && (status == HAL_OK))
+  {
+    if(step == 1)
+    {
+      *(__IO uint8_t*)Address = *pbuffer;
+    }
+    else if(step == 2)
+    {
+      *(__IO uint16_t*)Address = *(uint16_t *)pbuffer;
+    }
+    else if(step == 4)
+    {
+      *(__IO uint32_t*)Address = *(uint32_t *)pbuffer;
+    }
+    else
+    {
+      /* The double word is written as two consecutive words */
+      *(__IO uint32_t*)Address = *(uint32_t *)pbuffer;
+      __ISB();
+      *(__IO uint32_t*)(Address + 4) = *(uint32_t *)(pbuffer + 4);
+    }
+
+    /* Wait for the end of the write */
+    timeout = FLASH_RAMFUNC_TIMEOUT_VALUE;
+    while(((FLASH->SR & FLASH_FLAG_BSY) != 0) && (timeout != 0))
+    {
+      timeout--;
+    }
+
+    if(timeout == 0)
+    {
+      status = HAL_TIMEOUT;
+    }
+    else if((FLASH->SR & FLASH_RAMFUNC_ERROR_FLAGS) != 0)
+    {
+      status = HAL_ERROR;
+    }
+
+    Address += step;
+    pbuffer += step;
+    Size -= step;
+  }
+
+  /* Disable the PG Bit */
+  FLASH->CR &= (~FLASH_CR_PG);
+
+  return status;
+}
 
 /**
   * @}
@@ -181,7 +326,6 @@ __RAM_FUNC HAL_FLASHEx_DisableFlashSleepMode(void)
   * @}
   */
 
-#endif /* STM32F411xE || STM32F446xx */
 #endif /* HAL_FLASH_MODULE_ENABLED */
 /**
   * @}
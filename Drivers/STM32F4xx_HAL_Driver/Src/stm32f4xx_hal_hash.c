@@ -369,6 +369,9 @@ HAL_StatusTypeDef HAL_HASH_Init(HASH_HandleTypeDef *hhash)
   hhash->HashBuffSize = 0;
   hhash->HashITCounter = 0;
   
+  /* No context loaded in the HASH peripheral */
+  hhash->pContext = NULL;
+  
   /* Set the data type */
   HASH->CR |= (uint32_t) (hhash->Init.DataType);
   
@@ -408,6 +411,9 @@ HAL_StatusTypeDef HAL_HASH_DeInit(HASH_HandleTypeDef *hhash)
   hhash->HashBuffSize = 0;
   hhash->HashITCounter = 0;
   
+  /* No context loaded in the HASH peripheral */
+  hhash->pContext = NULL;
+  
   /* DeInit the low level hardware */
   HAL_HASH_MspDeInit(hhash);
   
@@ -9,6 +9,7 @@
   *          functionalities of HASH peripheral:
   *           + Extended HASH processing functions based on SHA224 Algorithm
   *           + Extended HASH processing functions based on SHA256 Algorithm
+  *           + Interleaved SHA224/SHA256 and HMAC digests with context swapping
   *         
   @verbatim
   ==============================================================================
@@ -60,6 +61,26 @@
        After that, call the finish function in order to get the digest value
        e.g. HAL_HASHEx_SHA224_Finish()
     (#)Call HAL_HASH_DeInit() to deinitialize the HASH peripheral.
+    (#)Several SHA224/SHA256 or HMAC digests can be computed in turn with contexts:
+       (##) HAL_HASHEx_ContextInit() prepares a context for an algorithm and,
+            for HMAC, a key which must be kept until the digest is finished.
+       (##) HAL_HASHEx_ContextUpdate() adds data of any length and alignment.
+            When the HASH peripheral holds another context, the latter is saved
+            through the HASH_CSRx registers and the context of the update is
+            restored. Data are written in the peripheral by words, an incomplete
+            word is kept in the context until the next update.
+       (##) HAL_HASHEx_ContextUpdate_DMA() does the same with the input DMA
+            stream, HAL_HASH_InCpltCallback() being called at the end. The words
+            following the bytes which complete the word of a previous update
+            must be word aligned. The multiple DMA transfer mode is used, so
+            that buffers are transferred in place, one after the other.
+       (##) HAL_HASHEx_ContextFinish() writes the last word, computes the digest
+            and reinitializes the context for a new message.
+       (##) A context is computed by software, with the same API, when the
+            first update is called with a NULL handle.
+       (##) HAL_HASHEx_ContextRelease() saves the loaded context, so that the
+            other processing functions can be used. They must not be called
+            while a context is loaded in the HASH peripheral.
 
   @endverbatim
   ******************************************************************************
@@ -110,8 +131,49 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/* Digest engine of a context */
+#define HASH_CONTEXT_ENGINE_NONE     ((uint32_t)0x00000000)  /* No data processed yet      */
+#define HASH_CONTEXT_ENGINE_HW       ((uint32_t)0x00000001)  /* HASH peripheral            */
+#define HASH_CONTEXT_ENGINE_SW       ((uint32_t)0x00000002)  /* Software computation       */
+
+/* Context swap registers holding a digest context in HASH mode */
+#define HASH_CONTEXT_CSR_HASH        ((uint32_t)38)
+
+/* Maximum duration of a block processing before a context swap (ms) */
+#define HASH_CONTEXT_TIMEOUT         ((uint32_t)10)
+
+/* Maximum number of words of a DMA transfer */
+#define HASH_CONTEXT_DMA_MAX_WORDS   ((uint32_t)0xFFFF)
+
 /* Private macro -------------------------------------------------------------*/
+#define HASH_ROTR(__X__, __N__)      (((__X__) >> (__N__)) | ((__X__) << (32 - (__N__))))
+#define HASH_GET_WORD(__P__)         ((uint32_t)(__P__)[0] | ((uint32_t)(__P__)[1] << 8) | \
+                                      ((uint32_t)(__P__)[2] << 16) | ((uint32_t)(__P__)[3] << 24))
+
 /* Private variables ---------------------------------------------------------*/
+/* SHA-256 round constants */
+static const uint32_t HASHEx_SHA256_K[64] =
+{
+  0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+  0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+  0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+  0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+  0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+  0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+  0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+  0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+/* SHA-224 and SHA-256 initial digests */
+static const uint32_t HASHEx_SHA224_H0[8] =
+{
+  0xC1059ED8, 0x367CD507, 0x3070DD17, 0xF70E5939, 0xFFC00B31, 0x68581511, 0x64F98FA7, 0xBEFA4FA4
+};
+static const uint32_t HASHEx_SHA256_H0[8] =
+{
+  0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
 /* Private function prototypes -----------------------------------------------*/
 /** @addtogroup HASHEx_Private_Functions
   * @{
@@ -120,6 +182,21 @@ static void HASHEx_DMAXferCplt(DMA_HandleTypeDef *hdma);
 static void HASHEx_WriteData(uint8_t *pInBuffer, uint32_t Size);
 static void HASHEx_GetDigest(uint8_t *pMsgDigest, uint8_t Size);
 static void HASHEx_DMAError(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef HASHEx_WaitNotBusy(uint32_t Timeout);
+static void HASHEx_Copy(uint8_t *pDst, uint8_t *pSrc, uint32_t Size);
+static void HASHEx_Zero(uint8_t *pDst, uint32_t Size);
+static void HASHEx_WriteBytes(uint8_t *pInBuffer, uint32_t Size);
+static HAL_StatusTypeDef HASHEx_WriteKey(HASH_ContextTypeDef *pContext, uint32_t Timeout);
+static HAL_StatusTypeDef HASHEx_ContextLoad(HASH_HandleTypeDef *hhash, HASH_ContextTypeDef *pContext);
+static HAL_StatusTypeDef HASHEx_ContextSave(HASH_HandleTypeDef *hhash, uint32_t Timeout);
+static void HASHEx_ContextDMAStart(HASH_HandleTypeDef *hhash);
+static void HASHEx_ContextDMAXferCplt(DMA_HandleTypeDef *hdma);
+static void HASHEx_ContextDMAError(DMA_HandleTypeDef *hdma);
+static void HASHEx_SwStart(HASH_ContextTypeDef *pContext);
+static void HASHEx_SwBlock(HASH_ContextTypeDef *pContext, uint8_t *pBlock);
+static void HASHEx_SwUpdate(HASH_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size);
+static void HASHEx_SwFinal(HASH_ContextTypeDef *pContext, uint8_t *pOutBuffer);
+static void HASHEx_SwKeyBlock(HASH_ContextTypeDef *pContext, uint8_t Pad);
 /**
   * @}
   */
@@ -305,6 +382,493 @@ static void HASHEx_DMAError(DMA_HandleTypeDef *hdma)
   HAL_HASH_ErrorCallback(hhash);
 }
 
+/**
+  * @brief  Waits for the end of the processing of a block.
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HASHEx_WaitNotBusy(uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while((HASH->SR & HASH_FLAG_BUSY) == HASH_FLAG_BUSY)
+  {
+    if(Timeout != HAL_MAX_DELAY)
+    {
+      if((Timeout == 0)||((HAL_GetTick() - tickstart ) > Timeout))
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copies bytes.
+  * @param  pDst: Pointer to the destination
+  * @param  pSrc: Pointer to the source
+  * @param  Size: Number of bytes
+  * @retval None
+  */
+static void HASHEx_Copy(uint8_t *pDst, uint8_t *pSrc, uint32_t Size)
+{
+  while(Size-- != 0)
+  {
+    *pDst++ = *pSrc++;
+  }
+}
+
+/**
+  * @brief  Clears bytes.
+  * @param  pDst: Pointer to the destination
+  * @param  Size: Number of bytes
+  * @retval None
+  */
+static void HASHEx_Zero(uint8_t *pDst, uint32_t Size)
+{
+  while(Size-- != 0)
+  {
+    *pDst++ = 0;
+  }
+}
+
+/**
+  * @brief  Writes bytes in data register, the last word being completed with zeros.
+  * @param  pInBuffer: Pointer to input buffer, no alignment required
+  * @param  Size: Number of bytes
+  * @retval None
+  */
+static void HASHEx_WriteBytes(uint8_t *pInBuffer, uint32_t Size)
+{
+  uint32_t nbwords = Size / 4;
+  uint32_t *pwords = (uint32_t *)pInBuffer;
+  uint32_t word = 0;
+
+  if(((uint32_t)pInBuffer & 3) == 0)
+  {
+    while(nbwords-- != 0)
+    {
+      HASH->DIN = *pwords++;
+    }
+    pInBuffer = (uint8_t *)pwords;
+  }
+  else
+  {
+    while(nbwords-- != 0)
+    {
+      HASH->DIN = HASH_GET_WORD(pInBuffer);
+      pInBuffer += 4;
+    }
+  }
+
+  Size &= 3;
+  if(Size != 0)
+  {
+    for(word = 0; Size != 0; Size--)
+    {
+      word |= (uint32_t)pInBuffer[Size - 1] << (8 * (Size - 1));
+    }
+    HASH->DIN = word;
+  }
+}
+
+/**
+  * @brief  Processes the HMAC key of the context loaded in the HASH peripheral.
+  * @param  pContext: Pointer to the context
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HASHEx_WriteKey(HASH_ContextTypeDef *pContext, uint32_t Timeout)
+{
+  __HAL_HASH_SET_NBVALIDBITS(pContext->KeySize);
+  HASHEx_WriteBytes(pContext->pKey, pContext->KeySize);
+  __HAL_HASH_START_DIGEST();
+
+  return HASHEx_WaitNotBusy(Timeout);
+}
+
+/**
+  * @brief  Saves the context loaded in the HASH peripheral.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HASHEx_ContextSave(HASH_HandleTypeDef *hhash, uint32_t Timeout)
+{
+  HASH_ContextTypeDef *pcontext = hhash->pContext;
+  uint32_t index = 0, nbcsr = 0;
+
+  if(pcontext == NULL)
+  {
+    return HAL_OK;
+  }
+
+  /* The context can be saved once the current block is processed */
+  if(HASHEx_WaitNotBusy(Timeout) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  pcontext->Imr = HASH->IMR;
+  pcontext->Str = HASH->STR;
+  pcontext->Cr = HASH->CR;
+
+  nbcsr = (pcontext->AlgoMode == HASH_ALGOMODE_HMAC) ? HASH_CONTEXT_CSR_NUMBER : HASH_CONTEXT_CSR_HASH;
+  for(index = 0; index < nbcsr; index++)
+  {
+    pcontext->Csr[index] = HASH->CSR[index];
+  }
+
+  hhash->pContext = NULL;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Loads a context in the HASH peripheral, the context already loaded
+  *         being saved first.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure
+  * @param  pContext: Pointer to the context
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HASHEx_ContextLoad(HASH_HandleTypeDef *hhash, HASH_ContextTypeDef *pContext)
+{
+  uint32_t index = 0, nbcsr = 0;
+
+  if(hhash->pContext == pContext)
+  {
+    return HAL_OK;
+  }
+
+  if(HASHEx_ContextSave(hhash, HASH_CONTEXT_TIMEOUT) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* The legacy processing functions restart from the initialization phase */
+  hhash->Phase = HAL_HASH_PHASE_READY;
+
+  if(pContext->Engine == HASH_CONTEXT_ENGINE_HW)
+  {
+    /* Restore the registers then initialize the core before the swap registers */
+    HASH->IMR = pContext->Imr;
+    HASH->STR = pContext->Str;
+    HASH->CR = pContext->Cr;
+    HASH->CR |= HASH_CR_INIT;
+
+    nbcsr = (pContext->AlgoMode == HASH_ALGOMODE_HMAC) ? HASH_CONTEXT_CSR_NUMBER : HASH_CONTEXT_CSR_HASH;
+    for(index = 0; index < nbcsr; index++)
+    {
+      HASH->CSR[index] = pContext->Csr[index];
+    }
+  }
+  else
+  {
+    /* New message: 8-bit data so that the bytes are processed in memory order */
+    HASH->IMR = 0;
+    HASH->STR = 0;
+    if((pContext->AlgoMode == HASH_ALGOMODE_HMAC) && (pContext->KeySize > 64))
+    {
+      HASH->CR = pContext->Algorithm | HASH_ALGOMODE_HMAC | HASH_HMAC_KEYTYPE_LONGKEY | HASH_DATATYPE_8B | HASH_CR_INIT;
+    }
+    else
+    {
+      HASH->CR = pContext->Algorithm | pContext->AlgoMode | HASH_DATATYPE_8B | HASH_CR_INIT;
+    }
+
+    pContext->Engine = HASH_CONTEXT_ENGINE_HW;
+
+    /* The inner HMAC key is processed first */
+    if(pContext->AlgoMode == HASH_ALGOMODE_HMAC)
+    {
+      if(HASHEx_WriteKey(pContext, HASH_CONTEXT_TIMEOUT) != HAL_OK)
+      {
+        return HAL_TIMEOUT;
+      }
+      __HAL_HASH_SET_NBVALIDBITS(0);
+    }
+  }
+
+  hhash->pContext = pContext;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Starts the next DMA transfer of a context update.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure
+  * @retval None
+  */
+static void HASHEx_ContextDMAStart(HASH_HandleTypeDef *hhash)
+{
+  hhash->HashInCount = (hhash->HashBuffSize < HASH_CONTEXT_DMA_MAX_WORDS) ? hhash->HashBuffSize : HASH_CONTEXT_DMA_MAX_WORDS;
+
+  HAL_DMA_Start_IT(hhash->hdmain, (uint32_t)hhash->pHashInBuffPtr, (uint32_t)&HASH->DIN, hhash->HashInCount);
+
+  /* Enable DMA requests, the digest calculation is not started at the end of the transfer */
+  HASH->CR |= (HASH_CR_MDMAT | HASH_CR_DMAE);
+}
+
+/**
+  * @brief  DMA context update complete callback.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void HASHEx_ContextDMAXferCplt(DMA_HandleTypeDef *hdma)
+{
+  HASH_HandleTypeDef* hhash = ( HASH_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  /* Disable the DMA transfer */
+  HASH->CR &= (uint32_t)(~HASH_CR_DMAE);
+
+  hhash->pHashInBuffPtr += hhash->HashInCount * 4;
+  hhash->HashBuffSize -= hhash->HashInCount;
+
+  if(hhash->HashBuffSize != 0)
+  {
+    HASHEx_ContextDMAStart(hhash);
+    return;
+  }
+
+  HASH->CR &= (uint32_t)(~HASH_CR_MDMAT);
+
+  /* Change HASH peripheral state */
+  hhash->State = HAL_HASH_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhash);
+
+  /* Call Input data transfer complete callback */
+  HAL_HASH_InCpltCallback(hhash);
+}
+
+/**
+  * @brief  DMA context update error callback.
+  * @note   A FIFO error does not stop the transfer and is ignored. Otherwise
+  *         the loaded context is lost.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void HASHEx_ContextDMAError(DMA_HandleTypeDef *hdma)
+{
+  HASH_HandleTypeDef* hhash = ( HASH_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  if((hdma->Instance->CR & DMA_SxCR_EN) != 0)
+  {
+    return;
+  }
+
+  HASH->CR &= (uint32_t)(~(HASH_CR_DMAE | HASH_CR_MDMAT));
+
+  hhash->pContext = NULL;
+  hhash->State = HAL_HASH_STATE_ERROR;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhash);
+
+  HAL_HASH_ErrorCallback(hhash);
+}
+
+/**
+  * @brief  Starts a software digest computation.
+  * @param  pContext: Pointer to the context
+  * @retval None
+  */
+static void HASHEx_SwStart(HASH_ContextTypeDef *pContext)
+{
+  uint32_t index = 0;
+  const uint32_t *ph0 = (pContext->Algorithm == HASH_ALGOSELECTION_SHA224) ? HASHEx_SHA224_H0 : HASHEx_SHA256_H0;
+
+  for(index = 0; index < 8; index++)
+  {
+    pContext->Digest[index] = ph0[index];
+  }
+  pContext->Length = 0;
+  pContext->NbBuffer = 0;
+}
+
+/**
+  * @brief  Processes a 64-byte block by software.
+  * @param  pContext: Pointer to the context
+  * @param  pBlock: Pointer to the block, no alignment required
+  * @retval None
+  */
+static void HASHEx_SwBlock(HASH_ContextTypeDef *pContext, uint8_t *pBlock)
+{
+  uint32_t w[64];
+  uint32_t a, b, c, d, e, f, g, h, t1, t2;
+  uint32_t index = 0;
+
+  for(index = 0; index < 16; index++)
+  {
+    w[index] = ((uint32_t)pBlock[0] << 24) | ((uint32_t)pBlock[1] << 16) | ((uint32_t)pBlock[2] << 8) | pBlock[3];
+    pBlock += 4;
+  }
+  for(index = 16; index < 64; index++)
+  {
+    t1 = w[index - 2];
+    t2 = w[index - 15];
+    w[index] = (HASH_ROTR(t1, 17) ^ HASH_ROTR(t1, 19) ^ (t1 >> 10)) + w[index - 7] +
+               (HASH_ROTR(t2, 7) ^ HASH_ROTR(t2, 18) ^ (t2 >> 3)) + w[index - 16];
+  }
+
+  a = pContext->Digest[0];
+  b = pContext->Digest[1];
+  c = pContext->Digest[2];
+  d = pContext->Digest[3];
+  e = pContext->Digest[4];
+  f = pContext->Digest[5];
+  g = pContext->Digest[6];
+  h = pContext->Digest[7];
+
+  for(index = 0; index < 64; index++)
+  {
+    t1 = h + (HASH_ROTR(e, 6) ^ HASH_ROTR(e, 11) ^ HASH_ROTR(e, 25)) + ((e & f) ^ (~e & g)) +
+         HASHEx_SHA256_K[index] + w[index];
+    t2 = (HASH_ROTR(a, 2) ^ HASH_ROTR(a, 13) ^ HASH_ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+
+  pContext->Digest[0] += a;
+  pContext->Digest[1] += b;
+  pContext->Digest[2] += c;
+  pContext->Digest[3] += d;
+  pContext->Digest[4] += e;
+  pContext->Digest[5] += f;
+  pContext->Digest[6] += g;
+  pContext->Digest[7] += h;
+}
+
+/**
+  * @brief  Adds data to a software digest computation.
+  * @param  pContext: Pointer to the context
+  * @param  pInBuffer: Pointer to the data
+  * @param  Size: Number of bytes
+  * @retval None
+  */
+static void HASHEx_SwUpdate(HASH_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size)
+{
+  uint32_t nbbytes = 0;
+
+  pContext->Length += Size;
+
+  if(pContext->NbBuffer != 0)
+  {
+    nbbytes = HASH_CONTEXT_BLOCK_SIZE - pContext->NbBuffer;
+    if(nbbytes > Size)
+    {
+      nbbytes = Size;
+    }
+    HASHEx_Copy(&pContext->Buffer[pContext->NbBuffer], pInBuffer, nbbytes);
+    pContext->NbBuffer += nbbytes;
+    pInBuffer += nbbytes;
+    Size -= nbbytes;
+
+    if(pContext->NbBuffer < HASH_CONTEXT_BLOCK_SIZE)
+    {
+      return;
+    }
+    HASHEx_SwBlock(pContext, pContext->Buffer);
+    pContext->NbBuffer = 0;
+  }
+
+  while(Size >= HASH_CONTEXT_BLOCK_SIZE)
+  {
+    HASHEx_SwBlock(pContext, pInBuffer);
+    pInBuffer += HASH_CONTEXT_BLOCK_SIZE;
+    Size -= HASH_CONTEXT_BLOCK_SIZE;
+  }
+
+  HASHEx_Copy(pContext->Buffer, pInBuffer, Size);
+  pContext->NbBuffer = Size;
+}
+
+/**
+  * @brief  Pads the message and provides the digest of a software computation.
+  * @param  pContext: Pointer to the context
+  * @param  pOutBuffer: Pointer to the digest, 28 or 32 bytes
+  * @retval None
+  */
+static void HASHEx_SwFinal(HASH_ContextTypeDef *pContext, uint8_t *pOutBuffer)
+{
+  uint32_t index = 0, nbwords = 0;
+  uint32_t length = pContext->Length;
+
+  pContext->Buffer[pContext->NbBuffer++] = 0x80;
+  if(pContext->NbBuffer > (HASH_CONTEXT_BLOCK_SIZE - 8))
+  {
+    HASHEx_Zero(&pContext->Buffer[pContext->NbBuffer], HASH_CONTEXT_BLOCK_SIZE - pContext->NbBuffer);
+    HASHEx_SwBlock(pContext, pContext->Buffer);
+    pContext->NbBuffer = 0;
+  }
+  HASHEx_Zero(&pContext->Buffer[pContext->NbBuffer], HASH_CONTEXT_BLOCK_SIZE - 8 - pContext->NbBuffer);
+
+  /* Message length in bits, big endian */
+  pContext->Buffer[56] = 0;
+  pContext->Buffer[57] = 0;
+  pContext->Buffer[58] = 0;
+  pContext->Buffer[59] = (uint8_t)(length >> 29);
+  pContext->Buffer[60] = (uint8_t)(length >> 21);
+  pContext->Buffer[61] = (uint8_t)(length >> 13);
+  pContext->Buffer[62] = (uint8_t)(length >> 5);
+  pContext->Buffer[63] = (uint8_t)(length << 3);
+  HASHEx_SwBlock(pContext, pContext->Buffer);
+  pContext->NbBuffer = 0;
+
+  nbwords = (pContext->Algorithm == HASH_ALGOSELECTION_SHA224) ? 7 : 8;
+  for(index = 0; index < nbwords; index++)
+  {
+    *pOutBuffer++ = (uint8_t)(pContext->Digest[index] >> 24);
+    *pOutBuffer++ = (uint8_t)(pContext->Digest[index] >> 16);
+    *pOutBuffer++ = (uint8_t)(pContext->Digest[index] >> 8);
+    *pOutBuffer++ = (uint8_t)(pContext->Digest[index]);
+  }
+}
+
+/**
+  * @brief  Starts a software digest computation with the HMAC key XORed with
+  *         the inner or outer pad.
+  * @param  pContext: Pointer to the context
+  * @param  Pad: 0x36 for the inner digest, 0x5C for the outer digest
+  * @retval None
+  */
+static void HASHEx_SwKeyBlock(HASH_ContextTypeDef *pContext, uint8_t Pad)
+{
+  uint8_t block[HASH_CONTEXT_BLOCK_SIZE];
+  uint32_t index = 0, keysize = pContext->KeySize;
+
+  HASHEx_Zero(block, sizeof(block));
+
+  /* A key longer than a block is replaced by its digest */
+  if(keysize > HASH_CONTEXT_BLOCK_SIZE)
+  {
+    HASHEx_SwStart(pContext);
+    HASHEx_SwUpdate(pContext, pContext->pKey, keysize);
+    HASHEx_SwFinal(pContext, block);
+  }
+  else
+  {
+    HASHEx_Copy(block, pContext->pKey, keysize);
+  }
+
+  for(index = 0; index < HASH_CONTEXT_BLOCK_SIZE; index++)
+  {
+    block[index] ^= Pad;
+  }
+
+  HASHEx_SwStart(pContext);
+  HASHEx_SwUpdate(pContext, block, HASH_CONTEXT_BLOCK_SIZE);
+}
+
  /**
   * @}
   */
@@ -1604,6 +2168,394 @@ HAL_StatusTypeDef HAL_HMACEx_SHA256_Start_DMA(HASH_HandleTypeDef *hhash, uint8_t
   return HAL_OK;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup HASHEx_Group6 Multi-context processing functions
+ *  @brief   Interleaved SHA224/SHA256 and HMAC digests. 
+ *
+@verbatim   
+ ===============================================================================
+              ##### Multi-context processing functions #####
+ ===============================================================================  
+    [..]  This section provides functions allowing to compute several SHA224,
+          SHA256, HMAC SHA224 or HMAC SHA256 digests in turn, each digest being
+          held in a context:
+      (+) Initialize a context
+      (+) Add data to a context in polling mode or with DMA
+      (+) Get the digest of a context
+      (+) Save the loaded context to use the other processing functions
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes a digest context.
+  * @param  pContext: Pointer to the context
+  * @param  Algorithm: HASH_ALGOSELECTION_SHA224 or HASH_ALGOSELECTION_SHA256
+  * @param  pKey: Pointer to the HMAC key, NULL for a plain digest. The key is
+  *         not copied and must be kept until HAL_HASHEx_ContextFinish().
+  * @param  KeySize: Size of the HMAC key in bytes
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASHEx_ContextInit(HASH_ContextTypeDef *pContext, uint32_t Algorithm, uint8_t *pKey, uint32_t KeySize)
+{
+  if((pContext == NULL) || !IS_HASH_CONTEXT_ALGOSELECTION(Algorithm) || ((pKey == NULL) && (KeySize != 0)))
+  {
+    return HAL_ERROR;
+  }
+
+  pContext->Algorithm = Algorithm;
+  pContext->AlgoMode = (pKey != NULL) ? HASH_ALGOMODE_HMAC : HASH_ALGOMODE_HASH;
+  pContext->pKey = pKey;
+  pContext->KeySize = KeySize;
+  pContext->Engine = HASH_CONTEXT_ENGINE_NONE;
+  pContext->NbBuffer = 0;
+  pContext->Length = 0;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Adds data to a digest context.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure, or NULL to compute
+  *         the digest by software. A context keeps the engine of its first update.
+  * @param  pContext: Pointer to the context
+  * @param  pInBuffer: Pointer to the data, no alignment required
+  * @param  Size: Number of bytes
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASHEx_ContextUpdate(HASH_HandleTypeDef *hhash, HASH_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size)
+{
+  uint32_t nbbytes = 0;
+
+  if((pContext == NULL) || ((pInBuffer == NULL) && (Size != 0)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Software computation */
+  if(hhash == NULL)
+  {
+    if(pContext->Engine == HASH_CONTEXT_ENGINE_HW)
+    {
+      return HAL_ERROR;
+    }
+    if(pContext->Engine == HASH_CONTEXT_ENGINE_NONE)
+    {
+      if(pContext->AlgoMode == HASH_ALGOMODE_HMAC)
+      {
+        HASHEx_SwKeyBlock(pContext, 0x36);
+      }
+      else
+      {
+        HASHEx_SwStart(pContext);
+      }
+      pContext->Engine = HASH_CONTEXT_ENGINE_SW;
+    }
+    HASHEx_SwUpdate(pContext, pInBuffer, Size);
+    return HAL_OK;
+  }
+
+  if(pContext->Engine == HASH_CONTEXT_ENGINE_SW)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_BUSY;
+
+  if(HASHEx_ContextLoad(hhash, pContext) != HAL_OK)
+  {
+    hhash->State = HAL_HASH_STATE_TIMEOUT;
+    __HAL_UNLOCK(hhash);
+    return HAL_TIMEOUT;
+  }
+
+  /* Complete the word started by the previous update */
+  if(pContext->NbBuffer != 0)
+  {
+    nbbytes = 4 - pContext->NbBuffer;
+    if(nbbytes > Size)
+    {
+      nbbytes = Size;
+    }
+    HASHEx_Copy(&pContext->Buffer[pContext->NbBuffer], pInBuffer, nbbytes);
+    pContext->NbBuffer += nbbytes;
+    pInBuffer += nbbytes;
+    Size -= nbbytes;
+
+    if(pContext->NbBuffer == 4)
+    {
+      HASHEx_WriteBytes(pContext->Buffer, 4);
+      pContext->NbBuffer = 0;
+    }
+  }
+
+  /* Whole words are written, the incomplete one is kept */
+  HASHEx_WriteBytes(pInBuffer, Size & ~3U);
+  HASHEx_Copy(&pContext->Buffer[pContext->NbBuffer], pInBuffer + (Size & ~3U), Size & 3);
+  pContext->NbBuffer += Size & 3;
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhash);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Adds data to a digest context with the input DMA stream.
+  *         HAL_HASH_InCpltCallback() is called at the end of the transfer.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure that contains
+  *         the configuration information for HASH module
+  * @param  pContext: Pointer to the context
+  * @param  pInBuffer: Pointer to the data. The words following the bytes which
+  *         complete the word of a previous update must be word aligned.
+  * @param  Size: Number of bytes
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASHEx_ContextUpdate_DMA(HASH_HandleTypeDef *hhash, HASH_ContextTypeDef *pContext, uint8_t *pInBuffer, uint32_t Size)
+{
+  uint32_t head = 0, nbwords = 0;
+
+  if((hhash == NULL) || (hhash->hdmain == NULL) || (pContext == NULL) || ((pInBuffer == NULL) && (Size != 0)) ||
+     (pContext->Engine == HASH_CONTEXT_ENGINE_SW))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Bytes completing the word started by the previous update */
+  head = (4 - pContext->NbBuffer) & 3;
+  if(head > Size)
+  {
+    head = Size;
+  }
+  nbwords = (Size - head) / 4;
+
+  if((nbwords != 0) && ((((uint32_t)pInBuffer + head) & 3) != 0))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_BUSY;
+
+  if(HASHEx_ContextLoad(hhash, pContext) != HAL_OK)
+  {
+    hhash->State = HAL_HASH_STATE_TIMEOUT;
+    __HAL_UNLOCK(hhash);
+    return HAL_TIMEOUT;
+  }
+
+  if(head != 0)
+  {
+    HASHEx_Copy(&pContext->Buffer[pContext->NbBuffer], pInBuffer, head);
+    pContext->NbBuffer += head;
+    pInBuffer += head;
+    Size -= head;
+
+    if(pContext->NbBuffer == 4)
+    {
+      HASHEx_WriteBytes(pContext->Buffer, 4);
+      pContext->NbBuffer = 0;
+    }
+  }
+
+  /* The incomplete word follows the transferred words: keep it now */
+  HASHEx_Copy(&pContext->Buffer[pContext->NbBuffer], pInBuffer + (nbwords * 4), Size & 3);
+  pContext->NbBuffer += Size & 3;
+
+  if(nbwords == 0)
+  {
+    hhash->State = HAL_HASH_STATE_READY;
+    __HAL_UNLOCK(hhash);
+    HAL_HASH_InCpltCallback(hhash);
+    return HAL_OK;
+  }
+
+  /* Save buffer pointer and number of words in handle */
+  hhash->pHashInBuffPtr = pInBuffer;
+  hhash->HashBuffSize = nbwords;
+
+  /* Set the HASH DMA transfer complete and error callbacks */
+  hhash->hdmain->Parent = hhash;
+  hhash->hdmain->XferCpltCallback = HASHEx_ContextDMAXferCplt;
+  hhash->hdmain->XferErrorCallback = HASHEx_ContextDMAError;
+
+  /* The handle stays locked until the end of the transfer */
+  HASHEx_ContextDMAStart(hhash);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Provides the digest of a context, then reinitializes the context
+  *         for a new message with the same algorithm and key.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure, NULL for a context
+  *         computed by software
+  * @param  pContext: Pointer to the context
+  * @param  pOutBuffer: Pointer to the computed digest. Its size must be 28 bytes
+  *         for SHA224 and 32 bytes for SHA256.
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASHEx_ContextFinish(HASH_HandleTypeDef *hhash, HASH_ContextTypeDef *pContext, uint8_t *pOutBuffer, uint32_t Timeout)
+{
+  uint8_t digest[32];
+  uint32_t index = 0, nbwords = 0, tickstart = 0;
+
+  if((pContext == NULL) || (pOutBuffer == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  nbwords = (pContext->Algorithm == HASH_ALGOSELECTION_SHA224) ? 7 : 8;
+
+  /* Software computation, also used for an empty message without handle */
+  if((hhash == NULL) || (pContext->Engine == HASH_CONTEXT_ENGINE_SW))
+  {
+    if(pContext->Engine == HASH_CONTEXT_ENGINE_HW)
+    {
+      return HAL_ERROR;
+    }
+    if(pContext->Engine == HASH_CONTEXT_ENGINE_NONE)
+    {
+      HAL_HASHEx_ContextUpdate(NULL, pContext, NULL, 0);
+    }
+    HASHEx_SwFinal(pContext, pOutBuffer);
+
+    if(pContext->AlgoMode == HASH_ALGOMODE_HMAC)
+    {
+      HASHEx_Copy(digest, pOutBuffer, nbwords * 4);
+      HASHEx_SwKeyBlock(pContext, 0x5C);
+      HASHEx_SwUpdate(pContext, digest, nbwords * 4);
+      HASHEx_SwFinal(pContext, pOutBuffer);
+    }
+
+    pContext->Engine = HASH_CONTEXT_ENGINE_NONE;
+    return HAL_OK;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_BUSY;
+
+  if(HASHEx_ContextLoad(hhash, pContext) != HAL_OK)
+  {
+    hhash->State = HAL_HASH_STATE_TIMEOUT;
+    __HAL_UNLOCK(hhash);
+    return HAL_TIMEOUT;
+  }
+
+  /* Last word of the message and digest calculation */
+  __HAL_HASH_SET_NBVALIDBITS(pContext->NbBuffer);
+  HASHEx_WriteBytes(pContext->Buffer, pContext->NbBuffer);
+  __HAL_HASH_START_DIGEST();
+
+  /* The outer HMAC key is processed after the message */
+  if(pContext->AlgoMode == HASH_ALGOMODE_HMAC)
+  {
+    if((HASHEx_WaitNotBusy(Timeout) != HAL_OK) || (HASHEx_WriteKey(pContext, Timeout) != HAL_OK))
+    {
+      hhash->pContext = NULL;
+      pContext->Engine = HASH_CONTEXT_ENGINE_NONE;
+      hhash->State = HAL_HASH_STATE_TIMEOUT;
+      __HAL_UNLOCK(hhash);
+      return HAL_TIMEOUT;
+    }
+  }
+
+  /* Get tick */
+  tickstart = HAL_GetTick();
+
+  while(HAL_IS_BIT_CLR(HASH->SR, HASH_FLAG_DCIS))
+  {
+    /* Check for the Timeout */
+    if(Timeout != HAL_MAX_DELAY)
+    {
+      if((Timeout == 0)||((HAL_GetTick() - tickstart ) > Timeout))
+      {
+        hhash->pContext = NULL;
+        pContext->Engine = HASH_CONTEXT_ENGINE_NONE;
+
+        /* Change state */
+        hhash->State = HAL_HASH_STATE_TIMEOUT;
+        
+        /* Process Unlocked */          
+        __HAL_UNLOCK(hhash);
+        
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
+  /* Read the message digest */
+  for(index = 0; index < nbwords; index++)
+  {
+    tickstart = (index < 5) ? HASH->HR[index] : HASH_DIGEST->HR[index];
+    *pOutBuffer++ = (uint8_t)(tickstart >> 24);
+    *pOutBuffer++ = (uint8_t)(tickstart >> 16);
+    *pOutBuffer++ = (uint8_t)(tickstart >> 8);
+    *pOutBuffer++ = (uint8_t)(tickstart);
+  }
+
+  /* The context is ready for a new message, the peripheral is free */
+  hhash->pContext = NULL;
+  pContext->Engine = HASH_CONTEXT_ENGINE_NONE;
+  pContext->NbBuffer = 0;
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhash);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Saves the context loaded in the HASH peripheral, so that the other
+  *         processing functions can be used. The context is restored by its
+  *         next update.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure that contains
+  *         the configuration information for HASH module
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASHEx_ContextRelease(HASH_HandleTypeDef *hhash, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  status = HASHEx_ContextSave(hhash, Timeout);
+
+  /* The legacy processing functions restart from the initialization phase */
+  hhash->Phase = HAL_HASH_PHASE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhash);
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -132,6 +132,42 @@
       (+) In case of transfer Error, HAL_I2C_ErrorCallback() function is executed and user can
            add his own code by customization of function pointer HAL_I2C_ErrorCallback
 
+    *** DMA mode transaction queue ***
+    ==================================
+    [..]
+      (+) Several master transfers, possibly for different devices, can be chained without
+          waiting for each other with HAL_I2C_Queue_DMA(). Each call links a caller owned
+          I2C_TransactionTypeDef (write, read, memory write or memory read) at the end of the
+          queue; the transaction must stay valid until its XferCpltCallback has been called.
+      (+) The queued transactions are performed one after the other without waiting on any
+          flag: the start conditions, address and memory address phases are driven by the
+          I2C event interrupt and the data are moved by DMA. HAL_I2C_EV_IRQHandler(),
+          HAL_I2C_ER_IRQHandler() and HAL_DMA_IRQHandler() of both streams must be called
+          from the corresponding interrupts. The next transaction is started from the end
+          of the previous one, then the XferCpltCallback of the finished transaction is
+          executed with its ErrorCode set. The start is not waited for while the bus is
+          still busy with the stop condition of the previous transfer: it is then deferred
+          to the next HAL_I2C_Queue_DMA() or HAL_I2C_QueuePollHandler() call, so the
+          application should call HAL_I2C_QueuePollHandler() periodically. HAL_I2C_MasterTxCpltCallback(),
+          HAL_I2C_MemTxCpltCallback(), ... and HAL_I2C_ErrorCallback() are not called for
+          queued transactions. Only the 7-bit addressing mode is supported.
+      (+) A write with a non zero PollTrials is completed only once the device acknowledges
+          its address again (e.g. EEPROM internal write cycle). Instead of spinning, the
+          acknowledge polling is done by HAL_I2C_QueuePollHandler() that the application
+          calls periodically, typically from a timer: each call starts one address probe and
+          decrements PollTrials when it is not acknowledged, the transaction fails with
+          HAL_I2C_ERROR_TIMEOUT when it reaches zero. Transactions for other devices keep
+          flowing meanwhile; a single write can wait for its acknowledge at a time.
+          HAL_I2C_QueuePollHandler() also ends with HAL_I2C_ERROR_TIMEOUT a transaction whose
+          addressing does not progress.
+      (+) HAL_I2C_QueueAbort() removes a transaction from the queue, stopping it if it owns
+          the bus; its XferCpltCallback is not called.
+      (+) Blocking, IT and DMA APIs called directly on the same handle return HAL_BUSY while a
+          queued transaction owns the bus. Conversely the queue waits while such a transfer
+          is in progress and is restarted by the next HAL_I2C_Queue_DMA() or
+          HAL_I2C_QueuePollHandler() call.
+      (@) HAL_I2C_Init() and HAL_I2C_DeInit() empty the queue.
+
 
      *** I2C HAL driver macros list ***
      ==================================
@@ -201,11 +237,33 @@
   */    
 #define I2C_TIMEOUT_FLAG          ((uint32_t)35)     /* 35 ms */
 #define I2C_TIMEOUT_ADDR_SLAVE    ((uint32_t)10000)  /* 10 s  */
+
+/* Steps of the queued transaction owning the bus */
+#define I2C_QUEUE_PHASE_IDLE        ((uint32_t)0x00000000)  /* No queued transfer              */
+#define I2C_QUEUE_PHASE_START       ((uint32_t)0x00000001)  /* Start condition requested       */
+#define I2C_QUEUE_PHASE_ADDR        ((uint32_t)0x00000002)  /* Address sent for writing        */
+#define I2C_QUEUE_PHASE_MEMADD_MSB  ((uint32_t)0x00000003)  /* MSB of the memory address sent  */
+#define I2C_QUEUE_PHASE_MEMADD      ((uint32_t)0x00000004)  /* Last memory address byte sent   */
+#define I2C_QUEUE_PHASE_RESTART     ((uint32_t)0x00000005)  /* Repeated start requested        */
+#define I2C_QUEUE_PHASE_READADDR    ((uint32_t)0x00000006)  /* Address sent for reading        */
+#define I2C_QUEUE_PHASE_DATA        ((uint32_t)0x00000007)  /* Data moved by DMA               */
+#define I2C_QUEUE_PHASE_LAST        ((uint32_t)0x00000008)  /* Last byte written, BTF awaited  */
+#define I2C_QUEUE_PHASE_WAIT        ((uint32_t)0x00000009)  /* Start deferred, bus busy        */
 /**
   * @}
   */
 
 /* Private macro -------------------------------------------------------------*/
+/* Queued write that is completed by acknowledge polling */
+#define I2C_QUEUE_POLLED(__TRANS__) ((((__TRANS__)->Type == I2C_TRANSACTION_WRITE) || \
+                                      ((__TRANS__)->Type == I2C_TRANSACTION_MEM_WRITE)) && \
+                                     ((__TRANS__)->PollTrials != 0))
+
+/* DMA handle used by a queued transaction */
+#define I2C_QUEUE_HDMA(__HANDLE__, __TRANS__) ((((__TRANS__)->Type == I2C_TRANSACTION_READ) || \
+                                                ((__TRANS__)->Type == I2C_TRANSACTION_MEM_READ)) ? \
+                                               (__HANDLE__)->hdmarx : (__HANDLE__)->hdmatx)
+
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 /** @addtogroup I2C_Private_Functions
@@ -219,6 +277,17 @@ static void I2C_DMAMemTransmitCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMAMemReceiveCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMAError(DMA_HandleTypeDef *hdma);
 
+static void I2C_DMAQueueCplt(DMA_HandleTypeDef *hdma);
+static void I2C_DMAQueueError(DMA_HandleTypeDef *hdma);
+
+static void I2C_QueueStart(I2C_HandleTypeDef *hi2c);
+static void I2C_QueueLaunch(I2C_HandleTypeDef *hi2c, I2C_TransactionTypeDef *pTrans);
+static void I2C_QueueEV(I2C_HandleTypeDef *hi2c);
+static void I2C_QueueStop(I2C_HandleTypeDef *hi2c, I2C_TransactionTypeDef *pTrans);
+static void I2C_QueueCplt(I2C_HandleTypeDef *hi2c);
+static I2C_TransactionTypeDef *I2C_QueueSelect(I2C_HandleTypeDef *hi2c);
+static void I2C_QueueReset(I2C_HandleTypeDef *hi2c);
+
 static HAL_StatusTypeDef I2C_MasterRequestWrite(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Timeout);
 static HAL_StatusTypeDef I2C_MasterRequestRead(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Timeout);
 static HAL_StatusTypeDef I2C_RequestMemoryWrite(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint32_t Timeout);
@@ -353,6 +422,9 @@ HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
   /* Enable the selected I2C peripheral */
   __HAL_I2C_ENABLE(hi2c);
 
+  /* No transaction queued */
+  I2C_QueueReset(hi2c);
+
   hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
   hi2c->State = HAL_I2C_STATE_READY;
 
@@ -384,6 +456,9 @@ HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c)
   /* DeInit the low level hardware: GPIO, CLOCK, NVIC */
   HAL_I2C_MspDeInit(hi2c);
 
+  /* Forget the transactions still queued */
+  I2C_QueueReset(hi2c);
+
   hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
 
   hi2c->State = HAL_I2C_STATE_RESET;
@@ -469,6 +544,9 @@ HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c)
         (++) HAL_I2C_Slave_Receive_DMA()
         (++) HAL_I2C_Mem_Write_DMA()
         (++) HAL_I2C_Mem_Read_DMA()
+        (++) HAL_I2C_Queue_DMA()
+        (++) HAL_I2C_QueuePollHandler()
+        (++) HAL_I2C_QueueAbort()
 
     (#) A set of Transfer Complete Callbacks are provided in non Blocking mode:
         (++) HAL_I2C_MemTxCpltCallback()
@@ -2199,6 +2277,199 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddr
   }
 }
 
+/**
+  * @brief  Queues a master transaction, started with DMA as soon as the bus is free.
+  * @note   The transaction is owned by the driver until its XferCpltCallback is called.
+  * @param  hi2c: pointer to a I2C_HandleTypeDef structure that contains
+  *         the configuration information for I2C module
+  * @param  pTrans: Pointer to the transaction to queue
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2C_Queue_DMA(I2C_HandleTypeDef *hi2c, I2C_TransactionTypeDef *pTrans)
+{
+  uint32_t primask = 0;
+
+  /* Check the parameters */
+  assert_param(IS_I2C_TRANSACTION_TYPE(pTrans->Type));
+
+  if((pTrans->Type == I2C_TRANSACTION_MEM_WRITE) || (pTrans->Type == I2C_TRANSACTION_MEM_READ))
+  {
+    assert_param(IS_I2C_MEMADD_SIZE(pTrans->MemAddSize));
+  }
+
+  if((hi2c->State == HAL_I2C_STATE_RESET) || (I2C_QUEUE_HDMA(hi2c, pTrans) == NULL) ||
+     (hi2c->Init.AddressingMode != I2C_ADDRESSINGMODE_7BIT))
+  {
+    return HAL_ERROR;
+  }
+
+  if((pTrans->pData == NULL) || (pTrans->Size == 0))
+  {
+    return  HAL_ERROR;
+  }
+
+  pTrans->ErrorCode = HAL_I2C_ERROR_NONE;
+  pTrans->pNext = NULL;
+
+  /* Link the transaction at the end of the queue */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if(hi2c->pQueueTail == NULL)
+  {
+    hi2c->pQueueHead = pTrans;
+  }
+  else
+  {
+    hi2c->pQueueTail->pNext = pTrans;
+  }
+  hi2c->pQueueTail = pTrans;
+
+  __set_PRIMASK(primask);
+
+  /* Start it if the bus is free */
+  I2C_QueueStart(hi2c);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Runs the acknowledge polling of the queued write waiting for its device,
+  *         one address probe per call, and restarts the queue.
+  * @note   This function is intended to be called periodically, e.g. from a timer.
+  *         It never waits for the bus: the probe is driven by the I2C interrupts.
+  *         It also starts the transaction deferred while the bus was busy.
+  *         It also ends with HAL_I2C_ERROR_TIMEOUT a queued transaction whose
+  *         addressing does not progress within I2C_TIMEOUT_FLAG.
+  * @param  hi2c: pointer to a I2C_HandleTypeDef structure that contains
+  *         the configuration information for I2C module
+  * @retval None
+  */
+void HAL_I2C_QueuePollHandler(I2C_HandleTypeDef *hi2c)
+{
+  I2C_TransactionTypeDef *ptrans = NULL;
+  uint32_t primask = 0, timeout = 0;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  /* Addressing of the transaction in progress stuck */
+  if((hi2c->pQueueActive != NULL) && (hi2c->QueuePhase != I2C_QUEUE_PHASE_DATA) &&
+     (hi2c->QueuePhase != I2C_QUEUE_PHASE_IDLE) && ((HAL_GetTick() - hi2c->QueueTickstart) > I2C_TIMEOUT_FLAG))
+  {
+    __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR);
+    hi2c->ErrorCode |= HAL_I2C_ERROR_TIMEOUT;
+    timeout = 1;
+  }
+  /* Claim the bus for the probe */
+  else if((hi2c->pQueuePoll != NULL) && (hi2c->pQueueActive == NULL) &&
+          (hi2c->State == HAL_I2C_STATE_READY) && (hi2c->Lock == HAL_UNLOCKED))
+  {
+    ptrans = hi2c->pQueuePoll;
+    hi2c->pQueueActive = ptrans;
+    hi2c->State = HAL_I2C_STATE_BUSY;
+  }
+
+  __set_PRIMASK(primask);
+
+  if(timeout != 0)
+  {
+    I2C_QueueCplt(hi2c);
+  }
+  else if(ptrans != NULL)
+  {
+    /* Completed from the I2C interrupts */
+    I2C_QueueLaunch(hi2c, ptrans);
+  }
+  else
+  {
+    /* Restart the queue, the bus may have been released by a transfer outside of it */
+    I2C_QueueStart(hi2c);
+  }
+}
+
+/**
+  * @brief  Removes a transaction from the queue, stopping it if it owns the bus.
+  * @note   The XferCpltCallback of the removed transaction is not called.
+  * @param  hi2c: pointer to a I2C_HandleTypeDef structure that contains
+  *         the configuration information for I2C module
+  * @param  pTrans: Pointer to the transaction to remove
+  * @retval HAL status: HAL_ERROR if the transaction is no longer queued
+  */
+HAL_StatusTypeDef HAL_I2C_QueueAbort(I2C_HandleTypeDef *hi2c, I2C_TransactionTypeDef *pTrans)
+{
+  I2C_TransactionTypeDef *ptrans = NULL, *pprev = NULL;
+  HAL_StatusTypeDef status = HAL_ERROR;
+  uint32_t primask = 0, active = 0;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if(hi2c->pQueueActive == pTrans)
+  {
+    /* Keep the interrupts of the transfer in progress away */
+    __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR);
+    hi2c->QueuePhase = I2C_QUEUE_PHASE_IDLE;
+    active = 1;
+  }
+  else if(hi2c->pQueuePoll == pTrans)
+  {
+    hi2c->pQueuePoll = NULL;
+    status = HAL_OK;
+  }
+  else
+  {
+    for(ptrans = hi2c->pQueueHead; (ptrans != NULL) && (ptrans != pTrans); ptrans = ptrans->pNext)
+    {
+      pprev = ptrans;
+    }
+
+    if(ptrans != NULL)
+    {
+      if(pprev == NULL)
+      {
+        hi2c->pQueueHead = ptrans->pNext;
+      }
+      else
+      {
+        pprev->pNext = ptrans->pNext;
+      }
+      if(hi2c->pQueueTail == ptrans)
+      {
+        hi2c->pQueueTail = pprev;
+      }
+      ptrans->pNext = NULL;
+      status = HAL_OK;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  if(active != 0)
+  {
+    I2C_QueueStop(hi2c, pTrans);
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    if(hi2c->pQueuePoll == pTrans)
+    {
+      hi2c->pQueuePoll = NULL;
+    }
+    hi2c->pQueueActive = NULL;
+    hi2c->State = HAL_I2C_STATE_READY;
+
+    __set_PRIMASK(primask);
+
+    status = HAL_OK;
+  }
+
+  /* The bus may be free for the next transaction */
+  I2C_QueueStart(hi2c);
+
+  return status;
+}
+
 /**
   * @brief  Checks if target device is ready for communication.
   * @note   This function is used with Memory devices
@@ -2320,8 +2591,13 @@ HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAdd
 void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c)
 {
   uint32_t tmp1 = 0, tmp2 = 0, tmp3 = 0, tmp4 = 0;
+  /* Queued transaction owning the bus */
+  if(hi2c->pQueueActive != NULL)
+  {
+    I2C_QueueEV(hi2c);
+  }
   /* Master mode selected */
-  if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_MSL) == SET)
+  else if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_MSL) == SET)
   {
     /* I2C in mode Transmitter -----------------------------------------------*/
     if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_TRA) == SET)
@@ -2485,7 +2761,15 @@ void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c)
     /* Disable Pos bit in I2C CR1 when error occurred in Master/Mem Receive IT Process */
     hi2c->Instance->CR1 &= ~I2C_CR1_POS;
     
-    HAL_I2C_ErrorCallback(hi2c);
+    /* Queued transaction owning the bus */
+    if(hi2c->pQueueActive != NULL)
+    {
+      I2C_QueueCplt(hi2c);
+    }
+    else
+    {
+      HAL_I2C_ErrorCallback(hi2c);
+    }
   }
 }
 
@@ -3559,6 +3843,476 @@ static void I2C_DMAError(DMA_HandleTypeDef *hdma)
   HAL_I2C_ErrorCallback(hi2c);
 }
 
+/**
+  * @brief  Selects and unlinks the next queued transaction that may be started.
+  * @note   Called with interrupts disabled. While a write waits for its acknowledge,
+  *         the transactions for that device and the other polled writes are skipped,
+  *         the order of the transactions of each device is kept.
+  * @param  hi2c: pointer to a I2C_HandleTypeDef structure that contains
+  *         the configuration information for I2C module
+  * @retval Transaction to start or NULL
+  */
+static I2C_TransactionTypeDef *I2C_QueueSelect(I2C_HandleTypeDef *hi2c)
+{
+  I2C_TransactionTypeDef *ptrans = hi2c->pQueueHead, *pprev = NULL, *pskip = NULL;
+  I2C_TransactionTypeDef *ppoll = hi2c->pQueuePoll;
+  uint32_t blocked = 0;
+
+  while(ptrans != NULL)
+  {
+    blocked = (ppoll != NULL) && ((ptrans->DevAddress == ppoll->DevAddress) || I2C_QUEUE_POLLED(ptrans));
+
+    /* Do not overtake a skipped transaction of the same device */
+    for(pskip = hi2c->pQueueHead; (blocked == 0) && (pskip != ptrans); pskip = pskip->pNext)
+    {
+      blocked = (pskip->DevAddress == ptrans->DevAddress);
+    }
+
+    if(blocked == 0)
+    {
+      break;
+    }
+    pprev = ptrans;
+    ptrans = ptrans->pNext;
+  }
+
+  if(ptrans != NULL)
+  {
+    if(pprev == NULL)
+    {
+      hi2c->pQueueHead = ptrans->pNext;
+    }
+    else
+    {
+      pprev->pNext = ptrans->pNext;
+    }
+    if(hi2c->pQueueTail == ptrans)
+    {
+      hi2c->pQueueTail = pprev;
+    }
+    ptrans->pNext = NULL;
+  }
+
+  return ptrans;
+}
+
+/**
+  * @brief  Starts the next queued transaction if the bus is free.
+  * @param  hi2c: pointer to a I2C_HandleTypeDef structure that contains
+  *         the configuration information for I2C module
+  * @retval None
+  */
+static void I2C_QueueStart(I2C_HandleTypeDef *hi2c)
+{
+  I2C_TransactionTypeDef *ptrans = NULL;
+  uint32_t primask = 0;
+
+  /* Claim the bus */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if((hi2c->pQueueActive == NULL) && (hi2c->State == HAL_I2C_STATE_READY) && (hi2c->Lock == HAL_UNLOCKED))
+  {
+    ptrans = I2C_QueueSelect(hi2c);
+    if(ptrans != NULL)
+    {
+      hi2c->pQueueActive = ptrans;
+      hi2c->State = HAL_I2C_STATE_BUSY;
+    }
+  }
+  /* Start deferred by I2C_QueueLaunch(), now that the bus is free */
+  else if((hi2c->pQueueActive != NULL) && (hi2c->QueuePhase == I2C_QUEUE_PHASE_WAIT) &&
+          (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_BUSY) == RESET))
+  {
+    ptrans = hi2c->pQueueActive;
+    hi2c->QueueTickstart = HAL_GetTick();
+    hi2c->QueuePhase = I2C_QUEUE_PHASE_START;
+  }
+
+  __set_PRIMASK(primask);
+
+  if(ptrans != NULL)
+  {
+    I2C_QueueLaunch(hi2c, ptrans);
+  }
+}
+
+/**
+  * @brief  Generates the start condition of the transaction that owns the bus,
+  *         or of the acknowledge probe of the polled write. The addressing is
+  *         then driven by I2C_QueueEV(), the data by DMA.
+  * @param  hi2c: pointer to a I2C_HandleTypeDef structure that contains
+  *         the configuration information for I2C module
+  * @param  pTrans: Pointer to the transaction, hi2c->pQueueActive
+  * @retval None
+  */
+static void I2C_QueueLaunch(I2C_HandleTypeDef *hi2c, I2C_TransactionTypeDef *pTrans)
+{
+  DMA_HandleTypeDef *hdma = NULL;
+
+  hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+  hi2c->QueueTickstart = HAL_GetTick();
+
+  /* The stop condition of the previous transfer is not over: CR1 must not be
+     written before, and this may run from an interrupt, so the start is left
+     to the next I2C_QueueStart() call instead of waiting for the bus */
+  if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_BUSY) == SET)
+  {
+    hi2c->QueuePhase = I2C_QUEUE_PHASE_WAIT;
+    return;
+  }
+
+  /* Arm the DMA stream of the data phase, its requests are enabled after the addressing */
+  if(pTrans != hi2c->pQueuePoll)
+  {
+    hdma = I2C_QUEUE_HDMA(hi2c, pTrans);
+    hdma->XferCpltCallback = I2C_DMAQueueCplt;
+    hdma->XferErrorCallback = I2C_DMAQueueError;
+
+    if((pTrans->Type == I2C_TRANSACTION_READ) || (pTrans->Type == I2C_TRANSACTION_MEM_READ))
+    {
+      HAL_DMA_Start_IT(hdma, (uint32_t)&hi2c->Instance->DR, (uint32_t)pTrans->pData, pTrans->Size);
+    }
+    else
+    {
+      HAL_DMA_Start_IT(hdma, (uint32_t)pTrans->pData, (uint32_t)&hi2c->Instance->DR, pTrans->Size);
+    }
+  }
+
+  hi2c->QueuePhase = I2C_QUEUE_PHASE_START;
+
+  /* Enable Acknowledge, Generate Start */
+  hi2c->Instance->CR1 |= (I2C_CR1_ACK | I2C_CR1_START);
+
+  __HAL_I2C_ENABLE_IT(hi2c, I2C_IT_EVT | I2C_IT_ERR);
+}
+
+/**
+  * @brief  Handles the I2C events of the queued transaction owning the bus:
+  *         start conditions, address and memory address phases, end of the
+  *         last transmitted byte.
+  * @param  hi2c: pointer to a I2C_HandleTypeDef structure that contains
+  *         the configuration information for I2C module
+  * @retval None
+  */
+static void I2C_QueueEV(I2C_HandleTypeDef *hi2c)
+{
+  I2C_TransactionTypeDef *ptrans = hi2c->pQueueActive;
+
+  switch(hi2c->QueuePhase)
+  {
+    case I2C_QUEUE_PHASE_START:
+    case I2C_QUEUE_PHASE_RESTART:
+      if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_SB) == SET)
+      {
+        /* Send slave address */
+        if(hi2c->QueuePhase == I2C_QUEUE_PHASE_RESTART)
+        {
+          hi2c->Instance->DR = I2C_7BIT_ADD_READ(ptrans->DevAddress);
+          hi2c->QueuePhase = I2C_QUEUE_PHASE_READADDR;
+        }
+        else if(ptrans->Type == I2C_TRANSACTION_READ)
+        {
+          hi2c->Instance->DR = I2C_7BIT_ADD_READ(ptrans->DevAddress);
+          hi2c->QueuePhase = I2C_QUEUE_PHASE_READADDR;
+        }
+        else
+        {
+          hi2c->Instance->DR = I2C_7BIT_ADD_WRITE(ptrans->DevAddress);
+          hi2c->QueuePhase = I2C_QUEUE_PHASE_ADDR;
+        }
+      }
+      break;
+
+    case I2C_QUEUE_PHASE_ADDR:
+      if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_ADDR) == SET)
+      {
+        if(ptrans == hi2c->pQueuePoll)
+        {
+          /* The device acknowledged the probe */
+          __HAL_I2C_CLEAR_ADDRFLAG(hi2c);
+          hi2c->Instance->CR1 |= I2C_CR1_STOP;
+          I2C_QueueCplt(hi2c);
+        }
+        else if(ptrans->Type == I2C_TRANSACTION_WRITE)
+        {
+          hi2c->QueuePhase = I2C_QUEUE_PHASE_DATA;
+          __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_EVT);
+          hi2c->Instance->CR2 |= I2C_CR2_DMAEN;
+          __HAL_I2C_CLEAR_ADDRFLAG(hi2c);
+        }
+        else
+        {
+          __HAL_I2C_CLEAR_ADDRFLAG(hi2c);
+
+          /* Send the memory address, its end is reported by BTF */
+          if(ptrans->MemAddSize == I2C_MEMADD_SIZE_8BIT)
+          {
+            hi2c->Instance->DR = I2C_MEM_ADD_LSB(ptrans->MemAddress);
+            hi2c->QueuePhase = I2C_QUEUE_PHASE_MEMADD;
+          }
+          else
+          {
+            hi2c->Instance->DR = I2C_MEM_ADD_MSB(ptrans->MemAddress);
+            hi2c->QueuePhase = I2C_QUEUE_PHASE_MEMADD_MSB;
+          }
+        }
+      }
+      break;
+
+    case I2C_QUEUE_PHASE_MEMADD_MSB:
+      if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_BTF) == SET)
+      {
+        hi2c->Instance->DR = I2C_MEM_ADD_LSB(ptrans->MemAddress);
+        hi2c->QueuePhase = I2C_QUEUE_PHASE_MEMADD;
+      }
+      break;
+
+    case I2C_QUEUE_PHASE_MEMADD:
+      if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_BTF) == SET)
+      {
+        if(ptrans->Type == I2C_TRANSACTION_MEM_WRITE)
+        {
+          hi2c->QueuePhase = I2C_QUEUE_PHASE_DATA;
+          __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_EVT);
+          hi2c->Instance->CR2 |= I2C_CR2_DMAEN;
+        }
+        else
+        {
+          /* Generate Restart */
+          hi2c->QueuePhase = I2C_QUEUE_PHASE_RESTART;
+          hi2c->Instance->CR1 |= I2C_CR1_START;
+        }
+      }
+      break;
+
+    case I2C_QUEUE_PHASE_READADDR:
+      if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_ADDR) == SET)
+      {
+        hi2c->QueuePhase = I2C_QUEUE_PHASE_DATA;
+        __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_EVT);
+
+        if(ptrans->Size == 1)
+        {
+          /* Disable Acknowledge */
+          hi2c->Instance->CR1 &= ~I2C_CR1_ACK;
+        }
+        else
+        {
+          /* Enable Last DMA bit */
+          hi2c->Instance->CR2 |= I2C_CR2_LAST;
+        }
+
+        /* Enable DMA Request */
+        hi2c->Instance->CR2 |= I2C_CR2_DMAEN;
+
+        /* Clear ADDR flag */
+        __HAL_I2C_CLEAR_ADDRFLAG(hi2c);
+
+        if(ptrans->Size == 1)
+        {
+          /* Generate Stop */
+          hi2c->Instance->CR1 |= I2C_CR1_STOP;
+        }
+      }
+      break;
+
+    case I2C_QUEUE_PHASE_LAST:
+      if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_BTF) == SET)
+      {
+        /* Generate Stop */
+        hi2c->Instance->CR1 |= I2C_CR1_STOP;
+        I2C_QueueCplt(hi2c);
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+/**
+  * @brief  DMA I2C queued transaction complete callback.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void I2C_DMAQueueCplt(DMA_HandleTypeDef *hdma)
+{
+  I2C_HandleTypeDef* hi2c = (I2C_HandleTypeDef*)((DMA_HandleTypeDef*)hdma)->Parent;
+  I2C_TransactionTypeDef *ptrans = hi2c->pQueueActive;
+
+  /* The transaction was aborted */
+  if((ptrans == NULL) || (hi2c->QueuePhase != I2C_QUEUE_PHASE_DATA))
+  {
+    return;
+  }
+
+  /* Disable DMA Request */
+  hi2c->Instance->CR2 &= ~I2C_CR2_DMAEN;
+
+  if((ptrans->Type == I2C_TRANSACTION_READ) || (ptrans->Type == I2C_TRANSACTION_MEM_READ))
+  {
+    /* The last byte is received and not acknowledged: the stop condition of a
+       single byte was generated with its address */
+    if(ptrans->Size != 1)
+    {
+      hi2c->Instance->CR1 |= I2C_CR1_STOP;
+    }
+
+    /* Disable Last DMA, Disable Acknowledge */
+    hi2c->Instance->CR2 &= ~I2C_CR2_LAST;
+    hi2c->Instance->CR1 &= ~I2C_CR1_ACK;
+
+    I2C_QueueCplt(hi2c);
+  }
+  else
+  {
+    /* The last byte is in the data register: wait for its BTF event */
+    hi2c->QueuePhase = I2C_QUEUE_PHASE_LAST;
+    hi2c->QueueTickstart = HAL_GetTick();
+    __HAL_I2C_ENABLE_IT(hi2c, I2C_IT_EVT);
+  }
+}
+
+/**
+  * @brief  DMA I2C queued transaction error callback.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void I2C_DMAQueueError(DMA_HandleTypeDef *hdma)
+{
+  I2C_HandleTypeDef* hi2c = (I2C_HandleTypeDef*)((DMA_HandleTypeDef*)hdma)->Parent;
+
+  /* The transaction was aborted */
+  if((hi2c->pQueueActive == NULL) || (hi2c->QueuePhase == I2C_QUEUE_PHASE_IDLE))
+  {
+    return;
+  }
+
+  hi2c->ErrorCode |= HAL_I2C_ERROR_DMA;
+
+  I2C_QueueCplt(hi2c);
+}
+
+/**
+  * @brief  Releases the bus and the DMA stream of a queued transaction that
+  *         failed or is aborted midway.
+  * @param  hi2c: pointer to a I2C_HandleTypeDef structure that contains
+  *         the configuration information for I2C module
+  * @param  pTrans: Pointer to the transaction owning the bus
+  * @retval None
+  */
+static void I2C_QueueStop(I2C_HandleTypeDef *hi2c, I2C_TransactionTypeDef *pTrans)
+{
+  __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR);
+  hi2c->Instance->CR2 &= ~(I2C_CR2_DMAEN | I2C_CR2_LAST);
+
+  /* CR1 must not be written while a stop condition is pending */
+  if((hi2c->Instance->CR1 & I2C_CR1_STOP) == 0)
+  {
+    /* Disable Acknowledge */
+    hi2c->Instance->CR1 &= ~I2C_CR1_ACK;
+
+    if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_MSL) == SET)
+    {
+      hi2c->Instance->CR1 |= I2C_CR1_STOP;
+    }
+  }
+
+  /* The probe of a polled write has no DMA transfer */
+  if(pTrans != hi2c->pQueuePoll)
+  {
+    HAL_DMA_Abort(I2C_QUEUE_HDMA(hi2c, pTrans));
+  }
+}
+
+/**
+  * @brief  Ends the queued transaction or acknowledge probe owning the bus and
+  *         starts the next transaction.
+  * @param  hi2c: pointer to a I2C_HandleTypeDef structure that contains
+  *         the configuration information for I2C module
+  * @retval None
+  */
+static void I2C_QueueCplt(I2C_HandleTypeDef *hi2c)
+{
+  I2C_TransactionTypeDef *ptrans = hi2c->pQueueActive;
+  uint32_t primask = 0;
+
+  if(hi2c->ErrorCode != HAL_I2C_ERROR_NONE)
+  {
+    I2C_QueueStop(hi2c, ptrans);
+  }
+  else
+  {
+    __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_EVT | I2C_IT_ERR);
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  hi2c->pQueueActive = NULL;
+  hi2c->QueuePhase = I2C_QUEUE_PHASE_IDLE;
+  hi2c->State = HAL_I2C_STATE_READY;
+
+  if(ptrans == hi2c->pQueuePoll)
+  {
+    /* No acknowledge yet: the device is still busy */
+    if(hi2c->ErrorCode == HAL_I2C_ERROR_AF)
+    {
+      if(--ptrans->PollTrials == 0)
+      {
+        ptrans->ErrorCode = HAL_I2C_ERROR_TIMEOUT;
+        hi2c->pQueuePoll = NULL;
+      }
+      else
+      {
+        ptrans = NULL;
+      }
+    }
+    else
+    {
+      ptrans->ErrorCode = hi2c->ErrorCode;
+      hi2c->pQueuePoll = NULL;
+    }
+  }
+  else
+  {
+    ptrans->ErrorCode = hi2c->ErrorCode;
+
+    /* A successful write may still have to wait for its acknowledge */
+    if((ptrans->ErrorCode == HAL_I2C_ERROR_NONE) && I2C_QUEUE_POLLED(ptrans))
+    {
+      hi2c->pQueuePoll = ptrans;
+      ptrans = NULL;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  I2C_QueueStart(hi2c);
+
+  if((ptrans != NULL) && (ptrans->XferCpltCallback != NULL))
+  {
+    ptrans->XferCpltCallback(hi2c, ptrans);
+  }
+}
+
+/**
+  * @brief  Empties the transaction queue.
+  * @param  hi2c: pointer to a I2C_HandleTypeDef structure that contains
+  *         the configuration information for I2C module
+  * @retval None
+  */
+static void I2C_QueueReset(I2C_HandleTypeDef *hi2c)
+{
+  hi2c->pQueueHead = NULL;
+  hi2c->pQueueTail = NULL;
+  hi2c->pQueueActive = NULL;
+  hi2c->pQueuePoll = NULL;
+  hi2c->QueuePhase = I2C_QUEUE_PHASE_IDLE;
+  hi2c->QueueTickstart = 0;
+}
+
 /**
   * @brief  This function handles I2C Communication Timeout.
   * @param  hi2c: pointer to a I2C_HandleTypeDef structure that contains
@@ -52,6 +52,28 @@
       (#) The CRC feature is not managed when the DMA circular mode is enabled
       (#) When the SPI DMA Pause/Stop features are used, we must use the following APIs 
           the HAL_SPI_DMAPause()/ HAL_SPI_DMAStop() only under the SPI callbacks
+     [..]
+       Bus queue:
+      (#) Several devices can share a master 2Lines bus through a queue of DMA transactions:
+          (##) Describe each device in a SPI_DeviceTypeDef structure: chip select GPIO, clock
+               polarity and phase, baudrate prescaler and bit order
+          (##) Fill a SPI_TransactionTypeDef structure with the device, the data to send, the
+               buffer of the received data, their size and an optional completion callback,
+               and queue it using HAL_SPI_Queue_DMA(), from a task or an interrupt
+          (##) The DMA Rx transfer complete interrupt releases the chip select, starts the next
+               transaction and then executes the callback of the completed one with its
+               ErrorCode set. The callback can signal a RTOS event using the pContext field
+          (##) When the clock of the last frame is not over at the DMA Rx transfer complete
+               interrupt, this is done from the SPI TXE interrupt: enable the SPI global
+               interrupt and call HAL_SPI_IRQHandler() from it
+          (##) HAL_SPI_TxRxCpltCallback() is executed once the queue is empty
+          (##) Get the number of transactions and of clock settings changes using
+               HAL_SPI_GetQueueStats()
+      (#) The transactions and their buffers belong to the driver until their callback. After
+          a DMA error the remaining transactions are completed with HAL_SPI_ERROR_DMA and
+          HAL_SPI_DMAStop() forgets them
+      (#) The CRC feature is not managed by the bus queue, and the other transfer APIs must not
+          be called while transactions are queued
 
 
             
@@ -103,8 +125,15 @@
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 #define SPI_TIMEOUT_VALUE  10
+#define SPI_QUEUE_CR1_MASK (SPI_CR1_CPOL | SPI_CR1_CPHA | SPI_CR1_BR | SPI_CR1_LSBFIRST)
+/* Bound of the SPI interrupts waiting for the end of the last frame of a queued
+   transaction: its last clock pulse lasts at most 128 APB cycles */
+#define SPI_QUEUE_BSY_TIMEOUT_IT  1024
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Frames sent and received by the bus queue transactions without Tx or Rx buffer */
+static const uint16_t SPI_QueueTxDummy = 0xFFFF;
+static uint16_t SPI_QueueRxDummy;
 /* Private function prototypes -----------------------------------------------*/
 /** @addtogroup SPI_Private_Functions
   * @{
@@ -122,6 +151,15 @@ static void SPI_DMAHalfTransmitCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAHalfReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAHalfTransmitReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAError(DMA_HandleTypeDef *hdma);
+static void SPI_DMAQueueCplt(DMA_HandleTypeDef *hdma);
+static void SPI_DMAQueueError(DMA_HandleTypeDef *hdma);
+static void SPI_QueueTxISR(SPI_HandleTypeDef *hspi);
+static void SPI_QueueEnd(SPI_HandleTypeDef *hspi);
+static void SPI_QueueStart(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans);
+static void SPI_QueueRestore(SPI_HandleTypeDef *hspi);
+static void SPI_QueueAbort(SPI_HandleTypeDef *hspi, uint32_t ErrorCode);
+static void SPI_QueueReset(SPI_HandleTypeDef *hspi);
+static void SPI_QueueMemInc(DMA_HandleTypeDef *hdma, uint32_t MemInc);
 static HAL_StatusTypeDef SPI_WaitOnFlagUntilTimeout(SPI_HandleTypeDef *hspi, uint32_t Flag, FlagStatus Status, uint32_t Timeout);
 /**
   * @}
@@ -223,6 +261,9 @@ HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
   /* Activate the SPI mode (Make sure that I2SMOD bit in I2SCFGR register is reset) */
   hspi->Instance->I2SCFGR &= (uint32_t)(~SPI_I2SCFGR_I2SMOD);
 
+  /* No transaction queued */
+  SPI_QueueReset(hspi);
+
   hspi->ErrorCode = HAL_SPI_ERROR_NONE;
   hspi->State = HAL_SPI_STATE_READY;
   
@@ -249,6 +290,9 @@ HAL_StatusTypeDef HAL_SPI_DeInit(SPI_HandleTypeDef *hspi)
   /* DeInit the low level hardware: GPIO, CLOCK, NVIC... */
   HAL_SPI_MspDeInit(hspi);
 
+  /* Forget the transactions still queued */
+  SPI_QueueReset(hspi);
+
   hspi->ErrorCode = HAL_SPI_ERROR_NONE;
   hspi->State = HAL_SPI_STATE_RESET;
 
@@ -1407,6 +1451,84 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, uint8_t *
   }
 }
 
+/**
+  * @brief  Queues a full duplex transaction with a device of the bus, in non blocking
+  *         mode using DMA.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *                the configuration information for SPI module.
+  * @param  pTrans: Transaction to execute. It belongs to the driver until its callback
+  *         is executed and must not be queued twice.
+  * @note   This function can be called from a task or from an interrupt. The transaction
+  *         starts right away when the queue is empty, otherwise after those queued before.
+  * @note   The SPI must be configured as master in SPI_DIRECTION_2LINES mode without CRC.
+  * @retval HAL status: HAL_BUSY when a transfer outside the queue is ongoing.
+  */
+HAL_StatusTypeDef HAL_SPI_Queue_DMA(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans)
+{
+  uint32_t primask;
+
+  if((pTrans == NULL) || (pTrans->pDevice == NULL) || (pTrans->Size == 0) ||
+     (hspi->hdmatx == NULL) || (hspi->hdmarx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_SPI_CPOL(pTrans->pDevice->CLKPolarity));
+  assert_param(IS_SPI_CPHA(pTrans->pDevice->CLKPhase));
+  assert_param(IS_SPI_BAUDRATE_PRESCALER(pTrans->pDevice->BaudRatePrescaler));
+  assert_param(IS_SPI_FIRST_BIT(pTrans->pDevice->FirstBit));
+
+  if((hspi->Init.Mode != SPI_MODE_MASTER) || (hspi->Init.Direction != SPI_DIRECTION_2LINES) ||
+     (hspi->Init.CRCCalculation == SPI_CRCCALCULATION_ENABLE))
+  {
+    return HAL_ERROR;
+  }
+
+  pTrans->ErrorCode = HAL_SPI_ERROR_NONE;
+  pTrans->pNext = NULL;
+
+  /* Tasks and interrupts may queue transactions concurrently */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if(hspi->pQueueHead == NULL)
+  {
+    /* A transfer outside the queue owns the bus */
+    if(hspi->State != HAL_SPI_STATE_READY)
+    {
+      __set_PRIMASK(primask);
+      return HAL_BUSY;
+    }
+
+    hspi->State = HAL_SPI_STATE_BUSY_TX_RX;
+    hspi->ErrorCode = HAL_SPI_ERROR_NONE;
+
+    hspi->pQueueHead = pTrans;
+    hspi->pQueueTail = pTrans;
+
+    /* Flush a frame left by a previous transmit only transfer */
+    __HAL_SPI_CLEAR_OVRFLAG(hspi);
+
+    SPI_QueueStart(hspi, pTrans);
+  }
+  else
+  {
+    hspi->pQueueTail->pNext = pTrans;
+    hspi->pQueueTail = pTrans;
+  }
+
+  hspi->QueueStats.Pending++;
+  if(hspi->QueueStats.Pending > hspi->QueueStats.MaxPending)
+  {
+    hspi->QueueStats.MaxPending = hspi->QueueStats.Pending;
+  }
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
 /**
   * @brief Pauses the DMA Transfer.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
@@ -1478,6 +1600,16 @@ HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
   hspi->Instance->CR2 &= (uint32_t)(~SPI_CR2_TXDMAEN);
   hspi->Instance->CR2 &= (uint32_t)(~SPI_CR2_RXDMAEN);
   
+  /* Release the selected device and forget the queued transactions */
+  if(hspi->pQueueHead != NULL)
+  {
+    if(hspi->pQueueHead->pDevice->CSPort != NULL)
+    {
+      HAL_GPIO_WritePin(hspi->pQueueHead->pDevice->CSPort, hspi->pQueueHead->pDevice->CSPin, GPIO_PIN_SET);
+    }
+    SPI_QueueRestore(hspi);
+  }
+  
   hspi->State = HAL_SPI_STATE_READY;
   
   return HAL_OK;
@@ -1687,6 +1819,24 @@ uint32_t HAL_SPI_GetError(SPI_HandleTypeDef *hspi)
   return hspi->ErrorCode;
 }
 
+/**
+  * @brief  Return the counters of the bus queue.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *                the configuration information for SPI module.
+  * @param  pStats: Set to the counters since the SPI initialization.
+  * @retval None
+  */
+void HAL_SPI_GetQueueStats(SPI_HandleTypeDef *hspi, SPI_QueueStatsTypeDef *pStats)
+{
+  uint32_t primask;
+
+  /* Copy the counters consistently with the DMA interrupt */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *pStats = hspi->QueueStats;
+  __set_PRIMASK(primask);
+}
+
 /**
   * @}
   */
@@ -2195,6 +2345,350 @@ static void SPI_DMAError(DMA_HandleTypeDef *hdma)
   HAL_SPI_ErrorCallback(hspi);
 }
 
+/**
+  * @brief  DMA SPI bus queue Rx transfer complete callback: ends the transaction
+  *         once the clock of its last frame is over.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SPI_DMAQueueCplt(DMA_HandleTypeDef *hdma)
+{
+  SPI_HandleTypeDef* hspi = (SPI_HandleTypeDef*)((DMA_HandleTypeDef*)hdma)->Parent;
+
+  /* The queue was stopped by HAL_SPI_DMAStop() */
+  if(hspi->pQueueHead == NULL)
+  {
+    return;
+  }
+
+  /* Disable the Tx & Rx DMA requests */
+  hspi->Instance->CR2 &= (uint32_t)(~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN));
+
+  /* The last frame is received but its clock may not be over: the device is then
+     released from the SPI TXE interrupt, which occurs until BSY is reset */
+  if(__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_BSY) != RESET)
+  {
+    hspi->QueueBsyCount = SPI_QUEUE_BSY_TIMEOUT_IT;
+    hspi->TxISR = SPI_QueueTxISR;
+    __HAL_SPI_ENABLE_IT(hspi, SPI_IT_TXE);
+    return;
+  }
+
+  SPI_QueueEnd(hspi);
+}
+
+/**
+  * @brief  SPI bus queue TXE interrupt handler: ends the transaction once the clock
+  *         of its last frame is over. The bus is stuck if it does not end: the queue
+  *         is aborted.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *                the configuration information for SPI module.
+  * @retval None
+  */
+static void SPI_QueueTxISR(SPI_HandleTypeDef *hspi)
+{
+  /* The queue was stopped by HAL_SPI_DMAStop() */
+  if(hspi->pQueueHead == NULL)
+  {
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXE);
+    return;
+  }
+
+  if(__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_BSY) != RESET)
+  {
+    if(--hspi->QueueBsyCount == 0)
+    {
+      SPI_QueueAbort(hspi, HAL_SPI_ERROR_FLAG);
+    }
+    return;
+  }
+
+  __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXE);
+
+  SPI_QueueEnd(hspi);
+}
+
+/**
+  * @brief  Ends the ongoing transaction of the bus queue: releases the device, starts
+  *         the next queued transaction and then completes the one just done.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *                the configuration information for SPI module.
+  * @retval None
+  */
+static void SPI_QueueEnd(SPI_HandleTypeDef *hspi)
+{
+  SPI_TransactionTypeDef *pTrans = hspi->pQueueHead;
+  uint32_t primask;
+  uint32_t idle = 0;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if(pTrans->pDevice->CSPort != NULL)
+  {
+    HAL_GPIO_WritePin(pTrans->pDevice->CSPort, pTrans->pDevice->CSPin, GPIO_PIN_SET);
+  }
+
+  /* The Tx stream completed without interrupt: release its handle */
+  __HAL_DMA_CLEAR_FLAG(hspi->hdmatx, __HAL_DMA_GET_TC_FLAG_INDEX(hspi->hdmatx));
+  __HAL_DMA_CLEAR_FLAG(hspi->hdmatx, __HAL_DMA_GET_HT_FLAG_INDEX(hspi->hdmatx));
+  __HAL_DMA_CLEAR_FLAG(hspi->hdmarx, __HAL_DMA_GET_HT_FLAG_INDEX(hspi->hdmarx));
+  hspi->hdmatx->State = HAL_DMA_STATE_READY_MEM0;
+  __HAL_UNLOCK(hspi->hdmatx);
+
+  hspi->pQueueHead = pTrans->pNext;
+
+  hspi->QueueStats.Bytes += pTrans->Size;
+  hspi->QueueStats.Transfers++;
+  hspi->QueueStats.Pending--;
+
+  if(hspi->pQueueHead != NULL)
+  {
+    /* Chain the next transaction right away */
+    SPI_QueueStart(hspi, hspi->pQueueHead);
+  }
+  else
+  {
+    SPI_QueueRestore(hspi);
+
+    hspi->TxXferCount = 0;
+    hspi->RxXferCount = 0;
+    hspi->State = HAL_SPI_STATE_READY;
+    idle = 1;
+  }
+
+  __set_PRIMASK(primask);
+
+  if(pTrans->XferCpltCallback != NULL)
+  {
+    pTrans->XferCpltCallback(hspi, pTrans);
+  }
+
+  if(idle != 0)
+  {
+    HAL_SPI_TxRxCpltCallback(hspi);
+  }
+}
+
+/**
+  * @brief  DMA SPI bus queue error callback: stops the queue and completes its
+  *         transactions with an error.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SPI_DMAQueueError(DMA_HandleTypeDef *hdma)
+{
+  SPI_HandleTypeDef* hspi = (SPI_HandleTypeDef*)((DMA_HandleTypeDef*)hdma)->Parent;
+
+  /* Both streams may report the same failure */
+  if(hspi->pQueueHead == NULL)
+  {
+    return;
+  }
+
+  SPI_QueueAbort(hspi, HAL_SPI_ERROR_DMA);
+}
+
+/**
+  * @brief  Stops the bus queue after a failure and completes the ongoing transaction
+  *         and those queued behind it with an error.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *                the configuration information for SPI module.
+  * @param  ErrorCode: HAL_SPI_ERROR_DMA or HAL_SPI_ERROR_FLAG
+  * @retval None
+  */
+static void SPI_QueueAbort(SPI_HandleTypeDef *hspi, uint32_t ErrorCode)
+{
+  SPI_TransactionTypeDef *pTrans;
+  SPI_TransactionTypeDef *pNext;
+  uint32_t primask;
+
+  /* Stop both streams */
+  hspi->Instance->CR2 &= (uint32_t)(~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN));
+  HAL_DMA_Abort(hspi->hdmatx);
+  HAL_DMA_Abort(hspi->hdmarx);
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  /* Release the device and take the queued transactions */
+  pTrans = hspi->pQueueHead;
+
+  if(pTrans->pDevice->CSPort != NULL)
+  {
+    HAL_GPIO_WritePin(pTrans->pDevice->CSPort, pTrans->pDevice->CSPin, GPIO_PIN_SET);
+  }
+
+  SPI_QueueRestore(hspi);
+
+  hspi->TxXferCount = 0;
+  hspi->RxXferCount = 0;
+  hspi->State = HAL_SPI_STATE_READY;
+  hspi->ErrorCode |= ErrorCode;
+
+  __set_PRIMASK(primask);
+
+  /* Complete the failed transaction and those queued behind it */
+  while(pTrans != NULL)
+  {
+    pNext = pTrans->pNext;
+    pTrans->ErrorCode |= ErrorCode;
+    if(pTrans->XferCpltCallback != NULL)
+    {
+      pTrans->XferCpltCallback(hspi, pTrans);
+    }
+    pTrans = pNext;
+  }
+
+  HAL_SPI_ErrorCallback(hspi);
+}
+
+/**
+  * @brief  Starts a queued transaction: applies the clock settings of its device,
+  *         selects it and starts the DMA streams. Called with the interrupts disabled.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *                the configuration information for SPI module.
+  * @param  pTrans: Transaction to start
+  * @retval None
+  */
+static void SPI_QueueStart(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans)
+{
+  SPI_DeviceTypeDef *pDevice = pTrans->pDevice;
+  uint32_t tmpcr1 = 0;
+
+  hspi->pTxBuffPtr  = (uint8_t *)pTrans->pTxData;
+  hspi->TxXferSize  = pTrans->Size;
+  hspi->TxXferCount = pTrans->Size;
+
+  hspi->pRxBuffPtr  = pTrans->pRxData;
+  hspi->RxXferSize  = pTrans->Size;
+  hspi->RxXferCount = pTrans->Size;
+
+  /* The clock settings can only be changed while the SPI is disabled */
+  tmpcr1 = (pDevice->CLKPolarity | pDevice->CLKPhase | pDevice->BaudRatePrescaler | pDevice->FirstBit);
+  if((hspi->Instance->CR1 & SPI_QUEUE_CR1_MASK) != tmpcr1)
+  {
+    __HAL_SPI_DISABLE(hspi);
+    hspi->Instance->CR1 = (hspi->Instance->CR1 & ~SPI_QUEUE_CR1_MASK) | tmpcr1;
+    hspi->QueueStats.Reconfigurations++;
+  }
+
+  /* Select the device */
+  if(pDevice->CSPort != NULL)
+  {
+    HAL_GPIO_WritePin(pDevice->CSPort, pDevice->CSPin, GPIO_PIN_RESET);
+  }
+
+  /* The Rx stream completion ends the transaction */
+  hspi->hdmarx->XferCpltCallback = SPI_DMAQueueCplt;
+  hspi->hdmarx->XferHalfCpltCallback = NULL;
+  hspi->hdmarx->XferErrorCallback = SPI_DMAQueueError;
+
+  if(pTrans->pRxData != NULL)
+  {
+    SPI_QueueMemInc(hspi->hdmarx, DMA_MINC_ENABLE);
+    HAL_DMA_Start_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->DR, (uint32_t)pTrans->pRxData, pTrans->Size);
+  }
+  else
+  {
+    SPI_QueueMemInc(hspi->hdmarx, DMA_MINC_DISABLE);
+    HAL_DMA_Start_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->DR, (uint32_t)&SPI_QueueRxDummy, pTrans->Size);
+  }
+  __HAL_DMA_DISABLE_IT(hspi->hdmarx, DMA_IT_HT);
+
+  /* Enable Rx DMA Request */
+  hspi->Instance->CR2 |= SPI_CR2_RXDMAEN;
+
+  hspi->hdmatx->XferCpltCallback = NULL;
+  hspi->hdmatx->XferHalfCpltCallback = NULL;
+  hspi->hdmatx->XferErrorCallback = SPI_DMAQueueError;
+
+  if(pTrans->pTxData != NULL)
+  {
+    SPI_QueueMemInc(hspi->hdmatx, DMA_MINC_ENABLE);
+    HAL_DMA_Start_IT(hspi->hdmatx, (uint32_t)pTrans->pTxData, (uint32_t)&hspi->Instance->DR, pTrans->Size);
+  }
+  else
+  {
+    SPI_QueueMemInc(hspi->hdmatx, DMA_MINC_DISABLE);
+    HAL_DMA_Start_IT(hspi->hdmatx, (uint32_t)&SPI_QueueTxDummy, (uint32_t)&hspi->Instance->DR, pTrans->Size);
+  }
+  /* The Tx stream ends before the Rx one: its interrupts would only delay the next transaction */
+  __HAL_DMA_DISABLE_IT(hspi->hdmatx, (DMA_IT_TC | DMA_IT_HT));
+
+  /* Check if the SPI is already enabled */ 
+  if((hspi->Instance->CR1 &SPI_CR1_SPE) != SPI_CR1_SPE)
+  {
+    /* Enable SPI peripheral */
+    __HAL_SPI_ENABLE(hspi);
+  }
+
+  /* Enable Tx DMA Request */  
+  hspi->Instance->CR2 |= SPI_CR2_TXDMAEN;
+}
+
+/**
+  * @brief  Restores the clock settings and the DMA memory increment of the SPI
+  *         handle once the bus queue is empty or stopped, and clears the queue.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *                the configuration information for SPI module.
+  * @retval None
+  */
+static void SPI_QueueRestore(SPI_HandleTypeDef *hspi)
+{
+  uint32_t tmpcr1 = 0;
+
+  tmpcr1 = (hspi->Init.CLKPolarity | hspi->Init.CLKPhase | hspi->Init.BaudRatePrescaler | hspi->Init.FirstBit);
+  if((hspi->Instance->CR1 & SPI_QUEUE_CR1_MASK) != tmpcr1)
+  {
+    __HAL_SPI_DISABLE(hspi);
+    hspi->Instance->CR1 = (hspi->Instance->CR1 & ~SPI_QUEUE_CR1_MASK) | tmpcr1;
+  }
+
+  SPI_QueueMemInc(hspi->hdmatx, hspi->hdmatx->Init.MemInc);
+  SPI_QueueMemInc(hspi->hdmarx, hspi->hdmarx->Init.MemInc);
+
+  /* Stop a wait for the end of the last frame */
+  __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXE);
+
+  hspi->pQueueHead = NULL;
+  hspi->pQueueTail = NULL;
+  hspi->QueueStats.Pending = 0;
+}
+
+/**
+  * @brief  Clears the bus queue and its counters: the handle may not be
+  *         zero-initialized or may be left by a previous use.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *                the configuration information for SPI module.
+  * @retval None
+  */
+static void SPI_QueueReset(SPI_HandleTypeDef *hspi)
+{
+  hspi->pQueueHead = NULL;
+  hspi->pQueueTail = NULL;
+  hspi->QueueBsyCount = 0;
+  hspi->QueueStats.Bytes = 0;
+  hspi->QueueStats.Transfers = 0;
+  hspi->QueueStats.Pending = 0;
+  hspi->QueueStats.MaxPending = 0;
+  hspi->QueueStats.Reconfigurations = 0;
+}
+
+/**
+  * @brief  Sets the memory increment of a disabled DMA stream.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @param  MemInc: DMA_MINC_ENABLE or DMA_MINC_DISABLE
+  * @retval None
+  */
+static void SPI_QueueMemInc(DMA_HandleTypeDef *hdma, uint32_t MemInc)
+{
+  hdma->Instance->CR = (hdma->Instance->CR & ~DMA_SxCR_MINC) | MemInc;
+}
+
 /**
   * @brief This function handles SPI Communication Timeout.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
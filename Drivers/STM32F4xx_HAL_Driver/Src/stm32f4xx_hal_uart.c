@@ -106,6 +106,34 @@
        (+) Resume the DMA Transfer using HAL_UART_DMAResume()  
        (+) Stop the DMA Transfer using HAL_UART_DMAStop()      
     
+     *** Queued DMA transmission ***
+     ===============================
+     [..]
+       (+) Fill a UART_TxDescTypeDef descriptor with the data, their size and an optional
+            completion callback, and queue it using HAL_UART_TransmitQueue_DMA(), from a task
+            or an interrupt. The data are sent in place: they must stay valid until the
+            descriptor callback, or until HAL_UART_TxCpltCallback when it has none
+       (+) The DMA transfer complete interrupt starts the next descriptor, so that the queued
+            data are sent back to back
+       (+) HAL_UART_TxCpltCallback is executed once the queue is empty and the last byte has
+            left the UART
+       (+) Get the number of bytes and descriptors sent using HAL_UART_GetTxQueueStats()
+       (+) HAL_UART_DMAStop() stops the transmission and forgets the queued descriptors
+
+     *** Circular DMA reception ***
+     ==============================
+     [..]
+       (+) Configure the DMA Rx stream in DMA_CIRCULAR mode in HAL_UART_MspInit() and give
+            the DMA Rx stream and the UART interrupts the same preemption priority
+       (+) Start a continuous reception into a ring buffer using HAL_UART_ReceiveCircular_DMA()
+       (+) At each DMA half and full transfer, and each time the Rx line becomes idle after
+            a frame, HAL_UART_RxEventCallback is executed with the number of new bytes
+       (+) Read the received bytes with HAL_UART_RxCircularRead(), or in place with
+            HAL_UART_RxCircularPeek() and HAL_UART_RxCircularRelease(). The reader and the
+            interrupts share no lock: the read functions must be called from a single context
+       (+) Get the number of bytes lost on overruns using HAL_UART_GetRxOverrun()
+       (+) Stop the reception using HAL_UART_DMAStop()
+
      *** UART HAL driver macros list ***
      ============================================= 
      [..]
@@ -190,6 +218,13 @@ static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAError(DMA_HandleTypeDef *hdma); 
+static void UART_DMARxCircularEvent(DMA_HandleTypeDef *hdma);
+static void UART_DMATxQueueCplt(DMA_HandleTypeDef *hdma);
+static void UART_TxQueueStart(UART_HandleTypeDef *huart, UART_TxDescTypeDef *pDesc);
+static void UART_ResetQueues(UART_HandleTypeDef *huart);
+static void UART_RxCircularUpdate(UART_HandleTypeDef *huart);
+static uint32_t UART_RxCircularWritten(UART_HandleTypeDef *huart);
+static uint32_t UART_RxCircularPending(UART_HandleTypeDef *huart);
 static HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_t Flag, FlagStatus Status, uint32_t Timeout);
 /**
   * @}
@@ -284,6 +319,9 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
   /* Enable the peripheral */
   __HAL_UART_ENABLE(huart);
   
+  /* No Tx descriptor queued, no circular reception */
+  UART_ResetQueues(huart);
+  
   /* Initialize the UART state */
   huart->ErrorCode = HAL_UART_ERROR_NONE;
   huart->State= HAL_UART_STATE_READY;
@@ -339,6 +377,9 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
   /* Enable the peripheral */
   __HAL_UART_ENABLE(huart);
   
+  /* No Tx descriptor queued, no circular reception */
+  UART_ResetQueues(huart);
+  
   /* Initialize the UART state*/
   huart->ErrorCode = HAL_UART_ERROR_NONE;
   huart->State= HAL_UART_STATE_READY;
@@ -403,6 +444,9 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
   /* Enable the peripheral */
   __HAL_UART_ENABLE(huart);
   
+  /* No Tx descriptor queued, no circular reception */
+  UART_ResetQueues(huart);
+  
   /* Initialize the UART state*/
   huart->ErrorCode = HAL_UART_ERROR_NONE;
   huart->State= HAL_UART_STATE_READY;
@@ -471,6 +515,9 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
   /* Enable the peripheral */
   __HAL_UART_ENABLE(huart);
   
+  /* No Tx descriptor queued, no circular reception */
+  UART_ResetQueues(huart);
+  
   /* Initialize the UART state */
   huart->ErrorCode = HAL_UART_ERROR_NONE;
   huart->State= HAL_UART_STATE_READY;
@@ -500,6 +547,9 @@ HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
   /* DeInit the low level hardware */
   HAL_UART_MspDeInit(huart);
   
+  /* Drop the Tx descriptors still queued and the circular reception */
+  UART_ResetQueues(huart);
+  
   huart->ErrorCode = HAL_UART_ERROR_NONE;
   huart->State = HAL_UART_STATE_RESET;
 
@@ -576,11 +626,20 @@ HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
     (#) Non Blocking mode functions with DMA are:
         (++) HAL_UART_Transmit_DMA()
         (++) HAL_UART_Receive_DMA()
+        (++) HAL_UART_ReceiveCircular_DMA()
+        (++) HAL_UART_TransmitQueue_DMA()
+
+    (#) Ring buffer read functions of the circular DMA reception are:
+        (++) HAL_UART_RxCircularAvailable()
+        (++) HAL_UART_RxCircularRead()
+        (++) HAL_UART_RxCircularPeek()
+        (++) HAL_UART_RxCircularRelease()
 
     (#) A set of Transfer Complete Callbacks are provided in non blocking mode:
         (++) HAL_UART_TxCpltCallback()
         (++) HAL_UART_RxCpltCallback()
         (++) HAL_UART_ErrorCallback()
+        (++) HAL_UART_RxEventCallback()
 
     [..] 
       (@) In the Half duplex communication, it is forbidden to run the transmit 
@@ -1037,6 +1096,72 @@ HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData
     return HAL_BUSY; 
   }
 }
+
+/**
+  * @brief  Queues data to be sent in non blocking mode using DMA.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @param  pDesc: Descriptor of the data to send. It belongs to the driver until its
+  *         callback is executed and must not be queued twice.
+  * @note   This function can be called from a task or from an interrupt. The data are
+  *         sent right away when the queue is empty, otherwise after the data queued before.
+  * @retval HAL status: HAL_BUSY when a transmission outside the queue is ongoing.
+  */
+HAL_StatusTypeDef HAL_UART_TransmitQueue_DMA(UART_HandleTypeDef *huart, UART_TxDescTypeDef *pDesc)
+{
+  uint32_t primask;
+  uint32_t tmp1 = 0;
+  
+  if((pDesc == NULL) || (pDesc->pData == NULL) || (pDesc->Size == 0) || (huart->hdmatx == NULL))
+  {
+    return HAL_ERROR;
+  }
+  
+  pDesc->pNext = NULL;
+  
+  /* Tasks and interrupts may queue descriptors concurrently */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  
+  if(huart->pTxQueueHead == NULL)
+  {
+    /* A transmission outside the queue owns the transmitter */
+    tmp1 = huart->State;
+    if(((tmp1 == HAL_UART_STATE_BUSY_TX) || (tmp1 == HAL_UART_STATE_BUSY_TX_RX)) &&
+       (huart->hdmatx->XferCpltCallback != UART_DMATxQueueCplt))
+    {
+      __set_PRIMASK(primask);
+      return HAL_BUSY;
+    }
+    
+    if((tmp1 != HAL_UART_STATE_READY) && (tmp1 != HAL_UART_STATE_BUSY_RX) &&
+       (tmp1 != HAL_UART_STATE_BUSY_TX) && (tmp1 != HAL_UART_STATE_BUSY_TX_RX))
+    {
+      __set_PRIMASK(primask);
+      return HAL_BUSY;
+    }
+    
+    huart->pTxQueueHead = pDesc;
+    huart->pTxQueueTail = pDesc;
+    
+    UART_TxQueueStart(huart, pDesc);
+  }
+  else
+  {
+    huart->pTxQueueTail->pNext = pDesc;
+    huart->pTxQueueTail = pDesc;
+  }
+  
+  huart->TxQueueStats.Pending++;
+  if(huart->TxQueueStats.Pending > huart->TxQueueStats.MaxPending)
+  {
+    huart->TxQueueStats.MaxPending = huart->TxQueueStats.Pending;
+  }
+  
+  __set_PRIMASK(primask);
+  
+  return HAL_OK;
+}
     
 /**
   * @brief Pauses the DMA Transfer.
@@ -1128,11 +1253,24 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
   huart->Instance->CR3 &= ~USART_CR3_DMAT;
   huart->Instance->CR3 &= ~USART_CR3_DMAR;
   
+  /* Disable the idle line and error interrupts of a circular reception */
+  if(__HAL_UART_GET_IT_SOURCE(huart, UART_IT_IDLE) != RESET)
+  {
+    __HAL_UART_DISABLE_IT(huart, UART_IT_IDLE);
+    __HAL_UART_DISABLE_IT(huart, UART_IT_PE);
+    __HAL_UART_DISABLE_IT(huart, UART_IT_ERR);
+  }
+  
   /* Abort the UART DMA tx Stream */
   if(huart->hdmatx != NULL)
   {
     HAL_DMA_Abort(huart->hdmatx);
   }
+  
+  /* Forget the queued Tx descriptors */
+  huart->pTxQueueHead = NULL;
+  huart->pTxQueueTail = NULL;
+  huart->TxQueueStats.Pending = 0;
   /* Abort the UART DMA rx Stream */
   if(huart->hdmarx != NULL)
   {
@@ -1144,6 +1282,187 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
   return HAL_OK;
 }
 
+/**
+  * @brief  Receives data continuously in a ring buffer using a circular DMA.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @param  pData: Pointer to the ring buffer
+  * @param  Size: Size of the ring buffer
+  * @note   The DMA Rx stream must be configured in DMA_CIRCULAR mode. The reception
+  *         runs until HAL_UART_DMAStop() is called.
+  * @note   HAL_UART_RxEventCallback() is executed with the number of new bytes at
+  *         each DMA half and full transfer and when the Rx line becomes idle.
+  * @note   The DMA Rx stream interrupt and the UART interrupt must have the same
+  *         preemption priority.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UART_ReceiveCircular_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  uint32_t *tmp;
+  uint32_t tmp1 = 0;
+  
+  tmp1 = huart->State;    
+  if((tmp1 == HAL_UART_STATE_READY) || (tmp1 == HAL_UART_STATE_BUSY_TX))
+  {
+    if((pData == NULL ) || (Size == 0) || (huart->hdmarx->Init.Mode != DMA_CIRCULAR)) 
+    {
+      return HAL_ERROR;
+    }
+    
+    /* Process Locked */
+    __HAL_LOCK(huart);
+    
+    huart->pRxBuffPtr = pData;
+    huart->RxXferSize = Size;
+    /* RxXferCount holds the DMA counter seen at the last event */
+    huart->RxXferCount = Size;
+    
+    huart->RxHead = 0;
+    huart->RxTail = 0;
+    huart->RxReadPos = 0;
+    huart->RxLostCount = 0;
+    huart->RxOreCount = 0;
+    
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+    /* Check if a transmit process is ongoing or not */
+    if(huart->State == HAL_UART_STATE_BUSY_TX) 
+    {
+      huart->State = HAL_UART_STATE_BUSY_TX_RX;
+    }
+    else
+    {
+      huart->State = HAL_UART_STATE_BUSY_RX;
+    }
+    
+    /* Both DMA events report the bytes received since the previous event */
+    huart->hdmarx->XferCpltCallback = UART_DMARxCircularEvent;
+    huart->hdmarx->XferHalfCpltCallback = UART_DMARxCircularEvent;
+    
+    /* Set the DMA error callback */
+    huart->hdmarx->XferErrorCallback = UART_DMAError;
+
+    /* Enable the DMA Stream */
+    tmp = (uint32_t*)&pData;
+    HAL_DMA_Start_IT(huart->hdmarx, (uint32_t)&huart->Instance->DR, *(uint32_t*)tmp, Size);
+    
+    /* Clear a pending idle line so that the first event follows a real frame */
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+    
+    /* Enable the UART Idle line, Parity Error and Error (Frame error, noise error,
+       overrun error) interrupts */
+    __HAL_UART_ENABLE_IT(huart, UART_IT_IDLE);
+    __HAL_UART_ENABLE_IT(huart, UART_IT_PE);
+    __HAL_UART_ENABLE_IT(huart, UART_IT_ERR);
+    
+    /* Enable the DMA transfer for the receiver request by setting the DMAR bit 
+    in the UART CR3 register */
+    huart->Instance->CR3 |= USART_CR3_DMAR;
+    
+    /* Process Unlocked */
+    __HAL_UNLOCK(huart);
+    
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY; 
+  }
+}
+
+/**
+  * @brief  Returns the number of received bytes not read yet in circular reception.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval Number of bytes available
+  */
+uint16_t HAL_UART_RxCircularAvailable(UART_HandleTypeDef *huart)
+{
+  return (uint16_t)UART_RxCircularPending(huart);
+}
+
+/**
+  * @brief  Copies received bytes out of the ring buffer in circular reception.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @param  pData: Pointer to the destination buffer
+  * @param  Size: Maximum number of bytes to copy
+  * @retval Number of bytes copied
+  */
+uint16_t HAL_UART_RxCircularRead(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  uint8_t *pBlock;
+  uint16_t count = 0, block, i;
+  
+  /* The data may wrap at the end of the ring buffer: at most two blocks */
+  while(count < Size)
+  {
+    block = HAL_UART_RxCircularPeek(huart, &pBlock);
+    if(block == 0)
+    {
+      break;
+    }
+    if(block > (Size - count))
+    {
+      block = Size - count;
+    }
+    
+    for(i = 0; i < block; i++)
+    {
+      pData[count + i] = pBlock[i];
+    }
+    HAL_UART_RxCircularRelease(huart, block);
+    count += block;
+  }
+  
+  /* Drop the copy if the DMA overwrote the bytes while they were copied */
+  if((UART_RxCircularWritten(huart) - (huart->RxTail - count)) > huart->RxXferSize)
+  {
+    huart->RxLostCount += count;
+    count = 0;
+  }
+  
+  return count;
+}
+
+/**
+  * @brief  Gives the oldest received bytes in place in circular reception.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @param  ppData: Set to the first byte not read yet
+  * @note   The bytes remain in the ring buffer until HAL_UART_RxCircularRelease()
+  *         is called; the DMA overwrites them after one more turn of the buffer.
+  * @retval Number of contiguous bytes available at *ppData
+  */
+uint16_t HAL_UART_RxCircularPeek(UART_HandleTypeDef *huart, uint8_t **ppData)
+{
+  uint32_t pending = UART_RxCircularPending(huart);
+  uint32_t contiguous = huart->RxXferSize - huart->RxReadPos;
+  
+  *ppData = &huart->pRxBuffPtr[huart->RxReadPos];
+  
+  return (uint16_t)((pending < contiguous) ? pending : contiguous);
+}
+
+/**
+  * @brief  Frees bytes given by HAL_UART_RxCircularPeek() in circular reception.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @param  Size: Number of bytes consumed, at most the value returned by
+  *         HAL_UART_RxCircularPeek()
+  * @retval None
+  */
+void HAL_UART_RxCircularRelease(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  uint32_t pos = huart->RxReadPos + Size;
+  
+  if(pos >= huart->RxXferSize)
+  {
+    pos -= huart->RxXferSize;
+  }
+  huart->RxReadPos = (uint16_t)pos;
+  huart->RxTail += Size;
+}
+
 /**
   * @brief  This function handles UART interrupt request.
   * @param  huart: pointer to a UART_HandleTypeDef structure that contains
@@ -1217,13 +1536,38 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
   {
     UART_EndTransmit_IT(huart);
   }
+  
+  tmp1 = __HAL_UART_GET_FLAG(huart, UART_FLAG_IDLE);
+  tmp2 = __HAL_UART_GET_IT_SOURCE(huart, UART_IT_IDLE);
+  /* UART Idle line in circular reception -------------------------------------*/
+  if((tmp1 != RESET) && (tmp2 != RESET))
+  {
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+    
+    UART_RxCircularUpdate(huart);
+  }
 
   if(huart->ErrorCode != HAL_UART_ERROR_NONE)
   {
-    /* Set the UART state ready to be able to start again the process */
-    huart->State = HAL_UART_STATE_READY;
-    
-    HAL_UART_ErrorCallback(huart);
+    if(__HAL_UART_GET_IT_SOURCE(huart, UART_IT_IDLE) != RESET)
+    {
+      /* The circular reception goes on: report and forget the error */
+      if((huart->ErrorCode & HAL_UART_ERROR_ORE) != 0)
+      {
+        huart->RxOreCount++;
+      }
+      
+      HAL_UART_ErrorCallback(huart);
+      
+      huart->ErrorCode = HAL_UART_ERROR_NONE;
+    }
+    else
+    {
+      /* Set the UART state ready to be able to start again the process */
+      huart->State = HAL_UART_STATE_READY;
+      
+      HAL_UART_ErrorCallback(huart);
+    }
   }  
 }
 
@@ -1292,6 +1636,20 @@ __weak void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
    */ 
 }
 
+/**
+  * @brief  Rx event callbacks of the circular reception.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @param  Size: Number of new bytes in the ring buffer
+  * @retval None
+  */
+__weak void HAL_UART_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  /* NOTE: This function Should not be modified, when the callback is needed,
+           the HAL_UART_RxEventCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -1508,6 +1866,37 @@ uint32_t HAL_UART_GetError(UART_HandleTypeDef *huart)
   return huart->ErrorCode;
 }
 
+/**
+  * @brief  Return the number of bytes lost by the circular reception.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @note   Counts the unread bytes dropped when the DMA wrapped over them, plus one
+  *         byte for each UART overrun error.
+  * @retval Number of bytes lost since HAL_UART_ReceiveCircular_DMA()
+  */
+uint32_t HAL_UART_GetRxOverrun(UART_HandleTypeDef *huart)
+{
+  return huart->RxLostCount + huart->RxOreCount;
+}
+
+/**
+  * @brief  Return the counters of the Tx queue.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @param  pStats: Set to the counters since the UART initialization.
+  * @retval None
+  */
+void HAL_UART_GetTxQueueStats(UART_HandleTypeDef *huart, UART_TxQueueStatsTypeDef *pStats)
+{
+  uint32_t primask;
+  
+  /* Copy the counters consistently with the DMA interrupt */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *pStats = huart->TxQueueStats;
+  __set_PRIMASK(primask);
+}
+
 /**
   * @}
   */
@@ -1605,11 +1994,238 @@ static void UART_DMAError(DMA_HandleTypeDef *hdma)
   UART_HandleTypeDef* huart = ( UART_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
   huart->RxXferCount = 0;
   huart->TxXferCount = 0;
+  /* The Tx queue stops with its transfer: forget the queued descriptors */
+  if(hdma == huart->hdmatx)
+  {
+    huart->pTxQueueHead = NULL;
+    huart->pTxQueueTail = NULL;
+    huart->TxQueueStats.Pending = 0;
+  }
   huart->State= HAL_UART_STATE_READY;
   huart->ErrorCode |= HAL_UART_ERROR_DMA;
   HAL_UART_ErrorCallback(huart);
 }
 
+/**
+  * @brief  DMA UART queued transmit process complete callback: sends the next
+  *         queued descriptor and then completes the one just sent.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void UART_DMATxQueueCplt(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef* huart = (UART_HandleTypeDef*)((DMA_HandleTypeDef*)hdma)->Parent;
+  UART_TxDescTypeDef *pDesc;
+  uint32_t primask;
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  
+  pDesc = huart->pTxQueueHead;
+  huart->pTxQueueHead = pDesc->pNext;
+  
+  huart->TxQueueStats.Bytes += pDesc->Size;
+  huart->TxQueueStats.Transfers++;
+  huart->TxQueueStats.Pending--;
+  
+  if(huart->pTxQueueHead != NULL)
+  {
+    /* Chain the next descriptor while the UART shifts out the last bytes */
+    UART_TxQueueStart(huart, huart->pTxQueueHead);
+  }
+  else
+  {
+    huart->pTxQueueTail = NULL;
+    huart->TxXferCount = 0;
+    
+    /* Disable the DMA transfer for transmit request by setting the DMAT bit
+       in the UART CR3 register */
+    huart->Instance->CR3 &= (uint32_t)~((uint32_t)USART_CR3_DMAT);
+    
+    /* Enable the UART Transmit Complete Interrupt */
+    __HAL_UART_ENABLE_IT(huart, UART_IT_TC);
+  }
+  
+  __set_PRIMASK(primask);
+  
+  if(pDesc->XferCpltCallback != NULL)
+  {
+    pDesc->XferCpltCallback(huart, pDesc);
+  }
+}
+
+/**
+  * @brief  Starts the DMA transfer of a queued descriptor. Called with the
+  *         interrupts disabled.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @param  pDesc: Descriptor to send
+  * @retval None
+  */
+static void UART_TxQueueStart(UART_HandleTypeDef *huart, UART_TxDescTypeDef *pDesc)
+{
+  huart->pTxBuffPtr = (uint8_t *)pDesc->pData;
+  huart->TxXferSize = pDesc->Size;
+  huart->TxXferCount = pDesc->Size;
+  
+  /* Check if a receive process is ongoing or not */
+  if(huart->State == HAL_UART_STATE_BUSY_RX) 
+  {
+    huart->State = HAL_UART_STATE_BUSY_TX_RX;
+  }
+  else if(huart->State == HAL_UART_STATE_READY)
+  {
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+    huart->State = HAL_UART_STATE_BUSY_TX;
+  }
+  
+  /* The end of a previous queue may still be awaited */
+  __HAL_UART_DISABLE_IT(huart, UART_IT_TC);
+  
+  huart->hdmatx->XferCpltCallback = UART_DMATxQueueCplt;
+  huart->hdmatx->XferHalfCpltCallback = NULL;
+  huart->hdmatx->XferErrorCallback = UART_DMAError;
+  
+  HAL_DMA_Start_IT(huart->hdmatx, (uint32_t)pDesc->pData, (uint32_t)&huart->Instance->DR, pDesc->Size);
+  
+  /* Clear the TC flag in the SR register by writing 0 to it */
+  __HAL_UART_CLEAR_FLAG(huart, UART_FLAG_TC);
+  
+  /* Enable the DMA transfer for transmit request by setting the DMAT bit
+     in the UART CR3 register */
+  huart->Instance->CR3 |= USART_CR3_DMAT;
+}
+
+/**
+  * @brief  DMA UART circular reception half and full transfer callback.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void UART_DMARxCircularEvent(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef* huart = (UART_HandleTypeDef*)((DMA_HandleTypeDef*)hdma)->Parent;
+  
+  UART_RxCircularUpdate(huart);
+}
+
+/**
+  * @brief  Clears the Tx queue and the circular reception fields of the handle,
+  *         which may not be zero-initialized or may be left by a previous use.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+static void UART_ResetQueues(UART_HandleTypeDef *huart)
+{
+  huart->RxHead = 0;
+  huart->RxTail = 0;
+  huart->RxReadPos = 0;
+  huart->RxLostCount = 0;
+  huart->RxOreCount = 0;
+  
+  huart->pTxQueueHead = NULL;
+  huart->pTxQueueTail = NULL;
+  huart->TxQueueStats.Bytes = 0;
+  huart->TxQueueStats.Transfers = 0;
+  huart->TxQueueStats.Pending = 0;
+  huart->TxQueueStats.MaxPending = 0;
+}
+
+/**
+  * @brief  Accounts the bytes written by the DMA since the previous Rx event and
+  *         reports them. Called from the DMA Rx and the UART interrupts only.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+static void UART_RxCircularUpdate(UART_HandleTypeDef *huart)
+{
+  uint32_t counter = __HAL_DMA_GET_COUNTER(huart->hdmarx);
+  uint32_t received;
+  
+  /* The counter reloads to the buffer size when it reaches zero */
+  if(counter == 0)
+  {
+    counter = huart->RxXferSize;
+  }
+  
+  if(counter <= huart->RxXferCount)
+  {
+    received = huart->RxXferCount - counter;
+  }
+  else
+  {
+    received = huart->RxXferCount + huart->RxXferSize - counter;
+  }
+  
+  /* An idle line right after a DMA event reports nothing new */
+  if(received != 0)
+  {
+    huart->RxXferCount = (uint16_t)counter;
+    huart->RxHead += received;
+    
+    HAL_UART_RxEventCallback(huart, (uint16_t)received);
+  }
+}
+
+/**
+  * @brief  Returns the number of bytes written by the DMA since the start of the
+  *         circular reception, including those not reported by an Rx event yet.
+  *         Only reads the state updated by the interrupts.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval Number of bytes written
+  */
+static uint32_t UART_RxCircularWritten(UART_HandleTypeDef *huart)
+{
+  uint32_t head, last, counter;
+  
+  /* The interrupts update RxXferCount then RxHead: retry if one ran meanwhile */
+  do
+  {
+    head = huart->RxHead;
+    last = huart->RxXferCount;
+    counter = __HAL_DMA_GET_COUNTER(huart->hdmarx);
+  } while(head != huart->RxHead);
+  
+  if(counter == 0)
+  {
+    counter = huart->RxXferSize;
+  }
+  
+  if(counter <= last)
+  {
+    return head + (last - counter);
+  }
+  else
+  {
+    return head + (last + huart->RxXferSize - counter);
+  }
+}
+
+/**
+  * @brief  Returns the number of bytes not read yet in circular reception. When the
+  *         DMA has wrapped over unread bytes, they are dropped and counted as lost.
+  *         Called from the reading context only.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval Number of bytes available
+  */
+static uint32_t UART_RxCircularPending(UART_HandleTypeDef *huart)
+{
+  uint32_t pending = UART_RxCircularWritten(huart) - huart->RxTail;
+  
+  if(pending > huart->RxXferSize)
+  {
+    huart->RxLostCount += pending;
+    huart->RxReadPos = (uint16_t)((huart->RxReadPos + pending) % huart->RxXferSize);
+    huart->RxTail += pending;
+    pending = 0;
+  }
+  
+  return pending;
+}
+
 /**
   * @brief  This function handles UART Communication Timeout.
   * @param  huart: pointer to a UART_HandleTypeDef structure that contains
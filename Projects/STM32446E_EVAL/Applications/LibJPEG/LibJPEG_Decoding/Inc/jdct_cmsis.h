@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * @file    LibJPEG/LibJPEG_Decoding/Inc/jdct_cmsis.h 
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    13-March-2015
+  * @brief   header of jdct_cmsis.c file
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __JDCT_CMSIS_H
+#define __JDCT_CMSIS_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "jpeglib.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* DCT method selecting the CMSIS-DSP 8x8 DCT kernels (arm_dct8x8_q15 and 
+   arm_idct8x8_q15). The codec runs with JDCT_ISLOW, whose per-component DCT 
+   routines are then replaced by jpeg_cmsis_fdct_enable() or 
+   jpeg_cmsis_idct_enable() once the codec is started. */
+#define JDCT_CMSIS  ((J_DCT_METHOD) (JDCT_FLOAT + 1))
+
+/* Exported functions ------------------------------------------------------- */
+void jpeg_cmsis_fdct_enable(j_compress_ptr cinfo);
+void jpeg_cmsis_idct_enable(j_decompress_ptr cinfo);
+
+#endif /* __JDCT_CMSIS_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -55,6 +55,7 @@ void OTG_FS_IRQHandler(void);
 void OTG_HS_IRQHandler(void);
 #endif
 void USARTx_DMA_TX_IRQHandler(void);
+void USARTx_DMA_RX_IRQHandler(void);
 void USARTx_IRQHandler(void);
 void TIMx_IRQHandler(void);
 
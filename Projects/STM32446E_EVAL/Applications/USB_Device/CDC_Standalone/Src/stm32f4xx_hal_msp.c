@@ -59,6 +59,7 @@
 void HAL_UART_MspInit(UART_HandleTypeDef *huart)
 {
   static DMA_HandleTypeDef hdma_tx;
+  static DMA_HandleTypeDef hdma_rx;
   GPIO_InitTypeDef  GPIO_InitStruct;
   
   /*##-1- Enable peripherals and GPIO Clocks #################################*/
@@ -109,11 +110,38 @@ void HAL_UART_MspInit(UART_HandleTypeDef *huart)
   
   /* Associate the initialized DMA handle to the UART handle */
   __HAL_LINKDMA(huart, hdmatx, hdma_tx);
+
+  /* Configure the DMA handler for reception process: the DMA writes the
+     received data continuously in a ring buffer */
+  hdma_rx.Instance                 = USARTx_RX_DMA_STREAM;
+
+  hdma_rx.Init.Channel             = USARTx_RX_DMA_CHANNEL;
+  hdma_rx.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+  hdma_rx.Init.PeriphInc           = DMA_PINC_DISABLE;
+  hdma_rx.Init.MemInc              = DMA_MINC_ENABLE;
+  hdma_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_rx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  hdma_rx.Init.Mode                = DMA_CIRCULAR;
+  hdma_rx.Init.Priority            = DMA_PRIORITY_HIGH;
+  hdma_rx.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+  hdma_rx.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+  hdma_rx.Init.MemBurst            = DMA_MBURST_INC4;
+  hdma_rx.Init.PeriphBurst         = DMA_PBURST_INC4;
+
+  HAL_DMA_Init(&hdma_rx);
+
+  /* Associate the initialized DMA handle to the UART handle */
+  __HAL_LINKDMA(huart, hdmarx, hdma_rx);
   
   /*##-5- Configure the NVIC for DMA #########################################*/   
   /* NVIC configuration for DMA transfer complete interrupt (USARTx_TX) */
   HAL_NVIC_SetPriority(USARTx_DMA_TX_IRQn, 6, 0);
   HAL_NVIC_EnableIRQ(USARTx_DMA_TX_IRQn);
+
+  /* NVIC configuration for DMA half and full transfer interrupts (USARTx_RX):
+     same priority as the UART interrupt, which also reports received data */
+  HAL_NVIC_SetPriority(USARTx_DMA_RX_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(USARTx_DMA_RX_IRQn);
   
   /*##-6- Enable TIM peripherals Clock #######################################*/
   TIMx_CLK_ENABLE();
@@ -149,6 +177,7 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef *huart)
   
   /*##-3- Disable the NVIC for UART ##########################################*/
   HAL_NVIC_DisableIRQ(USARTx_IRQn);
+  HAL_NVIC_DisableIRQ(USARTx_DMA_RX_IRQn);
   
   /*##-4- Reset TIM peripheral ###############################################*/
   TIMx_FORCE_RESET();
@@ -180,6 +180,16 @@ void USARTx_DMA_TX_IRQHandler(void)
   HAL_DMA_IRQHandler(UartHandle.hdmatx);
 }
 
+/**
+  * @brief  This function handles DMA Rx interrupt request.
+  * @param  None
+  * @retval None
+  */
+void USARTx_DMA_RX_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(UartHandle.hdmarx);
+}
+
 /**
   * @brief  This function handles UART interrupt request.  
   * @param  None
@@ -205,6 +205,9 @@ void HAL_PCD_DataOutStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 void HAL_PCD_DataInStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 {
   USBD_LL_DataInStage(hpcd->pData, epnum, hpcd->IN_ep[epnum].xfer_buff);
+  
+  /* Release the UART bytes sent in place by the CDC interface */
+  CDC_Itf_DataIn(hpcd->pData, epnum);
 }
 
 /**
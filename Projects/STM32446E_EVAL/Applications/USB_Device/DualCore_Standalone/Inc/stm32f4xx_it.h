@@ -52,6 +52,7 @@ void SysTick_Handler(void);
 void OTG_FS_IRQHandler(void);
 void OTG_HS_IRQHandler(void);
 void USARTx_DMA_TX_IRQHandler(void);
+void USARTx_DMA_RX_IRQHandler(void);
 void USARTx_IRQHandler(void);
 void TIMx_IRQHandler(void);
 
@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * @file    FatFs/FatFs_uSD_DMA_RTOS/Inc/main.h 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Header for main.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MAIN_H
+#define __MAIN_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/* EVAL includes component */
+#include "stm324x9i_eval.h"
+
+/* FatFs includes component */
+#include "ff_gen_drv.h"
+#include "sd_diskio_dma.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Result of one benchmark pass */
+typedef struct
+{
+  uint32_t Write;             /* 1 for f_write() calls, 0 for f_read() calls         */
+  uint32_t AccessSize;        /* Bytes transferred by each call                      */
+  uint32_t Throughput;        /* KBytes/s, including the closing of the file         */
+  uint32_t LatencyAvg;        /* Average duration of a call in us                    */
+  uint32_t LatencyMax;        /* Longest call in us                                  */
+  uint32_t CpuFree;           /* Percentage of CPU left to the lower priority thread */
+  SD_StatsTypeDef Stats;      /* SD disk I/O driver statistics of the pass           */
+}BenchResultTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Benchmark file size and access sizes in bytes */
+#define BENCH_FILE_SIZE       ((uint32_t)(1024 * 1024))
+#define BENCH_SMALL_ACCESS    ((uint32_t)512)
+#define BENCH_LARGE_ACCESS    ((uint32_t)(32 * 1024))
+#define BENCH_PASSES          4
+
+#endif /* __MAIN_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * @file    FatFs/FatFs_uSD_DMA_RTOS/Inc/sd_diskio_dma.h
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Header for sd_diskio_dma.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SD_DISKIO_DMA_H
+#define __SD_DISKIO_DMA_H
+
+/* Includes ------------------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* SD disk I/O driver statistics */
+typedef struct
+{
+  uint32_t ReadTransfers;     /* Read transfers issued to the card                   */
+  uint32_t WriteTransfers;    /* Write transfers issued to the card                  */
+  uint32_t CacheHits;         /* Sectors read from the read-ahead cache              */
+  uint32_t CacheMisses;       /* Sectors read from the card                          */
+  uint32_t QueuedSectors;     /* Sectors accepted by the write queue                 */
+  uint32_t CoalescedSectors;  /* Queued sectors merged into a pending extent         */
+}SD_StatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+extern Diskio_drvTypeDef  SD_Driver;
+
+DRESULT SD_Suspend(void);
+void    SD_Resume(void);
+
+#if (SD_DISKIO_STATS == 1)
+void SD_GetStats(SD_StatsTypeDef *pStats);
+void SD_ResetStats(void);
+#endif /* SD_DISKIO_STATS == 1 */
+
+#endif /* __SD_DISKIO_DMA_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,406 @@
+/**
+  ******************************************************************************
+  * @file    FatFs/FatFs_uSD_DMA_RTOS/Src/main.c 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Main program body
+  *          This sample code shows how to use FatFs with uSD card drive in RTOS
+  *          mode with a DMA based disk I/O driver, and measures its throughput
+  *          and latency with small and large file accesses.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+FATFS SDFatFs;  /* File system object for SD card logical drive */
+FIL MyFile;     /* File object */
+char SDPath[4]; /* SD card logical drive path */
+
+/* Benchmark buffer, word aligned for the DMA */
+static uint32_t aBenchBuffer[BENCH_LARGE_ACCESS / 4];
+
+/* Loops of the load thread, and loops per ms when the CPU is idle */
+static __IO uint32_t uwLoadCount = 0;
+static uint32_t uwLoadPerMs = 0;
+
+/* Benchmark results, to be read with the debugger */
+BenchResultTypeDef aBenchResults[BENCH_PASSES];
+
+/* Private function prototypes -----------------------------------------------*/
+static void SystemClock_Config(void);
+static void Error_Handler(void);
+static void StartThread(void const *argument);
+static void LoadThread(void const *argument);
+static void Bench_Init(void);
+static void Bench_Fill(uint32_t Offset, uint32_t Size);
+static uint32_t Bench_Check(uint32_t Offset, uint32_t Size);
+static uint32_t Bench_Run(uint32_t Write, uint32_t AccessSize, BenchResultTypeDef *pResult);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval None
+  */
+int main(void)
+{
+  /* STM32F4xx HAL library initialization:
+       - Configure the Flash prefetch, instruction and Data caches
+       - Configure the Systick to generate an interrupt each 1 msec
+       - Set NVIC Group Priority to 4
+       - Global MSP (MCU Support Package) initialization
+     */
+  HAL_Init();
+ 
+  /* Configure the system clock to 175 MHz */
+  SystemClock_Config();
+  
+  /* Configure LED1 and LED3 */
+  BSP_LED_Init(LED1);
+  BSP_LED_Init(LED3);  
+  
+  /*##-1- Start tasks ########################################################*/
+  osThreadDef(uSDThread, StartThread, osPriorityNormal, 0, 8 * configMINIMAL_STACK_SIZE);
+  osThreadCreate(osThread(uSDThread), NULL);
+  
+  /* The load thread only runs when the uSD thread sleeps */
+  osThreadDef(LoadThread, LoadThread, osPriorityLow, 0, configMINIMAL_STACK_SIZE);
+  osThreadCreate(osThread(LoadThread), NULL);
+  
+  /*##-2- Start scheduler ####################################################*/
+  osKernelStart();
+
+  /* We should never get here as control is now taken by the scheduler */
+  for( ;; );
+}
+
+/**
+  * @brief  Start task
+  * @param  pvParameters not used
+  * @retval None
+  */
+static void StartThread(void const *argument)
+{
+  uint32_t pass = 0;
+  
+  Bench_Init();
+  
+  /*##-1- Link the micro SD disk I/O driver ##################################*/
+  if(FATFS_LinkDriver(&SD_Driver, SDPath) == 0)
+  {  
+    /*##-2- Register the file system object to the FatFs module ##############*/
+    if(f_mount(&SDFatFs, (TCHAR const*)SDPath, 0) != FR_OK)
+    {
+      /* FatFs Initialization Error */
+      Error_Handler();
+    }
+    
+    /*##-3- Create a FAT file system (format) on the logical drive ###########*/
+    /* WARNING: Formatting the uSD card will delete all content on the device */
+    if(f_mkfs((TCHAR const*)SDPath, 0, 0) != FR_OK)
+    {
+      /* FatFs Format Error */
+      Error_Handler();
+    }
+    
+    /*##-4- Write then read the benchmark file with small and large accesses #*/
+    if((Bench_Run(1, BENCH_SMALL_ACCESS, &aBenchResults[pass++]) != 0) ||
+       (Bench_Run(1, BENCH_LARGE_ACCESS, &aBenchResults[pass++]) != 0) ||
+       (Bench_Run(0, BENCH_SMALL_ACCESS, &aBenchResults[pass++]) != 0) ||
+       (Bench_Run(0, BENCH_LARGE_ACCESS, &aBenchResults[pass++]) != 0))
+    {
+      /* Benchmark file access or data check error */
+      Error_Handler();
+    }
+    
+    /* Success of the benchmark: aBenchResults can be read */
+    BSP_LED_On(LED1);
+  }
+  
+  /*##-5- Unlink the micro SD disk I/O driver ################################*/
+  FATFS_UnLinkDriver(SDPath);
+  
+  /* Infinite Loop */
+  for( ;; )
+  {
+  }
+}
+
+/**
+  * @brief  Load task: counts the CPU time left by the uSD task
+  * @param  pvParameters not used
+  * @retval None
+  */
+static void LoadThread(void const *argument)
+{
+  for( ;; )
+  {
+    uwLoadCount++;
+  }
+}
+
+/**
+  * @brief  Enables the cycle counter and measures the load thread speed
+  * @param  None
+  * @retval None
+  */
+static void Bench_Init(void)
+{
+  uint32_t count;
+  
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  
+  /* The load thread gets the whole CPU while this thread sleeps */
+  count = uwLoadCount;
+  osDelay(100);
+  uwLoadPerMs = (uwLoadCount - count) / 100;
+  
+  if(uwLoadPerMs == 0)
+  {
+    uwLoadPerMs = 1;
+  }
+}
+
+/**
+  * @brief  Fills the benchmark buffer with the pattern of a file area
+  * @param  Offset: Offset of the area in the file, multiple of 4
+  * @param  Size: Size of the area in bytes, multiple of 4
+  * @retval None
+  */
+static void Bench_Fill(uint32_t Offset, uint32_t Size)
+{
+  uint32_t i;
+  
+  for(i = 0; i < Size / 4; i++)
+  {
+    aBenchBuffer[i] = (Offset + (i * 4)) ^ 0xA5A5A5A5;
+  }
+}
+
+/**
+  * @brief  Checks the benchmark buffer against the pattern of a file area
+  * @param  Offset: Offset of the area in the file, multiple of 4
+  * @param  Size: Size of the area in bytes, multiple of 4
+  * @retval 0 if the data is correct, 1 otherwise
+  */
+static uint32_t Bench_Check(uint32_t Offset, uint32_t Size)
+{
+  uint32_t i;
+  
+  for(i = 0; i < Size / 4; i++)
+  {
+    if(aBenchBuffer[i] != ((Offset + (i * 4)) ^ 0xA5A5A5A5))
+    {
+      return 1;
+    }
+  }
+  
+  return 0;
+}
+
+/**
+  * @brief  Writes or reads the whole benchmark file with accesses of one size
+  * @note   The time spent to fill and check the buffer is not counted in the
+  *         latencies, but is counted in the throughput.
+  * @param  Write: 1 to write the file, 0 to read it
+  * @param  AccessSize: Bytes transferred by each f_write()/f_read() call
+  * @param  pResult: Result of the pass
+  * @retval 0 if the pass succeeded, 1 otherwise
+  */
+static uint32_t Bench_Run(uint32_t Write, uint32_t AccessSize, BenchResultTypeDef *pResult)
+{
+  FRESULT res;
+  UINT bytes;
+  uint32_t offset, cycles, total = 0, max = 0;
+  uint32_t tickstart, elapsed, loadstart;
+  
+  SD_ResetStats();
+  
+  tickstart = HAL_GetTick();
+  loadstart = uwLoadCount;
+  
+  if(f_open(&MyFile, "BENCH.BIN", Write ? (FA_CREATE_ALWAYS | FA_WRITE) : FA_READ) != FR_OK)
+  {
+    return 1;
+  }
+  
+  for(offset = 0; offset < BENCH_FILE_SIZE; offset += AccessSize)
+  {
+    if(Write)
+    {
+      Bench_Fill(offset, AccessSize);
+    }
+    
+    cycles = DWT->CYCCNT;
+    
+    if(Write)
+    {
+      res = f_write(&MyFile, aBenchBuffer, AccessSize, &bytes);
+    }
+    else
+    {
+      res = f_read(&MyFile, aBenchBuffer, AccessSize, &bytes);
+    }
+    
+    cycles = DWT->CYCCNT - cycles;
+    
+    if((res != FR_OK) || (bytes != AccessSize))
+    {
+      f_close(&MyFile);
+      return 1;
+    }
+    
+    if((!Write) && (Bench_Check(offset, AccessSize) != 0))
+    {
+      f_close(&MyFile);
+      return 1;
+    }
+    
+    total += cycles;
+    if(cycles > max)
+    {
+      max = cycles;
+    }
+  }
+  
+  /* Closing the file writes the sectors still queued by the driver */
+  if(f_close(&MyFile) != FR_OK)
+  {
+    return 1;
+  }
+  
+  elapsed = HAL_GetTick() - tickstart;
+  if(elapsed == 0)
+  {
+    elapsed = 1;
+  }
+  
+  pResult->Write      = Write;
+  pResult->AccessSize = AccessSize;
+  pResult->Throughput = (BENCH_FILE_SIZE / 1024) * 1000 / elapsed;
+  pResult->LatencyAvg = (total / (BENCH_FILE_SIZE / AccessSize)) / (SystemCoreClock / 1000000);
+  pResult->LatencyMax = max / (SystemCoreClock / 1000000);
+  pResult->CpuFree    = ((uwLoadCount - loadstart) / elapsed) * 100 / uwLoadPerMs;
+  SD_GetStats(&pResult->Stats);
+  
+  return 0;
+}
+
+/**
+  * @brief  System Clock Configuration
+  *         The system Clock is configured as follow : 
+  *            System Clock source            = PLL (HSE)
+  *            SYSCLK(Hz)                     = 175000000
+  *            HCLK(Hz)                       = 175000000
+  *            AHB Prescaler                  = 1
+  *            APB1 Prescaler                 = 4
+  *            APB2 Prescaler                 = 2
+  *            HSE Frequency(Hz)              = 25000000
+  *            PLL_M                          = 25
+  *            PLL_N                          = 350
+  *            PLL_P                          = 2
+  *            PLL_Q                          = 7
+  *            VDD(V)                         = 3.3
+  *            Main regulator output voltage  = Scale1 mode
+  *            Flash Latency(WS)              = 5
+  * @param  None
+  * @retval None
+  */
+static void SystemClock_Config(void)
+{
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+
+  /* Enable Power Control clock */
+  __HAL_RCC_PWR_CLK_ENABLE();
+
+  /* The voltage scaling allows optimizing the power consumption when the device is 
+     clocked below the maximum system frequency, to update the voltage scaling value 
+     regarding system frequency refer to product datasheet.  */
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+  /* Enable HSE Oscillator and activate PLL with HSE as source */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+  RCC_OscInitStruct.PLL.PLLM = 25;
+  RCC_OscInitStruct.PLL.PLLN = 350;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+  RCC_OscInitStruct.PLL.PLLQ = 7;
+  HAL_RCC_OscConfig(&RCC_OscInitStruct);
+  
+  /* Activate the Over-Drive mode */
+  HAL_PWREx_EnableOverDrive();
+  
+  /* Select PLL as system clock source and configure the HCLK, PCLK1 and PCLK2 
+     clocks dividers */
+  RCC_ClkInitStruct.ClockType = (RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2);
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;  
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;  
+  HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5);
+}
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @param  None
+  * @retval None
+  */
+static void Error_Handler(void)
+{
+  /* Turn LED3 on */
+  BSP_LED_On(LED3);
+  while(1)
+  {
+  }
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t* file, uint32_t line)
+{ 
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+#endif
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
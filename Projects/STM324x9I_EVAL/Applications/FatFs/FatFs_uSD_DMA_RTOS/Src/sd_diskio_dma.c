@@ -0,0 +1,897 @@
+/**
+  ******************************************************************************
+  * @file    FatFs/FatFs_uSD_DMA_RTOS/Src/sd_diskio_dma.c
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   SD Disk I/O driver using DMA transfers in RTOS mode
+  *
+  *          The driver never masks the interrupts:
+  *           - Transfers are performed by the SDIO DMA streams and the calling
+  *             thread sleeps on a semaphore released by the DMA/SDIO interrupts.
+  *           - Writes are queued in a few runs of consecutive sectors. A write
+  *             adjacent to or overlapping a pending run is merged into it, and
+  *             each run is written with a single multi-block command when the
+  *             queue is full, when a read needs the sectors or on CTRL_SYNC.
+  *           - Reads are served from a read-ahead cache, refilled with
+  *             SD_CACHE_SECTORS sectors when the accesses are sequential.
+  *           - Accesses of at least a cache (read) or a run (write) of sectors
+  *             to a DMA capable buffer are transferred directly.
+  *           - The end of the card programming is not waited for after a write,
+  *             but before the next command, so that it overlaps the processing
+  *             of the calling thread.
+  *           - SD_Suspend() lends the card to the USB mass storage device,
+  *             which accesses it from the USB interrupt: the queued sectors
+  *             are written, the cache is dropped and the driver reports the
+  *             disk as not ready until SD_Resume() is called. The card is
+  *             then initialized and the volume mounted again, since the host
+  *             may have changed it.
+  *           - With SD_DISKIO_STATS set to 1 in ffconf.h, the transfers, the
+  *             cache hits and the queued sectors are counted: see
+  *             SD_GetStats().
+  *
+  *          The driver is also used by the STM324x9I_EVAL demonstrations.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "ff_gen_drv.h"
+#include "cmsis_os.h"
+#include "sd_diskio_dma.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Block Size in Bytes */
+#define BLOCK_SIZE                512
+
+/* Sectors held by the read-ahead cache, also used to bounce unaligned reads */
+#define SD_CACHE_SECTORS          16
+
+/* Runs of the write queue and sectors held by a run */
+#define SD_QUEUE_DEPTH            4
+#define SD_RUN_SECTORS            8
+
+/* Sectors of a single transfer */
+#define SD_MAX_TRANSFER_SECTORS   128
+
+/* Transfer and card programming timeout in ms */
+#define SD_TIMEOUT                1000
+
+/* Private macro -------------------------------------------------------------*/
+/* The SDIO DMA streams transfer words and do not reach the CCM data RAM */
+#define SD_IS_DMA_BUFFER(__BUFF__)  (((((uint32_t)(__BUFF__)) & 0x3) == 0) && \
+                                     ((((uint32_t)(__BUFF__)) & 0xFFFF0000) != CCMDATARAM_BASE))
+
+#define SD_MIN(__A__, __B__)        (((__A__) < (__B__)) ? (__A__) : (__B__))
+
+#if (SD_DISKIO_STATS == 1)
+#define SD_STATS_ADD(__FIELD__, __N__)  (SD_Stats.__FIELD__ += (__N__))
+#else
+#define SD_STATS_ADD(__FIELD__, __N__)  ((void)(__N__))
+#endif /* SD_DISKIO_STATS == 1 */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Run of consecutive sectors waiting in the write queue */
+typedef struct
+{
+  DWORD    Sector;                                    /* First sector of the run         */
+  UINT     Count;                                     /* Sectors held, 0 for a free run  */
+  uint32_t Buffer[SD_RUN_SECTORS * BLOCK_SIZE / 4];   /* Sectors data                    */
+}SD_RunTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+/* Disk status */
+static volatile DSTATUS Stat = STA_NOINIT;
+
+/* Transfer complete semaphore and driver lock */
+osSemaphoreDef(SD_XferSemaphore);
+osMutexDef(SD_Mutex);
+static osSemaphoreId SD_XferSemaphoreId = NULL;
+static osMutexId     SD_MutexId = NULL;
+
+/* Card geometry and state */
+static DWORD   SD_CardSectors = 0;
+static uint8_t SD_CardBusy = 0;
+
+/* Card lent to the USB mass storage device, and not initialized again since */
+static volatile uint8_t SD_Suspended = 0;
+static volatile uint8_t SD_MediaChanged = 0;
+
+/* Read-ahead cache */
+static uint32_t SD_Cache[SD_CACHE_SECTORS * BLOCK_SIZE / 4];
+static DWORD    SD_CacheSector = 0;
+static UINT     SD_CacheCount = 0;
+static DWORD    SD_NextSector = 0xFFFFFFFF;
+
+/* Write queue */
+static SD_RunTypeDef SD_Queue[SD_QUEUE_DEPTH];
+
+#if (SD_DISKIO_STATS == 1)
+/* Statistics */
+static SD_StatsTypeDef SD_Stats;
+#endif /* SD_DISKIO_STATS == 1 */
+
+/* Private function prototypes -----------------------------------------------*/
+DSTATUS SD_initialize(void);
+DSTATUS SD_status(void);
+DRESULT SD_read(BYTE*, DWORD, UINT);
+#if _USE_WRITE == 1
+  DRESULT SD_write(const BYTE*, DWORD, UINT);
+#endif /* _USE_WRITE == 1 */
+#if _USE_IOCTL == 1
+  DRESULT SD_ioctl(BYTE, void*);
+#endif  /* _USE_IOCTL == 1 */
+
+static DRESULT SD_WaitReady(void);
+static DRESULT SD_ReadSectors(uint32_t *pData, DWORD sector, UINT count);
+static DRESULT SD_WriteSectors(uint32_t *pData, DWORD sector, UINT count);
+static void    SD_CacheUpdate(const BYTE *buff, DWORD sector, UINT count);
+static DRESULT SD_QueueFlush(DWORD sector, DWORD end);
+static DRESULT SD_QueueWrite(const BYTE *buff, DWORD sector, UINT count);
+static void    SD_QueueReset(void);
+
+Diskio_drvTypeDef  SD_Driver =
+{
+  SD_initialize,
+  SD_status,
+  SD_read,
+#if  _USE_WRITE == 1
+  SD_write,
+#endif /* _USE_WRITE == 1 */
+
+#if  _USE_IOCTL == 1
+  SD_ioctl,
+#endif /* _USE_IOCTL == 1 */
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Initializes a Drive
+  * @param  None
+  * @retval DSTATUS: Operation status
+  */
+DSTATUS SD_initialize(void)
+{
+  SD_CardInfo CardInfo;
+
+  /* Create the RTOS objects at the first call, from a thread */
+  if(SD_XferSemaphoreId == NULL)
+  {
+    SD_XferSemaphoreId = osSemaphoreCreate(osSemaphore(SD_XferSemaphore), 1);
+    SD_MutexId = osMutexCreate(osMutex(SD_Mutex));
+
+    if((SD_XferSemaphoreId == NULL) || (SD_MutexId == NULL))
+    {
+      return STA_NOINIT;
+    }
+  }
+
+  osMutexWait(SD_MutexId, osWaitForever);
+
+  /* The USB mass storage device owns the card */
+  if(SD_Suspended)
+  {
+    osMutexRelease(SD_MutexId);
+    return STA_NOINIT;
+  }
+
+  /* Write the sectors still queued for the card being initialized again */
+  if((Stat & STA_NOINIT) == 0)
+  {
+    SD_QueueFlush(0, 0xFFFFFFFF);
+    SD_WaitReady();
+  }
+
+  Stat = STA_NOINIT;
+
+  SD_QueueReset();
+  SD_CacheCount = 0;
+  SD_NextSector = 0xFFFFFFFF;
+  SD_CardBusy = 0;
+
+  /* Configure the uSD device */
+  if(BSP_SD_Init() == MSD_OK)
+  {
+    BSP_SD_GetCardInfo(&CardInfo);
+    SD_CardSectors = (DWORD)(CardInfo.CardCapacity / BLOCK_SIZE);
+
+    SD_MediaChanged = 0;
+    Stat &= ~STA_NOINIT;
+  }
+
+  osMutexRelease(SD_MutexId);
+
+  return Stat;
+}
+
+/**
+  * @brief  Gets Disk Status
+  * @param  None
+  * @retval DSTATUS: Operation status
+  */
+DSTATUS SD_status(void)
+{
+  if(SD_MutexId == NULL)
+  {
+    return STA_NOINIT;
+  }
+
+  osMutexWait(SD_MutexId, osWaitForever);
+
+  Stat = STA_NOINIT;
+
+  /* A card still programming the last write is not an error. A card lent to
+     the USB device must be initialized again, so that FatFs mounts it again */
+  if((SD_MediaChanged == 0) && (SD_WaitReady() == RES_OK))
+  {
+    if(BSP_SD_GetStatus() == SD_TRANSFER_OK)
+    {
+      Stat &= ~STA_NOINIT;
+    }
+  }
+
+  osMutexRelease(SD_MutexId);
+
+  return Stat;
+}
+
+/**
+  * @brief  Reads Sector(s)
+  * @param  *buff: Data buffer to store read data
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to read (1..128)
+  * @retval DRESULT: Operation result
+  */
+DRESULT SD_read(BYTE *buff, DWORD sector, UINT count)
+{
+  DRESULT res;
+  UINT n;
+
+  if(Stat & STA_NOINIT)
+  {
+    return RES_NOTRDY;
+  }
+
+  if((sector >= SD_CardSectors) || (count > (SD_CardSectors - sector)))
+  {
+    return RES_PARERR;
+  }
+
+  osMutexWait(SD_MutexId, osWaitForever);
+
+  /* The card may have been lent to the USB device while waiting for the lock */
+  if(Stat & STA_NOINIT)
+  {
+    osMutexRelease(SD_MutexId);
+    return RES_NOTRDY;
+  }
+
+  /* The queued writes of the requested sectors must reach the card first */
+  res = SD_QueueFlush(sector, sector + count);
+
+  while((res == RES_OK) && (count > 0))
+  {
+    if((sector >= SD_CacheSector) && (sector < (SD_CacheSector + SD_CacheCount)))
+    {
+      /* Copy the sectors found in the read-ahead cache */
+      n = SD_MIN(count, (SD_CacheSector + SD_CacheCount) - sector);
+      memcpy(buff, (BYTE *)SD_Cache + ((sector - SD_CacheSector) * BLOCK_SIZE), n * BLOCK_SIZE);
+      SD_STATS_ADD(CacheHits, n);
+    }
+    else if((count >= SD_CACHE_SECTORS) && SD_IS_DMA_BUFFER(buff))
+    {
+      /* Large reads are transferred directly into the caller buffer */
+      n = count;
+      res = SD_ReadSectors((uint32_t *)buff, sector, n);
+      SD_STATS_ADD(CacheMisses, n);
+    }
+    else
+    {
+      /* Refill the cache, reading ahead when the access is sequential */
+      if(sector == SD_NextSector)
+      {
+        n = SD_MIN(SD_CACHE_SECTORS, SD_CardSectors - sector);
+      }
+      else
+      {
+        n = SD_MIN(count, SD_CACHE_SECTORS);
+      }
+
+      SD_CacheCount = 0;
+      res = SD_ReadSectors(SD_Cache, sector, n);
+      SD_STATS_ADD(CacheMisses, n);
+
+      if(res == RES_OK)
+      {
+        SD_CacheSector = sector;
+        SD_CacheCount = n;
+      }
+
+      /* The sectors are now copied from the cache */
+      continue;
+    }
+
+    sector += n;
+    buff += n * BLOCK_SIZE;
+    count -= n;
+  }
+
+  SD_NextSector = sector;
+
+  osMutexRelease(SD_MutexId);
+
+  return res;
+}
+
+/**
+  * @brief  Writes Sector(s)
+  * @param  *buff: Data to be written
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to write (1..128)
+  * @retval DRESULT: Operation result
+  */
+#if _USE_WRITE == 1
+DRESULT SD_write(const BYTE *buff, DWORD sector, UINT count)
+{
+  DRESULT res;
+
+  if(Stat & STA_NOINIT)
+  {
+    return RES_NOTRDY;
+  }
+
+  if((sector >= SD_CardSectors) || (count > (SD_CardSectors - sector)))
+  {
+    return RES_PARERR;
+  }
+
+  osMutexWait(SD_MutexId, osWaitForever);
+
+  /* The card may have been lent to the USB device while waiting for the lock */
+  if(Stat & STA_NOINIT)
+  {
+    osMutexRelease(SD_MutexId);
+    return RES_NOTRDY;
+  }
+
+  SD_CacheUpdate(buff, sector, count);
+
+  if((count >= SD_RUN_SECTORS) && SD_IS_DMA_BUFFER(buff))
+  {
+    /* Large writes are transferred directly, after the queued sectors they
+       overwrite */
+    res = SD_QueueFlush(sector, sector + count);
+
+    if(res == RES_OK)
+    {
+      res = SD_WriteSectors((uint32_t *)buff, sector, count);
+    }
+  }
+  else
+  {
+    res = SD_QueueWrite(buff, sector, count);
+  }
+
+  osMutexRelease(SD_MutexId);
+
+  return res;
+}
+#endif /* _USE_WRITE == 1 */
+
+/**
+  * @brief  I/O control operation
+  * @param  cmd: Control code
+  * @param  *buff: Buffer to send/receive control data
+  * @retval DRESULT: Operation result
+  */
+#if _USE_IOCTL == 1
+DRESULT SD_ioctl(BYTE cmd, void *buff)
+{
+  DRESULT res = RES_ERROR;
+  SD_CardInfo CardInfo;
+
+  if (Stat & STA_NOINIT) return RES_NOTRDY;
+
+  /* The card is not accessed while a transfer is in progress */
+  osMutexWait(SD_MutexId, osWaitForever);
+
+  /* The card may have been lent to the USB device while waiting for the lock */
+  if(Stat & STA_NOINIT)
+  {
+    osMutexRelease(SD_MutexId);
+    return RES_NOTRDY;
+  }
+
+  switch (cmd)
+  {
+  /* Make sure that no pending write process */
+  case CTRL_SYNC :
+    res = SD_QueueFlush(0, 0xFFFFFFFF);
+    if(res == RES_OK)
+    {
+      res = SD_WaitReady();
+    }
+    break;
+
+  /* Get number of sectors on the disk (DWORD) */
+  case GET_SECTOR_COUNT :
+    BSP_SD_GetCardInfo(&CardInfo);
+    *(DWORD*)buff = CardInfo.CardCapacity / BLOCK_SIZE;
+    res = RES_OK;
+    break;
+
+  /* Get R/W sector size (WORD) */
+  case GET_SECTOR_SIZE :
+    *(WORD*)buff = BLOCK_SIZE;
+    res = RES_OK;
+    break;
+
+  /* Get erase block size in unit of sector (DWORD) */
+  case GET_BLOCK_SIZE :
+    *(DWORD*)buff = BLOCK_SIZE;
+    res = RES_OK;
+    break;
+
+  default:
+    res = RES_PARERR;
+  }
+
+  osMutexRelease(SD_MutexId);
+
+  return res;
+}
+#endif /* _USE_IOCTL == 1 */
+
+/**
+  * @brief  Lends the card to the USB mass storage device: writes the queued
+  *         sectors and makes the driver report the disk as not ready
+  * @note   To be called from a thread before the USB device is started.
+  * @param  None
+  * @retval DRESULT: Result of the queued writes
+  */
+DRESULT SD_Suspend(void)
+{
+  DRESULT res = RES_OK;
+
+  if(SD_MutexId == NULL)
+  {
+    /* The driver never accessed the card */
+    SD_Suspended = 1;
+    SD_MediaChanged = 1;
+    return RES_OK;
+  }
+
+  /* Wait for the transfer in progress */
+  osMutexWait(SD_MutexId, osWaitForever);
+
+  if((Stat & STA_NOINIT) == 0)
+  {
+    res = SD_QueueFlush(0, 0xFFFFFFFF);
+    if(res == RES_OK)
+    {
+      res = SD_WaitReady();
+    }
+  }
+
+  /* The host may change the card: drop the queued and cached sectors */
+  SD_QueueReset();
+  SD_CacheCount = 0;
+  SD_NextSector = 0xFFFFFFFF;
+  SD_CardBusy = 0;
+
+  Stat = STA_NOINIT;
+  SD_Suspended = 1;
+  SD_MediaChanged = 1;
+
+  osMutexRelease(SD_MutexId);
+
+  return res;
+}
+
+/**
+  * @brief  Gives the card back to FatFs once the USB device is stopped
+  * @param  None
+  * @retval None
+  */
+void SD_Resume(void)
+{
+  SD_Suspended = 0;
+}
+
+#if (SD_DISKIO_STATS == 1)
+/**
+  * @brief  Gets the driver statistics
+  * @param  pStats: Pointer to the structure receiving the statistics
+  * @retval None
+  */
+void SD_GetStats(SD_StatsTypeDef *pStats)
+{
+  *pStats = SD_Stats;
+}
+
+/**
+  * @brief  Clears the driver statistics
+  * @param  None
+  * @retval None
+  */
+void SD_ResetStats(void)
+{
+  memset(&SD_Stats, 0, sizeof(SD_Stats));
+}
+#endif /* SD_DISKIO_STATS == 1 */
+
+/**
+  * @brief  Waits for the card to finish programming the last written sectors
+  * @param  None
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_WaitReady(void)
+{
+  uint32_t tickstart;
+
+  if(SD_CardBusy == 0)
+  {
+    return RES_OK;
+  }
+
+  tickstart = HAL_GetTick();
+
+  while(BSP_SD_GetStatus() != SD_TRANSFER_OK)
+  {
+    if((HAL_GetTick() - tickstart) > SD_TIMEOUT)
+    {
+      return RES_ERROR;
+    }
+
+    /* Let the other threads run while the card is busy */
+    osDelay(1);
+  }
+
+  SD_CardBusy = 0;
+
+  return RES_OK;
+}
+
+/**
+  * @brief  Reads sectors from the card in DMA mode
+  * @param  pData: Word aligned destination buffer
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to read
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_ReadSectors(uint32_t *pData, DWORD sector, UINT count)
+{
+  DRESULT res = RES_OK;
+  UINT n;
+
+  while((res == RES_OK) && (count > 0))
+  {
+    n = SD_MIN(count, SD_MAX_TRANSFER_SECTORS);
+    res = RES_ERROR;
+
+    if(SD_WaitReady() == RES_OK)
+    {
+      /* Discard a completion left by an aborted transfer */
+      osSemaphoreWait(SD_XferSemaphoreId, 0);
+
+      if(BSP_SD_ReadBlocks_DMA_Start(pData, (uint64_t)sector * BLOCK_SIZE, BLOCK_SIZE, n) == MSD_OK)
+      {
+        /* Sleep until the DMA or SDIO interrupt ends the transfer */
+        if(osSemaphoreWait(SD_XferSemaphoreId, SD_TIMEOUT) == osOK)
+        {
+          res = RES_OK;
+        }
+
+        if(BSP_SD_ReadBlocks_DMA_End() != MSD_OK)
+        {
+          res = RES_ERROR;
+        }
+      }
+    }
+
+    SD_STATS_ADD(ReadTransfers, 1);
+
+    pData += n * (BLOCK_SIZE / 4);
+    sector += n;
+    count -= n;
+  }
+
+  return res;
+}
+
+/**
+  * @brief  Writes sectors to the card in DMA mode
+  * @param  pData: Word aligned source buffer
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to write
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_WriteSectors(uint32_t *pData, DWORD sector, UINT count)
+{
+  DRESULT res = RES_OK;
+  UINT n;
+
+  while((res == RES_OK) && (count > 0))
+  {
+    n = SD_MIN(count, SD_MAX_TRANSFER_SECTORS);
+    res = RES_ERROR;
+
+    if(SD_WaitReady() == RES_OK)
+    {
+      /* Discard a completion left by an aborted transfer */
+      osSemaphoreWait(SD_XferSemaphoreId, 0);
+
+      if(BSP_SD_WriteBlocks_DMA_Start(pData, (uint64_t)sector * BLOCK_SIZE, BLOCK_SIZE, n) == MSD_OK)
+      {
+        /* Sleep until the DMA or SDIO interrupt ends the transfer */
+        if(osSemaphoreWait(SD_XferSemaphoreId, SD_TIMEOUT) == osOK)
+        {
+          res = RES_OK;
+        }
+
+        if(BSP_SD_WriteBlocks_DMA_End() != MSD_OK)
+        {
+          res = RES_ERROR;
+        }
+      }
+
+      /* The card programs the sectors, wait for it before the next command */
+      SD_CardBusy = 1;
+    }
+
+    SD_STATS_ADD(WriteTransfers, 1);
+
+    pData += n * (BLOCK_SIZE / 4);
+    sector += n;
+    count -= n;
+  }
+
+  return res;
+}
+
+/**
+  * @brief  Copies written sectors into the read-ahead cache
+  * @param  buff: Written data
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors written
+  * @retval None
+  */
+static void SD_CacheUpdate(const BYTE *buff, DWORD sector, UINT count)
+{
+  DWORD first, end;
+
+  first = (sector > SD_CacheSector) ? sector : SD_CacheSector;
+  end = SD_MIN(sector + count, SD_CacheSector + SD_CacheCount);
+
+  if(first < end)
+  {
+    memcpy((BYTE *)SD_Cache + ((first - SD_CacheSector) * BLOCK_SIZE),
+           buff + ((first - sector) * BLOCK_SIZE),
+           (end - first) * BLOCK_SIZE);
+  }
+}
+
+/**
+  * @brief  Writes the queued runs overlapping a range of sectors
+  * @param  sector: First sector of the range
+  * @param  end: Sector following the range
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_QueueFlush(DWORD sector, DWORD end)
+{
+  DRESULT res = RES_OK;
+  SD_RunTypeDef *run;
+  uint32_t i;
+
+  while(res == RES_OK)
+  {
+    /* Write the runs in ascending order of sectors */
+    run = NULL;
+
+    for(i = 0; i < SD_QUEUE_DEPTH; i++)
+    {
+      if((SD_Queue[i].Count != 0) &&
+         (SD_Queue[i].Sector < end) && (sector < (SD_Queue[i].Sector + SD_Queue[i].Count)))
+      {
+        if((run == NULL) || (SD_Queue[i].Sector < run->Sector))
+        {
+          run = &SD_Queue[i];
+        }
+      }
+    }
+
+    if(run == NULL)
+    {
+      break;
+    }
+
+    res = SD_WriteSectors(run->Buffer, run->Sector, run->Count);
+
+    if(res == RES_OK)
+    {
+      run->Count = 0;
+    }
+  }
+
+  return res;
+}
+
+/**
+  * @brief  Queues written sectors, merging them into the pending runs
+  * @param  buff: Data to be written
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to write
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_QueueWrite(const BYTE *buff, DWORD sector, UINT count)
+{
+  DRESULT res = RES_OK;
+  SD_RunTypeDef *run, *append, *empty;
+  DWORD limit;
+  UINT offset, n, merged;
+  uint32_t i;
+
+  while((res == RES_OK) && (count > 0))
+  {
+    run = NULL;
+    append = NULL;
+    empty = NULL;
+    limit = 0xFFFFFFFF;
+
+    for(i = 0; i < SD_QUEUE_DEPTH; i++)
+    {
+      if(SD_Queue[i].Count == 0)
+      {
+        empty = &SD_Queue[i];
+      }
+      else if((sector >= SD_Queue[i].Sector) && (sector < (SD_Queue[i].Sector + SD_Queue[i].Count)))
+      {
+        /* The run holds an older copy of the sector */
+        run = &SD_Queue[i];
+      }
+      else if((sector == (SD_Queue[i].Sector + SD_Queue[i].Count)) && (SD_Queue[i].Count < SD_RUN_SECTORS))
+      {
+        /* The sector extends the run */
+        append = &SD_Queue[i];
+      }
+      else if((SD_Queue[i].Sector > sector) && (SD_Queue[i].Sector < limit))
+      {
+        /* A run must not grow over the next one */
+        limit = SD_Queue[i].Sector;
+      }
+    }
+
+    if(run == NULL)
+    {
+      run = append;
+    }
+
+    merged = (run != NULL);
+
+    if((run == NULL) && (empty != NULL))
+    {
+      run = empty;
+      run->Sector = sector;
+    }
+    else if(run == NULL)
+    {
+      /* The queue is full: write it and look again */
+      res = SD_QueueFlush(0, 0xFFFFFFFF);
+      continue;
+    }
+
+    offset = sector - run->Sector;
+    n = SD_MIN(count, SD_RUN_SECTORS - offset);
+    n = SD_MIN(n, limit - sector);
+
+    memcpy((BYTE *)run->Buffer + (offset * BLOCK_SIZE), buff, n * BLOCK_SIZE);
+
+    if((offset + n) > run->Count)
+    {
+      run->Count = offset + n;
+    }
+
+    SD_STATS_ADD(QueuedSectors, n);
+    SD_STATS_ADD(CoalescedSectors, (merged != 0) ? n : 0);
+
+
+    sector += n;
+    buff += n * BLOCK_SIZE;
+    count -= n;
+  }
+
+  return res;
+}
+
+/**
+  * @brief  Empties the write queue
+  * @param  None
+  * @retval None
+  */
+static void SD_QueueReset(void)
+{
+  uint32_t i;
+
+  for(i = 0; i < SD_QUEUE_DEPTH; i++)
+  {
+    SD_Queue[i].Count = 0;
+  }
+}
+
+/**
+  * @brief  SD DMA Rx transfer complete callback
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+void HAL_SD_DMA_RxCpltCallback(DMA_HandleTypeDef *hdma)
+{
+  osSemaphoreRelease(SD_XferSemaphoreId);
+}
+
+/**
+  * @brief  SD DMA Tx transfer complete callback
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+void HAL_SD_DMA_TxCpltCallback(DMA_HandleTypeDef *hdma)
+{
+  osSemaphoreRelease(SD_XferSemaphoreId);
+}
+
+/**
+  * @brief  SD DMA Rx transfer error callback
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+void HAL_SD_DMA_RxErrorCallback(DMA_HandleTypeDef *hdma)
+{
+  /* A FIFO error does not stop the stream */
+  if((hdma->Instance->CR & DMA_SxCR_EN) == 0)
+  {
+    osSemaphoreRelease(SD_XferSemaphoreId);
+  }
+}
+
+/**
+  * @brief  SD DMA Tx transfer error callback
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+void HAL_SD_DMA_TxErrorCallback(DMA_HandleTypeDef *hdma)
+{
+  /* A FIFO error does not stop the stream */
+  if((hdma->Instance->CR & DMA_SxCR_EN) == 0)
+  {
+    osSemaphoreRelease(SD_XferSemaphoreId);
+  }
+}
+
+/**
+  * @brief  SD transfer error callback
+  * @param  hsd: SD handle
+  * @retval None
+  */
+void HAL_SD_XferErrorCallback(SD_HandleTypeDef *hsd)
+{
+  osSemaphoreRelease(SD_XferSemaphoreId);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
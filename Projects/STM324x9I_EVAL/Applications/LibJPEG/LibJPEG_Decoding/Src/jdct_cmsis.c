@@ -0,0 +1,194 @@
+/**
+  ******************************************************************************
+  * @file    LibJPEG/LibJPEG_Decoding/Src/jdct_cmsis.c 
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    13-March-2015
+  * @brief   This file plugs the CMSIS-DSP Q15 8x8 DCT kernels into LibJPEG.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#define JPEG_INTERNALS
+#include "main.h"
+#include "arm_math.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* The kernels work on samples stored as (sample - CENTERJSAMPLE) << 8 and 
+   return 32 times the JPEG DCT coefficients */
+#define SAMPLE_SHIFT  8
+#define COEF_SHIFT    5
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void jpeg_fdct_cmsis(j_compress_ptr cinfo, jpeg_component_info * compptr,
+                            JSAMPARRAY sample_data, JBLOCKROW coef_blocks,
+                            JDIMENSION start_row, JDIMENSION start_col,
+                            JDIMENSION num_blocks);
+static void jpeg_idct_cmsis(j_decompress_ptr cinfo, jpeg_component_info * compptr,
+                            JCOEFPTR coef_block, JSAMPARRAY output_buf,
+                            JDIMENSION output_col);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Replaces the forward DCT of the 8x8 components by arm_dct8x8_q15.
+  * @note   To be called after jpeg_start_compress(), which selects the DCT 
+  *         routines of the pass. Components using a scaled DCT keep the 
+  *         LibJPEG one.
+  * @param  cinfo: pointer to the JPEG compression object
+  * @retval None
+  */
+void jpeg_cmsis_fdct_enable(j_compress_ptr cinfo)
+{
+  jpeg_component_info *compptr;
+  int ci;
+
+  for (ci = 0, compptr = cinfo->comp_info; ci < cinfo->num_components; ci++, compptr++)
+  {
+    if ((compptr->DCT_h_scaled_size == DCTSIZE) && (compptr->DCT_v_scaled_size == DCTSIZE))
+    {
+      cinfo->fdct->forward_DCT[ci] = jpeg_fdct_cmsis;
+    }
+  }
+}
+
+/**
+  * @brief  Replaces the inverse DCT of the 8x8 components by arm_idct8x8_q15.
+  * @note   To be called after jpeg_start_decompress(), which selects the IDCT 
+  *         routines of the output pass. Components using a scaled IDCT keep 
+  *         the LibJPEG one.
+  * @param  cinfo: pointer to the JPEG decompression object
+  * @retval None
+  */
+void jpeg_cmsis_idct_enable(j_decompress_ptr cinfo)
+{
+  jpeg_component_info *compptr;
+  int ci;
+
+  for (ci = 0, compptr = cinfo->comp_info; ci < cinfo->num_components; ci++, compptr++)
+  {
+    if ((compptr->DCT_h_scaled_size == DCTSIZE) && (compptr->DCT_v_scaled_size == DCTSIZE))
+    {
+      cinfo->idct->inverse_DCT[ci] = jpeg_idct_cmsis;
+    }
+  }
+}
+
+/**
+  * @brief  Forward DCT and quantization of a row of 8x8 blocks.
+  * @param  cinfo:       pointer to the JPEG compression object
+  * @param  compptr:     pointer to the component
+  * @param  sample_data: pointer to the sample rows
+  * @param  coef_blocks: pointer to the output coefficient blocks
+  * @param  start_row:   first sample row of the blocks
+  * @param  start_col:   first sample column of the blocks
+  * @param  num_blocks:  number of blocks
+  * @retval None
+  */
+static void jpeg_fdct_cmsis(j_compress_ptr cinfo, jpeg_component_info * compptr,
+                            JSAMPARRAY sample_data, JBLOCKROW coef_blocks,
+                            JDIMENSION start_row, JDIMENSION start_col,
+                            JDIMENSION num_blocks)
+{
+  const UINT16 *quantval = cinfo->quant_tbl_ptrs[compptr->quant_tbl_no]->quantval;
+  q15_t block[DCTSIZE2];
+  JSAMPROW elemptr;
+  JCOEFPTR output_ptr;
+  int32_t temp, qval;
+  JDIMENSION bi;
+  int row, col, i;
+
+  sample_data += start_row;
+
+  for (bi = 0; bi < num_blocks; bi++, start_col += DCTSIZE)
+  {
+    /* Load the block and remove the sample offset */
+    for (row = 0; row < DCTSIZE; row++)
+    {
+      elemptr = sample_data[row] + start_col;
+      for (col = 0; col < DCTSIZE; col++)
+      {
+        block[row * DCTSIZE + col] = (q15_t) ((GETJSAMPLE(elemptr[col]) - CENTERJSAMPLE) << SAMPLE_SHIFT);
+      }
+    }
+
+    arm_dct8x8_q15(block, block);
+
+    /* Quantize, rounding to the nearest integer */
+    output_ptr = coef_blocks[bi];
+    for (i = 0; i < DCTSIZE2; i++)
+    {
+      qval = (int32_t) quantval[i] << COEF_SHIFT;
+      temp = block[i];
+      if (temp < 0)
+      {
+        output_ptr[i] = (JCOEF) -((qval / 2 - temp) / qval);
+      }
+      else
+      {
+        output_ptr[i] = (JCOEF) ((qval / 2 + temp) / qval);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Dequantization and inverse DCT of an 8x8 block.
+  * @param  cinfo:      pointer to the JPEG decompression object
+  * @param  compptr:    pointer to the component
+  * @param  coef_block: pointer to the coefficient block
+  * @param  output_buf: pointer to the output sample rows
+  * @param  output_col: first output sample column
+  * @retval None
+  */
+static void jpeg_idct_cmsis(j_decompress_ptr cinfo, jpeg_component_info * compptr,
+                            JCOEFPTR coef_block, JSAMPARRAY output_buf,
+                            JDIMENSION output_col)
+{
+  const UINT16 *quantval = compptr->quant_table->quantval;
+  q15_t block[DCTSIZE2];
+  JSAMPROW outptr;
+  int row, col, i;
+
+  (void) cinfo;
+
+  /* Dequantize to the input scaling of the kernel */
+  for (i = 0; i < DCTSIZE2; i++)
+  {
+    block[i] = (q15_t) __SSAT(((int32_t) coef_block[i] * quantval[i]) << COEF_SHIFT, 16);
+  }
+
+  arm_idct8x8_q15(block, block);
+
+  /* Round, restore the sample offset and range limit */
+  for (row = 0; row < DCTSIZE; row++)
+  {
+    outptr = output_buf[row] + output_col;
+    for (col = 0; col < DCTSIZE; col++)
+    {
+      outptr[col] = (JSAMPLE) __USAT(((block[row * DCTSIZE + col] + (1 << (SAMPLE_SHIFT - 1))) >> SAMPLE_SHIFT) + CENTERJSAMPLE, 8);
+    }
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
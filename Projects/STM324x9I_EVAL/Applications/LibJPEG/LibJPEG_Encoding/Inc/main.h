@@ -45,6 +45,7 @@
 #include <stdint.h>
 #include <string.h>
 #include "jpeglib.h"
+#include "jdct_cmsis.h"
 
 #include "decode.h"
 #include "encode.h"
@@ -58,6 +59,10 @@ typedef struct RGB
 }RGB_typedef;
 
 /* Exported constants --------------------------------------------------------*/
+/* DCT method used by the codec: JDCT_ISLOW, JDCT_IFAST, JDCT_FLOAT or 
+   JDCT_CMSIS (see jdct_cmsis.h) */
+#define JPEG_DCT_METHOD  JDCT_CMSIS
+
 #define IMAGE_HEIGHT 240
 #define IMAGE_WIDTH  320
 #define IMAGE_QUALITY 90
@@ -44,6 +44,19 @@
 #define IFNAME0 's'
 #define IFNAME1 't'
 
+/* Number of spare Rx buffers refilling the descriptors in zero-copy mode:
+   they hold the received frames while LwIP has not released them */
+#if ETH_RX_ZERO_COPY
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "ETH_RX_ZERO_COPY requires LWIP_SUPPORT_CUSTOM_PBUF set to 1 in lwipopts.h"
+#endif
+#ifndef ETH_RX_POOL_NB
+#define ETH_RX_POOL_NB   (2 * ETH_RXBUFNB)
+#endif
+#else
+#define ETH_RX_POOL_NB   0
+#endif
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 #if defined ( __ICCARM__ ) /*!< IAR Compiler */
@@ -59,7 +72,7 @@ __ALIGN_BEGIN ETH_DMADescTypeDef  DMATxDscrTab[ETH_TXBUFNB] __ALIGN_END;/* Ether
 #if defined ( __ICCARM__ ) /*!< IAR Compiler */
   #pragma data_alignment=4   
 #endif
-__ALIGN_BEGIN uint8_t Rx_Buff[ETH_RXBUFNB][ETH_RX_BUF_SIZE] __ALIGN_END; /* Ethernet Receive Buffer */
+__ALIGN_BEGIN uint8_t Rx_Buff[ETH_RXBUFNB + ETH_RX_POOL_NB][ETH_RX_BUF_SIZE] __ALIGN_END; /* Ethernet Receive Buffer */
 
 #if defined ( __ICCARM__ ) /*!< IAR Compiler */
   #pragma data_alignment=4   
@@ -72,6 +85,16 @@ osSemaphoreId s_xSemaphore = NULL;
 /* Global Ethernet handle*/
 ETH_HandleTypeDef EthHandle;
 
+#if ETH_RX_ZERO_COPY
+/* Custom pbufs wrapping the Rx buffers: aRxPbuf[i] references Rx_Buff[i] */
+static struct pbuf_custom aRxPbuf[ETH_RXBUFNB + ETH_RX_POOL_NB];
+/* Spare Rx buffers, owned neither by a descriptor nor by LwIP */
+static uint8_t *aRxFreeBuff[ETH_RX_POOL_NB];
+static __IO uint32_t RxFreeNb = 0;
+static __IO u8_t RxZeroCopy = 1;
+static EthernetifRxStatsTypeDef RxStats;
+#endif
+
 /* Private function prototypes -----------------------------------------------*/
 static void ethernetif_input( void const * argument );
 
@@ -208,6 +231,154 @@ void ETHERNET_IRQHandler(void)
 /*******************************************************************************
                        LL Driver Interface ( LwIP stack --> ETH) 
 *******************************************************************************/
+#if ETH_RX_ZERO_COPY
+/**
+  * @brief  Custom pbuf free function: called by LwIP when the last reference
+  *         to a received frame segment is released. The Rx buffer goes back to
+  *         the pool of spare buffers used to refill the DMA descriptors.
+  * @param  p: the custom pbuf wrapping the Rx buffer
+  * @retval None
+  */
+static void ethernetif_rx_pbuf_free(struct pbuf *p)
+{
+  uint32_t index = (uint32_t)((struct pbuf_custom *)p - aRxPbuf);
+  uint32_t primask = __get_PRIMASK();
+  
+  /* The pbuf may be freed by any thread of the application */
+  __disable_irq();
+  aRxFreeBuff[RxFreeNb++] = &Rx_Buff[index][0];
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Initializes the custom pbufs wrapping the Rx buffers and fills the
+  *         pool of spare buffers with the buffers not given to the descriptors.
+  * @param  None
+  * @retval None
+  */
+static void ethernetif_rx_pool_init(void)
+{
+  uint32_t i;
+  
+  for (i = 0; i < (ETH_RXBUFNB + ETH_RX_POOL_NB); i++)
+  {
+    aRxPbuf[i].custom_free_function = ethernetif_rx_pbuf_free;
+  }
+  
+  for (i = 0; i < ETH_RX_POOL_NB; i++)
+  {
+    aRxFreeBuff[i] = &Rx_Buff[ETH_RXBUFNB + i][0];
+  }
+  RxFreeNb = ETH_RX_POOL_NB;
+}
+
+/**
+  * @brief  Passes the received frame to LwIP without copying it: each DMA buffer
+  *         of the frame is wrapped in a custom pbuf and its descriptor is given
+  *         back to the DMA with a spare buffer taken from the pool.
+  * @param  None
+  * @retval The pbuf chain holding the frame, NULL if zero-copy is disabled or
+  *         if the pool cannot replace all the buffers of the frame: the frame
+  *         is then copied by low_level_input().
+  */
+static struct pbuf * low_level_input_zero_copy(void)
+{
+  struct pbuf *p = NULL, *q;
+  __IO ETH_DMADescTypeDef *dmarxdesc;
+  uint8_t *spare[ETH_RXBUFNB];
+  uint32_t segcount = EthHandle.RxFrameInfos.SegCount;
+  uint32_t len = EthHandle.RxFrameInfos.length;
+  uint32_t seglen, index, primask, i;
+  
+  if (len == 0)
+  {
+    return NULL;
+  }
+  
+  if ((RxZeroCopy == 0) || (segcount > ETH_RXBUFNB))
+  {
+    RxStats.CopiedFrames++;
+    return NULL;
+  }
+  
+  /* Take a spare buffer for each segment of the frame, or none */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (RxFreeNb < segcount)
+  {
+    __set_PRIMASK(primask);
+    RxStats.CopiedFrames++;
+    return NULL;
+  }
+  for (i = 0; i < segcount; i++)
+  {
+    spare[i] = aRxFreeBuff[--RxFreeNb];
+  }
+  __set_PRIMASK(primask);
+  
+  dmarxdesc = EthHandle.RxFrameInfos.FSRxDesc;
+  for (i = 0; i < segcount; i++)
+  {
+    seglen = (len > ETH_RX_BUF_SIZE) ? ETH_RX_BUF_SIZE : len;
+    len -= seglen;
+    
+    /* Wrap the received buffer in its custom pbuf */
+    index = (dmarxdesc->Buffer1Addr - (uint32_t)&Rx_Buff[0][0]) / ETH_RX_BUF_SIZE;
+    q = pbuf_alloced_custom(PBUF_RAW, (u16_t)seglen, PBUF_REF, &aRxPbuf[index],
+                            (void *)dmarxdesc->Buffer1Addr, ETH_RX_BUF_SIZE);
+    if (p == NULL)
+    {
+      p = q;
+    }
+    else
+    {
+      pbuf_cat(p, q);
+    }
+    
+    /* Refill the descriptor and give it back to DMA */
+    dmarxdesc->Buffer1Addr = (uint32_t)spare[i];
+    dmarxdesc->Status = ETH_DMARXDESC_OWN;
+    dmarxdesc = (ETH_DMADescTypeDef *)(dmarxdesc->Buffer2NextDescAddr);
+  }
+  
+  /* Clear Segment_Count */
+  EthHandle.RxFrameInfos.SegCount = 0;
+  
+  /* When Rx Buffer unavailable flag is set: clear it and resume reception */
+  if ((EthHandle.Instance->DMASR & ETH_DMASR_RBUS) != (uint32_t)RESET)
+  {
+    /* Clear RBUS ETHERNET DMA flag */
+    EthHandle.Instance->DMASR = ETH_DMASR_RBUS;
+    /* Resume DMA reception */
+    EthHandle.Instance->DMARPDR = 0;
+  }
+  
+  RxStats.ZeroCopyFrames++;
+  return p;
+}
+
+/**
+  * @brief  Enables or disables the zero-copy reception at run time. When
+  *         disabled, all the received frames are copied into PBUF_POOL pbufs.
+  * @param  enable: 1 to pass the frames in their DMA buffers, 0 to copy them
+  * @retval None
+  */
+void ethernetif_set_rx_zero_copy(u8_t enable)
+{
+  RxZeroCopy = enable;
+}
+
+/**
+  * @brief  Returns the reception statistics of the zero-copy path.
+  * @param  stats: pointer to the structure receiving the statistics
+  * @retval None
+  */
+void ethernetif_get_rx_stats(EthernetifRxStatsTypeDef *stats)
+{
+  *stats = RxStats;
+}
+#endif /* ETH_RX_ZERO_COPY */
+
 /**
   * @brief In this function, the hardware should be initialized.
   * Called from ethernetif_init().
@@ -242,6 +413,11 @@ static void low_level_init(struct netif *netif)
      
   /* Initialize Rx Descriptors list: Chain Mode  */
   HAL_ETH_DMARxDescListInit(&EthHandle, DMARxDscrTab, &Rx_Buff[0][0], ETH_RXBUFNB);
+
+#if ETH_RX_ZERO_COPY
+  /* Initialize the custom pbufs and the pool of spare Rx buffers */
+  ethernetif_rx_pool_init();
+#endif
   
   /* set netif MAC hardware address length */
   netif->hwaddr_len = ETHARP_HWADDR_LEN;
@@ -405,6 +581,13 @@ static struct pbuf * low_level_input(struct netif *netif)
   /* get received frame */
   if(HAL_ETH_GetReceivedFrame_IT(&EthHandle) != HAL_OK)
     return NULL;
+
+#if ETH_RX_ZERO_COPY
+  /* Pass the frame in its DMA buffers when spare buffers are available */
+  p = low_level_input_zero_copy();
+  if (p != NULL)
+    return p;
+#endif
   
   /* Obtain the size of the packet and put it into the "len" variable. */
   len = EthHandle.RxFrameInfos.length;
@@ -36,7 +36,6 @@
 #ifdef USE_IAP_TFTP
 
 /* Private variables ---------------------------------------------------------*/
-static uint32_t Flash_Write_Address;
 static struct udp_pcb *UDPpcb;
 static __IO uint32_t total_count=0;
 
@@ -170,8 +169,7 @@ static err_t IAP_tftp_send_ack_packet(struct udp_pcb *upcb, struct ip_addr *to,
 static void IAP_wrq_recv_callback(void *_args, struct udp_pcb *upcb, struct pbuf *pkt_buf, struct ip_addr *addr, u16_t port)
 {
   tftp_connection_args *args = (tftp_connection_args *)_args;
-  uint32_t data_buffer[128];
-  uint16_t count=0;
+  uint32_t writestatus = 0, crc = 0;
 
 #ifdef USE_LCD
   char message[40];
@@ -189,18 +187,12 @@ static void IAP_wrq_recv_callback(void *_args, struct udp_pcb *upcb, struct pbuf
   if ((pkt_buf->len > TFTP_DATA_PKT_HDR_LEN) &&
       (IAP_tftp_extract_block(pkt_buf->payload) == (args->block + 1)))
   {
-    /* copy packet payload to data_buffer */
-    pbuf_copy_partial(pkt_buf, data_buffer, pkt_buf->len - TFTP_DATA_PKT_HDR_LEN,
-                      TFTP_DATA_PKT_HDR_LEN);
-    
     total_count += pkt_buf->len - TFTP_DATA_PKT_HDR_LEN; 
-    
-    count = (pkt_buf->len - TFTP_DATA_PKT_HDR_LEN)/4;
-    if (((pkt_buf->len - TFTP_DATA_PKT_HDR_LEN)%4)!=0) 
-    count++;
      
-    /* Write received data in Flash */
-    FLASH_If_Write(&Flash_Write_Address, data_buffer ,count);
+    /* Write received data in Flash: the payload is buffered by the flash
+       writer so it is passed without copy nor word alignment */
+    FLASH_If_WriterPush((uint8_t*)pkt_buf->payload + TFTP_DATA_PKT_HDR_LEN,
+                        pkt_buf->len - TFTP_DATA_PKT_HDR_LEN);
        
     /* update our block number to match the block number just received */
     args->block++;
@@ -226,14 +218,25 @@ static void IAP_wrq_recv_callback(void *_args, struct udp_pcb *upcb, struct pbuf
    */
   if (pkt_buf->len < TFTP_DATA_PKT_LEN_MAX)
   {
+    /* program the last bytes and check the flash content */
+    writestatus = FLASH_If_WriterFinish(&crc);
+    
     IAP_tftp_cleanup_wr(upcb, args);
     pbuf_free(pkt_buf);
     
 #ifdef USE_LCD
     sprintf(message, "%d bytes ",(int)total_count);
     LCD_UsrLog("Tot bytes Received:, %s\n", message);
-    LCD_UsrLog("  State: Prog Finished \n");
-    LCD_UsrLog("Reset the board \n");
+    if (writestatus == 0)
+    {
+      sprintf(message, "CRC 0x%08X", (unsigned int)crc);
+      LCD_UsrLog("  State: Prog Finished, %s\n", message);
+      LCD_UsrLog("Reset the board \n");
+    }
+    else
+    {
+      LCD_ErrLog("  State: Prog Failed (error %d)\n", (int)writestatus);
+    }
 #endif
   }
   else
@@ -278,13 +281,10 @@ static int IAP_tftp_process_write(struct udp_pcb *upcb, struct ip_addr *to, int
   
   total_count =0;
 
-  /* init flash */
-  FLASH_If_Init();
-  
-  /* erase user flash area */
-  FLASH_If_Erase(USER_FLASH_FIRST_PAGE_ADDRESS);
+  /* start a flash write sequence, each sector of the user flash area is
+     erased when the received data reaches it */
+  FLASH_If_WriterStart(USER_FLASH_FIRST_PAGE_ADDRESS);
  
-  Flash_Write_Address = USER_FLASH_FIRST_PAGE_ADDRESS;    
   /* initiate the write transaction by sending the first ack */
   IAP_tftp_send_ack_packet(upcb, to, to_port, args->block);
 #ifdef USE_LCD
@@ -366,7 +366,6 @@ static void IAP_tftp_recv_callback(void *arg, struct udp_pcb *upcb, struct pbuf
     LCD_UsrLog("IAP using TFTP \n");
     sprintf(message, "File: %s",filename);
     LCD_UsrLog("%s\n", message);
-    LCD_UsrLog("  State: Erasing...\n");
 #endif
      
     /* Start the TFTP write mode*/
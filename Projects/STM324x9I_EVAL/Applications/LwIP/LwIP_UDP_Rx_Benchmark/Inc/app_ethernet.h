@@ -1,10 +1,10 @@
 /**
   ******************************************************************************
-  * @file    k_sd_diskio.h 
+  * @file    LwIP/LwIP_UDP_Rx_Benchmark/Inc/app_ethernet.h 
   * @author  MCD Application Team
   * @version V1.2.1
   * @date    13-March-2015
-  * @brief   Header for k_sd_diskio.c module
+  * @brief   Header for app_ethernet.c module
   ******************************************************************************
   * @attention
   *
@@ -26,16 +26,28 @@
   */
 
 /* Define to prevent recursive inclusion -------------------------------------*/
-#ifndef __SD_DISKIO_H
-#define __SD_DISKIO_H
+#ifndef __APP_ETHERNET_H
+#define __APP_ETHERNET_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
 
 /* Includes ------------------------------------------------------------------*/
+#include "lwip/netif.h"
+
 /* Exported types ------------------------------------------------------------*/
-/* Exported constants --------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/   
+/* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
-extern Diskio_drvTypeDef  SD_Driver;
+void User_notification(struct netif *netif);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __APP_ETHERNET_H */
 
-#endif /* __SD_DISKIO_H */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
@@ -0,0 +1,88 @@
+/**
+  ******************************************************************************
+  * @file    LwIP/LwIP_UDP_Rx_Benchmark/Inc/main.h 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Header for main.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+#include "stm324x9i_eval.h"
+#include "stm324x9i_eval_io.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Result of one benchmark pass */
+typedef struct
+{
+  uint32_t ZeroCopy;          /* 1 for the zero-copy reception, 0 for the copy      */
+  uint32_t Datagrams;         /* UDP datagrams received during the pass             */
+  uint32_t Throughput;        /* UDP payload received in Kbit/s                     */
+  uint32_t CyclesPerFrame;    /* CPU cycles spent in ethernetif_input() per frame   */
+  uint32_t CpuLoad;           /* Percentage of the CPU spent in ethernetif_input()  */
+  uint32_t ZeroCopyFrames;    /* Frames passed to LwIP in their DMA buffers         */
+  uint32_t CopiedFrames;      /* Frames copied into PBUF_POOL pbufs                 */
+}BenchResultTypeDef;
+
+/* Exported constants --------------------------------------------------------*/ 
+/* Duration of a benchmark pass in ms: the passes alternate the zero-copy and
+   the copy reception as long as datagrams are received */
+#define BENCH_PASS_TIME   ((uint32_t)5000)
+#define BENCH_PASSES      2
+
+/*Static IP ADDRESS: IP_ADDR0.IP_ADDR1.IP_ADDR2.IP_ADDR3 */
+#define IP_ADDR0   192
+#define IP_ADDR1   168
+#define IP_ADDR2   0
+#define IP_ADDR3   10
+   
+/*NETMASK*/
+#define NETMASK_ADDR0   255
+#define NETMASK_ADDR1   255
+#define NETMASK_ADDR2   255
+#define NETMASK_ADDR3   0
+
+/*Gateway Address*/
+#define GW_ADDR0   192
+#define GW_ADDR1   168
+#define GW_ADDR2   0
+#define GW_ADDR3   1
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MAIN_H */
+
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -1,10 +1,10 @@
 /**
   ******************************************************************************
-  * @file    k_sd_diskio.h 
+  * @file    LwIP/LwIP_UDP_Rx_Benchmark/Inc/udp_rxbench.h 
   * @author  MCD Application Team
   * @version V1.2.1
   * @date    13-March-2015
-  * @brief   Header for k_sd_diskio.c module
+  * @brief   Header for udp_rxbench.c module
   ******************************************************************************
   * @attention
   *
@@ -26,16 +26,31 @@
   */
 
 /* Define to prevent recursive inclusion -------------------------------------*/
-#ifndef __SD_DISKIO_H
-#define __SD_DISKIO_H
+#ifndef __UDP_RXBENCH_H
+#define __UDP_RXBENCH_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
 
 /* Includes ------------------------------------------------------------------*/
+#include "lwip/opt.h"
+
 /* Exported types ------------------------------------------------------------*/
 /* Exported constants --------------------------------------------------------*/
+/* UDP port of the receiver: default port of iperf */
+#define UDP_RXBENCH_PORT   5001
+
+/* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
-extern Diskio_drvTypeDef  SD_Driver;
+void udp_rxbench_init(void);
+void udp_rxbench_read_counters(u32_t *bytes, u32_t *datagrams);
 
-#endif /* __SD_DISKIO_H */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __UDP_RXBENCH_H */
 
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
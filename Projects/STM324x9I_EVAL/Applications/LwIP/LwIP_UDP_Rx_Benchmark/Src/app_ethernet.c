@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file    LwIP/LwIP_UDP_Rx_Benchmark/Src/app_ethernet.c 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Ethernet specefic module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lwip/opt.h"
+#include "main.h"
+#include "app_ethernet.h"
+#include "ethernetif.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Notify the User about the nework interface config status 
+  * @param  netif: the network interface
+  * @retval None
+  */
+void User_notification(struct netif *netif) 
+{
+  if (netif_is_up(netif))
+  {
+    /* Turn On LED 1 to indicate ETH and LwIP init success*/
+    BSP_LED_On(LED1);
+  }
+  else
+  {     
+    /* Turn On LED 2 to indicate ETH and LwIP init error */
+    BSP_LED_On(LED2);
+  } 
+}
+
+/**
+  * @brief  This function notify user about link status changement.
+  * @param  netif: the network interface
+  * @retval None
+  */
+void ethernetif_notify_conn_changed(struct netif *netif)
+{
+  struct ip_addr ipaddr;
+  struct ip_addr netmask;
+  struct ip_addr gw;
+  
+  if(netif_is_link_up(netif))
+  {
+    IP4_ADDR(&ipaddr, IP_ADDR0, IP_ADDR1, IP_ADDR2, IP_ADDR3);
+    IP4_ADDR(&netmask, NETMASK_ADDR0, NETMASK_ADDR1 , NETMASK_ADDR2, NETMASK_ADDR3);
+    IP4_ADDR(&gw, GW_ADDR0, GW_ADDR1, GW_ADDR2, GW_ADDR3);    
+    
+    netif_set_addr(netif, &ipaddr , &netmask, &gw);
+    
+    /* When the netif is fully configured this function must be called.*/
+    netif_set_up(netif);      
+    
+    BSP_LED_Off(LED2);
+    BSP_LED_On(LED1);    
+  }
+  else
+  {    
+    /*  When the netif link is down this function must be called.*/
+    netif_set_down(netif);
+    
+    BSP_LED_Off(LED1);
+    BSP_LED_On(LED2);   
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,822 @@
+/**
+  ******************************************************************************
+  * @file    LwIP/LwIP_UDP_Rx_Benchmark/Src/ethernetif.c
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   This file implements Ethernet network interface drivers for lwIP
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+#include "lwip/opt.h"
+#include "lwip/lwip_timers.h"
+#include "netif/etharp.h"
+#include "ethernetif.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Network interface name */
+#define IFNAME0 's'
+#define IFNAME1 't'
+
+/* Number of spare Rx buffers refilling the descriptors in zero-copy mode:
+   they hold the received frames while LwIP has not released them */
+#if ETH_RX_ZERO_COPY
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "ETH_RX_ZERO_COPY requires LWIP_SUPPORT_CUSTOM_PBUF set to 1 in lwipopts.h"
+#endif
+#ifndef ETH_RX_POOL_NB
+#define ETH_RX_POOL_NB   (2 * ETH_RXBUFNB)
+#endif
+#else
+#define ETH_RX_POOL_NB   0
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if defined ( __ICCARM__ ) /*!< IAR Compiler */
+  #pragma data_alignment=4   
+#endif
+__ALIGN_BEGIN ETH_DMADescTypeDef  DMARxDscrTab[ETH_RXBUFNB] __ALIGN_END;/* Ethernet Rx MA Descriptor */
+
+#if defined ( __ICCARM__ ) /*!< IAR Compiler */
+  #pragma data_alignment=4   
+#endif
+__ALIGN_BEGIN ETH_DMADescTypeDef  DMATxDscrTab[ETH_TXBUFNB] __ALIGN_END;/* Ethernet Tx DMA Descriptor */
+
+#if defined ( __ICCARM__ ) /*!< IAR Compiler */
+  #pragma data_alignment=4   
+#endif
+__ALIGN_BEGIN uint8_t Rx_Buff[ETH_RXBUFNB + ETH_RX_POOL_NB][ETH_RX_BUF_SIZE] __ALIGN_END; /* Ethernet Receive Buffer */
+
+#if defined ( __ICCARM__ ) /*!< IAR Compiler */
+  #pragma data_alignment=4   
+#endif
+__ALIGN_BEGIN uint8_t Tx_Buff[ETH_TXBUFNB][ETH_TX_BUF_SIZE] __ALIGN_END; /* Ethernet Transmit Buffer */
+
+ETH_HandleTypeDef EthHandle;
+
+#if ETH_RX_ZERO_COPY
+/* Custom pbufs wrapping the Rx buffers: aRxPbuf[i] references Rx_Buff[i] */
+static struct pbuf_custom aRxPbuf[ETH_RXBUFNB + ETH_RX_POOL_NB];
+/* Spare Rx buffers, owned neither by a descriptor nor by LwIP */
+static uint8_t *aRxFreeBuff[ETH_RX_POOL_NB];
+static __IO uint32_t RxFreeNb = 0;
+static __IO u8_t RxZeroCopy = 1;
+static EthernetifRxStatsTypeDef RxStats;
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+/*******************************************************************************
+                       Ethernet MSP Routines
+*******************************************************************************/
+/**
+  * @brief  Initializes the ETH MSP.
+  * @param  heth: ETH handle
+  * @retval None
+  */
+void HAL_ETH_MspInit(ETH_HandleTypeDef *heth)
+{ 
+  GPIO_InitTypeDef GPIO_InitStructure;
+  
+  /* Enable GPIOs clocks */
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  __HAL_RCC_GPIOF_CLK_ENABLE();
+  __HAL_RCC_GPIOG_CLK_ENABLE();
+  __HAL_RCC_GPIOH_CLK_ENABLE();
+  __HAL_RCC_GPIOI_CLK_ENABLE(); 
+
+/* Ethernet pins configuration ************************************************/
+  /*
+        ETH_MDIO -------------------------> PA2
+        ETH_MDC --------------------------> PC1
+        ETH_PPS_OUT ----------------------> PB5
+        ETH_MII_RXD2 ---------------------> PH6
+        ETH_MII_RXD3 ---------------------> PH7
+        ETH_MII_TX_CLK -------------------> PC3
+        ETH_MII_TXD2 ---------------------> PC2
+        ETH_MII_TXD3 ---------------------> PB8
+        ETH_MII_RX_CLK -------------------> PA1
+        ETH_MII_RX_DV --------------------> PA7
+        ETH_MII_RXD0 ---------------------> PC4
+        ETH_MII_RXD1 ---------------------> PC5
+        ETH_MII_TX_EN --------------------> PG11
+        ETH_MII_TXD0 ---------------------> PG13
+        ETH_MII_TXD1 ---------------------> PG14
+        ETH_MII_RX_ER --------------------> PI10 (not configured)        
+        ETH_MII_CRS ----------------------> PA0  (not configured)
+        ETH_MII_COL ----------------------> PH3  (not configured)
+  */
+
+  /* Configure PA1, PA2 and PA7 */
+  GPIO_InitStructure.Speed = GPIO_SPEED_HIGH;
+  GPIO_InitStructure.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStructure.Pull = GPIO_NOPULL; 
+  GPIO_InitStructure.Alternate = GPIO_AF11_ETH;
+  GPIO_InitStructure.Pin = GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_7;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStructure);
+
+  /* Configure PB5 and PB8 */
+  GPIO_InitStructure.Pin = GPIO_PIN_5 | GPIO_PIN_8;
+  HAL_GPIO_Init(GPIOB, &GPIO_InitStructure);
+
+  /* Configure PC1, PC2, PC3, PC4 and PC5 */
+  GPIO_InitStructure.Pin = GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3 | GPIO_PIN_4 | GPIO_PIN_5;
+  HAL_GPIO_Init(GPIOC, &GPIO_InitStructure);
+
+                                
+  /* Configure PG11, PG14 and PG13 */
+  GPIO_InitStructure.Pin =  GPIO_PIN_11 | GPIO_PIN_13 | GPIO_PIN_14;
+  HAL_GPIO_Init(GPIOG, &GPIO_InitStructure);
+
+  /* Configure PH6, PH7 */
+  GPIO_InitStructure.Pin =  GPIO_PIN_6 | GPIO_PIN_7;
+  HAL_GPIO_Init(GPIOH, &GPIO_InitStructure);
+  
+  /* Configure PA0 
+  GPIO_InitStructure.Pin =  GPIO_PIN_0;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStructure);
+  
+  Note: Ethernet Full duplex mode works properly in the default setting
+  (which MII_CRS is not connected to PA0 of STM32F4x9NIH6) because PA0 is shared
+  with Wakeup button and MC_ENA. 
+  If Half duplex mode is needed, uncomment PA0 configuration code source (above 
+  the note) and close the SB7 solder bridge of the STM324x9I-EVAL board . 
+  */
+
+  /* Configure PH3 
+  GPIO_InitStructure.Pin =  GPIO_PIN_3;
+  HAL_GPIO_Init(GPIOH, &GPIO_InitStructure);
+  
+  Note: Ethernet Full duplex mode works properly in the default setting
+  (which MII_COL is not connected to PH3 of STM32F4x9NIH6) because PH3 is shared
+  with SDRAM chip select SDNE0. 
+  If Half duplex mode is needed, uncomment PH3 configuration code source (above 
+  the note) and close SB8 solder bridge of the STM324x9I-EVAL board. 
+  */
+
+  /* Configure PI10
+  GPIO_InitStructure.Pin = GPIO_PIN_10;
+  HAL_GPIO_Init(GPIOI, &GPIO_InitStructure); 
+  
+  Note: Ethernet works properly in the default setting (which RX_ER is not 
+  connected to PI10 of STM32F4x9NIH6) because PI10 is shared with data signal 
+  of SDRAM. 
+  If RX_ER signal is needed, uncomment PI10 configuration code source (above 
+  the note) then remove R244 and solder R43 of the STM324x9I-EVAL board. 
+  */
+  
+  /* Enable ETHERNET clock  */
+  __HAL_RCC_ETH_CLK_ENABLE();
+}
+
+/*******************************************************************************
+                       LL Driver Interface ( LwIP stack --> ETH) 
+*******************************************************************************/
+#if ETH_RX_ZERO_COPY
+/**
+  * @brief  Custom pbuf free function: called by LwIP when the last reference
+  *         to a received frame segment is released. The Rx buffer goes back to
+  *         the pool of spare buffers used to refill the DMA descriptors.
+  * @param  p: the custom pbuf wrapping the Rx buffer
+  * @retval None
+  */
+static void ethernetif_rx_pbuf_free(struct pbuf *p)
+{
+  uint32_t index = (uint32_t)((struct pbuf_custom *)p - aRxPbuf);
+  uint32_t primask = __get_PRIMASK();
+  
+  /* The pbuf may be freed by any thread of the application */
+  __disable_irq();
+  aRxFreeBuff[RxFreeNb++] = &Rx_Buff[index][0];
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Initializes the custom pbufs wrapping the Rx buffers and fills the
+  *         pool of spare buffers with the buffers not given to the descriptors.
+  * @param  None
+  * @retval None
+  */
+static void ethernetif_rx_pool_init(void)
+{
+  uint32_t i;
+  
+  for (i = 0; i < (ETH_RXBUFNB + ETH_RX_POOL_NB); i++)
+  {
+    aRxPbuf[i].custom_free_function = ethernetif_rx_pbuf_free;
+  }
+  
+  for (i = 0; i < ETH_RX_POOL_NB; i++)
+  {
+    aRxFreeBuff[i] = &Rx_Buff[ETH_RXBUFNB + i][0];
+  }
+  RxFreeNb = ETH_RX_POOL_NB;
+}
+
+/**
+  * @brief  Passes the received frame to LwIP without copying it: each DMA buffer
+  *         of the frame is wrapped in a custom pbuf and its descriptor is given
+  *         back to the DMA with a spare buffer taken from the pool.
+  * @param  None
+  * @retval The pbuf chain holding the frame, NULL if zero-copy is disabled or
+  *         if the pool cannot replace all the buffers of the frame: the frame
+  *         is then copied by low_level_input().
+  */
+static struct pbuf * low_level_input_zero_copy(void)
+{
+  struct pbuf *p = NULL, *q;
+  __IO ETH_DMADescTypeDef *dmarxdesc;
+  uint8_t *spare[ETH_RXBUFNB];
+  uint32_t segcount = EthHandle.RxFrameInfos.SegCount;
+  uint32_t len = EthHandle.RxFrameInfos.length;
+  uint32_t seglen, index, primask, i;
+  
+  if (len == 0)
+  {
+    return NULL;
+  }
+  
+  if ((RxZeroCopy == 0) || (segcount > ETH_RXBUFNB))
+  {
+    RxStats.CopiedFrames++;
+    return NULL;
+  }
+  
+  /* Take a spare buffer for each segment of the frame, or none */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (RxFreeNb < segcount)
+  {
+    __set_PRIMASK(primask);
+    RxStats.CopiedFrames++;
+    return NULL;
+  }
+  for (i = 0; i < segcount; i++)
+  {
+    spare[i] = aRxFreeBuff[--RxFreeNb];
+  }
+  __set_PRIMASK(primask);
+  
+  dmarxdesc = EthHandle.RxFrameInfos.FSRxDesc;
+  for (i = 0; i < segcount; i++)
+  {
+    seglen = (len > ETH_RX_BUF_SIZE) ? ETH_RX_BUF_SIZE : len;
+    len -= seglen;
+    
+    /* Wrap the received buffer in its custom pbuf */
+    index = (dmarxdesc->Buffer1Addr - (uint32_t)&Rx_Buff[0][0]) / ETH_RX_BUF_SIZE;
+    q = pbuf_alloced_custom(PBUF_RAW, (u16_t)seglen, PBUF_REF, &aRxPbuf[index],
+                            (void *)dmarxdesc->Buffer1Addr, ETH_RX_BUF_SIZE);
+    if (p == NULL)
+    {
+      p = q;
+    }
+    else
+    {
+      pbuf_cat(p, q);
+    }
+    
+    /* Refill the descriptor and give it back to DMA */
+    dmarxdesc->Buffer1Addr = (uint32_t)spare[i];
+    dmarxdesc->Status = ETH_DMARXDESC_OWN;
+    dmarxdesc = (ETH_DMADescTypeDef *)(dmarxdesc->Buffer2NextDescAddr);
+  }
+  
+  /* Clear Segment_Count */
+  EthHandle.RxFrameInfos.SegCount = 0;
+  
+  /* When Rx Buffer unavailable flag is set: clear it and resume reception */
+  if ((EthHandle.Instance->DMASR & ETH_DMASR_RBUS) != (uint32_t)RESET)
+  {
+    /* Clear RBUS ETHERNET DMA flag */
+    EthHandle.Instance->DMASR = ETH_DMASR_RBUS;
+    /* Resume DMA reception */
+    EthHandle.Instance->DMARPDR = 0;
+  }
+  
+  RxStats.ZeroCopyFrames++;
+  return p;
+}
+
+/**
+  * @brief  Enables or disables the zero-copy reception at run time. When
+  *         disabled, all the received frames are copied into PBUF_POOL pbufs.
+  * @param  enable: 1 to pass the frames in their DMA buffers, 0 to copy them
+  * @retval None
+  */
+void ethernetif_set_rx_zero_copy(u8_t enable)
+{
+  RxZeroCopy = enable;
+}
+
+/**
+  * @brief  Returns the reception statistics of the zero-copy path.
+  * @param  stats: pointer to the structure receiving the statistics
+  * @retval None
+  */
+void ethernetif_get_rx_stats(EthernetifRxStatsTypeDef *stats)
+{
+  *stats = RxStats;
+}
+#endif /* ETH_RX_ZERO_COPY */
+
+/**
+  * @brief In this function, the hardware should be initialized.
+  * Called from ethernetif_init().
+  *
+  * @param netif the already initialized lwip network interface structure
+  *        for this ethernetif
+  */
+static void low_level_init(struct netif *netif)
+{ 
+  uint32_t regvalue = 0;
+  uint8_t macaddress[6]= { MAC_ADDR0, MAC_ADDR1, MAC_ADDR2, MAC_ADDR3, MAC_ADDR4, MAC_ADDR5 };
+
+  EthHandle.Instance = ETH;  
+  EthHandle.Init.MACAddr = macaddress;
+  EthHandle.Init.AutoNegotiation = ETH_AUTONEGOTIATION_ENABLE;
+  EthHandle.Init.Speed = ETH_SPEED_100M;
+  EthHandle.Init.DuplexMode = ETH_MODE_FULLDUPLEX;
+  EthHandle.Init.MediaInterface = ETH_MEDIA_INTERFACE_MII;
+  EthHandle.Init.RxMode = ETH_RXPOLLING_MODE;
+  EthHandle.Init.ChecksumMode = ETH_CHECKSUM_BY_HARDWARE;
+  EthHandle.Init.PhyAddress = DP83848_PHY_ADDRESS;
+  
+  /* configure ethernet peripheral (GPIOs, clocks, MAC, DMA) */
+  if (HAL_ETH_Init(&EthHandle) == HAL_OK)
+  {
+    /* Set netif link flag */
+    netif->flags |= NETIF_FLAG_LINK_UP;
+  }
+  
+  /* Initialize Tx Descriptors list: Chain Mode */
+  HAL_ETH_DMATxDescListInit(&EthHandle, DMATxDscrTab, &Tx_Buff[0][0], ETH_TXBUFNB);
+     
+  /* Initialize Rx Descriptors list: Chain Mode  */
+  HAL_ETH_DMARxDescListInit(&EthHandle, DMARxDscrTab, &Rx_Buff[0][0], ETH_RXBUFNB);
+
+#if ETH_RX_ZERO_COPY
+  /* Initialize the custom pbufs and the pool of spare Rx buffers */
+  ethernetif_rx_pool_init();
+#endif
+  
+  /* set MAC hardware address length */
+  netif->hwaddr_len = ETHARP_HWADDR_LEN;
+  
+  /* set MAC hardware address */
+  netif->hwaddr[0] =  MAC_ADDR0;
+  netif->hwaddr[1] =  MAC_ADDR1;
+  netif->hwaddr[2] =  MAC_ADDR2;
+  netif->hwaddr[3] =  MAC_ADDR3;
+  netif->hwaddr[4] =  MAC_ADDR4;
+  netif->hwaddr[5] =  MAC_ADDR5;
+  
+  /* maximum transfer unit */
+  netif->mtu = 1500;
+  
+  /* device capabilities */
+  /* don't set NETIF_FLAG_ETHARP if this device is not an ethernet one */
+  netif->flags |= NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP;
+  
+  /* Enable MAC and DMA transmission and reception */
+  HAL_ETH_Start(&EthHandle);
+  
+  /**** Configure PHY to generate an interrupt when Eth Link state changes ****/
+  /* Read Register Configuration */
+  HAL_ETH_ReadPHYRegister(&EthHandle, PHY_MICR, &regvalue);
+  
+  regvalue |= (PHY_MICR_INT_EN | PHY_MICR_INT_OE);
+
+  /* Enable Interrupts */
+  HAL_ETH_WritePHYRegister(&EthHandle, PHY_MICR, regvalue );
+  
+  /* Read Register Configuration */
+  HAL_ETH_ReadPHYRegister(&EthHandle, PHY_MISR, &regvalue);
+  
+  regvalue |= PHY_MISR_LINK_INT_EN;
+    
+  /* Enable Interrupt on change of link status */
+  HAL_ETH_WritePHYRegister(&EthHandle, PHY_MISR, regvalue);
+}
+
+/**
+  * @brief This function should do the actual transmission of the packet. The packet is
+  * contained in the pbuf that is passed to the function. This pbuf
+  * might be chained.
+  *
+  * @param netif the lwip network interface structure for this ethernetif
+  * @param p the MAC packet to send (e.g. IP packet including MAC addresses and type)
+  * @return ERR_OK if the packet could be sent
+  *         an err_t value if the packet couldn't be sent
+  *
+  * @note Returning ERR_MEM here if a DMA queue of your MAC is full can lead to
+  *       strange results. You might consider waiting for space in the DMA queue
+  *       to become availale since the stack doesn't retry to send a packet
+  *       dropped because of memory failure (except for the TCP timers).
+  */
+static err_t low_level_output(struct netif *netif, struct pbuf *p)
+{
+  err_t errval;
+  struct pbuf *q;
+  uint8_t *buffer = (uint8_t *)(EthHandle.TxDesc->Buffer1Addr);
+  __IO ETH_DMADescTypeDef *DmaTxDesc;
+  uint32_t framelength = 0;
+  uint32_t bufferoffset = 0;
+  uint32_t byteslefttocopy = 0;
+  uint32_t payloadoffset = 0;
+
+  DmaTxDesc = EthHandle.TxDesc;
+  bufferoffset = 0;
+  
+  /* copy frame from pbufs to driver buffers */
+  for(q = p; q != NULL; q = q->next)
+  {
+    /* Is this buffer available? If not, goto error */
+    if((DmaTxDesc->Status & ETH_DMATXDESC_OWN) != (uint32_t)RESET)
+    {
+      errval = ERR_USE;
+      goto error;
+    }
+    
+    /* Get bytes in current lwIP buffer */
+    byteslefttocopy = q->len;
+    payloadoffset = 0;
+    
+    /* Check if the length of data to copy is bigger than Tx buffer size*/
+    while( (byteslefttocopy + bufferoffset) > ETH_TX_BUF_SIZE )
+    {
+      /* Copy data to Tx buffer*/
+      memcpy( (uint8_t*)((uint8_t*)buffer + bufferoffset), (uint8_t*)((uint8_t*)q->payload + payloadoffset), (ETH_TX_BUF_SIZE - bufferoffset) );
+      
+      /* Point to next descriptor */
+      DmaTxDesc = (ETH_DMADescTypeDef *)(DmaTxDesc->Buffer2NextDescAddr);
+      
+      /* Check if the buffer is available */
+      if((DmaTxDesc->Status & ETH_DMATXDESC_OWN) != (uint32_t)RESET)
+      {
+        errval = ERR_USE;
+        goto error;
+      }
+      
+      buffer = (uint8_t *)(DmaTxDesc->Buffer1Addr);
+      
+      byteslefttocopy = byteslefttocopy - (ETH_TX_BUF_SIZE - bufferoffset);
+      payloadoffset = payloadoffset + (ETH_TX_BUF_SIZE - bufferoffset);
+      framelength = framelength + (ETH_TX_BUF_SIZE - bufferoffset);
+      bufferoffset = 0;
+    }
+    
+    /* Copy the remaining bytes */
+    memcpy( (uint8_t*)((uint8_t*)buffer + bufferoffset), (uint8_t*)((uint8_t*)q->payload + payloadoffset), byteslefttocopy );
+    bufferoffset = bufferoffset + byteslefttocopy;
+    framelength = framelength + byteslefttocopy;
+  }
+  
+  /* Prepare transmit descriptors to give to DMA */ 
+  HAL_ETH_TransmitFrame(&EthHandle, framelength);
+  
+  errval = ERR_OK;
+  
+error:
+  
+  /* When Transmit Underflow flag is set, clear it and issue a Transmit Poll Demand to resume transmission */
+  if ((EthHandle.Instance->DMASR & ETH_DMASR_TUS) != (uint32_t)RESET)
+  {
+    /* Clear TUS ETHERNET DMA flag */
+    EthHandle.Instance->DMASR = ETH_DMASR_TUS;
+    
+    /* Resume DMA transmission*/
+    EthHandle.Instance->DMATPDR = 0;
+  }
+  return errval;
+}
+
+/**
+  * @brief Should allocate a pbuf and transfer the bytes of the incoming
+  * packet from the interface into the pbuf.
+  *
+  * @param netif the lwip network interface structure for this ethernetif
+  * @return a pbuf filled with the received packet (including MAC header)
+  *         NULL on memory error
+  */
+static struct pbuf * low_level_input(struct netif *netif)
+{
+  struct pbuf *p = NULL;
+  struct pbuf *q;
+  uint16_t len;
+  uint8_t *buffer;
+  __IO ETH_DMADescTypeDef *dmarxdesc;
+  uint32_t bufferoffset = 0;
+  uint32_t payloadoffset = 0;
+  uint32_t byteslefttocopy = 0;
+  uint32_t i=0;
+  
+  if (HAL_ETH_GetReceivedFrame(&EthHandle) != HAL_OK)
+    return NULL;
+
+#if ETH_RX_ZERO_COPY
+  /* Pass the frame in its DMA buffers when spare buffers are available */
+  p = low_level_input_zero_copy();
+  if (p != NULL)
+    return p;
+#endif
+  
+  /* Obtain the size of the packet and put it into the "len" variable. */
+  len = EthHandle.RxFrameInfos.length;
+  buffer = (uint8_t *)EthHandle.RxFrameInfos.buffer;
+  
+  if (len > 0)
+  {
+    /* We allocate a pbuf chain of pbufs from the Lwip buffer pool */
+    p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+  }
+  
+  if (p != NULL)
+  {
+    dmarxdesc = EthHandle.RxFrameInfos.FSRxDesc;
+    bufferoffset = 0;
+    
+    for(q = p; q != NULL; q = q->next)
+    {
+      byteslefttocopy = q->len;
+      payloadoffset = 0;
+      
+      /* Check if the length of bytes to copy in current pbuf is bigger than Rx buffer size */
+      while( (byteslefttocopy + bufferoffset) > ETH_RX_BUF_SIZE )
+      {
+        /* Copy data to pbuf */
+        memcpy( (uint8_t*)((uint8_t*)q->payload + payloadoffset), (uint8_t*)((uint8_t*)buffer + bufferoffset), (ETH_RX_BUF_SIZE - bufferoffset));
+        
+        /* Point to next descriptor */
+        dmarxdesc = (ETH_DMADescTypeDef *)(dmarxdesc->Buffer2NextDescAddr);
+        buffer = (uint8_t *)(dmarxdesc->Buffer1Addr);
+        
+        byteslefttocopy = byteslefttocopy - (ETH_RX_BUF_SIZE - bufferoffset);
+        payloadoffset = payloadoffset + (ETH_RX_BUF_SIZE - bufferoffset);
+        bufferoffset = 0;
+      }
+      
+      /* Copy remaining data in pbuf */
+      memcpy( (uint8_t*)((uint8_t*)q->payload + payloadoffset), (uint8_t*)((uint8_t*)buffer + bufferoffset), byteslefttocopy);
+      bufferoffset = bufferoffset + byteslefttocopy;
+    }
+    
+    
+    /* Release descriptors to DMA */
+    /* Point to first descriptor */
+    dmarxdesc = EthHandle.RxFrameInfos.FSRxDesc;
+    /* Set Own bit in Rx descriptors: gives the buffers back to DMA */
+    for (i=0; i< EthHandle.RxFrameInfos.SegCount; i++)
+    {  
+      dmarxdesc->Status |= ETH_DMARXDESC_OWN;
+      dmarxdesc = (ETH_DMADescTypeDef *)(dmarxdesc->Buffer2NextDescAddr);
+    }
+    
+    /* Clear Segment_Count */
+    EthHandle.RxFrameInfos.SegCount =0;
+  }
+  
+  /* When Rx Buffer unavailable flag is set: clear it and resume reception */
+  if ((EthHandle.Instance->DMASR & ETH_DMASR_RBUS) != (uint32_t)RESET)  
+  {
+    /* Clear RBUS ETHERNET DMA flag */
+    EthHandle.Instance->DMASR = ETH_DMASR_RBUS;
+    /* Resume DMA reception */
+    EthHandle.Instance->DMARPDR = 0;
+  }
+  return p;
+}
+
+/**
+  * @brief This function should be called when a packet is ready to be read
+  * from the interface. It uses the function low_level_input() that
+  * should handle the actual reception of bytes from the network
+  * interface. Then the type of the received packet is determined and
+  * the appropriate input function is called.
+  *
+  * @param netif the lwip network interface structure for this ethernetif
+  */
+void ethernetif_input(struct netif *netif)
+{
+  err_t err;
+  struct pbuf *p;
+  
+  /* move received packet into a new pbuf */
+  p = low_level_input(netif);
+    
+  /* no packet could be read, silently ignore this */
+  if (p == NULL) return;
+    
+  /* entry point to the LwIP stack */
+  err = netif->input(p, netif);
+    
+  if (err != ERR_OK)
+  {
+    LWIP_DEBUGF(NETIF_DEBUG, ("ethernetif_input: IP input error\n"));
+    pbuf_free(p);
+    p = NULL;
+  }
+}
+
+/**
+  * @brief Should be called at the beginning of the program to set up the
+  * network interface. It calls the function low_level_init() to do the
+  * actual setup of the hardware.
+  *
+  * This function should be passed as a parameter to netif_add().
+  *
+  * @param netif the lwip network interface structure for this ethernetif
+  * @return ERR_OK if the loopif is initialized
+  *         ERR_MEM if private data couldn't be allocated
+  *         any other err_t on error
+  */
+err_t ethernetif_init(struct netif *netif)
+{
+  LWIP_ASSERT("netif != NULL", (netif != NULL));
+  
+#if LWIP_NETIF_HOSTNAME
+  /* Initialize interface hostname */
+  netif->hostname = "lwip";
+#endif /* LWIP_NETIF_HOSTNAME */
+
+  netif->name[0] = IFNAME0;
+  netif->name[1] = IFNAME1;
+  /* We directly use etharp_output() here to save a function call.
+   * You can instead declare your own function an call etharp_output()
+   * from it if you have to do some checks before sending (e.g. if link
+   * is available...) */
+  netif->output = etharp_output;
+  netif->linkoutput = low_level_output;
+
+  /* initialize the hardware */
+  low_level_init(netif);
+
+  return ERR_OK;
+}
+
+/**
+  * @brief  Returns the current time in milliseconds
+  *         when LWIP_TIMERS == 1 and NO_SYS == 1
+  * @param  None
+  * @retval Current Time value
+  */
+u32_t sys_now(void)
+{
+  return HAL_GetTick();
+}
+
+/**
+  * @brief  This function sets the netif link status.
+  * @param  netif: the network interface
+  * @retval None
+  */
+void ethernetif_set_link(struct netif *netif)
+{
+  uint32_t regvalue = 0;
+  
+  /* Read PHY_MISR*/
+  HAL_ETH_ReadPHYRegister(&EthHandle, PHY_MISR, &regvalue);
+  
+  /* Check whether the link interrupt has occurred or not */
+  if((regvalue & PHY_LINK_INTERRUPT) != (uint16_t)RESET)
+  {
+    /* Read PHY_SR*/
+    HAL_ETH_ReadPHYRegister(&EthHandle, PHY_SR, &regvalue);
+    
+    /* Check whether the link is up or down*/
+    if((regvalue & PHY_LINK_STATUS)!= (uint16_t)RESET)
+    {
+      netif_set_link_up(netif);
+    }
+    else
+    {
+      netif_set_link_down(netif);
+    }
+  }
+}
+
+/**
+  * @brief  Link callback function, this function is called on change of link status
+  *         to update low level driver configuration.
+* @param  netif: The network interface
+  * @retval None
+  */
+void ethernetif_update_config(struct netif *netif)
+{
+  __IO uint32_t tickstart = 0;
+  uint32_t regvalue = 0;
+  
+  if(netif_is_link_up(netif))
+  { 
+    /* Restart the auto-negotiation */
+    if(EthHandle.Init.AutoNegotiation != ETH_AUTONEGOTIATION_DISABLE)
+    {
+      /* Enable Auto-Negotiation */
+      HAL_ETH_WritePHYRegister(&EthHandle, PHY_BCR, PHY_AUTONEGOTIATION);
+      
+      /* Get tick */
+      tickstart = HAL_GetTick();
+      
+      /* Wait until the auto-negotiation will be completed */
+      do
+      {
+        HAL_ETH_ReadPHYRegister(&EthHandle, PHY_BSR, &regvalue);
+        
+        /* Check for the Timeout ( 1s ) */
+        if((HAL_GetTick() - tickstart ) > 1000)
+        {
+          /* In case of timeout */
+          goto error;
+        }
+        
+      } while (((regvalue & PHY_AUTONEGO_COMPLETE) != PHY_AUTONEGO_COMPLETE));
+      
+      /* Read the result of the auto-negotiation */
+      HAL_ETH_ReadPHYRegister(&EthHandle, PHY_SR, &regvalue);
+      
+      /* Configure the MAC with the Duplex Mode fixed by the auto-negotiation process */
+      if((regvalue & PHY_DUPLEX_STATUS) != (uint32_t)RESET)
+      {
+        /* Set Ethernet duplex mode to Full-duplex following the auto-negotiation */
+        EthHandle.Init.DuplexMode = ETH_MODE_FULLDUPLEX;  
+      }
+      else
+      {
+        /* Set Ethernet duplex mode to Half-duplex following the auto-negotiation */
+        EthHandle.Init.DuplexMode = ETH_MODE_HALFDUPLEX;           
+      }
+      /* Configure the MAC with the speed fixed by the auto-negotiation process */
+      if(regvalue & PHY_SPEED_STATUS)
+      {  
+        /* Set Ethernet speed to 10M following the auto-negotiation */
+        EthHandle.Init.Speed = ETH_SPEED_10M; 
+      }
+      else
+      {   
+        /* Set Ethernet speed to 100M following the auto-negotiation */ 
+        EthHandle.Init.Speed = ETH_SPEED_100M;
+      }
+    }
+    else /* AutoNegotiation Disable */
+    {
+    error :
+      /* Check parameters */
+      assert_param(IS_ETH_SPEED(EthHandle.Init.Speed));
+      assert_param(IS_ETH_DUPLEX_MODE(EthHandle.Init.DuplexMode));
+      
+      /* Set MAC Speed and Duplex Mode to PHY */
+      HAL_ETH_WritePHYRegister(&EthHandle, PHY_BCR, ((uint16_t)(EthHandle.Init.DuplexMode >> 3) |
+                                                     (uint16_t)(EthHandle.Init.Speed >> 1))); 
+    }
+
+    /* ETHERNET MAC Re-Configuration */
+    HAL_ETH_ConfigMAC(&EthHandle, (ETH_MACInitTypeDef *) NULL);
+
+    /* Restart MAC interface */
+    HAL_ETH_Start(&EthHandle);   
+  }
+  else
+  {
+    /* Stop MAC interface */
+    HAL_ETH_Stop(&EthHandle);
+  }
+
+  ethernetif_notify_conn_changed(netif);
+}
+
+/**
+  * @brief  This function notify user about link status changement.
+  * @param  netif: the network interface
+  * @retval None
+  */
+__weak void ethernetif_notify_conn_changed(struct netif *netif)
+{
+  /* NOTE : This is function clould be implemented in user file 
+            when the callback is needed,
+  */  
+}
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,355 @@
+/**
+  ******************************************************************************
+  * @file    LwIP/LwIP_UDP_Rx_Benchmark/Src/main.c 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   This sample code measures the UDP reception throughput and the
+  *          CPU load of the Ethernet driver, alternating the zero-copy and
+  *          the copy reception of the frames. The datagrams are sent by
+  *          iperf running on a remote PC.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "lwip/opt.h"
+#include "lwip/init.h"
+#include "lwip/netif.h"
+#include "lwip/lwip_timers.h"
+#include "netif/etharp.h"
+#include "ethernetif.h"
+#include "app_ethernet.h"
+#include "udp_rxbench.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+struct netif gnetif;
+
+/* Benchmark results: aBenchResults[0] for the zero-copy reception,
+   aBenchResults[1] for the copy reception */
+BenchResultTypeDef aBenchResults[BENCH_PASSES];
+
+/* Current pass */
+static uint32_t PassRunning = 0;
+static uint32_t PassZeroCopy = 1;
+static uint32_t PassStartTick = 0;
+static uint32_t PassStartCycles = 0;
+static uint32_t PassBusyCycles = 0;
+static EthernetifRxStatsTypeDef PassStartStats;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SystemClock_Config(void);
+static void BSP_Config(void);
+static void Netif_Config(void);
+static void Bench_Input(void);
+static void Bench_Process(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval None
+  */
+int main(void)
+{
+  /* STM32F4xx HAL library initialization:
+       - Configure the Flash prefetch, instruction and Data caches
+       - Configure the Systick to generate an interrupt each 1 msec
+       - Set NVIC Group Priority to 4
+       - Global MSP (MCU Support Package) initialization
+     */
+  HAL_Init();  
+  
+  /* Configure the system clock to 180 MHz */
+  SystemClock_Config();
+  
+  /* Configure the BSP */
+  BSP_Config();
+    
+  /* Initilaize the LwIP stack */
+  lwip_init();
+  
+  /* Configure the Network interface */
+  Netif_Config();
+  
+  /* Enable the DWT cycle counter used to measure the reception load */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  
+  /* UDP receiver Init */
+  udp_rxbench_init();
+  
+  /* Notify user about the netwoek interface config */
+  User_notification(&gnetif);
+  
+  /* Infinite loop */
+  while (1)
+  {  
+    /* Read a received packet from the Ethernet buffers and send it 
+       to the lwIP for handling */
+    Bench_Input();
+    
+    /* Start or end the benchmark passes */
+    Bench_Process();
+
+    /* Handle timeouts */
+    sys_check_timeouts();
+  }
+}
+
+/**
+  * @brief  Passes a received frame to LwIP. The cycles of the calls which
+  *         received a frame are added to the load of the current pass.
+  * @param  None
+  * @retval None
+  */
+static void Bench_Input(void)
+{
+  EthernetifRxStatsTypeDef stats;
+  uint32_t frames, start, end;
+  
+  ethernetif_get_rx_stats(&stats);
+  frames = stats.ZeroCopyFrames + stats.CopiedFrames;
+  
+  start = DWT->CYCCNT;
+  ethernetif_input(&gnetif);
+  end = DWT->CYCCNT;
+  
+  ethernetif_get_rx_stats(&stats);
+  if ((stats.ZeroCopyFrames + stats.CopiedFrames) != frames)
+  {
+    PassBusyCycles += end - start;
+  }
+}
+
+/**
+  * @brief  Starts a pass at the first received datagram and ends it after
+  *         BENCH_PASS_TIME ms: its results are stored in aBenchResults and
+  *         the next pass uses the other reception mode.
+  * @param  None
+  * @retval None
+  */
+static void Bench_Process(void)
+{
+  BenchResultTypeDef *result;
+  EthernetifRxStatsTypeDef stats;
+  uint32_t bytes, datagrams, cycles, frames, ms;
+  
+  if (PassRunning == 0)
+  {
+    udp_rxbench_read_counters(&bytes, &datagrams);
+    if (datagrams != 0)
+    {
+      /* iperf is sending: start the pass */
+      ethernetif_set_rx_zero_copy((u8_t)PassZeroCopy);
+      ethernetif_get_rx_stats(&PassStartStats);
+      PassStartTick = HAL_GetTick();
+      PassStartCycles = DWT->CYCCNT;
+      PassBusyCycles = 0;
+      PassRunning = 1;
+      BSP_LED_On(LED3);
+    }
+    return;
+  }
+  
+  ms = HAL_GetTick() - PassStartTick;
+  if (ms < BENCH_PASS_TIME)
+  {
+    return;
+  }
+  
+  /* End of the pass */
+  cycles = DWT->CYCCNT - PassStartCycles;
+  udp_rxbench_read_counters(&bytes, &datagrams);
+  ethernetif_get_rx_stats(&stats);
+  
+  result = &aBenchResults[(PassZeroCopy != 0) ? 0 : 1];
+  result->ZeroCopy = PassZeroCopy;
+  result->Datagrams = datagrams;
+  result->Throughput = (bytes * 8) / ms;
+  result->ZeroCopyFrames = stats.ZeroCopyFrames - PassStartStats.ZeroCopyFrames;
+  result->CopiedFrames = stats.CopiedFrames - PassStartStats.CopiedFrames;
+  frames = result->ZeroCopyFrames + result->CopiedFrames;
+  result->CyclesPerFrame = (frames != 0) ? (PassBusyCycles / frames) : 0;
+  result->CpuLoad = PassBusyCycles / (cycles / 100);
+  
+  /* The next pass starts with the next datagram, in the other mode */
+  PassZeroCopy = (PassZeroCopy != 0) ? 0 : 1;
+  PassRunning = 0;
+  BSP_LED_Off(LED3);
+  BSP_LED_Toggle(LED4);
+}
+
+/**
+  * @brief  Configurates the BSP.
+  * @param  None
+  * @retval None
+  */
+static void BSP_Config(void)
+{
+  /* Configure LED1, LED2, LED3 and LED4 */
+  BSP_LED_Init(LED1);
+  BSP_LED_Init(LED2);
+  BSP_LED_Init(LED3);
+  BSP_LED_Init(LED4);
+  
+  /* Set Systick Interrupt to the highest priority */
+  HAL_NVIC_SetPriority(SysTick_IRQn, 0x0, 0x0);
+  
+  /* Init IO Expander */
+  BSP_IO_Init();
+  /* Enable IO Expander interrupt for ETH MII pin */
+  BSP_IO_ConfigPin(MII_INT_PIN, IO_MODE_IT_FALLING_EDGE);
+}
+
+/**
+  * @brief  Configurates the network interface
+  * @param  None
+  * @retval None
+  */
+static void Netif_Config(void)
+{
+  struct ip_addr ipaddr;
+  struct ip_addr netmask;
+  struct ip_addr gw;
+  
+  IP4_ADDR(&ipaddr, IP_ADDR0, IP_ADDR1, IP_ADDR2, IP_ADDR3);
+  IP4_ADDR(&netmask, NETMASK_ADDR0, NETMASK_ADDR1 , NETMASK_ADDR2, NETMASK_ADDR3);
+  IP4_ADDR(&gw, GW_ADDR0, GW_ADDR1, GW_ADDR2, GW_ADDR3);
+  
+  /* add the network interface */    
+  netif_add(&gnetif, &ipaddr, &netmask, &gw, NULL, &ethernetif_init, &ethernet_input);
+  
+  /*  Registers the default network interface */
+  netif_set_default(&gnetif);
+  
+  if (netif_is_link_up(&gnetif))
+  {
+    /* When the netif is fully configured this function must be called */
+    netif_set_up(&gnetif);
+  }
+  else
+  {
+    /* When the netif link is down this function must be called */
+    netif_set_down(&gnetif);
+  }
+  
+  /* Set the link callback function, this function is called on change of link status*/
+  netif_set_link_callback(&gnetif, ethernetif_update_config);
+}
+
+/**
+  * @brief  EXTI line detection callbacks
+  * @param  GPIO_Pin: Specifies the pins connected EXTI line
+  * @retval None
+  */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  /* Get the IT status register value */
+  if(BSP_IO_ITGetStatus(MII_INT_PIN))
+  {
+    ethernetif_set_link(&gnetif);
+  }
+  BSP_IO_ITClear();
+}
+
+/**
+  * @brief  System Clock Configuration
+  *         The system Clock is configured as follow : 
+  *            System Clock source            = PLL (HSE)
+  *            SYSCLK(Hz)                     = 180000000
+  *            HCLK(Hz)                       = 180000000
+  *            AHB Prescaler                  = 1
+  *            APB1 Prescaler                 = 4
+  *            APB2 Prescaler                 = 2
+  *            HSE Frequency(Hz)              = 25000000
+  *            PLL_M                          = 25
+  *            PLL_N                          = 360
+  *            PLL_P                          = 2
+  *            PLL_Q                          = 7
+  *            VDD(V)                         = 3.3
+  *            Main regulator output voltage  = Scale1 mode
+  *            Flash Latency(WS)              = 5
+  * @param  None
+  * @retval None
+  */
+static void SystemClock_Config(void)
+{
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+
+  /* Enable Power Control clock */
+  __HAL_RCC_PWR_CLK_ENABLE();
+
+  /* The voltage scaling allows optimizing the power consumption when the device is 
+     clocked below the maximum system frequency, to update the voltage scaling value 
+     regarding system frequency refer to product datasheet.  */
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+  /* Enable HSE Oscillator and activate PLL with HSE as source */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+  RCC_OscInitStruct.PLL.PLLM = 25;
+  RCC_OscInitStruct.PLL.PLLN = 360;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+  RCC_OscInitStruct.PLL.PLLQ = 7;
+  HAL_RCC_OscConfig(&RCC_OscInitStruct);
+  
+  /* Activate the Over-Drive mode */
+  HAL_PWREx_EnableOverDrive();
+
+  /* Select PLL as system clock source and configure the HCLK, PCLK1 and PCLK2 
+     clocks dividers */
+  RCC_ClkInitStruct.ClockType = (RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2);
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;  
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;  
+  HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5);
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t* file, uint32_t line)
+{
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+#endif
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,108 @@
+/**
+  ******************************************************************************
+  * @file    LwIP/LwIP_UDP_Rx_Benchmark/Src/udp_rxbench.c
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   UDP receiver counting the datagrams sent by iperf
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "lwip/pbuf.h"
+#include "lwip/udp.h"
+#include "udp_rxbench.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static u32_t RxBytes = 0;
+static u32_t RxDatagrams = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void udp_rxbench_receive_callback(void *arg, struct udp_pcb *upcb, struct pbuf *p, struct ip_addr *addr, u16_t port);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Initialize the receiver: binds a UDP control block to UDP_RXBENCH_PORT.
+  * @param  None
+  * @retval None
+  */
+void udp_rxbench_init(void)
+{
+  struct udp_pcb *upcb;
+  
+  /* Create a new UDP control block  */
+  upcb = udp_new();
+  
+  if (upcb)
+  {
+    /* Using IP_ADDR_ANY allow the upcb to be used by any local interface */
+    if (udp_bind(upcb, IP_ADDR_ANY, UDP_RXBENCH_PORT) == ERR_OK)
+    {
+      /* Set a receive callback for the upcb */
+      udp_recv(upcb, udp_rxbench_receive_callback, NULL);
+    }
+    else
+    {
+      udp_remove(upcb);
+    }
+  }
+}
+
+/**
+  * @brief  Returns the payload bytes and the datagrams received since the
+  *         last call, and clears the counters.
+  * @param  bytes: pointer to the received payload bytes
+  * @param  datagrams: pointer to the received datagrams
+  * @retval None
+  */
+void udp_rxbench_read_counters(u32_t *bytes, u32_t *datagrams)
+{
+  *bytes = RxBytes;
+  *datagrams = RxDatagrams;
+  RxBytes = 0;
+  RxDatagrams = 0;
+}
+
+/**
+  * @brief  This function is called when an UDP datagram has been received on
+  *         UDP_RXBENCH_PORT: the datagram is only counted, then released.
+  * @param  arg user supplied argument (udp_pcb.recv_arg)
+  * @param  upcb the udp_pcb which received data
+  * @param  p the packet buffer that was received
+  * @param  addr the remote IP address from which the packet was received
+  * @param  port the remote port from which the packet was received
+  * @retval None
+  */
+static void udp_rxbench_receive_callback(void *arg, struct udp_pcb *upcb, struct pbuf *p, struct ip_addr *addr, u16_t port)
+{
+  RxBytes += p->tot_len;
+  RxDatagrams++;
+  
+  /* Free the p buffer: in zero-copy mode, this gives the Rx buffers back
+     to the Ethernet driver */
+  pbuf_free(p);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
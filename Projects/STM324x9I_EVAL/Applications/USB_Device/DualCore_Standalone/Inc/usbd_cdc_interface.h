@@ -64,6 +64,12 @@
 #define USARTx_DMA_TX_IRQHandler         DMA2_Stream7_IRQHandler
 #define USARTx_DMA_TX_IRQn               DMA2_Stream7_IRQn
 
+/* Definition for USARTx's DMA: used for receiving data over Rx pin */
+#define USARTx_RX_DMA_CHANNEL            DMA_CHANNEL_4
+#define USARTx_RX_DMA_STREAM             DMA2_Stream2
+#define USARTx_DMA_RX_IRQHandler         DMA2_Stream2_IRQHandler
+#define USARTx_DMA_RX_IRQn               DMA2_Stream2_IRQn
+
 /* Definition for TIMx clock resources */
 #define TIMx                             TIM3
 #define TIMx_CLK_ENABLE                  __HAL_RCC_TIM3_CLK_ENABLE
@@ -82,6 +88,8 @@ extern USBD_CDC_ItfTypeDef  USBD_CDC_fops;
 
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
+void CDC_Itf_DataIn(USBD_HandleTypeDef *pdev, uint8_t epnum);
+
 #endif /* __USBD_CDC_IF_H */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
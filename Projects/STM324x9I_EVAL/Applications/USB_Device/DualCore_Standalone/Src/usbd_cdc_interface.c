@@ -44,11 +44,7 @@ USBD_CDC_LineCodingTypeDef LineCoding = {
 
 uint8_t UserRxBuffer[APP_RX_DATA_SIZE];/* Received Data over USB are stored in this buffer */
 uint8_t UserTxBuffer[APP_TX_DATA_SIZE];/* Received Data over UART (CDC interface) are stored in this buffer */
-
-uint32_t UserTxBufPtrIn = 0;/* Increment this pointer or roll it back to
-                               start address when data are received over USART */
-uint32_t UserTxBufPtrOut = 0; /* Increment this pointer or roll it back to
-                                 start address when data are sent over USB */
+__IO uint32_t UserTxPending = 0;/* Bytes of UserTxBuffer sent in place by the USB IN transfer in progress */
 
 /* UART handler declaration */
 UART_HandleTypeDef UartHandle;
@@ -105,9 +101,9 @@ static int8_t CDC_Itf_Init(void)
     Error_Handler();
   }
   
-  /*##-2- Put UART peripheral in IT reception process ########################*/
-  /* Any data received will be stored in "UserTxBuffer" buffer  */
-  if(HAL_UART_Receive_IT(&UartHandle, (uint8_t *)UserTxBuffer, 1) != HAL_OK)
+  /*##-2- Put UART peripheral in circular DMA reception process ##############*/
+  /* Any data received will be stored in the "UserTxBuffer" ring buffer */
+  if(HAL_UART_ReceiveCircular_DMA(&UartHandle, (uint8_t *)UserTxBuffer, APP_TX_DATA_SIZE) != HAL_OK)
   {
     /* Transfer error in reception process */
     Error_Handler();
@@ -139,6 +135,9 @@ static int8_t CDC_Itf_Init(void)
   */
 static int8_t CDC_Itf_DeInit(void)
 {
+  /* Stop the circular reception and any transmission in progress */
+  HAL_UART_DMAStop(&UartHandle);
+
   /* DeInitialize the UART peripheral */
   if(HAL_UART_DeInit(&UartHandle) != HAL_OK)
   {
@@ -223,53 +222,46 @@ static int8_t CDC_Itf_Control (uint8_t cmd, uint8_t* pbuf, uint16_t length)
   */
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
-  uint32_t buffptr;
+  uint8_t *buffptr;
   uint32_t buffsize;
   
-  if(UserTxBufPtrOut != UserTxBufPtrIn)
+  /* The bytes of the previous USB IN transfer are still in flight */
+  if(UserTxPending != 0)
   {
-    if(UserTxBufPtrOut > UserTxBufPtrIn) /* Rollback */
-    {
-      buffsize = APP_RX_DATA_SIZE - UserTxBufPtrOut;
-    }
-    else 
-    {
-      buffsize = UserTxBufPtrIn - UserTxBufPtrOut;
-    }
-    
-    buffptr = UserTxBufPtrOut;
-    
-    USBD_CDC_SetTxBuffer(&USBD_Device_HS, (uint8_t*)&UserTxBuffer[buffptr], buffsize);
+    return;
+  }
+  
+  /* Data received over UART are sent in place from the ring buffer: they are
+     released by CDC_Itf_DataIn() when the USB IN transfer is completed */
+  buffsize = HAL_UART_RxCircularPeek(&UartHandle, &buffptr);
+  
+  if(buffsize != 0)
+  {
+    USBD_CDC_SetTxBuffer(&USBD_Device_HS, buffptr, buffsize);
     
-    if(USBD_CDC_TransmitPacket(&USBD_Device_HS) == USBD_OK)
+    UserTxPending = buffsize;
+    if(USBD_CDC_TransmitPacket(&USBD_Device_HS) != USBD_OK)
     {
-      UserTxBufPtrOut += buffsize;
-      if (UserTxBufPtrOut == APP_RX_DATA_SIZE)
-      {
-        UserTxBufPtrOut = 0;
-      }
+      UserTxPending = 0;
     }
   }
 }
 
 /**
-  * @brief  Rx Transfer completed callback
-  * @param  huart: UART handle
+  * @brief  CDC_Itf_DataIn
+  *         Called when an IN transfer is completed: the bytes sent in place
+  *         from the ring buffer are given back to the UART reception.
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
   * @retval None
   */
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+void CDC_Itf_DataIn(USBD_HandleTypeDef *pdev, uint8_t epnum)
 {
-  /* Increment Index for buffer writing */
-  UserTxBufPtrIn++;
-  
-  /* To avoid buffer overflow */
-  if(UserTxBufPtrIn == APP_RX_DATA_SIZE)
+  if((pdev == &USBD_Device_HS) && (epnum == (CDC_IN_EP & 0x7F)) && (UserTxPending != 0))
   {
-    UserTxBufPtrIn = 0;
+    HAL_UART_RxCircularRelease(&UartHandle, UserTxPending);
+    UserTxPending = 0;
   }
-  
-  /* Start another reception: provide the buffer pointer with offset and the buffer size */
-  HAL_UART_Receive_IT(huart, (uint8_t *)(UserTxBuffer + UserTxBufPtrIn), 1);
 }
 
 /**
@@ -306,6 +298,9 @@ void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
   */
 static void ComPort_Config(void)
 {
+  /* Stop the circular reception and any transmission in progress */
+  HAL_UART_DMAStop(&UartHandle);
+
   if(HAL_UART_DeInit(&UartHandle) != HAL_OK)
   {
     /* Initialization Error */
@@ -377,8 +372,10 @@ static void ComPort_Config(void)
     Error_Handler();
   }
 
-  /* Start reception: provide the buffer pointer with offset and the buffer size */
-  HAL_UART_Receive_IT(&UartHandle, (uint8_t *)(UserTxBuffer + UserTxBufPtrIn), 1);
+  /* Restart the circular reception from the start of the ring buffer: the
+     bytes of a USB IN transfer in progress are not released in the new ring */
+  UserTxPending = 0;
+  HAL_UART_ReceiveCircular_DMA(&UartHandle, (uint8_t *)UserTxBuffer, APP_TX_DATA_SIZE);
 }
 
 /**
@@ -27,6 +27,7 @@
   
 /* Includes ------------------------------------------------------------------*/
 #include "usbd_app.h"
+#include "sd_diskio_dma.h"
 
 /** @addtogroup USB_DEVICE_MODULE
   * @{
@@ -72,6 +73,10 @@ USBD_ErrorTypdef  USBDSTOR_Start(void)
   */
 USBD_ErrorTypdef  USBDSTOR_Connect(void)
 {
+  /* The storage callbacks access the uSD card from the USB interrupt: stop
+     the FatFs accesses and write their queued sectors first */
+  SD_Suspend();
+  
   /* Start Device Process */
   USBD_Start(&USBD_Device);
   
@@ -96,6 +101,9 @@ USBD_ErrorTypdef  USBDSTOR_Refrech(void)
 USBD_ErrorTypdef  USBDSTOR_Disconnect(void)
 {
   USBD_Stop(&USBD_Device);  
+  
+  /* Give the uSD card back to FatFs */
+  SD_Resume();
   return USBD_ERROR_NONE;
 }
 
@@ -108,6 +116,7 @@ USBD_ErrorTypdef  USBDSTOR_Disconnect(void)
 USBD_ErrorTypdef  USBDSTOR_Stop(void)
 {
   USBD_DeInit(&USBD_Device);  
+  SD_Resume();
   return USBD_ERROR_NONE;
 }
 /**
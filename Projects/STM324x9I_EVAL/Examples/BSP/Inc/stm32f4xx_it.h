@@ -62,6 +62,10 @@ void SysTick_Handler(void);
 void EXTI0_IRQHandler(void);
 void EXTI2_IRQHandler(void);
 void EXTI15_10_IRQHandler(void);
+void EVAL_I2Cx_DMA_TX_IRQHandler(void);
+void EVAL_I2Cx_DMA_RX_IRQHandler(void);
+void EVAL_I2Cx_EV_IRQHandler(void);
+void EVAL_I2Cx_ER_IRQHandler(void);
 
 #ifdef __cplusplus
 }
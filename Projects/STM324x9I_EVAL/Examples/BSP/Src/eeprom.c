@@ -157,6 +157,9 @@ static void EEPROM_Show_Feature(uint8_t Feature)
   BSP_LCD_FillRect(12, 92, BSP_LCD_GetXSize() - 24, BSP_LCD_GetYSize()- 104);
   BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
   
+  /* Transfer the EEPROM data by DMA through the I2C transaction queue */
+  BSP_I2C_EnableQueue();
+  
   /* Initialize the I2C EEPROM driver ----------------------------------------*/
   if(BSP_EEPROM_Init() != EEPROM_OK)
   {
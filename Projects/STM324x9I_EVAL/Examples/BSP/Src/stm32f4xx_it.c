@@ -197,6 +197,45 @@ void EXTI15_10_IRQHandler(void)
   HAL_GPIO_EXTI_IRQHandler(TAMPER_BUTTON_PIN | KEY_BUTTON_PIN);
 }
 
+/**
+  * @brief  This function handles I2C DMA TX interrupt request.
+  * @param  None
+  * @retval None
+  */
+void EVAL_I2Cx_DMA_TX_IRQHandler(void)
+{
+  BSP_I2C_DMA_Tx_IRQHandler();
+}
+
+/**
+  * @brief  This function handles I2C DMA RX interrupt request.
+  * @param  None
+  * @retval None
+  */
+void EVAL_I2Cx_DMA_RX_IRQHandler(void)
+{
+  BSP_I2C_DMA_Rx_IRQHandler();
+}
+
+/**
+  * @brief  This function handles I2C event interrupt request.
+  * @param  None
+  * @retval None
+  */
+void EVAL_I2Cx_EV_IRQHandler(void)
+{
+  BSP_I2C_EV_IRQHandler();
+}
+
+/**
+  * @brief  This function handles I2C error interrupt request.
+  * @param  None
+  * @retval None
+  */
+void EVAL_I2Cx_ER_IRQHandler(void)
+{
+  BSP_I2C_ER_IRQHandler();
+}
 
 
 /**
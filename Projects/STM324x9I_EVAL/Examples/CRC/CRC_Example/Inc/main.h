@@ -44,7 +44,37 @@
 #include "stm324x9i_eval.h"
  
 /* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Size;              /* Number of bytes                                  */
+  uint32_t AccumulateCycles;  /* HAL_CRC_Calculate() over words                   */
+  uint32_t HwStm32Cycles;     /* CRC_ALGO_CRC32_STM32 with the CRC unit           */
+  uint32_t HwMpeg2Cycles;     /* CRC_ALGO_CRC32_MPEG2 with the CRC unit           */
+  uint32_t HwCrc32Cycles;     /* CRC_ALGO_CRC32 with the CRC unit                 */
+  uint32_t SwStm32Cycles;     /* CRC_ALGO_CRC32_STM32 by software                 */
+  uint32_t SwCrc32Cycles;     /* CRC_ALGO_CRC32 by software (slicing by 8)        */
+  uint32_t SwCrc16Cycles;     /* CRC_ALGO_CRC16_CCITT by software (slicing by 8)  */
+  uint32_t DmaCycles;         /* CRC_ALGO_CRC32_STM32 with the CRC unit fed by DMA,
+                                 from the request to the completion callback      */
+}BenchResultTypeDef;
+
 /* Exported constants --------------------------------------------------------*/
+/* DMA Stream parameters definitions. The CRC unit has no DMA request: it is fed
+   by a memory to memory transfer, only possible with the DMA2 Streams. */
+#define DMA_STREAM               DMA2_Stream0
+#define DMA_CHANNEL              DMA_CHANNEL_0
+#define DMA_STREAM_IRQ           DMA2_Stream0_IRQn
+#define DMA_STREAM_IRQHANDLER    DMA2_Stream0_IRQHandler
+#define DMA_STREAM_CLK_ENABLE()  __HAL_RCC_DMA2_CLK_ENABLE()
+
+/* Buffer sizes from BENCH_MIN_SIZE to BENCH_BUFFER_SIZE bytes, doubled at each step */
+#define BENCH_MIN_SIZE           16
+#define BENCH_NB_SIZES           10
+#define BENCH_BUFFER_SIZE        (BENCH_MIN_SIZE << (BENCH_NB_SIZES - 1))
+
+/* Number of computations averaged for each size */
+#define BENCH_NB_RUNS            8
+
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
 
@@ -59,6 +59,7 @@ void SVC_Handler(void);
 void DebugMon_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
+void DMA_STREAM_IRQHANDLER(void);
 
 #ifdef __cplusplus
 }
@@ -6,7 +6,8 @@
   * @date    13-March-2015
   * @brief   This sample code shows how to use the STM32F4xx CRC HAL API 
   *          to get a CRC code of a given buffer of data word(32-bit), 
-  *          based on a fixed generator polynomial(0x4C11DB7).
+  *          based on a fixed generator polynomial(0x4C11DB7), and how to
+  *          compute CRCs of byte buffers with the CRC context API.
   ******************************************************************************
   * @attention
   *
@@ -86,9 +87,27 @@ static const uint32_t aDataBuffer[BUFFER_SIZE] =
 /* Expected CRC Value */
 uint32_t uwExpectedCRCValue = 0x379E9F06;
 
+/* CRC of "123456789" for each algorithm of the context API */
+static const uint8_t aCheckData[] = "123456789";
+static const uint32_t aCheckValues[4] = {0xBF99399C, 0x0376E6E7, 0xCBF43926, 0x000029B1};
+
+/* Contexts of the interleaved computations */
+CRC_ContextTypeDef aContexts[4];
+
+/* Set by the DMA context update callbacks */
+__IO uint32_t uwDmaDone = 0;
+
+/* Benchmark buffer and results, to be displayed on the debugger */
+static uint32_t aBenchBuffer[BENCH_BUFFER_SIZE / 4];
+BenchResultTypeDef aBenchResults[BENCH_NB_SIZES];
+
 /* Private function prototypes -----------------------------------------------*/
 static void SystemClock_Config(void);
 static void Error_Handler(void);
+static void Context_Check(void);
+static void Bench_Run(void);
+static uint32_t Bench_Update(CRC_HandleTypeDef *hcrc, uint32_t Algorithm, uint32_t Size);
+static uint32_t Bench_UpdateDMA(uint32_t Size);
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -137,6 +156,12 @@ int main(void)
     /* Right CRC value: Turn LED1 on */
     BSP_LED_On(LED1);
   }  
+
+  /*##-4- Compute CRCs of byte buffers with the context API ##################*/
+  Context_Check();
+
+  /*##-5- Measure the duration of each computation path ######################*/
+  Bench_Run();
   
   /* Infinite loop */
   while (1)
@@ -144,6 +169,199 @@ int main(void)
   }
 }
 
+/**
+  * @brief  Check the CRC context API against known CRC values
+  * @param  None
+  * @retval None
+  */
+static void Context_Check(void)
+{
+  uint32_t algo = 0, index = 0;
+
+  /* Software computation of the check values */
+  for(algo = CRC_ALGO_CRC32_STM32; algo <= CRC_ALGO_CRC16_CCITT; algo++)
+  {
+    HAL_CRC_ContextInit(&aContexts[algo], algo);
+    HAL_CRC_ContextUpdate(NULL, &aContexts[algo], aCheckData, 9);
+    if(HAL_CRC_ContextFinal(&aContexts[algo]) != aCheckValues[algo])
+    {
+      Error_Handler();
+    }
+  }
+
+  /* The CRC unit gives the same value as HAL_CRC_Accumulate() for the bytes of
+     "aDataBuffer", even when the buffer is given in pieces not multiple of a
+     word and when the CRC unit is also used by other contexts */
+  for(algo = CRC_ALGO_CRC32_STM32; algo <= CRC_ALGO_CRC16_CCITT; algo++)
+  {
+    HAL_CRC_ContextInit(&aContexts[algo], algo);
+  }
+  for(index = 0; index < (BUFFER_SIZE * 4); index += 75)
+  {
+    for(algo = CRC_ALGO_CRC32_STM32; algo <= CRC_ALGO_CRC16_CCITT; algo++)
+    {
+      if(HAL_CRC_ContextUpdate(&CrcHandle, &aContexts[algo], (uint8_t *)aDataBuffer + index,
+                               ((BUFFER_SIZE * 4) - index < 75) ? (BUFFER_SIZE * 4) - index : 75) != HAL_OK)
+      {
+        Error_Handler();
+      }
+    }
+  }
+  if(HAL_CRC_ContextFinal(&aContexts[CRC_ALGO_CRC32_STM32]) != uwExpectedCRCValue)
+  {
+    Error_Handler();
+  }
+
+  /* The other algorithms give the same value as the software computation */
+  for(algo = CRC_ALGO_CRC32_MPEG2; algo <= CRC_ALGO_CRC32; algo++)
+  {
+    uwCRCValue = HAL_CRC_ContextFinal(&aContexts[algo]);
+    HAL_CRC_ContextInit(&aContexts[algo], algo);
+    HAL_CRC_ContextUpdate(NULL, &aContexts[algo], (uint8_t *)aDataBuffer, BUFFER_SIZE * 4);
+    if(HAL_CRC_ContextFinal(&aContexts[algo]) != uwCRCValue)
+    {
+      Error_Handler();
+    }
+  }
+
+  /* Same value with the CRC unit fed by DMA, the first 3 bytes being given
+     apart so that the remaining words are word aligned */
+  HAL_CRC_ContextInit(&aContexts[0], CRC_ALGO_CRC32_STM32);
+  HAL_CRC_ContextUpdate(&CrcHandle, &aContexts[0], (uint8_t *)aDataBuffer, 3);
+  uwDmaDone = 0;
+  if(HAL_CRC_ContextUpdate_DMA(&CrcHandle, &aContexts[0], (uint8_t *)aDataBuffer + 3, (BUFFER_SIZE * 4) - 3) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  while(uwDmaDone == 0)
+  {
+  }
+  if((uwDmaDone != 1) || (HAL_CRC_ContextFinal(&aContexts[0]) != uwExpectedCRCValue))
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Measure each computation path for increasing sizes
+  * @param  None
+  * @retval None
+  */
+static void Bench_Run(void)
+{
+  uint32_t index = 0, size = BENCH_MIN_SIZE, start = 0, run = 0;
+
+  /* Enable the cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for(index = 0; index < (BENCH_BUFFER_SIZE / 4); index++)
+  {
+    aBenchBuffer[index] = 0x01020304 * (index + 1);
+  }
+
+  for(index = 0; index < BENCH_NB_SIZES; index++, size <<= 1)
+  {
+    aBenchResults[index].Size = size;
+
+    aBenchResults[index].AccumulateCycles = 0;
+    for(run = 0; run < BENCH_NB_RUNS; run++)
+    {
+      start = DWT->CYCCNT;
+      HAL_CRC_Calculate(&CrcHandle, aBenchBuffer, size / 4);
+      aBenchResults[index].AccumulateCycles += DWT->CYCCNT - start;
+    }
+    aBenchResults[index].AccumulateCycles /= BENCH_NB_RUNS;
+
+    aBenchResults[index].HwStm32Cycles = Bench_Update(&CrcHandle, CRC_ALGO_CRC32_STM32, size);
+    aBenchResults[index].HwMpeg2Cycles = Bench_Update(&CrcHandle, CRC_ALGO_CRC32_MPEG2, size);
+    aBenchResults[index].HwCrc32Cycles = Bench_Update(&CrcHandle, CRC_ALGO_CRC32, size);
+    aBenchResults[index].SwStm32Cycles = Bench_Update(NULL, CRC_ALGO_CRC32_STM32, size);
+    aBenchResults[index].SwCrc32Cycles = Bench_Update(NULL, CRC_ALGO_CRC32, size);
+    aBenchResults[index].SwCrc16Cycles = Bench_Update(NULL, CRC_ALGO_CRC16_CCITT, size);
+    aBenchResults[index].DmaCycles = Bench_UpdateDMA(size);
+  }
+}
+
+/**
+  * @brief  Measure a CRC computation by the CPU
+  * @param  hcrc: CRC handle, NULL for a software computation
+  * @param  Algorithm: CRC algorithm
+  * @param  Size: number of bytes
+  * @retval Average number of core clock cycles
+  */
+static uint32_t Bench_Update(CRC_HandleTypeDef *hcrc, uint32_t Algorithm, uint32_t Size)
+{
+  uint32_t run = 0, start = 0, cycles = 0;
+
+  for(run = 0; run < BENCH_NB_RUNS; run++)
+  {
+    start = DWT->CYCCNT;
+    HAL_CRC_ContextInit(&aContexts[0], Algorithm);
+    HAL_CRC_ContextUpdate(hcrc, &aContexts[0], (uint8_t *)aBenchBuffer, Size);
+    uwCRCValue = HAL_CRC_ContextFinal(&aContexts[0]);
+    cycles += DWT->CYCCNT - start;
+  }
+
+  return cycles / BENCH_NB_RUNS;
+}
+
+/**
+  * @brief  Measure a CRC computation with the CRC unit fed by DMA, from the
+  *         request to the completion callback
+  * @param  Size: number of bytes
+  * @retval Average number of core clock cycles
+  */
+static uint32_t Bench_UpdateDMA(uint32_t Size)
+{
+  uint32_t run = 0, start = 0, cycles = 0;
+
+  for(run = 0; run < BENCH_NB_RUNS; run++)
+  {
+    uwDmaDone = 0;
+
+    start = DWT->CYCCNT;
+    HAL_CRC_ContextInit(&aContexts[0], CRC_ALGO_CRC32_STM32);
+    if(HAL_CRC_ContextUpdate_DMA(&CrcHandle, &aContexts[0], (uint8_t *)aBenchBuffer, Size) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    while(uwDmaDone == 0)
+    {
+    }
+    cycles += DWT->CYCCNT - start;
+
+    /* Same value as the CPU computation with the CRC unit */
+    if((uwDmaDone != 1) || (HAL_CRC_ContextFinal(&aContexts[0]) != HAL_CRC_Calculate(&CrcHandle, aBenchBuffer, Size / 4)))
+    {
+      Error_Handler();
+    }
+  }
+
+  return cycles / BENCH_NB_RUNS;
+}
+
+/**
+  * @brief  CRC context update by DMA complete callback
+  * @param  hcrc: CRC handle
+  * @retval None
+  */
+void HAL_CRC_CpltCallback(CRC_HandleTypeDef *hcrc)
+{
+  uwDmaDone = 1;
+}
+
+/**
+  * @brief  CRC context update by DMA error callback
+  * @param  hcrc: CRC handle
+  * @retval None
+  */
+void HAL_CRC_ErrorCallback(CRC_HandleTypeDef *hcrc)
+{
+  uwDmaDone = 2;
+}
+
 /**
   * @brief  System Clock Configuration
   *         The system Clock is configured as follow : 
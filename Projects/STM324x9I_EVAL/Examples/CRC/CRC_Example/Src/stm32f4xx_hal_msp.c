@@ -51,6 +51,8 @@
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+static DMA_HandleTypeDef DmaHandle;
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -62,6 +64,8 @@
   * @brief CRC MSP Initialization 
   *        This function configures the hardware resources used in this example: 
   *           - Peripheral's clock enable 
+  *           - DMA configuration for the context updates by DMA
+  *           - NVIC configuration for DMA interrupt request enable
   * @param hcrc: CRC handle pointer
   * @retval None
   */
@@ -69,12 +73,43 @@ void HAL_CRC_MspInit(CRC_HandleTypeDef *hcrc)
 {
    /* CRC Peripheral clock enable */
   __HAL_RCC_CRC_CLK_ENABLE();
+
+  /* DMA controller clock enable */
+  DMA_STREAM_CLK_ENABLE();
+
+  /* Memory to memory transfer from the data buffer (peripheral port, incremented)
+     to the CRC data register (memory port, not incremented). The buffer is read
+     word by word through the FIFO: bursts would need 16-byte aligned sources
+     and lengths. */
+  DmaHandle.Instance                 = DMA_STREAM;
+  DmaHandle.Init.Channel             = DMA_CHANNEL;
+  DmaHandle.Init.Direction           = DMA_MEMORY_TO_MEMORY;
+  DmaHandle.Init.PeriphInc           = DMA_PINC_ENABLE;
+  DmaHandle.Init.MemInc              = DMA_MINC_DISABLE;
+  DmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  DmaHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
+  DmaHandle.Init.Mode                = DMA_NORMAL;
+  DmaHandle.Init.Priority            = DMA_PRIORITY_HIGH;
+  DmaHandle.Init.FIFOMode            = DMA_FIFOMODE_ENABLE;
+  DmaHandle.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+  DmaHandle.Init.MemBurst            = DMA_MBURST_SINGLE;
+  DmaHandle.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+
+  HAL_DMA_Init(&DmaHandle);
+
+  /* Associate the initialized DMA handle to the CRC handle */
+  __HAL_LINKDMA(hcrc, hdma, DmaHandle);
+
+  /* NVIC configuration for DMA transfer complete interrupt */
+  HAL_NVIC_SetPriority(DMA_STREAM_IRQ, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA_STREAM_IRQ);
 }
 
 /**
   * @brief CRC MSP De-Initialization 
   *        This function freeze the hardware resources used in this example:
   *          - Disable the Peripheral's clock
+  *          - Revert DMA and NVIC configuration to their default state
   * @param hcrc: CRC handle pointer
   * @retval None
   */
@@ -85,6 +120,12 @@ void HAL_CRC_MspDeInit(CRC_HandleTypeDef *hcrc)
   
   /* Release CRC from reset state */
   __HAL_RCC_CRC_RELEASE_RESET();
+
+  /* De-Initialize the DMA Stream */
+  HAL_DMA_DeInit(hcrc->hdma);
+
+  /* Disable the NVIC for DMA */
+  HAL_NVIC_DisableIRQ(DMA_STREAM_IRQ);
 }
 
 /**
@@ -53,6 +53,8 @@
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+extern CRC_HandleTypeDef CrcHandle;
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -165,13 +167,14 @@ void SysTick_Handler(void)
 /******************************************************************************/
 
 /**
-  * @brief  This function handles PPP interrupt request.
+  * @brief  This function handles DMA Stream interrupt request.
   * @param  None
   * @retval None
   */
-/*void PPP_IRQHandler(void)
+void DMA_STREAM_IRQHANDLER(void)
 {
-}*/
+  HAL_DMA_IRQHandler(CrcHandle.hdma);
+}
      
 /**
   * @}
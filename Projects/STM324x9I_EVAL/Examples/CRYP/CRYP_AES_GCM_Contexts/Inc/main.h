@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file    CRYP/CRYP_AES_GCM_Contexts/Inc/main.h 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Header for main.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+  
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MAIN_H
+#define __MAIN_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+#include "stm324x9i_eval.h"
+#include "stdio.h"
+#include "string.h"
+
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Size;          /* Message size in bytes                                 */
+  uint32_t LegacyCycles;  /* HAL_CRYPEx_AESGCM_Encrypt() duration in core cycles    */
+  uint32_t PolledCycles;  /* Context encryption, CPU fed, duration in core cycles   */
+  uint32_t DmaCycles;     /* Context encryption, DMA fed, duration in core cycles   */
+  uint32_t SwCycles;      /* Context encryption by software, duration in core cycles */
+  uint32_t LegacyMBps;    /* HAL_CRYPEx_AESGCM_Encrypt() throughput in hundredths of MB/s */
+  uint32_t PolledMBps;    /* CPU fed throughput in hundredths of MB/s               */
+  uint32_t DmaMBps;       /* DMA fed throughput in hundredths of MB/s               */
+  uint32_t SwMBps;        /* Software throughput in hundredths of MB/s              */
+}BenchResultTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Bulk stream encrypted by DMA, in chunks of two segments, interleaved with
+   records encrypted by the CPU */
+#define STREAM_NB_CHUNKS                4
+#define STREAM_SEGMENT_SIZE             ((uint32_t)1024)
+#define STREAM_LAST_SEGMENT_SIZE        ((uint32_t)1001)
+#define STREAM_SIZE                     (((2 * STREAM_NB_CHUNKS) - 1) * STREAM_SEGMENT_SIZE + STREAM_LAST_SEGMENT_SIZE)
+#define STREAM_HEADER_SIZE              ((uint32_t)20)
+#define RECORD_SIZE                     ((uint32_t)301)
+#define DECRYPT_UPDATE_SIZE             ((uint32_t)333)
+
+/* Message sizes from BENCH_MIN_SIZE to BENCH_MAX_SIZE bytes, doubled at each step */
+#define BENCH_MIN_SIZE                  64
+#define BENCH_NB_SIZES                  9
+#define BENCH_MAX_SIZE                  (BENCH_MIN_SIZE << (BENCH_NB_SIZES - 1))
+#define BENCH_HEADER_SIZE               16
+
+/* Number of messages averaged for each size, and of updates for the context switch */
+#define BENCH_NB_RUNS                   4
+#define BENCH_NB_SWITCHES               64
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+
+#endif /* __MAIN_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,579 @@
+/**
+  ******************************************************************************
+  * @file    CRYP/CRYP_AES_GCM_Contexts/Src/main.c 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   This example shows how to interleave AES-GCM and AES-CTR messages
+  *          on the CRYPTO peripheral with the context functions, and measures
+  *          their throughput.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/** @addtogroup STM32F4xx_HAL_Examples
+  * @{
+  */
+
+/** @addtogroup CRYP_AES_GCM_Contexts
+  * @{
+  */ 
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Throughput in hundredths of MB/s of Size bytes processed in Cycles core cycles */
+#define BENCH_MBPS(Size, Cycles)  (((Size) * 100 * (SystemCoreClock / 1000000)) / (Cycles))
+
+/* Private variables ---------------------------------------------------------*/
+/* CRYP handler declaration */
+CRYP_HandleTypeDef     CrypHandle;
+
+/* Key size 128 bits */
+uint8_t aAES128Key[16] = {0xc9,0x39,0xcc,0x13,0x39,0x7c,0x1d,0x37,
+                          0xde,0x6a,0xe0,0xe1,0xcb,0x7c,0x42,0x3c};
+
+/* GCM initialization vector: 12 bytes, followed by the counter of the first
+   payload block for HAL_CRYPEx_AESGCM_Encrypt() */
+uint8_t aInitVector[16] = {0xb3,0xd8,0xcc,0x01,0x7c,0xbb,0x89,0xb3,
+                           0x9e,0x0f,0x67,0xe2,0x00,0x00,0x00,0x02};
+
+/* CTR initial counter block of the records */
+uint8_t aCounterBlock[16] = {0xf0,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,
+                             0xf8,0xf9,0xfa,0xfb,0x00,0x00,0x00,0x01};
+
+/* Bulk stream, encrypted by DMA, and records, encrypted by the CPU */
+static CRYP_ContextTypeDef StreamContext;
+static CRYP_ContextTypeDef RecordContext;
+
+/* Same messages processed by software, used as reference */
+static CRYP_ContextTypeDef StreamSwContext;
+static CRYP_ContextTypeDef RecordSwContext;
+
+static CRYP_SegmentTypeDef aSegments[2];
+
+static __IO uint32_t OutputDone = 0;
+
+static uint8_t aStreamHeader[STREAM_HEADER_SIZE] = "STM32F439 GCM header";
+
+__ALIGN_BEGIN static uint8_t aStream[STREAM_SIZE] __ALIGN_END;
+__ALIGN_BEGIN static uint8_t aStreamCypher[STREAM_SIZE] __ALIGN_END;
+__ALIGN_BEGIN static uint8_t aStreamSwCypher[STREAM_SIZE] __ALIGN_END;
+__ALIGN_BEGIN static uint8_t aRecord[RECORD_SIZE] __ALIGN_END;
+__ALIGN_BEGIN static uint8_t aRecordCypher[RECORD_SIZE] __ALIGN_END;
+__ALIGN_BEGIN static uint8_t aRecordSwCypher[RECORD_SIZE] __ALIGN_END;
+
+static uint8_t aStreamTag[16];
+static uint8_t aStreamSwTag[16];
+static uint8_t aDecryptTag[16];
+
+__ALIGN_BEGIN static uint8_t aBenchInput[BENCH_MAX_SIZE] __ALIGN_END;
+__ALIGN_BEGIN static uint8_t aBenchOutput[BENCH_MAX_SIZE] __ALIGN_END;
+static uint8_t aBenchTag[16];
+
+/* Results, to be read with the debugger: one entry per message size, with the
+   durations in core clock cycles and the throughputs in hundredths of MB/s */
+BenchResultTypeDef aBenchResults[BENCH_NB_SIZES];
+
+/* Extra core clock cycles taken by a 64 bytes update when the CRYP peripheral
+   holds another context, i.e. the cost of a context save and restore */
+uint32_t uwSwitchCycles = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SystemClock_Config(void);
+static void Error_Handler(void);
+static uint32_t Interleave_Run(void);
+static void Bench_Run(void);
+static uint32_t Bench_Legacy(uint32_t Size);
+static uint32_t Bench_Message(CRYP_HandleTypeDef *hcryp, uint32_t Size, uint32_t UseDMA);
+static uint32_t Bench_Updates(uint32_t NbContexts);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval None
+  */
+int main(void)
+{
+  /* STM32F4xx HAL library initialization:
+       - Configure the Flash prefetch, instruction and Data caches
+       - Configure the Systick to generate an interrupt each 1 msec
+       - Set NVIC Group Priority to 4
+       - Global MSP (MCU Support Package) initialization
+     */
+  HAL_Init();
+  
+  /* Configure the system clock to 180 MHz */
+  SystemClock_Config();
+
+  /* Configure LED1, LED2, LED3 and LED4 */
+  BSP_LED_Init(LED1);
+  BSP_LED_Init(LED2);
+  BSP_LED_Init(LED3);
+  BSP_LED_Init(LED4);
+  
+  /*##-1- Configure the CRYP peripheral ######################################*/
+  /* Set the CRYP parameters, used by HAL_CRYPEx_AESGCM_Encrypt() only: the
+     contexts hold their own key and initialization vector */
+  CrypHandle.Instance = CRYP;
+  
+  CrypHandle.Init.DataType    = CRYP_DATATYPE_8B;
+  CrypHandle.Init.KeySize     = CRYP_KEYSIZE_128B;
+  CrypHandle.Init.pKey        = aAES128Key;
+  CrypHandle.Init.pInitVect   = aInitVector;
+  CrypHandle.Init.Header      = aBenchInput;
+  CrypHandle.Init.HeaderSize  = BENCH_HEADER_SIZE;
+  
+  if(HAL_CRYP_Init(&CrypHandle) != HAL_OK)
+  {
+    /* Initialization Error */
+    Error_Handler(); 
+  }
+  
+  /*##-2- Interleave a GCM stream and CTR records ############################*/
+  if(Interleave_Run() != 0)
+  {
+    /* Wrong encryption or decryption: Turn LED2 on */
+    BSP_LED_On(LED2);
+  }
+  else
+  {
+    /* Right encryption and decryption: Turn LED1 on */
+    BSP_LED_On(LED1);
+  }
+
+  /*##-3- Measure the legacy, CPU fed, DMA fed and software throughputs ######*/
+  Bench_Run();
+
+  /* Turn LED4 on: measurements done */
+  BSP_LED_On(LED4);
+  
+  /* Infinite loop */
+  while(1)
+  {
+  }
+}
+
+/**
+  * @brief  Encrypts a GCM stream by DMA, in chunks of two segments, and CTR
+  *         records by the CPU between the chunks, each record taking the CRYP
+  *         peripheral from the stream context. While the DMA transfers a chunk,
+  *         the CPU computes the same messages by software. The stream is then
+  *         decrypted by the CPU, in updates which are not a multiple of a block.
+  * @param  None
+  * @retval 0 if the results are right, 1 otherwise
+  */
+static uint32_t Interleave_Run(void)
+{
+  uint32_t chunk = 0, offset = 0, size = 0, index = 0, errors = 0;
+
+  for(index = 0; index < STREAM_SIZE; index++)
+  {
+    aStream[index] = (uint8_t)(index * 13);
+  }
+
+  if((HAL_CRYPEx_ContextInit(&StreamContext, CRYP_CR_ALGOMODE_AES_GCM_ENCRYPT, aAES128Key, CRYP_KEYSIZE_128B, aInitVector) != HAL_OK) ||
+     (HAL_CRYPEx_ContextInit(&StreamSwContext, CRYP_CR_ALGOMODE_AES_GCM_ENCRYPT, aAES128Key, CRYP_KEYSIZE_128B, aInitVector) != HAL_OK) ||
+     (HAL_CRYPEx_ContextInit(&RecordContext, CRYP_CR_ALGOMODE_AES_CTR_ENCRYPT, aAES128Key, CRYP_KEYSIZE_128B, aCounterBlock) != HAL_OK) ||
+     (HAL_CRYPEx_ContextInit(&RecordSwContext, CRYP_CR_ALGOMODE_AES_CTR_ENCRYPT, aAES128Key, CRYP_KEYSIZE_128B, aCounterBlock) != HAL_OK))
+  {
+    Error_Handler();
+  }
+
+  if((HAL_CRYPEx_ContextHeader(&CrypHandle, &StreamContext, aStreamHeader, STREAM_HEADER_SIZE, 10) != HAL_OK) ||
+     (HAL_CRYPEx_ContextHeader(NULL, &StreamSwContext, aStreamHeader, STREAM_HEADER_SIZE, 0) != HAL_OK))
+  {
+    Error_Handler();
+  }
+
+  for(chunk = 0; chunk < STREAM_NB_CHUNKS; chunk++)
+  {
+    /* Two segments, the last one of the stream not being a multiple of a block */
+    size = (chunk == (STREAM_NB_CHUNKS - 1)) ? STREAM_LAST_SEGMENT_SIZE : STREAM_SEGMENT_SIZE;
+    aSegments[0].pInBuffer  = &aStream[offset];
+    aSegments[0].pOutBuffer = &aStreamCypher[offset];
+    aSegments[0].Size       = STREAM_SEGMENT_SIZE;
+    aSegments[0].pNext      = &aSegments[1];
+    aSegments[1].pInBuffer  = &aStream[offset + STREAM_SEGMENT_SIZE];
+    aSegments[1].pOutBuffer = &aStreamCypher[offset + STREAM_SEGMENT_SIZE];
+    aSegments[1].Size       = size;
+    aSegments[1].pNext      = NULL;
+
+    OutputDone = 0;
+    if(HAL_CRYPEx_ContextUpdate_DMA(&CrypHandle, &StreamContext, aSegments) != HAL_OK)
+    {
+      Error_Handler();
+    }
+
+    /* Meanwhile, compute the chunk by software and build the next record */
+    if(HAL_CRYPEx_ContextUpdate(NULL, &StreamSwContext, &aStream[offset], STREAM_SEGMENT_SIZE + size, &aStreamSwCypher[offset], 0) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    for(index = 0; index < RECORD_SIZE; index++)
+    {
+      aRecord[index] = (uint8_t)(chunk + index);
+    }
+
+    while(OutputDone == 0)
+    {
+    }
+    offset += STREAM_SEGMENT_SIZE + size;
+
+    /* The record takes the CRYP peripheral: the stream context is saved */
+    if((HAL_CRYPEx_ContextUpdate(&CrypHandle, &RecordContext, aRecord, RECORD_SIZE, aRecordCypher, 10) != HAL_OK) ||
+       (HAL_CRYPEx_ContextUpdate(NULL, &RecordSwContext, aRecord, RECORD_SIZE, aRecordSwCypher, 0) != HAL_OK))
+    {
+      Error_Handler();
+    }
+    if(memcmp(aRecordCypher, aRecordSwCypher, RECORD_SIZE) != 0)
+    {
+      errors = 1;
+    }
+  }
+
+  if((HAL_CRYPEx_ContextFinish(&CrypHandle, &StreamContext, aStreamTag, 10) != HAL_OK) ||
+     (HAL_CRYPEx_ContextFinish(NULL, &StreamSwContext, aStreamSwTag, 0) != HAL_OK) ||
+     (HAL_CRYPEx_ContextFinish(&CrypHandle, &RecordContext, NULL, 10) != HAL_OK) ||
+     (HAL_CRYPEx_ContextFinish(NULL, &RecordSwContext, NULL, 0) != HAL_OK))
+  {
+    Error_Handler();
+  }
+
+  if((memcmp(aStreamCypher, aStreamSwCypher, STREAM_SIZE) != 0) || (memcmp(aStreamTag, aStreamSwTag, 16) != 0))
+  {
+    errors = 1;
+  }
+
+  /* Decrypt the stream in place, the tag of the cyphertext being the same */
+  if((HAL_CRYPEx_ContextInit(&StreamContext, CRYP_CR_ALGOMODE_AES_GCM_DECRYPT, aAES128Key, CRYP_KEYSIZE_128B, aInitVector) != HAL_OK) ||
+     (HAL_CRYPEx_ContextHeader(&CrypHandle, &StreamContext, aStreamHeader, STREAM_HEADER_SIZE, 10) != HAL_OK))
+  {
+    Error_Handler();
+  }
+  for(offset = 0; offset < STREAM_SIZE; offset += size)
+  {
+    size = ((STREAM_SIZE - offset) > DECRYPT_UPDATE_SIZE) ? DECRYPT_UPDATE_SIZE : (STREAM_SIZE - offset);
+    if(HAL_CRYPEx_ContextUpdate(&CrypHandle, &StreamContext, &aStreamCypher[offset], size, &aStreamCypher[offset], 10) != HAL_OK)
+    {
+      Error_Handler();
+    }
+  }
+  if(HAL_CRYPEx_ContextFinish(&CrypHandle, &StreamContext, aDecryptTag, 10) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if((memcmp(aStreamCypher, aStream, STREAM_SIZE) != 0) || (memcmp(aDecryptTag, aStreamTag, 16) != 0))
+  {
+    errors = 1;
+  }
+
+  return errors;
+}
+
+/**
+  * @brief  Measures the GCM encryption of 64 bytes to 16 Kbytes messages with a
+  *         16 bytes header, and the cost of a context switch.
+  * @param  None
+  * @retval None
+  */
+static void Bench_Run(void)
+{
+  uint32_t index = 0, size = 0, single = 0, alternate = 0;
+
+  /* Enable the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for(index = 0; index < BENCH_MAX_SIZE; index++)
+  {
+    aBenchInput[index] = (uint8_t)(index * 7);
+  }
+
+  for(index = 0, size = BENCH_MIN_SIZE; index < BENCH_NB_SIZES; index++, size <<= 1)
+  {
+    aBenchResults[index].Size = size;
+    aBenchResults[index].LegacyCycles = Bench_Legacy(size);
+    aBenchResults[index].PolledCycles = Bench_Message(&CrypHandle, size, 0);
+    aBenchResults[index].DmaCycles = Bench_Message(&CrypHandle, size, 1);
+    aBenchResults[index].SwCycles = Bench_Message(NULL, size, 0);
+    aBenchResults[index].LegacyMBps = BENCH_MBPS(size, aBenchResults[index].LegacyCycles);
+    aBenchResults[index].PolledMBps = BENCH_MBPS(size, aBenchResults[index].PolledCycles);
+    aBenchResults[index].DmaMBps = BENCH_MBPS(size, aBenchResults[index].DmaCycles);
+    aBenchResults[index].SwMBps = BENCH_MBPS(size, aBenchResults[index].SwCycles);
+  }
+
+  single = Bench_Updates(1);
+  alternate = Bench_Updates(2);
+  uwSwitchCycles = (alternate > single) ? (alternate - single) : 0;
+}
+
+/**
+  * @brief  Measures the encryption of a message by HAL_CRYPEx_AESGCM_Encrypt(),
+  *         which loads the key and runs the GCM init phase for each message.
+  * @param  Size: Message size in bytes
+  * @retval Average duration in core clock cycles
+  */
+static uint32_t Bench_Legacy(uint32_t Size)
+{
+  uint32_t run = 0, start = 0, cycles = 0;
+
+  /* Free the CRYP peripheral from the contexts */
+  if(HAL_CRYPEx_ContextRelease(&CrypHandle, 10) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  for(run = 0; run < BENCH_NB_RUNS; run++)
+  {
+    start = DWT->CYCCNT;
+    if((HAL_CRYP_Init(&CrypHandle) != HAL_OK) ||
+       (HAL_CRYPEx_AESGCM_Encrypt(&CrypHandle, aBenchInput, Size, aBenchOutput, 100) != HAL_OK) ||
+       (HAL_CRYPEx_AESGCM_Finish(&CrypHandle, Size, aBenchTag, 100) != HAL_OK))
+    {
+      Error_Handler();
+    }
+    cycles += DWT->CYCCNT - start;
+  }
+
+  return cycles / BENCH_NB_RUNS;
+}
+
+/**
+  * @brief  Measures the encryption of a message through a context.
+  * @param  hcryp: CRYP handle, NULL for the software computation
+  * @param  Size: Message size in bytes
+  * @param  UseDMA: 1 to transfer the message by DMA, 0 to write it by the CPU
+  * @retval Average duration in core clock cycles
+  */
+static uint32_t Bench_Message(CRYP_HandleTypeDef *hcryp, uint32_t Size, uint32_t UseDMA)
+{
+  uint32_t run = 0, start = 0, cycles = 0;
+
+  for(run = 0; run < BENCH_NB_RUNS; run++)
+  {
+    start = DWT->CYCCNT;
+    if((HAL_CRYPEx_ContextInit(&StreamContext, CRYP_CR_ALGOMODE_AES_GCM_ENCRYPT, aAES128Key, CRYP_KEYSIZE_128B, aInitVector) != HAL_OK) ||
+       (HAL_CRYPEx_ContextHeader(hcryp, &StreamContext, aBenchInput, BENCH_HEADER_SIZE, 10) != HAL_OK))
+    {
+      Error_Handler();
+    }
+    if(UseDMA != 0)
+    {
+      aSegments[0].pInBuffer  = aBenchInput;
+      aSegments[0].pOutBuffer = aBenchOutput;
+      aSegments[0].Size       = Size;
+      aSegments[0].pNext      = NULL;
+      OutputDone = 0;
+      if(HAL_CRYPEx_ContextUpdate_DMA(hcryp, &StreamContext, aSegments) != HAL_OK)
+      {
+        Error_Handler();
+      }
+      while(OutputDone == 0)
+      {
+      }
+    }
+    else if(HAL_CRYPEx_ContextUpdate(hcryp, &StreamContext, aBenchInput, Size, aBenchOutput, 100) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    if(HAL_CRYPEx_ContextFinish(hcryp, &StreamContext, aBenchTag, 100) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    cycles += DWT->CYCCNT - start;
+  }
+
+  return cycles / BENCH_NB_RUNS;
+}
+
+/**
+  * @brief  Measures 64 bytes GCM updates, on one context or alternately on two
+  *         contexts, which saves and restores a context at each update.
+  * @param  NbContexts: 1 or 2
+  * @retval Average duration of an update in core clock cycles
+  */
+static uint32_t Bench_Updates(uint32_t NbContexts)
+{
+  uint32_t update = 0, start = 0, cycles = 0;
+  CRYP_ContextTypeDef *pcontext = NULL;
+
+  if((HAL_CRYPEx_ContextInit(&StreamContext, CRYP_CR_ALGOMODE_AES_GCM_ENCRYPT, aAES128Key, CRYP_KEYSIZE_128B, aInitVector) != HAL_OK) ||
+     (HAL_CRYPEx_ContextInit(&RecordContext, CRYP_CR_ALGOMODE_AES_GCM_ENCRYPT, aAES128Key, CRYP_KEYSIZE_128B, aInitVector) != HAL_OK))
+  {
+    Error_Handler();
+  }
+
+  for(update = 0; update < BENCH_NB_SWITCHES; update++)
+  {
+    pcontext = ((NbContexts == 2) && ((update & 1) != 0)) ? &RecordContext : &StreamContext;
+    start = DWT->CYCCNT;
+    if(HAL_CRYPEx_ContextUpdate(&CrypHandle, pcontext, aBenchInput, 64, aBenchOutput, 10) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    cycles += DWT->CYCCNT - start;
+  }
+
+  if((HAL_CRYPEx_ContextFinish(&CrypHandle, &StreamContext, aBenchTag, 10) != HAL_OK) ||
+     (HAL_CRYPEx_ContextFinish(&CrypHandle, &RecordContext, aBenchTag, 10) != HAL_OK))
+  {
+    Error_Handler();
+  }
+
+  return cycles / BENCH_NB_SWITCHES;
+}
+
+/**
+  * @brief  Output transfer complete callback: end of a DMA context update.
+  * @param  hcryp: CRYP handle
+  * @retval None
+  */
+void HAL_CRYP_OutCpltCallback(CRYP_HandleTypeDef *hcryp)
+{
+  OutputDone = 1;
+}
+
+/**
+  * @brief  CRYP error callback.
+  * @param  hcryp: CRYP handle
+  * @retval None
+  */
+void HAL_CRYP_ErrorCallback(CRYP_HandleTypeDef *hcryp)
+{
+  Error_Handler();
+}
+
+/**
+  * @brief  System Clock Configuration
+  *         The system Clock is configured as follow : 
+  *            System Clock source            = PLL (HSE)
+  *            SYSCLK(Hz)                     = 180000000
+  *            HCLK(Hz)                       = 180000000
+  *            AHB Prescaler                  = 1
+  *            APB1 Prescaler                 = 4
+  *            APB2 Prescaler                 = 2
+  *            HSE Frequency(Hz)              = 25000000
+  *            PLL_M                          = 25
+  *            PLL_N                          = 360
+  *            PLL_P                          = 2
+  *            PLL_Q                          = 7
+  *            VDD(V)                         = 3.3
+  *            Main regulator output voltage  = Scale1 mode
+  *            Flash Latency(WS)              = 5
+  * @param  None
+  * @retval None
+  */
+static void SystemClock_Config(void)
+{
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+
+  /* Enable Power Control clock */
+  __HAL_RCC_PWR_CLK_ENABLE();
+
+  /* The voltage scaling allows optimizing the power consumption when the device is 
+     clocked below the maximum system frequency, to update the voltage scaling value 
+     regarding system frequency refer to product datasheet.  */
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+  /* Enable HSE Oscillator and activate PLL with HSE as source */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+  RCC_OscInitStruct.PLL.PLLM = 25;
+  RCC_OscInitStruct.PLL.PLLN = 360;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+  RCC_OscInitStruct.PLL.PLLQ = 7;
+  HAL_RCC_OscConfig(&RCC_OscInitStruct);
+
+  /* Activate the Over-Drive mode */
+  HAL_PWREx_EnableOverDrive();
+    
+  /* Select PLL as system clock source and configure the HCLK, PCLK1 and PCLK2 
+     clocks dividers */
+  RCC_ClkInitStruct.ClockType = (RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2);
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;  
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;  
+  HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5);
+}
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @param  None
+  * @retval None
+  */
+static void Error_Handler(void)
+{
+  /* Turn LED3 on */
+  BSP_LED_On(LED3);
+  while(1)
+  {
+  }
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t* file, uint32_t line)
+{ 
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+#endif
+
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
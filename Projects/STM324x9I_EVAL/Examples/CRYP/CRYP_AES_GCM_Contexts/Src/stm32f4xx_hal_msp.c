@@ -0,0 +1,147 @@
+/**
+  ******************************************************************************
+  * @file    CRYP/CRYP_AES_GCM_Contexts/Src/stm32f4xx_hal_msp.c
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   HAL MSP module.    
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************  
+  */ 
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/** @addtogroup STM32F4xx_HAL_Examples
+  * @{
+  */
+
+/** @defgroup HAL_MSP
+  * @brief HAL MSP module.
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup HAL_MSP_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief CRYP MSP Initialization 
+  *        This function configures the hardware resources used in this example: 
+  *           - DMA configuration for transmission request by peripheral 
+  *           - NVIC configuration for DMA interrupt request enable
+  * @param hcryp: CRYP handle pointer
+  * @retval None
+  */
+
+void HAL_CRYP_MspInit(CRYP_HandleTypeDef *hcryp)
+{
+  static DMA_HandleTypeDef   hdmaIn;
+  static DMA_HandleTypeDef   hdmaOut;
+  
+  /*##-1- Enable peripherals Clock ###########################################*/
+  /* Enable CRYP clock */
+  __HAL_RCC_CRYP_CLK_ENABLE();  
+  /* Enable DMA2 clock */
+  __HAL_RCC_DMA2_CLK_ENABLE();
+  
+  /*##-2- Configure the DMA streams ##########################################*/
+  
+  /***************** Configure common DMA In parameters ***********************/
+  hdmaIn.Init.Channel             = DMA_CHANNEL_2;
+  hdmaIn.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  hdmaIn.Init.PeriphInc           = DMA_PINC_DISABLE;
+  hdmaIn.Init.MemInc              = DMA_MINC_ENABLE;
+  hdmaIn.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  hdmaIn.Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
+  hdmaIn.Init.Mode                = DMA_NORMAL;
+  hdmaIn.Init.Priority            = DMA_PRIORITY_HIGH;
+  hdmaIn.Init.FIFOMode            = DMA_FIFOMODE_ENABLE;
+  hdmaIn.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_HALFFULL;
+  hdmaIn.Init.MemBurst            = DMA_MBURST_SINGLE;
+  hdmaIn.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+  hdmaIn.Instance = DMA2_Stream6;
+  
+  /* Associate the DMA handle */
+  __HAL_LINKDMA(hcryp, hdmain, hdmaIn);
+
+  /* Configure the DMA Stream */
+  HAL_DMA_Init(hcryp->hdmain);      
+  
+  /* NVIC configuration for DMA Input data interrupt */
+  HAL_NVIC_SetPriority(DMA2_Stream6_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream6_IRQn);
+  
+  /***************** Configure common DMA Out parameters **********************/
+  hdmaOut.Init.Channel             = DMA_CHANNEL_2;
+  hdmaOut.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+  hdmaOut.Init.PeriphInc           = DMA_PINC_DISABLE;
+  hdmaOut.Init.MemInc              = DMA_MINC_ENABLE;
+  hdmaOut.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  hdmaOut.Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
+  hdmaOut.Init.Mode                = DMA_NORMAL;
+  hdmaOut.Init.Priority            = DMA_PRIORITY_VERY_HIGH;
+  hdmaOut.Init.FIFOMode            = DMA_FIFOMODE_ENABLE;
+  hdmaOut.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_HALFFULL;
+  hdmaOut.Init.MemBurst            = DMA_MBURST_SINGLE;
+  hdmaOut.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+  hdmaOut.Instance = DMA2_Stream5;
+  
+  /* Associate the DMA handle */
+  __HAL_LINKDMA(hcryp, hdmaout, hdmaOut);
+  
+  /* Configure the DMA Stream */
+  HAL_DMA_Init(&hdmaOut);
+  
+  /*##-3- Configure the NVIC for DMA #########################################*/
+  /* NVIC configuration for DMA output data interrupt */
+  HAL_NVIC_SetPriority(DMA2_Stream5_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream5_IRQn);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,369 @@
+/**
+  ******************************************************************************
+  * @file    DMA/DMA_MemCopy/Src/main.c  
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   This example shows how to offload memory copies to a DMA2 stream
+  *          with the DMA copy engine and measures the copy size above which
+  *          the DMA is faster than memcpy().
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <string.h>
+
+/** @addtogroup STM32F4xx_HAL_Examples
+  * @{
+  */
+
+/** @addtogroup DMA_MemCopy
+  * @{
+  */ 
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* DMA Handle declaration */
+DMA_HandleTypeDef     DmaHandle;
+
+/* Copy engine running on DmaHandle */
+static DMA_CopyEngineTypeDef CopyEngine;
+static DMA_CopyTypeDef       CopyRequest;
+static __IO uint32_t         CopyDone = 0;
+
+static uint32_t aSRC_Buffer[BUFFER_SIZE / 4];
+static uint32_t aDST_Buffer[BUFFER_SIZE / 4];
+
+/* Results, to be read with the debugger: one entry per copy size, the CPU
+   memcpy() and DMA copy durations are in core clock cycles */
+BenchResultTypeDef aBenchResults[BENCH_NB_SIZES];
+
+/* Smallest copy size faster with the DMA, 0 if the DMA never wins */
+uint32_t uwCrossoverSize = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void DMA_Config(void);
+static void SystemClock_Config(void);
+static void Bench_Run(void);
+static uint32_t Bench_Memcpy(uint32_t Size);
+static uint32_t Bench_DmaCopy(uint32_t Size);
+static void CopyComplete(DMA_HandleTypeDef *hdma, DMA_CopyTypeDef *pCopy);
+static void Error_Handler(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval None
+  */
+int main(void)
+{   
+  /* STM32F4xx HAL library initialization:
+       - Configure the Flash prefetch, instruction and Data caches
+       - Configure the Systick to generate an interrupt each 1 msec
+       - Set NVIC Group Priority to 4
+       - Global MSP (MCU Support Package) initialization
+     */
+  HAL_Init();
+  
+  /* Configure the system clock to 180 MHz */
+  SystemClock_Config();     
+  
+  /* Configure LED1, LED2 and LED3 */
+  BSP_LED_Init(LED1);
+  BSP_LED_Init(LED2);
+  BSP_LED_Init(LED3);
+  
+  /* Configure the DMA Stream for Memory to Memory transfers */
+  DMA_Config(); 
+  
+  /* Measure memcpy() against the DMA copy engine */
+  Bench_Run();
+
+  /* Turn LED1 on: benchmark complete */
+  BSP_LED_On(LED1);
+
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+
+/**
+  * @brief  Configure the DMA stream used by the copy engine
+  * @note   The transfer parameters (data sizes, increments, FIFO and bursts)
+  *         are set by the copy engine for each request.
+  * @param  None
+  * @retval None
+  */
+static void DMA_Config(void)
+{   
+  /*## -1- Enable DMA2 clock #################################################*/
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  /*##-2- Select the DMA functional Parameters ###############################*/
+  DmaHandle.Init.Channel = DMA_CHANNEL;                     /* DMA_CHANNEL_0                    */                     
+  DmaHandle.Init.Direction = DMA_MEMORY_TO_MEMORY;          /* M2M transfer mode                */           
+  DmaHandle.Init.PeriphInc = DMA_PINC_ENABLE;               /* Peripheral increment mode Enable */                 
+  DmaHandle.Init.MemInc = DMA_MINC_ENABLE;                  /* Memory increment mode Enable     */                   
+  DmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD; /* Peripheral data alignment : Word */    
+  DmaHandle.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;    /* memory data alignment : Word     */     
+  DmaHandle.Init.Mode = DMA_NORMAL;                         /* Normal DMA mode                  */  
+  DmaHandle.Init.Priority = DMA_PRIORITY_HIGH;              /* priority level : high            */  
+  DmaHandle.Init.FIFOMode = DMA_FIFOMODE_ENABLE;            /* FIFO mode enabled                */        
+  DmaHandle.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;  
+  DmaHandle.Init.MemBurst = DMA_MBURST_INC4;                /* Memory burst                     */  
+  DmaHandle.Init.PeriphBurst = DMA_PBURST_INC4;             /* Peripheral burst                 */
+  
+  /*##-3- Select the DMA instance to be used for the transfer : DMA2_Stream0 #*/
+  DmaHandle.Instance = DMA_STREAM;
+
+  /*##-4- Initialize the DMA stream ##########################################*/
+  if(HAL_DMA_Init(&DmaHandle) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  
+  /*##-5- Configure NVIC for DMA transfer complete/error interrupts ##########*/
+  HAL_NVIC_SetPriority(DMA_STREAM_IRQ, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA_STREAM_IRQ);
+
+  /*##-6- Attach the copy engine to the DMA stream ###########################*/
+  CopyEngine.hdma = &DmaHandle;
+}
+
+/**
+  * @brief  Measure memcpy() and the DMA copy engine for increasing sizes
+  * @param  None
+  * @retval None
+  */
+static void Bench_Run(void)
+{
+  uint32_t index = 0, size = BENCH_MIN_SIZE;
+
+  /* Enable the cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for(index = 0; index < (BUFFER_SIZE / 4); index++)
+  {
+    aSRC_Buffer[index] = 0x01020304 * (index + 1);
+  }
+
+  for(index = 0; index < BENCH_NB_SIZES; index++, size <<= 1)
+  {
+    aBenchResults[index].Size = size;
+    aBenchResults[index].CpuCycles = Bench_Memcpy(size);
+    aBenchResults[index].DmaCycles = Bench_DmaCopy(size);
+
+    if((uwCrossoverSize == 0) && (aBenchResults[index].DmaCycles < aBenchResults[index].CpuCycles))
+    {
+      uwCrossoverSize = size;
+    }
+  }
+}
+
+/**
+  * @brief  Measure a CPU copy
+  * @param  Size: number of bytes to copy
+  * @retval Average number of core clock cycles
+  */
+static uint32_t Bench_Memcpy(uint32_t Size)
+{
+  uint32_t run = 0, start = 0, cycles = 0;
+
+  for(run = 0; run < BENCH_NB_RUNS; run++)
+  {
+    start = DWT->CYCCNT;
+    memcpy(aDST_Buffer, aSRC_Buffer, Size);
+    cycles += DWT->CYCCNT - start;
+  }
+
+  return cycles / BENCH_NB_RUNS;
+}
+
+/**
+  * @brief  Measure a DMA copy, from the request to the completion callback
+  * @param  Size: number of bytes to copy
+  * @retval Average number of core clock cycles
+  */
+static uint32_t Bench_DmaCopy(uint32_t Size)
+{
+  uint32_t run = 0, start = 0, cycles = 0;
+
+  for(run = 0; run < BENCH_NB_RUNS; run++)
+  {
+    memset(aDST_Buffer, 0, Size);
+
+    CopyRequest.Type = DMA_COPY_MEMCPY;
+    CopyRequest.pSrc = aSRC_Buffer;
+    CopyRequest.pDst = aDST_Buffer;
+    CopyRequest.Size = Size;
+    CopyRequest.XferCpltCallback = CopyComplete;
+    CopyDone = 0;
+
+    start = DWT->CYCCNT;
+    if(HAL_DMAEx_CopyQueue(&CopyEngine, &CopyRequest) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    while(CopyDone == 0)
+    {
+    }
+    cycles += DWT->CYCCNT - start;
+
+    /* Turn LED2 on: copy error or data mismatch */
+    if((CopyRequest.ErrorCode != HAL_DMA_ERROR_NONE) || (memcmp(aDST_Buffer, aSRC_Buffer, Size) != 0))
+    {
+      BSP_LED_On(LED2);
+    }
+  }
+
+  return cycles / BENCH_NB_RUNS;
+}
+
+/**
+  * @brief  Copy request complete callback
+  * @note   This function is executed from the DMA interrupt. An RTOS based
+  *         application would release a semaphore here.
+  * @param  hdma:  pointer to the DMA handle
+  * @param  pCopy: completed request
+  * @retval None
+  */
+static void CopyComplete(DMA_HandleTypeDef *hdma, DMA_CopyTypeDef *pCopy)
+{
+  CopyDone = 1;
+}
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @param  None
+  * @retval None
+  */
+static void Error_Handler(void)
+{
+  /* Turn LED3 on */
+  BSP_LED_On(LED3);
+  while(1)
+  {
+  }
+}
+
+/**
+  * @brief  System Clock Configuration
+  *         The system Clock is configured as follow : 
+  *            System Clock source            = PLL (HSE)
+  *            SYSCLK(Hz)                     = 180000000
+  *            HCLK(Hz)                       = 180000000
+  *            AHB Prescaler                  = 1
+  *            APB1 Prescaler                 = 4
+  *            APB2 Prescaler                 = 2
+  *            HSE Frequency(Hz)              = 25000000
+  *            PLL_M                          = 25
+  *            PLL_N                          = 360
+  *            PLL_P                          = 2
+  *            PLL_Q                          = 7
+  *            VDD(V)                         = 3.3
+  *            Main regulator output voltage  = Scale1 mode
+  *            Flash Latency(WS)              = 5
+  * @param  None
+  * @retval None
+  */
+static void SystemClock_Config(void)
+{
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+
+  /* Enable Power Control clock */
+  __HAL_RCC_PWR_CLK_ENABLE();
+
+  /* The voltage scaling allows optimizing the power consumption when the device is 
+     clocked below the maximum system frequency, to update the voltage scaling value 
+     regarding system frequency refer to product datasheet.  */
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+  /* Enable HSE Oscillator and activate PLL with HSE as source */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+  RCC_OscInitStruct.PLL.PLLM = 25;
+  RCC_OscInitStruct.PLL.PLLN = 360;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+  RCC_OscInitStruct.PLL.PLLQ = 7;
+  HAL_RCC_OscConfig(&RCC_OscInitStruct);
+
+  /* Activate the Over-Drive mode */
+  HAL_PWREx_EnableOverDrive();
+  
+  /* Select PLL as system clock source and configure the HCLK, PCLK1 and PCLK2 
+     clocks dividers */
+  RCC_ClkInitStruct.ClockType = (RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2);
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;  
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;  
+  HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5);
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t* file, uint32_t line)
+{ 
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+#endif
+
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
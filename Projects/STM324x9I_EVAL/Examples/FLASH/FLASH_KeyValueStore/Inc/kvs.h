@@ -0,0 +1,149 @@
+/**
+  ******************************************************************************
+  * @file    FLASH/FLASH_KeyValueStore/Inc/kvs.h
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Header for kvs.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __KVS_H
+#define __KVS_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Maximum number of sectors of a store */
+#ifndef KVS_MAX_SECTORS
+#define KVS_MAX_SECTORS       4
+#endif
+
+/* Number of entries of the RAM index, power of 2. A store holds up to 3/4 of
+   KVS_INDEX_SIZE keys */
+#ifndef KVS_INDEX_SIZE
+#define KVS_INDEX_SIZE        64
+#endif
+
+/* Maximum size of a value in bytes */
+#ifndef KVS_MAX_VALUE_SIZE
+#define KVS_MAX_VALUE_SIZE    128
+#endif
+
+/* Live records moved from the oldest sector by each KVS_Set()/KVS_Delete()
+   while a sector is compacted */
+#ifndef KVS_COMPACT_STEP
+#define KVS_COMPACT_STEP      2
+#endif
+
+#define KVS_NO_SECTOR         ((uint32_t)0xFFFFFFFF)
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  KVS_OK        = 0x00,
+  KVS_ERROR     = 0x01,   /* Flash operation failed or invalid parameter   */
+  KVS_NOT_FOUND = 0x02,   /* Key not in the store                          */
+  KVS_FULL      = 0x03    /* Live data or index would exceed the capacity  */
+}KVS_StatusTypeDef;
+
+/* Store sector, located from the driver base address */
+typedef struct
+{
+  uint32_t Offset;                  /* Sector offset from pBase                   */
+  uint32_t Size;                    /* Sector size in bytes                       */
+}KVS_SectorTypeDef;
+
+/* Flash access of a store: the sectors are read through pBase, erased and
+   programmed by 32-bit words through the driver functions */
+typedef struct
+{
+  const uint8_t           *pBase;   /* Address of the store area in the CPU map   */
+  uint32_t                 NbSectors;
+  const KVS_SectorTypeDef *pSectors;
+  KVS_StatusTypeDef      (*Erase)(uint32_t Sector);
+  KVS_StatusTypeDef      (*Program)(uint32_t Offset, uint32_t Data);
+}KVS_DriverTypeDef;
+
+/* RAM index entry */
+typedef struct
+{
+  uint32_t Offset;                  /* Offset of the last record, 0 if free       */
+  uint16_t Key;
+}KVS_IndexTypeDef;
+
+typedef struct
+{
+  uint32_t UserBytes;               /* Value bytes passed to KVS_Set()            */
+  uint32_t ProgrammedBytes;         /* Bytes programmed, headers and copies included */
+  uint32_t Records;                 /* Records appended by KVS_Set()/KVS_Delete() */
+  uint32_t CopiedRecords;           /* Live records moved by the compaction       */
+  uint32_t SkippedWrites;           /* KVS_Set() calls with the stored value      */
+  uint32_t Erases;                  /* Sectors erased since KVS_Init()            */
+  uint32_t MinEraseCount;           /* Least erased sector of the store           */
+  uint32_t MaxEraseCount;           /* Most erased sector of the store            */
+  uint32_t NbKeys;                  /* Keys in the store                          */
+  uint32_t LiveBytes;               /* Flash bytes of the current records         */
+  uint32_t Capacity;                /* Maximum of LiveBytes                       */
+}KVS_StatsTypeDef;
+
+typedef struct
+{
+  const KVS_DriverTypeDef *pDriver;
+  KVS_IndexTypeDef  Index[KVS_INDEX_SIZE];     /* Key to record offset hash table  */
+  uint32_t          NbKeys;
+  uint32_t          Seq[KVS_MAX_SECTORS];      /* Log order, KVS_NO_SECTOR if spare */
+  uint32_t          EraseCount[KVS_MAX_SECTORS];
+  uint32_t          LiveBytes[KVS_MAX_SECTORS];/* Bytes of the indexed records      */
+  uint32_t          TotalLiveBytes;
+  uint32_t          Capacity;
+  uint32_t          NextSeq;
+  uint32_t          Active;                    /* Sector receiving the records      */
+  uint32_t          WriteOffset;               /* Next record offset                */
+  uint32_t          Victim;                    /* Sector being compacted            */
+  uint32_t          VictimOffset;              /* Next record to check in Victim    */
+  KVS_StatsTypeDef  Stats;
+}KVS_HandleTypeDef;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+KVS_StatusTypeDef KVS_Init(KVS_HandleTypeDef *hkvs, const KVS_DriverTypeDef *pDriver);
+KVS_StatusTypeDef KVS_Format(KVS_HandleTypeDef *hkvs);
+KVS_StatusTypeDef KVS_Get(KVS_HandleTypeDef *hkvs, uint16_t Key, void *pData, uint32_t Size, uint32_t *pLength);
+KVS_StatusTypeDef KVS_Set(KVS_HandleTypeDef *hkvs, uint16_t Key, const void *pData, uint32_t Length);
+KVS_StatusTypeDef KVS_Delete(KVS_HandleTypeDef *hkvs, uint16_t Key);
+KVS_StatusTypeDef KVS_Compact(KVS_HandleTypeDef *hkvs, uint32_t NbRecords);
+void              KVS_GetStats(KVS_HandleTypeDef *hkvs, KVS_StatsTypeDef *pStats);
+
+#endif /* __KVS_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    FLASH/FLASH_KeyValueStore/Inc/kvs_sim.h
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Header for kvs_sim.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __KVS_SIM_H
+#define __KVS_SIM_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "kvs.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Simulated sectors, same size as the STM32F4 sectors 0 to 3 */
+#define KVS_SIM_NB_SECTORS     3
+#define KVS_SIM_SECTOR_SIZE    ((uint32_t)0x4000)
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Programs;                          /* Words programmed                     */
+  uint32_t Erases;                            /* Sectors erased                       */
+  uint32_t Overwrites;                        /* Words programmed twice without erase */
+  uint32_t EraseCount[KVS_SIM_NB_SECTORS];    /* Erases of each sector                */
+}KVS_SimStatsTypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+extern const KVS_DriverTypeDef KVS_SimDriver;
+
+void     KVS_SimInit(uint32_t Seed);
+void     KVS_SimPowerFail(uint32_t NbOperations);
+void     KVS_SimPowerOn(void);
+uint32_t KVS_SimRandom(void);
+void     KVS_SimGetStats(KVS_SimStatsTypeDef *pStats);
+
+#endif /* __KVS_SIM_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,1021 @@
+/**
+  ******************************************************************************
+  * @file    FLASH/FLASH_KeyValueStore/Src/kvs.c
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Log-structured key-value store on internal flash sectors.
+  *
+  *          The records are appended to the active sector; the last record of
+  *          each key is found in O(1) through a RAM hash index rebuilt by
+  *          KVS_Init(). The oldest sector is compacted incrementally: each
+  *          KVS_Set() moves a few of its live records to the active sector and
+  *          the sector is erased once it holds no live record.
+  *
+  *          Sector layout:
+  *            +0 magic (programmed last, cleared before the erase), +4 erase
+  *            count, +8 sequence and +12 inverted sequence (programmed when the
+  *            sector is opened), then the records.
+  *          Record layout:
+  *            key | length << 16 (bit 31: deleted key), value padded to a word,
+  *            commit word = CRC16 << 16 | 0x5AA5, programmed last.
+  *          A record without a valid commit word is skipped with the largest
+  *          record size: the data of a KVS_Set() interrupted by a power loss is
+  *          ignored at the next KVS_Init() and the previous value is kept.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "kvs.h"
+#include <string.h>
+
+/** @addtogroup STM32F4xx_HAL_Examples
+  * @{
+  */
+
+/** @addtogroup FLASH_KeyValueStore
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define KVS_MAGIC              ((uint32_t)0x4B565331)  /* "KVS1" */
+#define KVS_ERASED             ((uint32_t)0xFFFFFFFF)
+#define KVS_TOMBSTONE          ((uint32_t)0x80000000)
+#define KVS_COMMIT_TAG         ((uint32_t)0x00005AA5)
+#define KVS_NO_KEY             ((uint16_t)0xFFFF)
+
+/* Sector header */
+#define KVS_HDR_MAGIC          0
+#define KVS_HDR_ERASE_COUNT    4
+#define KVS_HDR_SEQ            8
+#define KVS_HDR_SEQ_CHECK      12
+#define KVS_HDR_SIZE           16
+
+/* The index is never filled over 3/4 */
+#define KVS_MAX_KEYS           ((KVS_INDEX_SIZE * 3) / 4)
+
+/* Private macro -------------------------------------------------------------*/
+#define KVS_RECORD_SIZE(__LENGTH__)      ((uint32_t)(8 + (((__LENGTH__) + 3) & ~3)))
+#define KVS_MAX_RECORD_SIZE              KVS_RECORD_SIZE(KVS_MAX_VALUE_SIZE)
+#define KVS_KEY(__HEADER__)              ((uint16_t)((__HEADER__) & 0xFFFF))
+#define KVS_LENGTH(__HEADER__)           (((__HEADER__) >> 16) & 0x7FFF)
+#define KVS_WORD(__HANDLE__, __OFFSET__) (*(const uint32_t *)((__HANDLE__)->pDriver->pBase + (__OFFSET__)))
+#define KVS_START(__HANDLE__, __SECTOR__) ((__HANDLE__)->pDriver->pSectors[(__SECTOR__)].Offset)
+#define KVS_END(__HANDLE__, __SECTOR__)   (KVS_START((__HANDLE__), (__SECTOR__)) + \
+                                           (__HANDLE__)->pDriver->pSectors[(__SECTOR__)].Size)
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static KVS_StatusTypeDef KVS_Mount(KVS_HandleTypeDef *hkvs);
+static KVS_StatusTypeDef KVS_FormatSector(KVS_HandleTypeDef *hkvs, uint32_t Sector, uint32_t EraseCount);
+static KVS_StatusTypeDef KVS_OpenSector(KVS_HandleTypeDef *hkvs);
+static KVS_StatusTypeDef KVS_Append(KVS_HandleTypeDef *hkvs, uint32_t Header, const uint8_t *pData, uint32_t Length, uint32_t *pOffset);
+static KVS_StatusTypeDef KVS_Reserve(KVS_HandleTypeDef *hkvs, uint32_t Size);
+static KVS_StatusTypeDef KVS_MoveRecord(KVS_HandleTypeDef *hkvs);
+static void              KVS_SelectVictim(KVS_HandleTypeDef *hkvs, uint32_t Force);
+static uint32_t          KVS_Available(KVS_HandleTypeDef *hkvs);
+static uint32_t          KVS_ReadRecord(KVS_HandleTypeDef *hkvs, uint32_t Offset, uint32_t End, uint32_t *pHeader);
+static uint32_t          KVS_SectorOf(KVS_HandleTypeDef *hkvs, uint32_t Offset);
+static uint16_t          KVS_Crc(uint32_t Header, const uint8_t *pData, uint32_t Length);
+static KVS_IndexTypeDef *KVS_Find(KVS_HandleTypeDef *hkvs, uint16_t Key);
+static KVS_StatusTypeDef KVS_IndexSet(KVS_HandleTypeDef *hkvs, uint16_t Key, uint32_t Offset);
+static void              KVS_IndexRemove(KVS_HandleTypeDef *hkvs, uint16_t Key);
+static void              KVS_Account(KVS_HandleTypeDef *hkvs, uint32_t Offset, int32_t Sign);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Mounts a store: formats the unused or interrupted sectors and
+  *         rebuilds the RAM index from the records of the other sectors.
+  * @param  hkvs: store handle
+  * @param  pDriver: flash access of the store (2 to KVS_MAX_SECTORS sectors)
+  * @retval KVS status
+  */
+KVS_StatusTypeDef KVS_Init(KVS_HandleTypeDef *hkvs, const KVS_DriverTypeDef *pDriver)
+{
+  if((pDriver == NULL) || (pDriver->NbSectors < 2) || (pDriver->NbSectors > KVS_MAX_SECTORS))
+  {
+    return KVS_ERROR;
+  }
+
+  memset(hkvs, 0, sizeof(KVS_HandleTypeDef));
+  hkvs->pDriver = pDriver;
+
+  return KVS_Mount(hkvs);
+}
+
+/**
+  * @brief  Erases all the records of a store
+  * @param  hkvs: store handle initialized by KVS_Init()
+  * @retval KVS status
+  */
+KVS_StatusTypeDef KVS_Format(KVS_HandleTypeDef *hkvs)
+{
+  uint32_t sector;
+
+  for(sector = 0; sector < hkvs->pDriver->NbSectors; sector++)
+  {
+    if(KVS_FormatSector(hkvs, sector, hkvs->EraseCount[sector] + 1) != KVS_OK)
+    {
+      return KVS_ERROR;
+    }
+  }
+
+  return KVS_Mount(hkvs);
+}
+
+/**
+  * @brief  Reads the value of a key
+  * @param  hkvs: store handle
+  * @param  Key: key, 0x0000 to 0xFFFE
+  * @param  pData: buffer receiving the value
+  * @param  Size: size of pData, the value is truncated to Size bytes
+  * @param  pLength: receives the length of the value, can be NULL
+  * @retval KVS_OK or KVS_NOT_FOUND
+  */
+KVS_StatusTypeDef KVS_Get(KVS_HandleTypeDef *hkvs, uint16_t Key, void *pData, uint32_t Size, uint32_t *pLength)
+{
+  KVS_IndexTypeDef *pentry = KVS_Find(hkvs, Key);
+  uint32_t length;
+
+  if(pentry == NULL)
+  {
+    return KVS_NOT_FOUND;
+  }
+
+  length = KVS_LENGTH(KVS_WORD(hkvs, pentry->Offset));
+  if(pLength != NULL)
+  {
+    *pLength = length;
+  }
+
+  memcpy(pData, hkvs->pDriver->pBase + pentry->Offset + 4, (length < Size) ? length : Size);
+
+  return KVS_OK;
+}
+
+/**
+  * @brief  Writes the value of a key. The previous value is kept until the new
+  *         record is committed. Nothing is programmed when the value is unchanged.
+  * @param  hkvs: store handle
+  * @param  Key: key, 0x0000 to 0xFFFE
+  * @param  pData: value
+  * @param  Length: value length in bytes, up to KVS_MAX_VALUE_SIZE
+  * @retval KVS status
+  */
+KVS_StatusTypeDef KVS_Set(KVS_HandleTypeDef *hkvs, uint16_t Key, const void *pData, uint32_t Length)
+{
+  KVS_IndexTypeDef *pentry;
+  KVS_StatusTypeDef status;
+  uint32_t size = KVS_RECORD_SIZE(Length);
+  uint32_t oldsize = 0;
+  uint32_t offset = 0;
+
+  if((Key == KVS_NO_KEY) || (Length > KVS_MAX_VALUE_SIZE) || ((pData == NULL) && (Length != 0)))
+  {
+    return KVS_ERROR;
+  }
+
+  /* Move a few live records of the sector being compacted */
+  status = KVS_Compact(hkvs, KVS_COMPACT_STEP);
+  if(status != KVS_OK)
+  {
+    return status;
+  }
+
+  pentry = KVS_Find(hkvs, Key);
+  if(pentry != NULL)
+  {
+    oldsize = KVS_RECORD_SIZE(KVS_LENGTH(KVS_WORD(hkvs, pentry->Offset)));
+    if((KVS_LENGTH(KVS_WORD(hkvs, pentry->Offset)) == Length) &&
+       (memcmp(hkvs->pDriver->pBase + pentry->Offset + 4, pData, Length) == 0))
+    {
+      hkvs->Stats.SkippedWrites++;
+      return KVS_OK;
+    }
+  }
+  else if(hkvs->NbKeys >= KVS_MAX_KEYS)
+  {
+    return KVS_FULL;
+  }
+
+  if((hkvs->TotalLiveBytes - oldsize + size) > hkvs->Capacity)
+  {
+    return KVS_FULL;
+  }
+
+  status = KVS_Reserve(hkvs, size);
+  if(status == KVS_OK)
+  {
+    status = KVS_Append(hkvs, (uint32_t)Key | (Length << 16), (const uint8_t *)pData, Length, &offset);
+  }
+  if(status == KVS_OK)
+  {
+    status = KVS_IndexSet(hkvs, Key, offset);
+    hkvs->Stats.Records++;
+    hkvs->Stats.UserBytes += Length;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Removes a key
+  * @param  hkvs: store handle
+  * @param  Key: key, 0x0000 to 0xFFFE
+  * @retval KVS status
+  */
+KVS_StatusTypeDef KVS_Delete(KVS_HandleTypeDef *hkvs, uint16_t Key)
+{
+  KVS_StatusTypeDef status;
+  uint32_t offset = 0;
+
+  if(Key == KVS_NO_KEY)
+  {
+    return KVS_ERROR;
+  }
+
+  status = KVS_Compact(hkvs, KVS_COMPACT_STEP);
+  if(status != KVS_OK)
+  {
+    return status;
+  }
+
+  if(KVS_Find(hkvs, Key) == NULL)
+  {
+    return KVS_NOT_FOUND;
+  }
+
+  status = KVS_Reserve(hkvs, KVS_RECORD_SIZE(0));
+  if(status == KVS_OK)
+  {
+    status = KVS_Append(hkvs, KVS_TOMBSTONE | Key, NULL, 0, &offset);
+  }
+  if(status == KVS_OK)
+  {
+    KVS_IndexRemove(hkvs, Key);
+    hkvs->Stats.Records++;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Runs the compaction of the oldest sector, for instance when the
+  *         application is idle. KVS_Set() and KVS_Delete() already run
+  *         KVS_COMPACT_STEP steps.
+  * @param  hkvs: store handle
+  * @param  NbRecords: maximum number of live records to move
+  * @retval KVS status
+  */
+KVS_StatusTypeDef KVS_Compact(KVS_HandleTypeDef *hkvs, uint32_t NbRecords)
+{
+  KVS_StatusTypeDef status = KVS_OK;
+
+  KVS_SelectVictim(hkvs, 0);
+
+  while((hkvs->Victim != KVS_NO_SECTOR) && (NbRecords != 0) && (status == KVS_OK))
+  {
+    status = KVS_MoveRecord(hkvs);
+    NbRecords--;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Returns the statistics of a store
+  * @param  hkvs: store handle
+  * @param  pStats: statistics
+  * @retval None
+  */
+void KVS_GetStats(KVS_HandleTypeDef *hkvs, KVS_StatsTypeDef *pStats)
+{
+  uint32_t sector;
+
+  *pStats = hkvs->Stats;
+  pStats->MinEraseCount = hkvs->EraseCount[0];
+  pStats->MaxEraseCount = hkvs->EraseCount[0];
+  for(sector = 1; sector < hkvs->pDriver->NbSectors; sector++)
+  {
+    if(hkvs->EraseCount[sector] < pStats->MinEraseCount)
+    {
+      pStats->MinEraseCount = hkvs->EraseCount[sector];
+    }
+    if(hkvs->EraseCount[sector] > pStats->MaxEraseCount)
+    {
+      pStats->MaxEraseCount = hkvs->EraseCount[sector];
+    }
+  }
+  pStats->NbKeys = hkvs->NbKeys;
+  pStats->LiveBytes = hkvs->TotalLiveBytes;
+  pStats->Capacity = hkvs->Capacity;
+}
+
+/**
+  * @brief  Rebuilds the state of a store from the flash content
+  * @param  hkvs: store handle
+  * @retval KVS status
+  */
+static KVS_StatusTypeDef KVS_Mount(KVS_HandleTypeDef *hkvs)
+{
+  const KVS_DriverTypeDef *pdriver = hkvs->pDriver;
+  uint32_t format[KVS_MAX_SECTORS];
+  uint32_t sector, start, offset, size, header, last;
+  uint32_t maxcount = 0;
+  KVS_StatusTypeDef status;
+
+  memset(hkvs->Index, 0, sizeof(hkvs->Index));
+  memset(hkvs->LiveBytes, 0, sizeof(hkvs->LiveBytes));
+  hkvs->NbKeys = 0;
+  hkvs->TotalLiveBytes = 0;
+  hkvs->NextSeq = 0;
+  hkvs->Active = KVS_NO_SECTOR;
+  hkvs->WriteOffset = 0;
+  hkvs->Victim = KVS_NO_SECTOR;
+
+  /* The live data must fit in one sector, with room for the record being
+     written, so that the compaction of the oldest sector always completes */
+  hkvs->Capacity = KVS_ERASED;
+  for(sector = 0; sector < pdriver->NbSectors; sector++)
+  {
+    size = pdriver->pSectors[sector].Size - KVS_HDR_SIZE - (2 * KVS_MAX_RECORD_SIZE);
+    if(size < hkvs->Capacity)
+    {
+      hkvs->Capacity = size;
+    }
+  }
+
+  /* Read the sector headers */
+  for(sector = 0; sector < pdriver->NbSectors; sector++)
+  {
+    start = KVS_START(hkvs, sector);
+    format[sector] = 1;
+    hkvs->Seq[sector] = KVS_NO_SECTOR;
+    hkvs->EraseCount[sector] = 0;
+
+    if(KVS_WORD(hkvs, start + KVS_HDR_MAGIC) == KVS_MAGIC)
+    {
+      hkvs->EraseCount[sector] = KVS_WORD(hkvs, start + KVS_HDR_ERASE_COUNT);
+
+      /* Spare sector, or sector in use when the sequence is programmed. A
+         sector whose opening was interrupted has no record, it is erased */
+      if((KVS_WORD(hkvs, start + KVS_HDR_SEQ) ^ KVS_WORD(hkvs, start + KVS_HDR_SEQ_CHECK)) == KVS_ERASED)
+      {
+        hkvs->Seq[sector] = KVS_WORD(hkvs, start + KVS_HDR_SEQ);
+        format[sector] = 0;
+      }
+      else if((KVS_WORD(hkvs, start + KVS_HDR_SEQ) == KVS_ERASED) &&
+              (KVS_WORD(hkvs, start + KVS_HDR_SEQ_CHECK) == KVS_ERASED))
+      {
+        format[sector] = 0;
+      }
+    }
+    if(hkvs->EraseCount[sector] > maxcount)
+    {
+      maxcount = hkvs->EraseCount[sector];
+    }
+  }
+
+  /* Erase the blank sectors and the sectors whose erase was interrupted, they
+     get the highest erase count of the store */
+  for(sector = 0; sector < pdriver->NbSectors; sector++)
+  {
+    if(format[sector] != 0)
+    {
+      if(KVS_WORD(hkvs, KVS_START(hkvs, sector) + KVS_HDR_MAGIC) != KVS_MAGIC)
+      {
+        hkvs->EraseCount[sector] = maxcount;
+      }
+      if(KVS_FormatSector(hkvs, sector, hkvs->EraseCount[sector] + 1) != KVS_OK)
+      {
+        return KVS_ERROR;
+      }
+    }
+  }
+
+  /* Replay the sectors in use from the oldest to the newest */
+  last = KVS_NO_SECTOR;
+  while(1)
+  {
+    sector = KVS_NO_SECTOR;
+    for(offset = 0; offset < pdriver->NbSectors; offset++)
+    {
+      if((hkvs->Seq[offset] != KVS_NO_SECTOR) &&
+         ((last == KVS_NO_SECTOR) || (hkvs->Seq[offset] > hkvs->Seq[last])) &&
+         ((sector == KVS_NO_SECTOR) || (hkvs->Seq[offset] < hkvs->Seq[sector])))
+      {
+        sector = offset;
+      }
+    }
+    if(sector == KVS_NO_SECTOR)
+    {
+      break;
+    }
+
+    offset = KVS_START(hkvs, sector) + KVS_HDR_SIZE;
+    while(1)
+    {
+      size = KVS_ReadRecord(hkvs, offset, KVS_END(hkvs, sector), &header);
+      if(size != 0)
+      {
+        if((header & KVS_TOMBSTONE) != 0)
+        {
+          KVS_IndexRemove(hkvs, KVS_KEY(header));
+        }
+        else
+        {
+          status = KVS_IndexSet(hkvs, KVS_KEY(header), offset);
+          if(status != KVS_OK)
+          {
+            return status;
+          }
+        }
+        offset += size;
+      }
+      else if(header != KVS_ERASED)
+      {
+        /* Record interrupted by a power loss */
+        offset += KVS_MAX_RECORD_SIZE;
+      }
+      else
+      {
+        break;
+      }
+    }
+    if(offset > KVS_END(hkvs, sector))
+    {
+      offset = KVS_END(hkvs, sector);
+    }
+
+    hkvs->Active = sector;
+    hkvs->WriteOffset = offset;
+    hkvs->NextSeq = hkvs->Seq[sector] + 1;
+    last = sector;
+  }
+
+  KVS_SelectVictim(hkvs, 0);
+
+  return KVS_OK;
+}
+
+/**
+  * @brief  Erases a sector and programs its header, the sector becomes a spare
+  * @param  hkvs: store handle
+  * @param  Sector: store sector
+  * @param  EraseCount: erase count of the sector, this erase included
+  * @retval KVS status
+  */
+static KVS_StatusTypeDef KVS_FormatSector(KVS_HandleTypeDef *hkvs, uint32_t Sector, uint32_t EraseCount)
+{
+  const KVS_DriverTypeDef *pdriver = hkvs->pDriver;
+  uint32_t start = KVS_START(hkvs, Sector);
+
+  hkvs->Seq[Sector] = KVS_NO_SECTOR;
+  hkvs->LiveBytes[Sector] = 0;
+
+  /* The records of a sector whose erase is interrupted must not be read
+     again: the magic number is cleared first */
+  if(KVS_WORD(hkvs, start + KVS_HDR_MAGIC) == KVS_MAGIC)
+  {
+    if(pdriver->Program(start + KVS_HDR_MAGIC, 0) != KVS_OK)
+    {
+      return KVS_ERROR;
+    }
+  }
+
+  if(pdriver->Erase(Sector) != KVS_OK)
+  {
+    return KVS_ERROR;
+  }
+  hkvs->Stats.Erases++;
+  hkvs->EraseCount[Sector] = EraseCount;
+
+  /* The magic number is programmed last: a sector without it is erased again
+     by KVS_Init() */
+  if((pdriver->Program(start + KVS_HDR_ERASE_COUNT, EraseCount) != KVS_OK) ||
+     (pdriver->Program(start + KVS_HDR_MAGIC, KVS_MAGIC) != KVS_OK))
+  {
+    return KVS_ERROR;
+  }
+  hkvs->Stats.ProgrammedBytes += 8;
+
+  return KVS_OK;
+}
+
+/**
+  * @brief  Opens the least erased spare sector to receive the records
+  * @param  hkvs: store handle
+  * @retval KVS status
+  */
+static KVS_StatusTypeDef KVS_OpenSector(KVS_HandleTypeDef *hkvs)
+{
+  uint32_t sector, spare = KVS_NO_SECTOR;
+
+  for(sector = 0; sector < hkvs->pDriver->NbSectors; sector++)
+  {
+    if((hkvs->Seq[sector] == KVS_NO_SECTOR) &&
+       ((spare == KVS_NO_SECTOR) || (hkvs->EraseCount[sector] < hkvs->EraseCount[spare])))
+    {
+      spare = sector;
+    }
+  }
+  if(spare == KVS_NO_SECTOR)
+  {
+    return KVS_FULL;
+  }
+
+  if((hkvs->pDriver->Program(KVS_START(hkvs, spare) + KVS_HDR_SEQ, hkvs->NextSeq) != KVS_OK) ||
+     (hkvs->pDriver->Program(KVS_START(hkvs, spare) + KVS_HDR_SEQ_CHECK, ~hkvs->NextSeq) != KVS_OK))
+  {
+    return KVS_ERROR;
+  }
+  hkvs->Stats.ProgrammedBytes += 8;
+
+  hkvs->Seq[spare] = hkvs->NextSeq++;
+  hkvs->Active = spare;
+  hkvs->WriteOffset = KVS_START(hkvs, spare) + KVS_HDR_SIZE;
+
+  KVS_SelectVictim(hkvs, 0);
+
+  return KVS_OK;
+}
+
+/**
+  * @brief  Appends a record to the active sector: header, value then commit word
+  * @param  hkvs: store handle
+  * @param  Header: record header
+  * @param  pData: value
+  * @param  Length: value length in bytes
+  * @param  pOffset: receives the offset of the record
+  * @retval KVS status
+  */
+static KVS_StatusTypeDef KVS_Append(KVS_HandleTypeDef *hkvs, uint32_t Header, const uint8_t *pData, uint32_t Length, uint32_t *pOffset)
+{
+  const KVS_DriverTypeDef *pdriver = hkvs->pDriver;
+  uint32_t size = KVS_RECORD_SIZE(Length);
+  uint32_t offset, index, word, byte;
+  KVS_StatusTypeDef status;
+
+  if((hkvs->Active == KVS_NO_SECTOR) || ((hkvs->WriteOffset + size) > KVS_END(hkvs, hkvs->Active)))
+  {
+    status = KVS_OpenSector(hkvs);
+    if(status != KVS_OK)
+    {
+      return status;
+    }
+  }
+
+  offset = hkvs->WriteOffset;
+  status = pdriver->Program(offset, Header);
+
+  for(index = 0; (index < Length) && (status == KVS_OK); index += 4)
+  {
+    word = KVS_ERASED;
+    for(byte = 0; (byte < 4) && ((index + byte) < Length); byte++)
+    {
+      word &= ~((uint32_t)0xFF << (8 * byte)) | ((uint32_t)pData[index + byte] << (8 * byte));
+    }
+    if(word != KVS_ERASED)
+    {
+      status = pdriver->Program(offset + 4 + index, word);
+    }
+  }
+
+  if(status == KVS_OK)
+  {
+    status = pdriver->Program(offset + size - 4, ((uint32_t)KVS_Crc(Header, pData, Length) << 16) | KVS_COMMIT_TAG);
+  }
+
+  if(status != KVS_OK)
+  {
+    /* A record which is not committed is skipped as the largest record */
+    if(KVS_WORD(hkvs, offset) != KVS_ERASED)
+    {
+      hkvs->WriteOffset += KVS_MAX_RECORD_SIZE;
+      if(hkvs->WriteOffset > KVS_END(hkvs, hkvs->Active))
+      {
+        hkvs->WriteOffset = KVS_END(hkvs, hkvs->Active);
+      }
+    }
+    return KVS_ERROR;
+  }
+
+  hkvs->WriteOffset += size;
+  hkvs->Stats.ProgrammedBytes += size;
+  *pOffset = offset;
+
+  return KVS_OK;
+}
+
+/**
+  * @brief  Makes room for a record: the sector being compacted is completed
+  *         when its live records and the record would not fit otherwise.
+  * @param  hkvs: store handle
+  * @param  Size: record size
+  * @retval KVS status
+  */
+static KVS_StatusTypeDef KVS_Reserve(KVS_HandleTypeDef *hkvs, uint32_t Size)
+{
+  KVS_StatusTypeDef status = KVS_OK;
+  uint32_t victim, loop;
+
+  for(loop = 0; loop <= hkvs->pDriver->NbSectors; loop++)
+  {
+    victim = hkvs->Victim;
+    if(KVS_Available(hkvs) >= (Size + ((victim != KVS_NO_SECTOR) ? hkvs->LiveBytes[victim] : 0)))
+    {
+      return KVS_OK;
+    }
+
+    if(victim == KVS_NO_SECTOR)
+    {
+      KVS_SelectVictim(hkvs, 1);
+      victim = hkvs->Victim;
+      if(victim == KVS_NO_SECTOR)
+      {
+        return KVS_FULL;
+      }
+    }
+
+    while((hkvs->Victim == victim) && (status == KVS_OK))
+    {
+      status = KVS_MoveRecord(hkvs);
+    }
+    if(status != KVS_OK)
+    {
+      return status;
+    }
+  }
+
+  return KVS_FULL;
+}
+
+/**
+  * @brief  Moves the next live record of the sector being compacted, or erases
+  *         the sector when it has no more records.
+  * @param  hkvs: store handle
+  * @retval KVS status
+  */
+static KVS_StatusTypeDef KVS_MoveRecord(KVS_HandleTypeDef *hkvs)
+{
+  uint32_t victim = hkvs->Victim;
+  uint32_t end = KVS_END(hkvs, victim);
+  uint32_t size, header, offset = 0;
+  KVS_IndexTypeDef *pentry;
+  KVS_StatusTypeDef status;
+
+  while(1)
+  {
+    size = KVS_ReadRecord(hkvs, hkvs->VictimOffset, end, &header);
+    if(size == 0)
+    {
+      if(header == KVS_ERASED)
+      {
+        break;
+      }
+      /* Record interrupted by a power loss */
+      size = KVS_MAX_RECORD_SIZE;
+      header = KVS_TOMBSTONE;
+    }
+
+    pentry = KVS_Find(hkvs, KVS_KEY(header));
+
+    if(((header & KVS_TOMBSTONE) == 0) && (pentry != NULL) && (pentry->Offset == hkvs->VictimOffset))
+    {
+      status = KVS_Append(hkvs, header, hkvs->pDriver->pBase + hkvs->VictimOffset + 4, KVS_LENGTH(header), &offset);
+      if(status != KVS_OK)
+      {
+        return status;
+      }
+      hkvs->VictimOffset += size;
+      hkvs->Stats.CopiedRecords++;
+
+      return KVS_IndexSet(hkvs, KVS_KEY(header), offset);
+    }
+
+    /* Older value, deleted key or record not committed: the oldest sector
+       does not need the deleted key records anymore */
+    hkvs->VictimOffset += size;
+  }
+
+  /* All the live records are in newer sectors */
+  hkvs->Victim = KVS_NO_SECTOR;
+  status = KVS_FormatSector(hkvs, victim, hkvs->EraseCount[victim] + 1);
+
+  KVS_SelectVictim(hkvs, 0);
+
+  return status;
+}
+
+/**
+  * @brief  Selects the oldest sector in use as the sector to compact when at
+  *         most one spare sector is left
+  * @param  hkvs: store handle
+  * @param  Force: select a sector whatever the number of spare sectors
+  * @retval None
+  */
+static void KVS_SelectVictim(KVS_HandleTypeDef *hkvs, uint32_t Force)
+{
+  uint32_t sector, spares = 0, victim = KVS_NO_SECTOR;
+
+  if(hkvs->Victim != KVS_NO_SECTOR)
+  {
+    return;
+  }
+
+  for(sector = 0; sector < hkvs->pDriver->NbSectors; sector++)
+  {
+    if(hkvs->Seq[sector] == KVS_NO_SECTOR)
+    {
+      spares++;
+    }
+    else if((sector != hkvs->Active) &&
+            ((victim == KVS_NO_SECTOR) || (hkvs->Seq[sector] < hkvs->Seq[victim])))
+    {
+      victim = sector;
+    }
+  }
+
+  if((victim != KVS_NO_SECTOR) && ((spares <= 1) || (Force != 0)))
+  {
+    hkvs->Victim = victim;
+    hkvs->VictimOffset = KVS_START(hkvs, victim) + KVS_HDR_SIZE;
+  }
+}
+
+/**
+  * @brief  Returns the number of record bytes which can be appended for sure:
+  *         the free space of the active sector and of the spare sectors, less
+  *         the unused end of a sector when a record does not fit in it.
+  * @param  hkvs: store handle
+  * @retval Number of bytes
+  */
+static uint32_t KVS_Available(KVS_HandleTypeDef *hkvs)
+{
+  uint32_t sector, available = 0;
+
+  if(hkvs->Active != KVS_NO_SECTOR)
+  {
+    available = KVS_END(hkvs, hkvs->Active) - hkvs->WriteOffset;
+  }
+
+  for(sector = 0; sector < hkvs->pDriver->NbSectors; sector++)
+  {
+    if(hkvs->Seq[sector] == KVS_NO_SECTOR)
+    {
+      available += hkvs->pDriver->pSectors[sector].Size - KVS_HDR_SIZE - KVS_MAX_RECORD_SIZE;
+    }
+  }
+
+  return available;
+}
+
+/**
+  * @brief  Checks a record
+  * @param  hkvs: store handle
+  * @param  Offset: record offset
+  * @param  End: end of the sector
+  * @param  pHeader: receives the record header, KVS_ERASED at the end of the records
+  * @retval Record size, 0 at the end of the records or for a record not committed
+  */
+static uint32_t KVS_ReadRecord(KVS_HandleTypeDef *hkvs, uint32_t Offset, uint32_t End, uint32_t *pHeader)
+{
+  uint32_t header, length, size;
+
+  *pHeader = KVS_ERASED;
+  if((Offset + KVS_RECORD_SIZE(0)) > End)
+  {
+    return 0;
+  }
+
+  header = KVS_WORD(hkvs, Offset);
+  *pHeader = header;
+  if(header == KVS_ERASED)
+  {
+    return 0;
+  }
+
+  length = KVS_LENGTH(header);
+  size = KVS_RECORD_SIZE(length);
+  if((length > KVS_MAX_VALUE_SIZE) || (KVS_KEY(header) == KVS_NO_KEY) ||
+     (((header & KVS_TOMBSTONE) != 0) && (length != 0)) || ((Offset + size) > End))
+  {
+    return 0;
+  }
+
+  if(KVS_WORD(hkvs, Offset + size - 4) != 
+     (((uint32_t)KVS_Crc(header, hkvs->pDriver->pBase + Offset + 4, length) << 16) | KVS_COMMIT_TAG))
+  {
+    return 0;
+  }
+
+  return size;
+}
+
+/**
+  * @brief  Returns the store sector holding an offset
+  * @param  hkvs: store handle
+  * @param  Offset: offset from the store base address
+  * @retval Store sector
+  */
+static uint32_t KVS_SectorOf(KVS_HandleTypeDef *hkvs, uint32_t Offset)
+{
+  uint32_t sector;
+
+  for(sector = 0; sector < (hkvs->pDriver->NbSectors - 1); sector++)
+  {
+    if((Offset >= KVS_START(hkvs, sector)) && (Offset < KVS_END(hkvs, sector)))
+    {
+      break;
+    }
+  }
+
+  return sector;
+}
+
+/**
+  * @brief  CRC-16/CCITT of a record header and value
+  * @param  Header: record header
+  * @param  pData: value
+  * @param  Length: value length in bytes
+  * @retval CRC
+  */
+static uint16_t KVS_Crc(uint32_t Header, const uint8_t *pData, uint32_t Length)
+{
+  uint32_t crc = 0xFFFF;
+  uint32_t index, bit;
+
+  for(index = 0; index < (Length + 4); index++)
+  {
+    crc ^= (uint32_t)((index < 4) ? (uint8_t)(Header >> (8 * index)) : pData[index - 4]) << 8;
+    for(bit = 0; bit < 8; bit++)
+    {
+      crc = ((crc & 0x8000) != 0) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+    }
+  }
+
+  return (uint16_t)crc;
+}
+
+/**
+  * @brief  Looks a key up in the RAM index (linear probing)
+  * @param  hkvs: store handle
+  * @param  Key: key
+  * @retval Index entry of the key, NULL if the key is not in the store
+  */
+static KVS_IndexTypeDef *KVS_Find(KVS_HandleTypeDef *hkvs, uint16_t Key)
+{
+  uint32_t slot = ((Key * 0x9E3779B1U) >> 16) & (KVS_INDEX_SIZE - 1);
+
+  while(hkvs->Index[slot].Offset != 0)
+  {
+    if(hkvs->Index[slot].Key == Key)
+    {
+      return &hkvs->Index[slot];
+    }
+    slot = (slot + 1) & (KVS_INDEX_SIZE - 1);
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Sets the record of a key in the RAM index
+  * @param  hkvs: store handle
+  * @param  Key: key
+  * @param  Offset: record offset
+  * @retval KVS_OK, KVS_FULL if the key is new and the index is full
+  */
+static KVS_StatusTypeDef KVS_IndexSet(KVS_HandleTypeDef *hkvs, uint16_t Key, uint32_t Offset)
+{
+  uint32_t slot = ((Key * 0x9E3779B1U) >> 16) & (KVS_INDEX_SIZE - 1);
+
+  while(hkvs->Index[slot].Offset != 0)
+  {
+    if(hkvs->Index[slot].Key == Key)
+    {
+      KVS_Account(hkvs, hkvs->Index[slot].Offset, -1);
+      hkvs->Index[slot].Offset = Offset;
+      KVS_Account(hkvs, Offset, 1);
+      return KVS_OK;
+    }
+    slot = (slot + 1) & (KVS_INDEX_SIZE - 1);
+  }
+
+  if(hkvs->NbKeys >= KVS_MAX_KEYS)
+  {
+    return KVS_FULL;
+  }
+
+  hkvs->Index[slot].Key = Key;
+  hkvs->Index[slot].Offset = Offset;
+  hkvs->NbKeys++;
+  KVS_Account(hkvs, Offset, 1);
+
+  return KVS_OK;
+}
+
+/**
+  * @brief  Removes a key from the RAM index, the following entries of the
+  *         probe sequence are shifted back
+  * @param  hkvs: store handle
+  * @param  Key: key
+  * @retval None
+  */
+static void KVS_IndexRemove(KVS_HandleTypeDef *hkvs, uint16_t Key)
+{
+  KVS_IndexTypeDef *pentry = KVS_Find(hkvs, Key);
+  uint32_t hole, slot, home;
+
+  if(pentry == NULL)
+  {
+    return;
+  }
+
+  KVS_Account(hkvs, pentry->Offset, -1);
+  hkvs->NbKeys--;
+
+  hole = (uint32_t)(pentry - hkvs->Index);
+  slot = hole;
+  while(1)
+  {
+    slot = (slot + 1) & (KVS_INDEX_SIZE - 1);
+    if(hkvs->Index[slot].Offset == 0)
+    {
+      break;
+    }
+
+    /* Move the entry to the hole unless its home slot is cyclically in
+       (hole, slot] */
+    home = ((hkvs->Index[slot].Key * 0x9E3779B1U) >> 16) & (KVS_INDEX_SIZE - 1);
+    if(((slot - home) & (KVS_INDEX_SIZE - 1)) >= ((slot - hole) & (KVS_INDEX_SIZE - 1)))
+    {
+      hkvs->Index[hole] = hkvs->Index[slot];
+      hole = slot;
+    }
+  }
+  hkvs->Index[hole].Offset = 0;
+}
+
+/**
+  * @brief  Adds or removes a record to the live bytes of its sector
+  * @param  hkvs: store handle
+  * @param  Offset: record offset
+  * @param  Sign: 1 to add the record, -1 to remove it
+  * @retval None
+  */
+static void KVS_Account(KVS_HandleTypeDef *hkvs, uint32_t Offset, int32_t Sign)
+{
+  uint32_t size = KVS_RECORD_SIZE(KVS_LENGTH(KVS_WORD(hkvs, Offset)));
+  uint32_t sector = KVS_SectorOf(hkvs, Offset);
+
+  if(Sign > 0)
+  {
+    hkvs->LiveBytes[sector] += size;
+    hkvs->TotalLiveBytes += size;
+  }
+  else
+  {
+    hkvs->LiveBytes[sector] -= size;
+    hkvs->TotalLiveBytes -= size;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
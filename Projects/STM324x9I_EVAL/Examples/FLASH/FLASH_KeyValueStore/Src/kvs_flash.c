@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * @file    FLASH/FLASH_KeyValueStore/Src/kvs_flash.c
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Internal flash access of the key-value store, through the HAL
+  *          FLASH driver.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "kvs_flash.h"
+
+/** @addtogroup STM32F4xx_HAL_Examples
+  * @{
+  */
+
+/** @addtogroup FLASH_KeyValueStore
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static const KVS_SectorTypeDef aFlashSectors[KVS_FLASH_NB_SECTORS] =
+{
+  {ADDR_FLASH_SECTOR_12 - KVS_FLASH_BASE, 0x4000},
+  {ADDR_FLASH_SECTOR_13 - KVS_FLASH_BASE, 0x4000},
+  {ADDR_FLASH_SECTOR_14 - KVS_FLASH_BASE, 0x4000},
+};
+
+/* HAL sector number of each store sector */
+static const uint32_t aFlashSectorNumbers[KVS_FLASH_NB_SECTORS] =
+{
+  FLASH_SECTOR_12,
+  FLASH_SECTOR_13,
+  FLASH_SECTOR_14,
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static KVS_StatusTypeDef KVS_FlashErase(uint32_t Sector);
+static KVS_StatusTypeDef KVS_FlashProgram(uint32_t Offset, uint32_t Data);
+static void KVS_FlashCacheReset(void);
+
+/* Exported variables --------------------------------------------------------*/
+const KVS_DriverTypeDef KVS_FlashDriver =
+{
+  (const uint8_t *)KVS_FLASH_BASE,
+  KVS_FLASH_NB_SECTORS,
+  aFlashSectors,
+  KVS_FlashErase,
+  KVS_FlashProgram
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Erases a sector of the store
+  * @param  Sector: store sector
+  * @retval KVS status
+  */
+static KVS_StatusTypeDef KVS_FlashErase(uint32_t Sector)
+{
+  FLASH_EraseInitTypeDef EraseInitStruct;
+  uint32_t SectorError = 0;
+  HAL_StatusTypeDef status;
+
+  EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
+  EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+  EraseInitStruct.Sector = aFlashSectorNumbers[Sector];
+  EraseInitStruct.NbSectors = 1;
+
+  HAL_FLASH_Unlock();
+  status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
+  HAL_FLASH_Lock();
+
+  KVS_FlashCacheReset();
+
+  return (status == HAL_OK) ? KVS_OK : KVS_ERROR;
+}
+
+/**
+  * @brief  Programs a word of the store
+  * @param  Offset: word offset from KVS_FLASH_BASE
+  * @param  Data: word to program
+  * @retval KVS status
+  */
+static KVS_StatusTypeDef KVS_FlashProgram(uint32_t Offset, uint32_t Data)
+{
+  HAL_StatusTypeDef status;
+
+  HAL_FLASH_Unlock();
+  status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, KVS_FLASH_BASE + Offset, Data);
+  HAL_FLASH_Lock();
+
+  KVS_FlashCacheReset();
+
+  return (status == HAL_OK) ? KVS_OK : KVS_ERROR;
+}
+
+/**
+  * @brief  Drops the data cache lines of the store: the records are read
+  *         through the data cache right after they are programmed
+  * @param  None
+  * @retval None
+  */
+static void KVS_FlashCacheReset(void)
+{
+  if((FLASH->ACR & FLASH_ACR_DCEN) != 0)
+  {
+    __HAL_FLASH_DATA_CACHE_DISABLE();
+    __HAL_FLASH_DATA_CACHE_RESET();
+    __HAL_FLASH_DATA_CACHE_ENABLE();
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,245 @@
+/**
+  ******************************************************************************
+  * @file    FLASH/FLASH_KeyValueStore/Src/kvs_sim.c
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   RAM simulation of the flash sectors of a key-value store.
+  *
+  *          An erase sets the sector to 0xFF, a program can only clear bits
+  *          (the programmed word is ANDed with its content) as on the STM32F4
+  *          flash. KVS_SimPowerFail() interrupts the Nth next operation: a part
+  *          of the bits of the word are programmed or a part of the words of the
+  *          sector are erased, and all the operations fail until KVS_SimPowerOn().
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "kvs_sim.h"
+#include <string.h>
+
+/** @addtogroup STM32F4xx_HAL_Examples
+  * @{
+  */
+
+/** @addtogroup FLASH_KeyValueStore
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define KVS_SIM_WORDS          (KVS_SIM_SECTOR_SIZE / 4)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint32_t aSimFlash[KVS_SIM_NB_SECTORS * KVS_SIM_WORDS];
+static KVS_SimStatsTypeDef SimStats;
+static uint32_t SimCountdown = 0;
+static uint32_t SimPowerOff = 0;
+static uint32_t SimRandom = 1;
+
+static const KVS_SectorTypeDef aSimSectors[KVS_SIM_NB_SECTORS] =
+{
+  {0 * KVS_SIM_SECTOR_SIZE, KVS_SIM_SECTOR_SIZE},
+  {1 * KVS_SIM_SECTOR_SIZE, KVS_SIM_SECTOR_SIZE},
+  {2 * KVS_SIM_SECTOR_SIZE, KVS_SIM_SECTOR_SIZE},
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static KVS_StatusTypeDef KVS_SimErase(uint32_t Sector);
+static KVS_StatusTypeDef KVS_SimProgram(uint32_t Offset, uint32_t Data);
+static uint32_t KVS_SimInterrupt(void);
+
+/* Exported variables --------------------------------------------------------*/
+const KVS_DriverTypeDef KVS_SimDriver =
+{
+  (const uint8_t *)aSimFlash,
+  KVS_SIM_NB_SECTORS,
+  aSimSectors,
+  KVS_SimErase,
+  KVS_SimProgram
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Erases the simulated flash and clears the statistics
+  * @param  Seed: seed of the pseudo-random generator
+  * @retval None
+  */
+void KVS_SimInit(uint32_t Seed)
+{
+  memset(aSimFlash, 0xFF, sizeof(aSimFlash));
+  memset(&SimStats, 0, sizeof(SimStats));
+  SimCountdown = 0;
+  SimPowerOff = 0;
+  SimRandom = (Seed != 0) ? Seed : 1;
+}
+
+/**
+  * @brief  Interrupts a flash operation
+  * @param  NbOperations: number of operations completed before the power loss,
+  *         the next one is interrupted
+  * @retval None
+  */
+void KVS_SimPowerFail(uint32_t NbOperations)
+{
+  SimCountdown = NbOperations + 1;
+}
+
+/**
+  * @brief  Restores the power: the flash operations succeed again
+  * @param  None
+  * @retval None
+  */
+void KVS_SimPowerOn(void)
+{
+  SimCountdown = 0;
+  SimPowerOff = 0;
+}
+
+/**
+  * @brief  Pseudo-random generator of the simulation (LCG)
+  * @param  None
+  * @retval 16-bit random number
+  */
+uint32_t KVS_SimRandom(void)
+{
+  SimRandom = (SimRandom * 1103515245U) + 12345U;
+
+  return (SimRandom >> 16) & 0xFFFF;
+}
+
+/**
+  * @brief  Returns the statistics of the simulated flash
+  * @param  pStats: statistics
+  * @retval None
+  */
+void KVS_SimGetStats(KVS_SimStatsTypeDef *pStats)
+{
+  *pStats = SimStats;
+}
+
+/**
+  * @brief  Erases a simulated sector
+  * @param  Sector: store sector
+  * @retval KVS status
+  */
+static KVS_StatusTypeDef KVS_SimErase(uint32_t Sector)
+{
+  uint32_t *psector = &aSimFlash[Sector * KVS_SIM_WORDS];
+  uint32_t index;
+
+  if((Sector >= KVS_SIM_NB_SECTORS) || (SimPowerOff != 0))
+  {
+    return KVS_ERROR;
+  }
+
+  if(KVS_SimInterrupt() != 0)
+  {
+    /* Interrupted erase: a part of the words is erased */
+    for(index = 0; index < KVS_SIM_WORDS; index++)
+    {
+      if((KVS_SimRandom() & 1) != 0)
+      {
+        psector[index] = 0xFFFFFFFF;
+      }
+    }
+    return KVS_ERROR;
+  }
+
+  memset(psector, 0xFF, KVS_SIM_SECTOR_SIZE);
+  SimStats.Erases++;
+  SimStats.EraseCount[Sector]++;
+
+  return KVS_OK;
+}
+
+/**
+  * @brief  Programs a word of the simulated flash
+  * @param  Offset: word offset
+  * @param  Data: word to program
+  * @retval KVS status
+  */
+static KVS_StatusTypeDef KVS_SimProgram(uint32_t Offset, uint32_t Data)
+{
+  uint32_t *pword = &aSimFlash[Offset / 4];
+
+  if((Offset >= sizeof(aSimFlash)) || ((Offset & 3) != 0) || (SimPowerOff != 0))
+  {
+    return KVS_ERROR;
+  }
+
+  if(KVS_SimInterrupt() != 0)
+  {
+    /* Interrupted program: a part of the bits is cleared */
+    *pword &= Data | (KVS_SimRandom() << 16) | KVS_SimRandom();
+    return KVS_ERROR;
+  }
+
+  if((*pword & Data) != Data)
+  {
+    SimStats.Overwrites++;
+  }
+  *pword &= Data;
+  SimStats.Programs++;
+
+  return KVS_OK;
+}
+
+/**
+  * @brief  Counts down the operations until the power loss
+  * @param  None
+  * @retval 1 if the current operation is interrupted
+  */
+static uint32_t KVS_SimInterrupt(void)
+{
+  if(SimCountdown != 0)
+  {
+    SimCountdown--;
+    if(SimCountdown == 0)
+    {
+      SimPowerOff = 1;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,431 @@
+/**
+  ******************************************************************************
+  * @file    FLASH/FLASH_KeyValueStore/Src/main.c 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   This example shows how to keep key-value records in the internal
+  *          FLASH with a wear-levelled log-structured store.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "kvs_flash.h"
+#include "kvs_sim.h"
+#include <string.h>
+
+/** @addtogroup STM32F4xx_HAL_Examples
+  * @{
+  */
+
+/** @addtogroup FLASH_KeyValueStore
+  * @{
+  */ 
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Keys of the store kept in the FLASH sectors 12 to 14 */
+#define KEY_BOOT_COUNT          ((uint16_t)0x0001)
+#define KEY_SETTINGS            ((uint16_t)0x0002)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Store kept in the internal FLASH and store of the RAM simulation */
+static KVS_HandleTypeDef FlashStore;
+static KVS_HandleTypeDef SimStore;
+
+static uint8_t aValue[BENCH_VALUE_SIZE];
+static uint8_t aRead[BENCH_VALUE_SIZE];
+static uint8_t aShadow[BENCH_CHECK_KEYS][BENCH_VALUE_SIZE];
+
+/* Number of resets of the board, kept in the FLASH store */
+uint32_t uwBootCount = 0;
+
+/* KVS_Set() and KVS_Get() durations on the FLASH store in core cycles */
+uint32_t uwFlashSetCycles = 0;
+uint32_t uwFlashGetCycles = 0;
+
+/* Results, to be read with the debugger: one entry per number of keys written
+   in the simulated sectors */
+BenchResultTypeDef aBenchResults[BENCH_NB_RUNS];
+
+/* Power losses simulated and values found corrupted after them */
+uint32_t uwPowerFails = 0;
+uint32_t uwPowerFailErrors = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SystemClock_Config(void);
+static void Flash_Run(void);
+static void Bench_Run(void);
+static void Bench_Wear(BenchResultTypeDef *pResult, uint32_t NbKeys);
+static void Bench_PowerFail(void);
+static void Bench_Value(uint32_t Key, uint32_t Version);
+static void Error_Handler(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval None
+  */
+int main(void)
+{
+  /* STM32F4xx HAL library initialization:
+       - Configure the Flash prefetch, instruction and Data caches
+       - Configure the Systick to generate an interrupt each 1 msec
+       - Set NVIC Group Priority to 4
+       - Global MSP (MCU Support Package) initialization
+     */
+  HAL_Init();
+  
+  /* Configure the system clock to 180 MHz */
+  SystemClock_Config();     
+  
+  /* Configure LED1, LED2 and LED3 */
+  BSP_LED_Init(LED1);
+  BSP_LED_Init(LED2);
+  BSP_LED_Init(LED3);
+
+  /* Enable the cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  /* Update the boot counter kept in the internal FLASH */
+  Flash_Run();
+
+  /* Measure the write amplification and the wear levelling, then check the
+     recovery from power losses, on the simulated sectors */
+  Bench_Run();
+  Bench_PowerFail();
+
+  if(uwPowerFailErrors == 0)
+  {
+    /* No error detected. Switch on LED1 */
+    BSP_LED_On(LED1);
+  }
+  else
+  {
+    /* Value corrupted by a power loss. Switch on LED2 */
+    BSP_LED_On(LED2);
+  }
+
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+
+/**
+  * @brief  Mounts the FLASH store, increments the boot counter and measures a
+  *         KVS_Set() and a KVS_Get()
+  * @param  None
+  * @retval None
+  */
+static void Flash_Run(void)
+{
+  uint32_t start = 0, length = 0;
+
+  /* The store is formatted at the first run */
+  if(KVS_Init(&FlashStore, &KVS_FlashDriver) != KVS_OK)
+  {
+    Error_Handler();
+  }
+
+  if(KVS_Get(&FlashStore, KEY_BOOT_COUNT, &uwBootCount, sizeof(uwBootCount), &length) != KVS_OK)
+  {
+    uwBootCount = 0;
+  }
+  uwBootCount++;
+
+  start = DWT->CYCCNT;
+  if(KVS_Set(&FlashStore, KEY_BOOT_COUNT, &uwBootCount, sizeof(uwBootCount)) != KVS_OK)
+  {
+    Error_Handler();
+  }
+  uwFlashSetCycles = DWT->CYCCNT - start;
+
+  /* Unchanged value: nothing is programmed */
+  Bench_Value(KEY_SETTINGS, 0);
+  if(KVS_Set(&FlashStore, KEY_SETTINGS, aValue, sizeof(aValue)) != KVS_OK)
+  {
+    Error_Handler();
+  }
+
+  start = DWT->CYCCNT;
+  if(KVS_Get(&FlashStore, KEY_SETTINGS, aValue, sizeof(aValue), &length) != KVS_OK)
+  {
+    Error_Handler();
+  }
+  uwFlashGetCycles = DWT->CYCCNT - start;
+}
+
+/**
+  * @brief  Runs the write amplification benchmark for increasing numbers of keys
+  * @param  None
+  * @retval None
+  */
+static void Bench_Run(void)
+{
+  uint32_t index = 0;
+
+  for(index = 0; index < BENCH_NB_RUNS; index++)
+  {
+    Bench_Wear(&aBenchResults[index], BENCH_MIN_KEYS << index);
+  }
+}
+
+/**
+  * @brief  Writes BENCH_NB_WRITES values in the simulated sectors: 3/4 of the
+  *         writes update 1/8 of the keys
+  * @param  pResult: benchmark result
+  * @param  NbKeys: number of keys
+  * @retval None
+  */
+static void Bench_Wear(BenchResultTypeDef *pResult, uint32_t NbKeys)
+{
+  KVS_StatsTypeDef stats;
+  uint32_t write = 0, key = 0, start = 0, length = 0;
+
+  KVS_SimInit(NbKeys);
+  if(KVS_Init(&SimStore, &KVS_SimDriver) != KVS_OK)
+  {
+    Error_Handler();
+  }
+
+  for(write = 0; write < BENCH_NB_WRITES; write++)
+  {
+    key = KVS_SimRandom();
+    key = ((key & 3) != 0) ? ((key >> 2) % (NbKeys / 8)) : ((key >> 2) % NbKeys);
+    Bench_Value(key, write);
+    if(KVS_Set(&SimStore, (uint16_t)key, aValue, sizeof(aValue)) != KVS_OK)
+    {
+      Error_Handler();
+    }
+  }
+
+  /* The index lookup does not depend on the number of keys */
+  start = DWT->CYCCNT;
+  for(key = 0; key < NbKeys; key++)
+  {
+    KVS_Get(&SimStore, (uint16_t)key, aValue, sizeof(aValue), &length);
+  }
+
+  pResult->GetCycles = (DWT->CYCCNT - start) / NbKeys;
+
+  KVS_GetStats(&SimStore, &stats);
+  pResult->NbKeys = NbKeys;
+  pResult->UserBytes = stats.UserBytes;
+  pResult->ProgrammedBytes = stats.ProgrammedBytes;
+  pResult->WriteAmplification = (uint32_t)(((uint64_t)stats.ProgrammedBytes * 100) / stats.UserBytes);
+  pResult->MinEraseCount = stats.MinEraseCount;
+  pResult->MaxEraseCount = stats.MaxEraseCount;
+}
+
+/**
+  * @brief  Interrupts KVS_Set() at random flash operations and checks that the
+  *         store found at the next KVS_Init() holds the previous or the new value
+  *         of the key, and the last value of the other keys
+  * @param  None
+  * @retval None
+  */
+static void Bench_PowerFail(void)
+{
+  uint32_t run = 0, key = 0, length = 0;
+  KVS_StatusTypeDef status;
+
+  KVS_SimInit(1);
+  if(KVS_Init(&SimStore, &KVS_SimDriver) != KVS_OK)
+  {
+    Error_Handler();
+  }
+
+  for(key = 0; key < BENCH_CHECK_KEYS; key++)
+  {
+    Bench_Value(key, 0);
+    memcpy(aShadow[key], aValue, sizeof(aValue));
+    if(KVS_Set(&SimStore, (uint16_t)key, aValue, sizeof(aValue)) != KVS_OK)
+    {
+      Error_Handler();
+    }
+  }
+
+  for(run = 1; run <= BENCH_NB_POWER_FAILS; run++)
+  {
+    key = KVS_SimRandom() % BENCH_CHECK_KEYS;
+    Bench_Value(key, run);
+
+    /* The power is lost during the update, the store is mounted again */
+    KVS_SimPowerFail(KVS_SimRandom() % 16);
+    status = KVS_Set(&SimStore, (uint16_t)key, aValue, sizeof(aValue));
+    KVS_SimPowerOn();
+    uwPowerFails += (status != KVS_OK) ? 1 : 0;
+
+    if(KVS_Init(&SimStore, &KVS_SimDriver) != KVS_OK)
+    {
+      Error_Handler();
+    }
+
+    /* The new value is kept when its record was committed */
+    if((KVS_Get(&SimStore, (uint16_t)key, aRead, sizeof(aRead), &length) == KVS_OK) &&
+       (memcmp(aRead, aValue, sizeof(aValue)) == 0))
+    {
+      memcpy(aShadow[key], aValue, sizeof(aValue));
+    }
+
+    for(key = 0; key < BENCH_CHECK_KEYS; key++)
+    {
+      if((KVS_Get(&SimStore, (uint16_t)key, aRead, sizeof(aRead), &length) != KVS_OK) ||
+         (memcmp(aRead, aShadow[key], sizeof(aRead)) != 0))
+      {
+        uwPowerFailErrors++;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Fills aValue with a pattern depending on a key and a version
+  * @param  Key: key
+  * @param  Version: version of the value
+  * @retval None
+  */
+static void Bench_Value(uint32_t Key, uint32_t Version)
+{
+  uint32_t index = 0;
+
+  for(index = 0; index < BENCH_VALUE_SIZE; index++)
+  {
+    aValue[index] = (uint8_t)((Key * 31) + (Version * 7) + index);
+  }
+}
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @param  None
+  * @retval None
+  */
+static void Error_Handler(void)
+{
+  /* Turn LED3 on */
+  BSP_LED_On(LED3);
+  while(1)
+  {
+  }
+}
+
+/**
+  * @brief  System Clock Configuration
+  *         The system Clock is configured as follow : 
+  *            System Clock source            = PLL (HSE)
+  *            SYSCLK(Hz)                     = 180000000
+  *            HCLK(Hz)                       = 180000000
+  *            AHB Prescaler                  = 1
+  *            APB1 Prescaler                 = 4
+  *            APB2 Prescaler                 = 2
+  *            HSE Frequency(Hz)              = 25000000
+  *            PLL_M                          = 25
+  *            PLL_N                          = 360
+  *            PLL_P                          = 2
+  *            PLL_Q                          = 7
+  *            VDD(V)                         = 3.3
+  *            Main regulator output voltage  = Scale1 mode
+  *            Flash Latency(WS)              = 5
+  * @param  None
+  * @retval None
+  */
+static void SystemClock_Config(void)
+{
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+
+  /* Enable Power Control clock */
+  __HAL_RCC_PWR_CLK_ENABLE();
+
+  /* The voltage scaling allows optimizing the power consumption when the device is 
+     clocked below the maximum system frequency, to update the voltage scaling value 
+     regarding system frequency refer to product datasheet.  */
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+  /* Enable HSE Oscillator and activate PLL with HSE as source */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+  RCC_OscInitStruct.PLL.PLLM = 25;
+  RCC_OscInitStruct.PLL.PLLN = 360;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+  RCC_OscInitStruct.PLL.PLLQ = 7;
+  HAL_RCC_OscConfig(&RCC_OscInitStruct);
+  
+  /* Activate the Over-Drive mode */
+  HAL_PWREx_EnableOverDrive();
+  
+  /* Select PLL as system clock source and configure the HCLK, PCLK1 and PCLK2 
+     clocks dividers */
+  RCC_ClkInitStruct.ClockType = (RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2);
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;  
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;  
+  HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5);
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t* file, uint32_t line)
+{ 
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+#endif
+
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * @file    HASH/HASH_SHA256_MultiContext/Inc/main.h 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Header for main.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+  
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MAIN_H
+#define __MAIN_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+#include "stm324x9i_eval.h"
+#include "string.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Size;        /* Message size in bytes                         */
+  uint32_t SwCycles;    /* Software digest duration in core cycles       */
+  uint32_t CpuCycles;   /* CPU fed HASH digest duration in core cycles   */
+  uint32_t DmaCycles;   /* DMA fed HASH digest duration in core cycles   */
+  uint32_t SwMBps;      /* Software throughput in hundredths of MB/s     */
+  uint32_t CpuMBps;     /* CPU fed HASH throughput in hundredths of MB/s */
+  uint32_t DmaMBps;     /* DMA fed HASH throughput in hundredths of MB/s */
+}BenchResultTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define DMA_CLK_ENABLE()               __HAL_RCC_DMA2_CLK_ENABLE()
+
+/* Definition for HASH's DMA */
+#define HASH_DMA_CHANNEL                DMA_CHANNEL_2
+#define HASH_DMA_STREAM                 DMA2_Stream7
+
+/* Definition for DMA's NVIC */
+#define HASH_DMA_IRQn                   DMA2_Stream7_IRQn
+#define HASH_DMA_IRQHandler             DMA2_Stream7_IRQHandler
+
+/* Firmware image digested by DMA, in chunks interleaved with records */
+#define FW_ADDRESS                      FLASH_BASE
+#define FW_SIZE                         ((uint32_t)0x10000)
+#define FW_CHUNK_SIZE                   ((uint32_t)0x800)
+#define RECORD_SIZE                     ((uint32_t)301)
+
+/* Message sizes from BENCH_MIN_SIZE to BENCH_MAX_SIZE bytes, doubled at each step */
+#define BENCH_MIN_SIZE                  64
+#define BENCH_NB_SIZES                  9
+#define BENCH_MAX_SIZE                  (BENCH_MIN_SIZE << (BENCH_NB_SIZES - 1))
+
+/* Number of digests averaged for each size, and of updates for the context switch */
+#define BENCH_NB_RUNS                   8
+#define BENCH_NB_SWITCHES               64
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+
+#endif /* __MAIN_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
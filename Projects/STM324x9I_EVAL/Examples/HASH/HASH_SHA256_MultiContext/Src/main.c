@@ -0,0 +1,443 @@
+/**
+  ******************************************************************************
+  * @file    HASH/HASH_SHA256_MultiContext/Src/main.c 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   This example shows how to interleave SHA256 and HMAC SHA256
+  *          digests with the HASH contexts and measures their throughput.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/** @addtogroup STM32F4xx_HAL_Examples
+  * @{
+  */
+
+/** @addtogroup HASH_SHA256_MultiContext
+  * @{
+  */ 
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Throughput in hundredths of MB/s of Size bytes processed in Cycles core cycles */
+#define BENCH_MBPS(Size, Cycles)  (((Size) * 100 * (SystemCoreClock / 1000000)) / (Cycles))
+
+/* Private variables ---------------------------------------------------------*/
+/* HASH handler declaration */
+HASH_HandleTypeDef     HashHandle;
+
+/* Firmware image digest, fed by DMA, and record HMAC, fed by the CPU */
+static HASH_ContextTypeDef FwContext;
+static HASH_ContextTypeDef RecordContext;
+
+/* Same digests computed by software, used as reference */
+static HASH_ContextTypeDef FwSwContext;
+static HASH_ContextTypeDef RecordSwContext;
+
+static __IO uint32_t InputDone = 0;
+
+static uint8_t aHmacKey[] = "STM32F439 HMAC SHA256 record key";
+
+/* Record carried between two firmware chunks, its length is not a multiple of
+   a word so that the contexts keep an incomplete word between updates */
+__ALIGN_BEGIN static uint8_t aRecord[RECORD_SIZE] __ALIGN_END;
+
+__ALIGN_BEGIN static uint8_t aFwDigest[32] __ALIGN_END;
+__ALIGN_BEGIN static uint8_t aFwSwDigest[32] __ALIGN_END;
+__ALIGN_BEGIN static uint8_t aRecordDigest[32] __ALIGN_END;
+__ALIGN_BEGIN static uint8_t aRecordSwDigest[32] __ALIGN_END;
+
+__ALIGN_BEGIN static uint8_t aBenchBuffer[BENCH_MAX_SIZE] __ALIGN_END;
+
+/* Results, to be read with the debugger: one entry per message size, with the
+   durations in core clock cycles and the throughputs in hundredths of MB/s */
+BenchResultTypeDef aBenchResults[BENCH_NB_SIZES];
+
+/* Extra core clock cycles taken by an update when the HASH peripheral holds
+   another context, i.e. the cost of a context save and restore */
+uint32_t uwSwitchCycles = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SystemClock_Config(void);
+static void Error_Handler(void);
+static void Interleave_Run(void);
+static void Bench_Run(void);
+static uint32_t Bench_Digest(HASH_HandleTypeDef *hhash, uint32_t Size, uint32_t UseDMA);
+static uint32_t Bench_Updates(uint32_t NbContexts);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval None
+  */
+int main(void)
+{
+  /* STM32F4xx HAL library initialization:
+       - Configure the Flash prefetch, instruction and Data caches
+       - Configure the Systick to generate an interrupt each 1 msec
+       - Set NVIC Group Priority to 4
+       - Global MSP (MCU Support Package) initialization
+     */
+  HAL_Init();
+  
+  /* Configure the system clock to 180 MHz */
+  SystemClock_Config();
+  
+  /* Configure LED1, LED3 and LED4 */
+  BSP_LED_Init(LED1);
+  BSP_LED_Init(LED3);
+  BSP_LED_Init(LED4);
+  
+  HAL_HASH_DeInit(&HashHandle);
+  HashHandle.Init.DataType = HASH_DATATYPE_8B;
+  
+  if(HAL_HASH_Init(&HashHandle) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /*##-1- Interleave a firmware digest and a record HMAC #####################*/
+  Interleave_Run();
+
+  /* Turn LED1 on: interleaved digests equal to the software ones */
+  BSP_LED_On(LED1);
+
+  /*##-2- Measure the software, CPU fed and DMA fed throughputs ##############*/
+  Bench_Run();
+
+  /* Turn LED4 on: measurements done */
+  BSP_LED_On(LED4);
+
+  while(1)
+  {
+  }
+}
+
+/**
+  * @brief  Computes the SHA256 digest of the beginning of the flash memory
+  *         by DMA while an HMAC SHA256 digest of records is computed by the
+  *         CPU, each firmware chunk being followed by a record.
+  * @param  None
+  * @retval None
+  */
+static void Interleave_Run(void)
+{
+  uint32_t offset = 0, index = 0;
+  uint8_t *pfw = (uint8_t *)FW_ADDRESS;
+
+  HAL_HASHEx_ContextInit(&FwContext, HASH_ALGOSELECTION_SHA256, NULL, 0);
+  HAL_HASHEx_ContextInit(&FwSwContext, HASH_ALGOSELECTION_SHA256, NULL, 0);
+  HAL_HASHEx_ContextInit(&RecordContext, HASH_ALGOSELECTION_SHA256, aHmacKey, sizeof(aHmacKey) - 1);
+  HAL_HASHEx_ContextInit(&RecordSwContext, HASH_ALGOSELECTION_SHA256, aHmacKey, sizeof(aHmacKey) - 1);
+
+  for(offset = 0; offset < FW_SIZE; offset += FW_CHUNK_SIZE)
+  {
+    /* The firmware chunk is transferred by DMA ... */
+    InputDone = 0;
+    if(HAL_HASHEx_ContextUpdate_DMA(&HashHandle, &FwContext, pfw + offset, FW_CHUNK_SIZE) != HAL_OK)
+    {
+      Error_Handler();
+    }
+
+    /* ... while the CPU prepares the next record and computes the references */
+    for(index = 0; index < RECORD_SIZE; index++)
+    {
+      aRecord[index] = (uint8_t)(offset + index);
+    }
+    HAL_HASHEx_ContextUpdate(NULL, &FwSwContext, pfw + offset, FW_CHUNK_SIZE);
+    HAL_HASHEx_ContextUpdate(NULL, &RecordSwContext, aRecord, RECORD_SIZE);
+
+    while(InputDone == 0)
+    {
+    }
+
+    /* The record update saves the firmware context and starts the HMAC one */
+    if(HAL_HASHEx_ContextUpdate(&HashHandle, &RecordContext, aRecord, RECORD_SIZE) != HAL_OK)
+    {
+      Error_Handler();
+    }
+  }
+
+  if((HAL_HASHEx_ContextFinish(&HashHandle, &FwContext, aFwDigest, 0xFF) != HAL_OK) ||
+     (HAL_HASHEx_ContextFinish(&HashHandle, &RecordContext, aRecordDigest, 0xFF) != HAL_OK))
+  {
+    Error_Handler();
+  }
+  HAL_HASHEx_ContextFinish(NULL, &FwSwContext, aFwSwDigest, 0);
+  HAL_HASHEx_ContextFinish(NULL, &RecordSwContext, aRecordSwDigest, 0);
+
+  if((memcmp(aFwDigest, aFwSwDigest, sizeof(aFwDigest)) != 0) ||
+     (memcmp(aRecordDigest, aRecordSwDigest, sizeof(aRecordDigest)) != 0))
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Measures the SHA256 throughput for increasing message sizes and
+  *         the cost of a context switch.
+  * @param  None
+  * @retval None
+  */
+static void Bench_Run(void)
+{
+  uint32_t index = 0, size = BENCH_MIN_SIZE;
+  uint32_t single = 0, alternate = 0;
+
+  /* Enable the cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for(index = 0; index < BENCH_MAX_SIZE; index++)
+  {
+    aBenchBuffer[index] = (uint8_t)(index * 7);
+  }
+
+  for(index = 0; index < BENCH_NB_SIZES; index++, size <<= 1)
+  {
+    aBenchResults[index].Size = size;
+    aBenchResults[index].SwCycles = Bench_Digest(NULL, size, 0);
+    aBenchResults[index].CpuCycles = Bench_Digest(&HashHandle, size, 0);
+    aBenchResults[index].DmaCycles = Bench_Digest(&HashHandle, size, 1);
+    aBenchResults[index].SwMBps = BENCH_MBPS(size, aBenchResults[index].SwCycles);
+    aBenchResults[index].CpuMBps = BENCH_MBPS(size, aBenchResults[index].CpuCycles);
+    aBenchResults[index].DmaMBps = BENCH_MBPS(size, aBenchResults[index].DmaCycles);
+  }
+
+  single = Bench_Updates(1);
+  alternate = Bench_Updates(2);
+  uwSwitchCycles = (alternate > single) ? (alternate - single) : 0;
+}
+
+/**
+  * @brief  Measures a complete SHA256 digest computation.
+  * @param  hhash: HASH handle, NULL for the software computation
+  * @param  Size: message size in bytes
+  * @param  UseDMA: 1 to feed the message with the input DMA
+  * @retval Average number of core clock cycles
+  */
+static uint32_t Bench_Digest(HASH_HandleTypeDef *hhash, uint32_t Size, uint32_t UseDMA)
+{
+  uint32_t run = 0, start = 0, cycles = 0;
+
+  for(run = 0; run < BENCH_NB_RUNS; run++)
+  {
+    start = DWT->CYCCNT;
+    HAL_HASHEx_ContextInit(&FwContext, HASH_ALGOSELECTION_SHA256, NULL, 0);
+    if(UseDMA != 0)
+    {
+      InputDone = 0;
+      if(HAL_HASHEx_ContextUpdate_DMA(hhash, &FwContext, aBenchBuffer, Size) != HAL_OK)
+      {
+        Error_Handler();
+      }
+      while(InputDone == 0)
+      {
+      }
+    }
+    else if(HAL_HASHEx_ContextUpdate(hhash, &FwContext, aBenchBuffer, Size) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    if(HAL_HASHEx_ContextFinish(hhash, &FwContext, aFwDigest, 0xFF) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    cycles += DWT->CYCCNT - start;
+  }
+
+  return cycles / BENCH_NB_RUNS;
+}
+
+/**
+  * @brief  Measures block sized CPU updates spread over one or two contexts.
+  * @param  NbContexts: 1 to keep the same context loaded, 2 to alternate the
+  *         updates between two contexts, each update then switching context
+  * @retval Average number of core clock cycles per update
+  */
+static uint32_t Bench_Updates(uint32_t NbContexts)
+{
+  uint32_t run = 0, start = 0, cycles = 0;
+  HASH_ContextTypeDef *pcontext = NULL;
+
+  HAL_HASHEx_ContextInit(&FwContext, HASH_ALGOSELECTION_SHA256, NULL, 0);
+  HAL_HASHEx_ContextInit(&RecordContext, HASH_ALGOSELECTION_SHA256, NULL, 0);
+
+  for(run = 0; run < BENCH_NB_SWITCHES; run++)
+  {
+    pcontext = ((NbContexts == 2) && ((run & 1) != 0)) ? &RecordContext : &FwContext;
+
+    start = DWT->CYCCNT;
+    if(HAL_HASHEx_ContextUpdate(&HashHandle, pcontext, aBenchBuffer, HASH_CONTEXT_BLOCK_SIZE) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    cycles += DWT->CYCCNT - start;
+  }
+
+  if(HAL_HASHEx_ContextFinish(&HashHandle, &FwContext, aFwDigest, 0xFF) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if((NbContexts == 2) && (HAL_HASHEx_ContextFinish(&HashHandle, &RecordContext, aRecordDigest, 0xFF) != HAL_OK))
+  {
+    Error_Handler();
+  }
+
+  return cycles / BENCH_NB_SWITCHES;
+}
+
+/**
+  * @brief  Input data transfer complete callback.
+  * @param  hhash: HASH handle
+  * @retval None
+  */
+void HAL_HASH_InCpltCallback(HASH_HandleTypeDef *hhash)
+{
+  InputDone = 1;
+}
+
+/**
+  * @brief  HASH error callback.
+  * @param  hhash: HASH handle
+  * @retval None
+  */
+void HAL_HASH_ErrorCallback(HASH_HandleTypeDef *hhash)
+{
+  Error_Handler();
+}
+
+/**
+  * @brief  System Clock Configuration
+  *         The system Clock is configured as follow : 
+  *            System Clock source            = PLL (HSE)
+  *            SYSCLK(Hz)                     = 180000000
+  *            HCLK(Hz)                       = 180000000
+  *            AHB Prescaler                  = 1
+  *            APB1 Prescaler                 = 4
+  *            APB2 Prescaler                 = 2
+  *            HSE Frequency(Hz)              = 25000000
+  *            PLL_M                          = 25
+  *            PLL_N                          = 360
+  *            PLL_P                          = 2
+  *            PLL_Q                          = 7
+  *            VDD(V)                         = 3.3
+  *            Main regulator output voltage  = Scale1 mode
+  *            Flash Latency(WS)              = 5
+  * @param  None
+  * @retval None
+  */
+static void SystemClock_Config(void)
+{
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+
+  /* Enable Power Control clock */
+  __HAL_RCC_PWR_CLK_ENABLE();
+
+  /* The voltage scaling allows optimizing the power consumption when the device is 
+     clocked below the maximum system frequency, to update the voltage scaling value 
+     regarding system frequency refer to product datasheet.  */
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+  /* Enable HSE Oscillator and activate PLL with HSE as source */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+  RCC_OscInitStruct.PLL.PLLM = 25;
+  RCC_OscInitStruct.PLL.PLLN = 360;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+  RCC_OscInitStruct.PLL.PLLQ = 7;
+  HAL_RCC_OscConfig(&RCC_OscInitStruct);
+
+  /* Activate the Over-Drive mode */
+  HAL_PWREx_EnableOverDrive();
+      
+  /* Select PLL as system clock source and configure the HCLK, PCLK1 and PCLK2 
+     clocks dividers */
+  RCC_ClkInitStruct.ClockType = (RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2);
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;  
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;  
+  HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5);
+}
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @param  None
+  * @retval None
+  */
+static void Error_Handler(void)
+{
+  /* Turn LED3 on */
+  BSP_LED_On(LED3);
+  while(1)
+  {
+  }
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t* file, uint32_t line)
+{ 
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+#endif
+
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -36,6 +36,7 @@
 #include <stdint.h>
 #include <string.h>
 #include "jpeglib.h"
+#include "jdct_cmsis.h"
 
 /* EVAL includes component */
 #include "stm324xg_eval.h"
@@ -57,6 +58,10 @@ typedef struct RGB
 }RGB_typedef;
 
 /* Exported constants --------------------------------------------------------*/
+/* DCT method used by the codec: JDCT_ISLOW, JDCT_IFAST, JDCT_FLOAT or 
+   JDCT_CMSIS (see jdct_cmsis.h) */
+#define JPEG_DCT_METHOD  JDCT_CMSIS
+
 #define IMAGE_HEIGHT 240
 #define IMAGE_WIDTH  320
 
@@ -37,6 +37,9 @@
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Time spent decoding the last image, in ms, output callback excluded */
+uint32_t JpegDecodeTime = 0;
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -54,8 +57,11 @@ void jpeg_decode(FIL *file, uint32_t width, uint8_t * buff, uint8_t (*callback)(
   /* Decode JPEG Image */
   JSAMPROW buffer[2] = {0}; /* Output row buffer */
   uint32_t row_stride = 0; /* physical row width in image buffer */
+  uint32_t tickstart = 0, tick = 0, callbacktime = 0;
   
   buffer[0] = buff;
+
+  tickstart = HAL_GetTick();
 	
   /* Step 1: allocate and initialize JPEG decompression object */
   cinfo.err = jpeg_std_error(&jerr);
@@ -69,20 +75,27 @@ void jpeg_decode(FIL *file, uint32_t width, uint8_t * buff, uint8_t (*callback)(
   jpeg_read_header(&cinfo, TRUE);
 
   /* Step 4: set parameters for decompression */
-  cinfo.dct_method = JDCT_FLOAT;
+  cinfo.dct_method = (JPEG_DCT_METHOD == JDCT_CMSIS) ? JDCT_ISLOW : JPEG_DCT_METHOD;
 
   /* Step 5: start decompressor */
   jpeg_start_decompress(&cinfo);
 
+  if (JPEG_DCT_METHOD == JDCT_CMSIS)
+  {
+    jpeg_cmsis_idct_enable(&cinfo);
+  }
+
   row_stride = width * 3;
   while (cinfo.output_scanline < cinfo.output_height)
   {
     (void) jpeg_read_scanlines(&cinfo, buffer, 1);
     
+    tick = HAL_GetTick();
     if (callback(buffer[0], row_stride) != 0)
     {
       break;
     }
+    callbacktime += HAL_GetTick() - tick;
   }
 
   /* Step 6: Finish decompression */
@@ -90,6 +103,8 @@ void jpeg_decode(FIL *file, uint32_t width, uint8_t * buff, uint8_t (*callback)(
 
   /* Step 7: Release JPEG decompression object */
   jpeg_destroy_decompress(&cinfo);
+
+  JpegDecodeTime = HAL_GetTick() - tickstart - callbacktime;
     
 }
 
@@ -37,6 +37,9 @@
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Time spent encoding the last image, in ms, bmp file reads excluded */
+uint32_t JpegEncodeTime = 0;
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -57,7 +60,11 @@ void jpeg_encode(FIL *file, FIL *file1, uint32_t width, uint32_t height, uint32_
   /* Pointer to a single row */
   JSAMPROW row_pointer;    
   uint32_t bytesread;
+  uint32_t tickstart = 0, tick = 0, readtime = 0;
+  FRESULT res;
   
+  tickstart = HAL_GetTick();
+
   /* Step 1: allocate and initialize JPEG compression object */
   /* Set up the error handler */
   cinfo_.err = jpeg_std_error(&jerr_);
@@ -77,19 +84,27 @@ void jpeg_encode(FIL *file, FIL *file1, uint32_t width, uint32_t height, uint32_
   /* Set default compression parameters */
   jpeg_set_defaults(&cinfo_);
   
-  cinfo_.dct_method  = JDCT_FLOAT;    
+  cinfo_.dct_method = (JPEG_DCT_METHOD == JDCT_CMSIS) ? JDCT_ISLOW : JPEG_DCT_METHOD;    
   
   jpeg_set_quality(&cinfo_, image_quality, TRUE);
   
   /* Step 4: start compressor */
   jpeg_start_compress(&cinfo_, TRUE);
+
+  if (JPEG_DCT_METHOD == JDCT_CMSIS)
+  {
+    jpeg_cmsis_fdct_enable(&cinfo_);
+  }
   
   /* Bypass the header bmp file */
   f_read(file, buff, 54, (UINT*)&bytesread);
 
   while (cinfo_.next_scanline < cinfo_.image_height)
   {             
-    if(f_read(file, buff, width*3, (UINT*)&bytesread) == FR_OK)
+    tick = HAL_GetTick();
+    res = f_read(file, buff, width*3, (UINT*)&bytesread);
+    readtime += HAL_GetTick() - tick;
+    if(res == FR_OK)
     {
       row_pointer = (JSAMPROW)buff;
       jpeg_write_scanlines(&cinfo_, &row_pointer, 1);        
@@ -101,6 +116,8 @@ void jpeg_encode(FIL *file, FIL *file1, uint32_t width, uint32_t height, uint32_
   
   /* Step 6: release JPEG compression object */
   jpeg_destroy_compress(&cinfo_);
+
+  JpegEncodeTime = HAL_GetTick() - tickstart - readtime;
     
 }
 
@@ -30,11 +30,20 @@
 /* Exported constants --------------------------------------------------------*/
 #define USER_FLASH_SIZE   (USER_FLASH_END_ADDRESS - USER_FLASH_FIRST_PAGE_ADDRESS)
 
+/* Device voltage range, it sets the erase and programming parallelism.
+   FLASH_VOLTAGE_RANGE_3 (2.7V to 3.6V) programs by word; use 
+   FLASH_VOLTAGE_RANGE_4 (double word) only when an external Vpp is applied */
+#define FLASH_IF_VOLTAGE_RANGE   FLASH_VOLTAGE_RANGE_3
+
+/* Size in bytes of the block programmed at once, multiple of 8 */
+#define FLASH_IF_BUFFER_SIZE     ((uint32_t)512)
+
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
-uint32_t FLASH_If_Write(__IO uint32_t* Address, uint32_t* Data, uint16_t DataLength);
-int8_t FLASH_If_Erase(uint32_t StartSector);
 void FLASH_If_Init(void);
+uint32_t FLASH_If_WriterStart(uint32_t Address);
+uint32_t FLASH_If_WriterPush(uint8_t *pData, uint32_t Size);
+uint32_t FLASH_If_WriterFinish(uint32_t *pCrc);
 
 #endif /* __FLASH_IF_H */
 
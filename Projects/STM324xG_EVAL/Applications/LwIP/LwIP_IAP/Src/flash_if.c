@@ -5,7 +5,7 @@
   * @version V1.2.1
   * @date    13-March-2015
   * @brief   This file provides high level routines to manage internal Flash 
-  *          programming (erase and write). 
+  *          programming: buffered write with erase-ahead and CRC check. 
   ******************************************************************************
   * @attention
   *
@@ -22,12 +22,28 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "flash_if.h"
+#include <string.h>
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/* Programming unit of the voltage range: double word with Vpp, word otherwise */
+#define FLASH_IF_PROGRAM_UNIT  ((FLASH_IF_VOLTAGE_RANGE == FLASH_VOLTAGE_RANGE_4) ? 8 : 4)
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+static CRC_HandleTypeDef CrcHandle;
+
+static uint32_t WriterBuffer[FLASH_IF_BUFFER_SIZE / 4];
+static uint32_t WriterCount = 0;         /* Bytes waiting in WriterBuffer        */
+static uint32_t WriterAddress = 0;       /* Flash address of WriterBuffer        */
+static uint32_t WriterStartAddress = 0;  /* First flash address of the image     */
+static uint32_t WriterEraseEnd = 0;      /* End of the sectors erased so far     */
+static uint32_t WriterCrc = 0;           /* CRC of the data programmed so far    */
+static uint32_t WriterStatus = 0;        /* First error of the write sequence    */
+
 /* Private function prototypes -----------------------------------------------*/
+static uint32_t FLASH_If_GetSector(uint32_t Address, uint32_t *pSectorEnd);
+static uint32_t FLASH_If_WriterFlush(void);
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -42,77 +58,223 @@ void FLASH_If_Init(void)
 }
 
 /**
-  * @brief  This function does an erase of all user flash area
-  * @param  StartSector: start of user flash area
-  * @retval 0: user flash area successfully erased
-  *         1: error occurred
+  * @brief  Starts a flash write sequence. Nothing is erased at this point: each
+  *         sector is erased just before the first byte is programmed in it.
+  * @param  Address: start address of the image, at the beginning of a sector
+  *         and inside the user flash area
+  * @retval 0: write sequence started
+  *         1: address outside of the user flash area
   */
-int8_t FLASH_If_Erase(uint32_t StartSector)
+uint32_t FLASH_If_WriterStart(uint32_t Address)
 {
-  uint32_t FlashAddress;
- 
-  FlashAddress = StartSector;
-
-  /* Device voltage range supposed to be [2.7V to 3.6V], the operation will
-     be done by word */ 
- 
-  if (FlashAddress <= (uint32_t) USER_FLASH_LAST_PAGE_ADDRESS)
-  {
-    FLASH_EraseInitTypeDef FLASH_EraseInitStruct;
-    uint32_t sectornb = 0;
-    
-    FLASH_EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
-    FLASH_EraseInitStruct.Sector = FLASH_SECTOR_5;
-    FLASH_EraseInitStruct.NbSectors = 7;
-    FLASH_EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
-    
-    if (HAL_FLASHEx_Erase(&FLASH_EraseInitStruct, &sectornb) != HAL_OK)
-      return (1);
-  }
-  else
+  if ((Address < USER_FLASH_FIRST_PAGE_ADDRESS) || (Address > USER_FLASH_END_ADDRESS))
   {
+    WriterStatus = 1;
     return (1);
   }
 
+  FLASH_If_Init();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | 
+                         FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
+
+  /* The CRC unit accumulates the programmed data for the final verification */
+  __HAL_RCC_CRC_CLK_ENABLE();
+  CrcHandle.Instance = CRC;
+  HAL_CRC_Init(&CrcHandle);
+  __HAL_CRC_DR_RESET(&CrcHandle);
+  WriterCrc = CrcHandle.Instance->DR;
+
+  WriterStartAddress = Address;
+  WriterAddress = Address;
+  WriterEraseEnd = Address;
+  WriterCount = 0;
+  WriterStatus = 0;
+
   return (0);
 }
+
 /**
-  * @brief  This function writes a data buffer in flash (data are 32-bit aligned).
-  * @note   After writing data buffer, the flash content is checked.
-  * @param  FlashAddress: start address for writing data buffer
-  * @param  Data: pointer on data buffer
-  * @param  DataLength: length of data buffer (unit is 32-bit word)   
+  * @brief  Writes a byte stream in flash. The bytes are buffered and programmed
+  *         by FLASH_IF_BUFFER_SIZE blocks, so the data has no alignment or size
+  *         constraint.
+  * @param  pData: pointer on data buffer
+  * @param  Size: number of bytes to write
+  * @retval 0: data accepted
+  *         1: error occurred while erasing or programming the Flash memory,
+  *            the error is kept until the end of the write sequence
+  */
+uint32_t FLASH_If_WriterPush(uint8_t *pData, uint32_t Size)
+{
+  uint32_t length;
+
+  while ((Size != 0) && (WriterStatus == 0))
+  {
+    length = FLASH_IF_BUFFER_SIZE - WriterCount;
+    if (length > Size)
+    {
+      length = Size;
+    }
+
+    memcpy((uint8_t *)WriterBuffer + WriterCount, pData, length);
+    WriterCount += length;
+    pData += length;
+    Size -= length;
+
+    if (WriterCount == FLASH_IF_BUFFER_SIZE)
+    {
+      WriterStatus = FLASH_If_WriterFlush();
+    }
+  }
+
+  return WriterStatus;
+}
+
+/**
+  * @brief  Ends a flash write sequence: programs the buffered bytes (the last
+  *         programming unit is padded with 0xFF) then checks the CRC of the
+  *         flash content against the CRC of the data programmed.
+  * @param  pCrc: pointer on the CRC of the image, can be NULL
   * @retval 0: Data successfully written to Flash memory
   *         1: Error occurred while writing data in Flash memory
   *         2: Written Data in flash memory is different from expected one
   */
-uint32_t FLASH_If_Write(__IO uint32_t* FlashAddress, uint32_t* Data ,uint16_t DataLength)
+uint32_t FLASH_If_WriterFinish(uint32_t *pCrc)
 {
-  uint32_t i = 0;
+  if (WriterStatus == 0)
+  {
+    WriterStatus = FLASH_If_WriterFlush();
+  }
 
-  for (i = 0; (i < DataLength) && (*FlashAddress <= (USER_FLASH_END_ADDRESS-4)); i++)
+  if (WriterStatus == 0)
   {
-    /* Device voltage range supposed to be [2.7V to 3.6V], the operation will
-       be done by word */ 
-    if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, *FlashAddress,  *(uint32_t*)(Data+i)) == HAL_OK)
+    /* Drop the data cache lines loaded from the user area before its erase */
+    if ((FLASH->ACR & FLASH_ACR_DCEN) != 0)
     {
-     /* Check the written value */
-      if (*(uint32_t*)*FlashAddress != *(uint32_t*)(Data+i))
-      {
-        /* Flash content doesn't match SRAM content */
-        return(2);
-      }
-      /* Increment FLASH destination address */
-      *FlashAddress += 4;
+      __HAL_FLASH_DATA_CACHE_DISABLE();
+      __HAL_FLASH_DATA_CACHE_RESET();
+      __HAL_FLASH_DATA_CACHE_ENABLE();
     }
-    else
+
+    /* One pass over the flash content replaces the word by word read back */
+    if (HAL_CRC_Calculate(&CrcHandle, (uint32_t *)WriterStartAddress, 
+                          (WriterAddress - WriterStartAddress) / 4) != WriterCrc)
+    {
+      /* Flash content doesn't match SRAM content */
+      WriterStatus = 2;
+    }
+  }
+
+  if (pCrc != NULL)
+  {
+    *pCrc = WriterCrc;
+  }
+
+  HAL_FLASH_Lock();
+
+  return WriterStatus;
+}
+
+/**
+  * @brief  Programs the writer buffer, erasing the next sector when the buffer
+  *         crosses the end of the sectors already erased.
+  * @param  None
+  * @retval 0: buffer programmed
+  *         1: error occurred while erasing or programming the Flash memory
+  */
+static uint32_t FLASH_If_WriterFlush(void)
+{
+  FLASH_EraseInitTypeDef FLASH_EraseInitStruct;
+  uint32_t sectorerror = 0;
+  uint32_t sectorend = 0;
+
+  /* Pad the last programming unit with the erased value */
+  while ((WriterCount % FLASH_IF_PROGRAM_UNIT) != 0)
+  {
+    ((uint8_t *)WriterBuffer)[WriterCount++] = 0xFF;
+  }
+
+  if (WriterCount == 0)
+  {
+    return (0);
+  }
+
+  if ((WriterAddress + WriterCount - 1) > USER_FLASH_END_ADDRESS)
+  {
+    return (1);
+  }
+
+  /* Erase the sectors just ahead of the write pointer */
+  while ((WriterAddress + WriterCount) > WriterEraseEnd)
+  {
+    FLASH_EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
+    FLASH_EraseInitStruct.Sector = FLASH_If_GetSector(WriterEraseEnd, &sectorend);
+    FLASH_EraseInitStruct.NbSectors = 1;
+    FLASH_EraseInitStruct.VoltageRange = FLASH_IF_VOLTAGE_RANGE;
+
+    if (HAL_FLASHEx_Erase(&FLASH_EraseInitStruct, &sectorerror) != HAL_OK)
     {
-      /* Error occurred while writing data in Flash memory */
       return (1);
     }
+    WriterEraseEnd = sectorend;
+  }
+
+  WriterCrc = HAL_CRC_Accumulate(&CrcHandle, WriterBuffer, WriterCount / 4);
+
+  /* The programming loop runs from internal SRAM with the widest parallelism */
+  if (HAL_FLASHEx_ProgramBuffer(FLASH_IF_VOLTAGE_RANGE, WriterAddress, 
+                                WriterBuffer, WriterCount) != HAL_OK)
+  {
+    return (1);
   }
 
+  WriterAddress += WriterCount;
+  WriterCount = 0;
+
   return (0);
 }
 
+/**
+  * @brief  Gets the sector of a given address
+  * @param  Address: flash address
+  * @param  pSectorEnd: pointer on the address following the sector
+  * @retval The sector of the given address
+  */
+static uint32_t FLASH_If_GetSector(uint32_t Address, uint32_t *pSectorEnd)
+{
+  uint32_t offset = Address - FLASH_BASE;
+  uint32_t bankbase = FLASH_BASE;
+  uint32_t sector = FLASH_SECTOR_0;
+
+#if defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx)
+  /* Bank 2 starts at 1 Mbyte with sector 12 and the same layout as bank 1 */
+  if (offset >= 0x100000)
+  {
+    offset -= 0x100000;
+    bankbase += 0x100000;
+    sector = FLASH_SECTOR_12;
+  }
+#endif
+
+  if (offset < 0x10000)
+  {
+    /* Sectors 0 to 3: 16 Kbytes */
+    sector += offset / 0x4000;
+    *pSectorEnd = bankbase + ((offset / 0x4000) + 1) * 0x4000;
+  }
+  else if (offset < 0x20000)
+  {
+    /* Sector 4: 64 Kbytes */
+    sector += 4;
+    *pSectorEnd = bankbase + 0x20000;
+  }
+  else
+  {
+    /* Sectors 5 to 11: 128 Kbytes */
+    sector += 4 + (offset / 0x20000);
+    *pSectorEnd = bankbase + ((offset / 0x20000) + 1) * 0x20000;
+  }
+
+  return sector;
+}
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -45,10 +45,7 @@
 
 static __IO uint32_t DataFlag=0;
 static __IO uint32_t size =0;
-static __IO uint32_t FlashWriteAddress;
 static uint32_t TotalReceived=0;
-static char LeftBytesTab[4];
-static uint8_t LeftBytes=0;
 static __IO uint8_t resetpage=0;
 static uint32_t ContentLengthOffset =0,BrowserFlag=0;
 static __IO uint32_t TotalData=0, checklogin=0; 
@@ -80,7 +77,6 @@ static const char Content_Length[17] =
 
 
 static uint32_t Parse_Content_Length(char *data, uint32_t len);
-static void IAP_HTTP_writedata(char* data, uint32_t len);
 
 /* file must be allocated by caller and will be filled in
    by the function. */
@@ -207,6 +203,7 @@ static err_t http_recv(void *arg, struct tcp_pcb *pcb,  struct pbuf *p, err_t er
 {
   int32_t i,len=0;
   uint32_t DataOffset, FilenameOffset;
+  uint32_t writestatus = 0, crc = 0;
   char *data, *ptr, filename[13], login[LOGIN_SIZE];
   struct fs_file file = {0, 0};
   struct http_state *hs;
@@ -405,16 +402,12 @@ static err_t http_recv(void *arg, struct tcp_pcb *pcb,  struct pbuf *p, err_t er
            LCD_UsrLog("IAP using HTTP\n");
            sprintf(message, "File: %s",filename);
            LCD_UsrLog("%s\n",message);
-           LCD_UsrLog("  State: Erasing...\n");
 #endif /* USE_LCD */
           
            TotalData =0;
-           /* init flash */
-           FLASH_If_Init();
-           /* erase user flash area */
-           FLASH_If_Erase(USER_FLASH_FIRST_PAGE_ADDRESS);
-          
-           FlashWriteAddress = USER_FLASH_FIRST_PAGE_ADDRESS;
+           /* start a flash write sequence, each sector of the user flash area
+              is erased when the received data reaches it */
+           FLASH_If_WriterStart(USER_FLASH_FIRST_PAGE_ADDRESS);
           
 #ifdef USE_LCD
             /*indicate start of flash programming */
@@ -448,14 +441,25 @@ static err_t http_recv(void *arg, struct tcp_pcb *pcb,  struct pbuf *p, err_t er
           
            /* write data in Flash */
            if (len)
-           IAP_HTTP_writedata(ptr,len);
+           FLASH_If_WriterPush((uint8_t*)ptr, len);
+          
+           /* program the last bytes and check the flash content */
+           writestatus = FLASH_If_WriterFinish(&crc);
           
            DataFlag=0;
           
 #ifdef USE_LCD
           sprintf(message, "%d bytes ",(int)TotalData);
           LCD_UsrLog("Tot bytes Received: %s\n", message);
-          LCD_UsrLog("  State: Prog Finished ");
+          if (writestatus == 0)
+          {
+            sprintf(message, "CRC 0x%08X", (unsigned int)crc);
+            LCD_UsrLog("  State: Prog Finished, %s\n", message);
+          }
+          else
+          {
+            LCD_ErrLog("  State: Prog Failed (error %d)\n", (int)writestatus);
+          }
 #endif
           htmlpage = UploadDonePage;
           /* send uploaddone.html page */
@@ -473,7 +477,7 @@ static err_t http_recv(void *arg, struct tcp_pcb *pcb,  struct pbuf *p, err_t er
         {
           /* write data in flash */
           if(len)
-          IAP_HTTP_writedata(ptr,len);
+          FLASH_If_WriterPush((uint8_t*)ptr, len);
         }
         pbuf_free(p);
       }
@@ -627,58 +631,6 @@ static uint32_t Parse_Content_Length(char *data, uint32_t len)
   return size;
 }
 
-/**
-  * @brief  writes received data in flash    
-  * @param  ptr: data pointer
-  * @param  len: data length
-  * @retval None 
-  */
-static void IAP_HTTP_writedata(char * ptr, uint32_t len)            
-{
-  uint32_t count, i=0, j=0;
-  
-  /* check if any left bytes from previous packet transfer*/
-  /* if it is the case do a concat with new data to create a 32-bit word */
-  if (LeftBytes)
-  {
-    while(LeftBytes<=3)
-    {
-      if(len>(j+1))
-      {
-        LeftBytesTab[LeftBytes++] = *(ptr+j);
-      }
-      else
-      {
-        LeftBytesTab[LeftBytes++] = 0xFF;
-      }
-      j++;
-    }
-    FLASH_If_Write(&FlashWriteAddress, (uint32_t*)(LeftBytesTab),1);
-    LeftBytes =0;
-    
-    /* update data pointer */
-    ptr = (char*)(ptr+j);
-    len = len -j;
-  }
-  
-  /* write received bytes into flash */
-  count = len/4;
-  
-  /* check if remaining bytes < 4 */
-  i= len%4;
-  if (i>0)
-  {
-    if (TotalReceived != size)
-    {
-      /* store bytes in LeftBytesTab */
-      LeftBytes=0;
-      for(;i>0;i--)
-      LeftBytesTab[LeftBytes++] = *(char*)(ptr+ len-i);  
-    }
-    else count++;
-  }
-  FLASH_If_Write(&FlashWriteAddress, (uint32_t*)ptr ,count);
-}
 #endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -5,10 +5,30 @@
 #include "lwip/err.h"
 #include "lwip/netif.h"
 
+/* Exported constants --------------------------------------------------------*/
+/* Set ETH_RX_ZERO_COPY to 1 in lwipopts.h to pass the received frames to LwIP
+   in their DMA buffers instead of copying them into PBUF_POOL pbufs */
+#ifndef ETH_RX_ZERO_COPY
+#define ETH_RX_ZERO_COPY   0
+#endif
+
 /* Exported types ------------------------------------------------------------*/
 err_t ethernetif_init(struct netif *netif);
 void ethernetif_input(struct netif *netif);
 void ethernetif_set_link(struct netif *netif);
 void ethernetif_update_config(struct netif *netif);
 void ethernetif_notify_conn_changed(struct netif *netif);
+
+#if ETH_RX_ZERO_COPY
+/* Reception statistics of the zero-copy path */
+typedef struct
+{
+  u32_t ZeroCopyFrames;  /*!< Frames passed to LwIP in their DMA buffers            */
+  u32_t CopiedFrames;    /*!< Frames copied because zero-copy was disabled or the
+                              pool had not enough spare buffers                    */
+} EthernetifRxStatsTypeDef;
+
+void ethernetif_set_rx_zero_copy(u8_t enable);
+void ethernetif_get_rx_stats(EthernetifRxStatsTypeDef *stats);
+#endif
 #endif
@@ -37,6 +37,9 @@ static struct jpeg_error_mgr jerr;
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Time spent encoding the last image, in ms, bmp file reads excluded */
+uint32_t JpegEncodeTime = 0;
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -55,7 +58,11 @@ void jpeg_encode(FIL *file, FIL *file1, uint32_t width, uint32_t height, uint32_
   /* Encode BMP Image to JPEG */  
   JSAMPROW row_pointer;    /* Pointer to a single row */
   uint32_t bytesread;
+  uint32_t tickstart = 0, tick = 0, readtime = 0;
+  FRESULT res;
   
+  tickstart = HAL_GetTick();
+
   /* Step 1: allocate and initialize JPEG compression object */
   /* Set up the error handler */
   cinfo.err = jpeg_std_error(&jerr);
@@ -75,18 +82,26 @@ void jpeg_encode(FIL *file, FIL *file1, uint32_t width, uint32_t height, uint32_
   /* Set default compression parameters */
   jpeg_set_defaults(&cinfo);
   
-  cinfo.dct_method  = JDCT_FLOAT;    
+  cinfo.dct_method = (JPEG_DCT_METHOD == JDCT_CMSIS) ? JDCT_ISLOW : JPEG_DCT_METHOD;    
   
   jpeg_set_quality(&cinfo, image_quality, TRUE);
   
   /* Step 4: start compressor */
   jpeg_start_compress(&cinfo, TRUE);
+
+  if (JPEG_DCT_METHOD == JDCT_CMSIS)
+  {
+    jpeg_cmsis_fdct_enable(&cinfo);
+  }
   
   f_read(file, buff, 54, (UINT*)&bytesread);
   
   while (cinfo.next_scanline < cinfo.image_height)
   {          
-    if(f_read(file, buff, width*3, (UINT*)&bytesread) == FR_OK)
+    tick = HAL_GetTick();
+    res = f_read(file, buff, width*3, (UINT*)&bytesread);
+    readtime += HAL_GetTick() - tick;
+    if(res == FR_OK)
     {
       row_pointer = (JSAMPROW)buff;
       jpeg_write_scanlines(&cinfo, &row_pointer, 1);          
@@ -96,7 +111,9 @@ void jpeg_encode(FIL *file, FIL *file1, uint32_t width, uint32_t height, uint32_
   jpeg_finish_compress(&cinfo);
   
   /* Step 6: release JPEG compression object */
-  jpeg_destroy_compress(&cinfo);   
+  jpeg_destroy_compress(&cinfo);
+
+  JpegEncodeTime = HAL_GetTick() - tickstart - readtime;
 }
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
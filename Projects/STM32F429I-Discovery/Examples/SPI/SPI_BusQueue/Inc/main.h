@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    SPI/SPI_BusQueue/Inc/main.h 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   Header for main.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MAIN_H
+#define __MAIN_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* User can use this section to tailor SPIx instance used and associated 
+   resources: the gyroscope and the LCD share the SPI5 bus of the board */
+/* Definition for SPIx clock resources */
+#define SPIx                             DISCOVERY_SPIx
+#define SPIx_CLK_ENABLE()                __HAL_RCC_SPI5_CLK_ENABLE()
+#define DMAx_CLK_ENABLE()                __HAL_RCC_DMA2_CLK_ENABLE()
+#define SPIx_GPIO_CLK_ENABLE()           __HAL_RCC_GPIOF_CLK_ENABLE()
+
+#define SPIx_FORCE_RESET()               __HAL_RCC_SPI5_FORCE_RESET()
+#define SPIx_RELEASE_RESET()             __HAL_RCC_SPI5_RELEASE_RESET()
+
+/* Definition for SPIx Pins */
+#define SPIx_GPIO_PORT                   DISCOVERY_SPIx_GPIO_PORT
+#define SPIx_SCK_PIN                     DISCOVERY_SPIx_SCK_PIN
+#define SPIx_MISO_PIN                    DISCOVERY_SPIx_MISO_PIN
+#define SPIx_MOSI_PIN                    DISCOVERY_SPIx_MOSI_PIN
+#define SPIx_AF                          DISCOVERY_SPIx_AF
+
+/* Definition for SPIx's DMA */
+#define SPIx_TX_DMA_CHANNEL              DMA_CHANNEL_2
+#define SPIx_TX_DMA_STREAM               DMA2_Stream4
+#define SPIx_RX_DMA_CHANNEL              DMA_CHANNEL_2
+#define SPIx_RX_DMA_STREAM               DMA2_Stream3
+
+/* Definition for SPIx's NVIC */
+#define SPIx_IRQn                        SPI5_IRQn
+#define SPIx_IRQHandler                  SPI5_IRQHandler
+#define SPIx_DMA_TX_IRQn                 DMA2_Stream4_IRQn
+#define SPIx_DMA_RX_IRQn                 DMA2_Stream3_IRQn
+#define SPIx_DMA_TX_IRQHandler           DMA2_Stream4_IRQHandler
+#define SPIx_DMA_RX_IRQHandler           DMA2_Stream3_IRQHandler
+
+/* SCK frequency of both devices: PCLK2 / 16 = 5.625 MHz, below the 10 MHz of the
+   ILI9341 writes and of the L3GD20 */
+#define SPIx_BAUDRATEPRESCALER           SPI_BAUDRATEPRESCALER_16
+#define SPIx_BAUDRATE_DIV                16
+
+/* Bus load: the LCD transactions are lines of 120 pixels in RGB565, a gyroscope
+   read follows every LCD_LINES_PER_READ lines */
+#define LCD_LINE_SIZE                    240
+#define LCD_LINES_PER_READ               3
+#define GYRO_READ_SIZE                   7
+
+/* Number of transactions exchanged during the measurement */
+#define TRANSACTIONS_NB                  4000
+
+/* Bus utilisation to reach, in percent */
+#define UTILISATION_TARGET               90
+
+/* Exported macro ------------------------------------------------------------*/
+#define COUNTOF(__BUFFER__)   (sizeof(__BUFFER__) / sizeof(*(__BUFFER__)))
+/* Exported functions ------------------------------------------------------- */
+
+#endif /* __MAIN_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,528 @@
+/**
+  ******************************************************************************
+  * @file    SPI/SPI_BusQueue/Src/main.c 
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   This example shows how the gyroscope and the LCD of the board share
+  *          the SPI5 bus through the SPI bus queue, and measures the bus
+  *          utilisation.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/** @addtogroup STM32F4xx_HAL_Examples
+  * @{
+  */
+
+/** @addtogroup SPI_BusQueue
+  * @{
+  */ 
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* L3GD20 registers */
+#define GYRO_WHO_AM_I_ADDR       0x0F
+#define GYRO_CTRL_REG1_ADDR      0x20
+#define GYRO_OUT_X_L_ADDR        0x28
+#define GYRO_READ_CMD            0x80
+#define GYRO_MULTIPLE_CMD        0x40
+
+/* WHO_AM_I values of the L3GD20 and of the I3G4250D */
+#define GYRO_L3GD20_ID           0xD4
+#define GYRO_I3G4250D_ID         0xD3
+
+/* CTRL_REG1: normal mode, X, Y and Z axes enabled */
+#define GYRO_CTRL_REG1_VALUE     0x0F
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* SPI handler declaration */
+SPI_HandleTypeDef SpiHandle;
+
+/* Devices of the bus */
+static SPI_DeviceTypeDef GyroDevice;
+static SPI_DeviceTypeDef LcdDevice;
+
+/* Transactions queued again from their callback during the measurement:
+   LCD_LINES_PER_READ LCD lines and then a gyroscope read */
+static SPI_TransactionTypeDef aTransactions[LCD_LINES_PER_READ + 1];
+
+/* LCD line: the WRX line is low, the ILI9341 executes these bytes as NOP commands */
+static uint8_t aLcdLine[LCD_LINE_SIZE];
+
+/* Gyroscope read of the angular rates of the 3 axes */
+static uint8_t aGyroTxBuffer[GYRO_READ_SIZE] = {GYRO_OUT_X_L_ADDR | GYRO_READ_CMD | GYRO_MULTIPLE_CMD};
+static uint8_t aGyroRxBuffer[GYRO_READ_SIZE];
+
+/* Measurement state */
+static __IO uint32_t TransactionsLeft = 0;
+static __IO uint32_t Measuring = 0;
+static __IO uint32_t MeasureDone = 0;
+static __IO uint32_t MeasureError = 0;
+static uint32_t CyclesPerFrame = 0;
+static uint32_t StartCycle = 0;
+
+/* Results, to be read with the debugger: the elapsed time and the time the bus
+   clock runs are in core clock cycles, the utilisation is in percent */
+__IO uint32_t uwElapsedCycles = 0;
+__IO uint32_t uwBusCycles = 0;
+uint32_t uwUtilisation = 0;
+SPI_QueueStatsTypeDef QueueStats;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SystemClock_Config(void);
+static void Error_Handler(void);
+static void Devices_Config(void);
+static void Gyro_Config(void);
+static void Bus_Exchange(SPI_DeviceTypeDef *pDevice, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
+static void Bus_Measure(void);
+static void ExchangeComplete(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans);
+static void MeasureComplete(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval None
+  */
+int main(void)
+{
+  /* STM32F4xx HAL library initialization:
+       - Configure the Flash prefetch, instruction and Data caches
+       - Configure the Systick to generate an interrupt each 1 msec
+       - Set NVIC Group Priority to 4
+       - Global MSP (MCU Support Package) initialization
+     */
+  HAL_Init();
+
+  /* Configure LED3 and LED4 */
+  BSP_LED_Init(LED3);
+  BSP_LED_Init(LED4);
+
+  /* Configure the system clock to 180 MHz */
+  SystemClock_Config();
+  
+  /*##-1- Configure the SPI peripheral #######################################*/
+  /* Set the SPI parameters: the bus queue applies the settings of each device */
+  SpiHandle.Instance               = SPIx;
+  SpiHandle.Init.BaudRatePrescaler = SPIx_BAUDRATEPRESCALER;
+  SpiHandle.Init.Direction         = SPI_DIRECTION_2LINES;
+  SpiHandle.Init.CLKPhase          = SPI_PHASE_1EDGE;
+  SpiHandle.Init.CLKPolarity       = SPI_POLARITY_LOW;
+  SpiHandle.Init.CRCCalculation    = SPI_CRCCALCULATION_DISABLE;
+  SpiHandle.Init.CRCPolynomial     = 7;
+  SpiHandle.Init.DataSize          = SPI_DATASIZE_8BIT;
+  SpiHandle.Init.FirstBit          = SPI_FIRSTBIT_MSB;
+  SpiHandle.Init.NSS               = SPI_NSS_SOFT;
+  SpiHandle.Init.TIMode            = SPI_TIMODE_DISABLE;
+  SpiHandle.Init.Mode              = SPI_MODE_MASTER;
+
+  if(HAL_SPI_Init(&SpiHandle) != HAL_OK)
+  {
+    /* Initialization Error */
+    Error_Handler();
+  }
+
+  /*##-2- Configure the devices of the bus ###################################*/
+  Devices_Config();
+  Gyro_Config();
+
+  /*##-3- Measure the bus utilisation ########################################*/
+  Bus_Measure();
+
+  /*##-4- Report the result ##################################################*/
+  if(uwUtilisation >= UTILISATION_TARGET)
+  {
+    /* Turn LED3 on: the target is reached */
+    BSP_LED_On(LED3);
+  }
+  else
+  {
+    /* Toggle LED4: the bus is idle too often */
+    while(1)
+    {
+      BSP_LED_Toggle(LED4);
+      HAL_Delay(200);
+    }
+  }
+
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+
+/**
+  * @brief  Describes the gyroscope and the LCD and configures their chip select
+  *         and the WRX line of the LCD.
+  * @param  None
+  * @retval None
+  */
+static void Devices_Config(void)
+{
+  GPIO_InitTypeDef  GPIO_InitStruct;
+
+  /* The L3GD20 samples on the rising edge with an idle high clock */
+  GyroDevice.CSPort            = GYRO_CS_GPIO_PORT;
+  GyroDevice.CSPin             = GYRO_CS_PIN;
+  GyroDevice.CLKPolarity       = SPI_POLARITY_HIGH;
+  GyroDevice.CLKPhase          = SPI_PHASE_2EDGE;
+  GyroDevice.BaudRatePrescaler = SPIx_BAUDRATEPRESCALER;
+  GyroDevice.FirstBit          = SPI_FIRSTBIT_MSB;
+
+  /* The ILI9341 samples on the rising edge with an idle low clock */
+  LcdDevice.CSPort             = LCD_NCS_GPIO_PORT;
+  LcdDevice.CSPin              = LCD_NCS_PIN;
+  LcdDevice.CLKPolarity        = SPI_POLARITY_LOW;
+  LcdDevice.CLKPhase           = SPI_PHASE_1EDGE;
+  LcdDevice.BaudRatePrescaler  = SPIx_BAUDRATEPRESCALER;
+  LcdDevice.FirstBit           = SPI_FIRSTBIT_MSB;
+
+  GYRO_CS_GPIO_CLK_ENABLE();
+  LCD_NCS_GPIO_CLK_ENABLE();
+  LCD_WRX_GPIO_CLK_ENABLE();
+
+  /* Both devices are deselected */
+  HAL_GPIO_WritePin(GYRO_CS_GPIO_PORT, GYRO_CS_PIN, GPIO_PIN_SET);
+  HAL_GPIO_WritePin(LCD_NCS_GPIO_PORT, LCD_NCS_PIN, GPIO_PIN_SET);
+
+  GPIO_InitStruct.Mode  = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull  = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FAST;
+
+  GPIO_InitStruct.Pin = GYRO_CS_PIN;
+  HAL_GPIO_Init(GYRO_CS_GPIO_PORT, &GPIO_InitStruct);
+
+  GPIO_InitStruct.Pin = LCD_NCS_PIN;
+  HAL_GPIO_Init(LCD_NCS_GPIO_PORT, &GPIO_InitStruct);
+
+  /* WRX low: the LCD receives commands */
+  HAL_GPIO_WritePin(LCD_WRX_GPIO_PORT, LCD_WRX_PIN, GPIO_PIN_RESET);
+  GPIO_InitStruct.Pin = LCD_WRX_PIN;
+  HAL_GPIO_Init(LCD_WRX_GPIO_PORT, &GPIO_InitStruct);
+}
+
+/**
+  * @brief  Checks the identity of the gyroscope and enables its 3 axes.
+  * @param  None
+  * @retval None
+  */
+static void Gyro_Config(void)
+{
+  uint8_t txbuffer[2];
+  uint8_t rxbuffer[2];
+
+  txbuffer[0] = GYRO_WHO_AM_I_ADDR | GYRO_READ_CMD;
+  txbuffer[1] = 0x00;
+  Bus_Exchange(&GyroDevice, txbuffer, rxbuffer, 2);
+
+  if((rxbuffer[1] != GYRO_L3GD20_ID) && (rxbuffer[1] != GYRO_I3G4250D_ID))
+  {
+    Error_Handler();
+  }
+
+  txbuffer[0] = GYRO_CTRL_REG1_ADDR;
+  txbuffer[1] = GYRO_CTRL_REG1_VALUE;
+  Bus_Exchange(&GyroDevice, txbuffer, NULL, 2);
+}
+
+/**
+  * @brief  Exchanges data with a device of the bus and waits for the end of the
+  *         transaction.
+  * @param  pDevice: Device to select
+  * @param  pTxData: Data to send
+  * @param  pRxData: Buffer of the received data, or NULL to discard them
+  * @param  Size: Number of bytes to exchange
+  * @retval None
+  */
+static void Bus_Exchange(SPI_DeviceTypeDef *pDevice, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size)
+{
+  SPI_TransactionTypeDef transaction;
+  __IO uint32_t done = 0;
+
+  transaction.pDevice          = pDevice;
+  transaction.pTxData          = pTxData;
+  transaction.pRxData          = pRxData;
+  transaction.Size             = Size;
+  transaction.XferCpltCallback = ExchangeComplete;
+  transaction.pContext         = (void *)&done;
+
+  if(HAL_SPI_Queue_DMA(&SpiHandle, &transaction) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* An application would wait for a RTOS event signaled by the callback */
+  while(done == 0)
+  {
+  }
+
+  if(transaction.ErrorCode != HAL_SPI_ERROR_NONE)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Keeps LCD lines and gyroscope reads queued until TRANSACTIONS_NB
+  *         transactions are done, and compares the time the bus clock runs with
+  *         the elapsed time.
+  * @param  None
+  * @retval None
+  */
+static void Bus_Measure(void)
+{
+  uint32_t index = 0;
+
+  for(index = 0; index < COUNTOF(aTransactions); index++)
+  {
+    if(index < LCD_LINES_PER_READ)
+    {
+      aTransactions[index].pDevice = &LcdDevice;
+      aTransactions[index].pTxData = aLcdLine;
+      aTransactions[index].pRxData = NULL;
+      aTransactions[index].Size    = LCD_LINE_SIZE;
+    }
+    else
+    {
+      aTransactions[index].pDevice = &GyroDevice;
+      aTransactions[index].pTxData = aGyroTxBuffer;
+      aTransactions[index].pRxData = aGyroRxBuffer;
+      aTransactions[index].Size    = GYRO_READ_SIZE;
+    }
+    aTransactions[index].XferCpltCallback = MeasureComplete;
+    aTransactions[index].pContext = NULL;
+  }
+
+  /* Core clock cycles of a frame of 8 bits, the SPI clock is divided from PCLK2 */
+  CyclesPerFrame = 8 * SPIx_BAUDRATE_DIV * (HAL_RCC_GetHCLKFreq() / HAL_RCC_GetPCLK2Freq());
+
+  /* Enable the cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  TransactionsLeft = TRANSACTIONS_NB;
+  Measuring = 1;
+  StartCycle = DWT->CYCCNT;
+
+  /* The callbacks queue the transactions again: the queue only drains at the end */
+  for(index = 0; index < COUNTOF(aTransactions); index++)
+  {
+    TransactionsLeft--;
+    if(HAL_SPI_Queue_DMA(&SpiHandle, &aTransactions[index]) != HAL_OK)
+    {
+      Error_Handler();
+    }
+  }
+
+  while(MeasureDone == 0)
+  {
+  }
+
+  if(MeasureError != 0)
+  {
+    Error_Handler();
+  }
+
+  HAL_SPI_GetQueueStats(&SpiHandle, &QueueStats);
+  uwUtilisation = (uint32_t)(((uint64_t)uwBusCycles * 100) / uwElapsedCycles);
+}
+
+/**
+  * @brief  Completion callback of the transactions queued by Bus_Exchange().
+  * @param  hspi: SPI handle
+  * @param  pTrans: Completed transaction
+  * @retval None
+  */
+static void ExchangeComplete(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans)
+{
+  *(__IO uint32_t *)pTrans->pContext = 1;
+}
+
+/**
+  * @brief  Completion callback of the measurement transactions: executed from the
+  *         DMA or SPI interrupt while the next transaction is already running.
+  * @param  hspi: SPI handle
+  * @param  pTrans: Completed transaction
+  * @retval None
+  */
+static void MeasureComplete(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans)
+{
+  if(pTrans->ErrorCode != HAL_SPI_ERROR_NONE)
+  {
+    MeasureError = 1;
+    return;
+  }
+
+  uwBusCycles += pTrans->Size * CyclesPerFrame;
+
+  if(TransactionsLeft > 0)
+  {
+    TransactionsLeft--;
+    if(HAL_SPI_Queue_DMA(hspi, pTrans) != HAL_OK)
+    {
+      MeasureError = 1;
+    }
+  }
+}
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @param  None
+  * @retval None
+  */
+static void Error_Handler(void)
+{
+  /* Turn LED4 on */
+  BSP_LED_On(LED4);
+  while(1)
+  {
+  }
+}
+
+/**
+  * @brief  System Clock Configuration
+  *         The system Clock is configured as follow : 
+  *            System Clock source            = PLL (HSE)
+  *            SYSCLK(Hz)                     = 180000000
+  *            HCLK(Hz)                       = 180000000
+  *            AHB Prescaler                  = 1
+  *            APB1 Prescaler                 = 4
+  *            APB2 Prescaler                 = 2
+  *            HSE Frequency(Hz)              = 8000000
+  *            PLL_M                          = 8
+  *            PLL_N                          = 360
+  *            PLL_P                          = 2
+  *            PLL_Q                          = 7
+  *            VDD(V)                         = 3.3
+  *            Main regulator output voltage  = Scale1 mode
+  *            Flash Latency(WS)              = 5
+  * @param  None
+  * @retval None
+  */
+static void SystemClock_Config(void)
+{
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+
+  /* Enable Power Control clock */
+  __HAL_RCC_PWR_CLK_ENABLE();
+  
+  /* The voltage scaling allows optimizing the power consumption when the device is 
+     clocked below the maximum system frequency, to update the voltage scaling value 
+     regarding system frequency refer to product datasheet.  */
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+  
+  /* Enable HSE Oscillator and activate PLL with HSE as source */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+  RCC_OscInitStruct.PLL.PLLM = 8;
+  RCC_OscInitStruct.PLL.PLLN = 360;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+  RCC_OscInitStruct.PLL.PLLQ = 7;
+  HAL_RCC_OscConfig(&RCC_OscInitStruct);
+
+  /* Activate the Over-Drive mode */
+  HAL_PWREx_EnableOverDrive();
+ 
+  /* Select PLL as system clock source and configure the HCLK, PCLK1 and PCLK2 
+     clocks dividers */
+  RCC_ClkInitStruct.ClockType = (RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2);
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;  
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;  
+  HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5);
+}
+
+/**
+  * @brief  TxRx Transfer completed callback: the bus queue is empty.
+  * @param  hspi: SPI handle.
+  * @retval None
+  */
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  if(Measuring != 0)
+  {
+    uwElapsedCycles = DWT->CYCCNT - StartCycle;
+    Measuring = 0;
+    MeasureDone = 1;
+  }
+}
+
+/**
+  * @brief  SPI error callbacks.
+  * @param  hspi: SPI handle
+  * @note   The transactions are completed with their ErrorCode set before this
+  *         callback.
+  * @retval None
+  */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+  MeasureError = 1;
+  MeasureDone = 1;
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t* file, uint32_t line)
+{ 
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+#endif
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
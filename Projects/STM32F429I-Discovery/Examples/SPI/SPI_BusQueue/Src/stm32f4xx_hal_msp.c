@@ -0,0 +1,197 @@
+/**
+  ******************************************************************************
+  * @file    SPI/SPI_BusQueue/Src/stm32f4xx_hal_msp.c
+  * @author  MCD Application Team
+  * @version V1.2.1
+  * @date    13-March-2015
+  * @brief   HAL MSP module.    
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2015 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************  
+  */ 
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/** @addtogroup STM32F4xx_HAL_Examples
+  * @{
+  */
+
+/** @defgroup SPI_BusQueue
+  * @brief HAL MSP module.
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup HAL_MSP_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief SPI MSP Initialization 
+  *        This function configures the hardware resources used in this example: 
+  *           - Peripheral's clock enable
+  *           - Peripheral's GPIO Configuration  
+  *           - DMA configuration for transmission request by peripheral 
+  *           - NVIC configuration for DMA and SPI interrupt request enable
+  * @param hspi: SPI handle pointer
+  * @retval None
+  */
+void HAL_SPI_MspInit(SPI_HandleTypeDef *hspi)
+{
+  static DMA_HandleTypeDef hdma_tx;
+  static DMA_HandleTypeDef hdma_rx;
+  
+  GPIO_InitTypeDef  GPIO_InitStruct;
+  
+  /*##-1- Enable peripherals and GPIO Clocks #################################*/
+  /* Enable GPIO TX/RX clock */
+  SPIx_GPIO_CLK_ENABLE();
+  /* Enable SPI5 clock */
+  SPIx_CLK_ENABLE(); 
+  /* Enable DMA2 clock */
+  DMAx_CLK_ENABLE();   
+  
+  /*##-2- Configure peripheral GPIO ##########################################*/  
+  /* SPI SCK, MISO and MOSI GPIO pins configuration  */
+  GPIO_InitStruct.Pin       = (SPIx_SCK_PIN | SPIx_MISO_PIN | SPIx_MOSI_PIN);
+  GPIO_InitStruct.Mode      = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Pull      = GPIO_PULLDOWN;
+  GPIO_InitStruct.Speed     = GPIO_SPEED_FAST;
+  GPIO_InitStruct.Alternate = SPIx_AF;
+  
+  HAL_GPIO_Init(SPIx_GPIO_PORT, &GPIO_InitStruct);
+    
+  /*##-3- Configure the DMA streams ##########################################*/
+  /* Configure the DMA handler for Transmission process: the bus queue changes
+     the memory increment of the transactions without Tx data */
+  hdma_tx.Instance                 = SPIx_TX_DMA_STREAM;
+  
+  hdma_tx.Init.Channel             = SPIx_TX_DMA_CHANNEL;
+  hdma_tx.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  hdma_tx.Init.PeriphInc           = DMA_PINC_DISABLE;
+  hdma_tx.Init.MemInc              = DMA_MINC_ENABLE;
+  hdma_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_tx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  hdma_tx.Init.Mode                = DMA_NORMAL;
+  hdma_tx.Init.Priority            = DMA_PRIORITY_LOW;
+  hdma_tx.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;         
+  hdma_tx.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+  hdma_tx.Init.MemBurst            = DMA_MBURST_SINGLE;
+  hdma_tx.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+  
+  HAL_DMA_Init(&hdma_tx);   
+  
+  /* Associate the initialized DMA handle to the the SPI handle */
+  __HAL_LINKDMA(hspi, hdmatx, hdma_tx);
+    
+  /* Configure the DMA handler for Reception process */
+  hdma_rx.Instance                 = SPIx_RX_DMA_STREAM;
+  
+  hdma_rx.Init.Channel             = SPIx_RX_DMA_CHANNEL;
+  hdma_rx.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+  hdma_rx.Init.PeriphInc           = DMA_PINC_DISABLE;
+  hdma_rx.Init.MemInc              = DMA_MINC_ENABLE;
+  hdma_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_rx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  hdma_rx.Init.Mode                = DMA_NORMAL;
+  hdma_rx.Init.Priority            = DMA_PRIORITY_HIGH;
+  hdma_rx.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;         
+  hdma_rx.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+  hdma_rx.Init.MemBurst            = DMA_MBURST_SINGLE;
+  hdma_rx.Init.PeriphBurst         = DMA_PBURST_SINGLE; 
+
+  HAL_DMA_Init(&hdma_rx);
+    
+  /* Associate the initialized DMA handle to the the SPI handle */
+  __HAL_LINKDMA(hspi, hdmarx, hdma_rx);
+    
+  /*##-4- Configure the NVIC for DMA and SPI #################################*/ 
+  /* NVIC configuration for DMA transfer error interrupt (SPI5_TX) */
+  HAL_NVIC_SetPriority(SPIx_DMA_TX_IRQn, 0, 1);
+  HAL_NVIC_EnableIRQ(SPIx_DMA_TX_IRQn);
+    
+  /* NVIC configuration for DMA transfer complete interrupt (SPI5_RX) */
+  HAL_NVIC_SetPriority(SPIx_DMA_RX_IRQn, 0, 0);   
+  HAL_NVIC_EnableIRQ(SPIx_DMA_RX_IRQn);
+
+  /* NVIC configuration for SPI interrupt: ends a transaction whose last clock
+     is not over at the DMA transfer complete interrupt */
+  HAL_NVIC_SetPriority(SPIx_IRQn, 0, 2);
+  HAL_NVIC_EnableIRQ(SPIx_IRQn);
+}
+
+/**
+  * @brief SPI MSP De-Initialization 
+  *        This function frees the hardware resources used in this example:
+  *          - Disable the Peripheral's clock
+  *          - Revert GPIO, DMA and NVIC configuration to their default state
+  * @param hspi: SPI handle pointer
+  * @retval None
+  */
+void HAL_SPI_MspDeInit(SPI_HandleTypeDef *hspi)
+{
+  /*##-1- Reset peripherals ##################################################*/
+  SPIx_FORCE_RESET();
+  SPIx_RELEASE_RESET();
+
+  /*##-2- Disable peripherals and GPIO Clocks ################################*/
+  /* Configure SPI SCK, MISO and MOSI as default  */
+  HAL_GPIO_DeInit(SPIx_GPIO_PORT, (SPIx_SCK_PIN | SPIx_MISO_PIN | SPIx_MOSI_PIN));
+   
+  /*##-3- Disable the DMA Streams ############################################*/
+  /* De-Initialize the DMA Stream associate to transmission process */
+  HAL_DMA_DeInit(hspi->hdmatx); 
+  /* De-Initialize the DMA Stream associate to reception process */
+  HAL_DMA_DeInit(hspi->hdmarx);
+  
+  /*##-4- Disable the NVIC for DMA and SPI ###################################*/
+  HAL_NVIC_DisableIRQ(SPIx_DMA_TX_IRQn);
+  HAL_NVIC_DisableIRQ(SPIx_DMA_RX_IRQn);
+  HAL_NVIC_DisableIRQ(SPIx_IRQn);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/